@@ -179,6 +179,24 @@ else()
     add_definitions(-DAREG_EXTENDED=0)
 endif()
 
+if (AREG_IO_URING)
+    # The raw io_uring interface is used, no liburing. Kernel headers of 5.11 or newer are required.
+    include(CheckCXXSourceCompiles)
+    check_cxx_source_compiles("
+        #include <linux/io_uring.h>
+        int main() { return (IORING_FEAT_EXT_ARG != 0 ? 0 : 1); }
+    " AREG_IO_URING_HEADERS)
+    if (AREG_IO_URING_HEADERS AND (${CMAKE_SYSTEM_NAME} STREQUAL "Linux"))
+        add_definitions(-DAREG_IO_URING=1)
+    else()
+        message(STATUS "Areg: >>> No suitable io_uring headers found, force to use epoll for the sockets.")
+        set(AREG_IO_URING OFF CACHE INTERNAL "Disable io_uring")
+        add_definitions(-DAREG_IO_URING=0)
+    endif()
+else()
+    add_definitions(-DAREG_IO_URING=0)
+endif()
+
 if (AREG_LOGGING)
     add_definitions(-DAREG_LOGGING=1)
 else()
@@ -30,6 +30,7 @@
 #  20. AREG_ARCH            -- The processor architect. Ignore if need to use system default.
 #  21. AREG_TARGET          -- Specifies the compiler and library architecture target. Defaults to the system-defined compiler and architecture.
 #  22. AREG_ARCH_NATIVE     -- Optimizes GNU/Clang Release builds for the build machine CPU ('-march=native'). Defaults to 'disabled'.
+#  23. AREG_IO_URING        -- Uses io_uring for the socket readiness and the grouped sends on Linux, with epoll as fallback. Defaults to 'disabled'.
 #
 # Default Values:
 #   1. AREG_LIB_TYPE        = shared    (possible values: shared, static)
@@ -54,6 +55,7 @@
 #  20. AREG_ARCH            = System    (possible values: x86 (i386, i486), x64 (x86_64, x86-64, amd64, ia64), arm (arm32, armv7), aarch64 (arm64))
 #  21. AREG_TARGET          = <default> (possible values: 'i386-linux-gnu', 'x86_64-linux-gnu', 'arm-linux-gnueabihf', 'aarch64-linux-gnu')
 #  22. AREG_ARCH_NATIVE     = OFF       (possible values: ON, OFF)
+#  23. AREG_IO_URING        = OFF       (possible values: ON, OFF)
 #
 # Hints:
 #   - AREG_COMPILER_FAMILY is an easy way to set compilers:
@@ -272,6 +274,9 @@ macro_create_option(AREG_INSTALL ON "Enable installation")
 # Modify 'AREG_ARCH_NATIVE' to enable or disable '-march=native' optimization for Release builds (GNU/Clang only)
 macro_create_option(AREG_ARCH_NATIVE OFF "Optimize Release builds for the build machine CPU (GNU/Clang only)")
 
+# Modify 'AREG_IO_URING' to enable or disable io_uring for the sockets (Linux only, epoll is the fallback when the kernel lacks it)
+macro_create_option(AREG_IO_URING OFF "Use io_uring for the sockets on Linux")
+
 # Check the request of using installed packages
 if (NOT DEFINED AREG_SYSTEM_PACKAGES)
     # Set default values
@@ -152,7 +152,19 @@ LocalLatency::LatencyMode loclat::string_as_mode(std::string_view name) noexcept
 
 const char * loclat::topology_as_str(loclat::Topology topology) noexcept
 {
-    return topology == loclat::Topology::SameThread ? "same" : "cross";
+    switch (topology)
+    {
+    case loclat::Topology::SameThread:
+        return "same";
+    case loclat::Topology::CrossThread:
+        return "cross";
+    case loclat::Topology::Strand:
+        return "strand";
+    case loclat::Topology::Spin:
+        return "spin";
+    default:
+        return "?";
+    }
 }
 
 uint32_t loclat::mode_payload_size(LocalLatency::LatencyMode mode) noexcept
@@ -213,15 +225,25 @@ void loclat::print_usage()
         "Areg SDK example 31 -- local latency benchmark.\n"
         "\n"
         "Measures how long one message needs inside a single process: between two\n"
-        "components of the same thread, and between two components of two threads.\n"
+        "components of the same thread, between two components of two threads, and\n"
+        "between two component threads running as strands on a pool of workers, and\n"
+        "between two component threads spinning on their empty queues.\n"
         "The message router is never involved, so nothing else must be started.\n"
         "The program is not interactive: it runs, prints the result and exits.\n"
         "\n"
         "Usage: 31_loclatency [options]\n"
         "\n"
-        "  -t, --topology=same|cross  Where provider and consumer run. Default: same\n"
-        "                             same  = both in one component thread\n"
-        "                             cross = each in its own component thread\n"
+        "  -t, --topology=same|cross|strand|spin\n"
+        "                             Where provider and consumer run. Default: same\n"
+        "                             same   = both in one component thread\n"
+        "                             cross  = each in its own component thread\n"
+        "                             strand = each in its own component thread, both\n"
+        "                                      running as strands on a pool of workers\n"
+        "                             spin   = each in its own component thread, which\n"
+        "                                      spins on its empty queue before it sleeps\n"
+        "  -s, --workers=<number>     Worker threads of the strand topology, 0 for one\n"
+        "                             per CPU core. Default: 0\n"
+        "  -p, --spin=<microseconds>  Spin time of the spin topology. Default: 100\n"
         "  -m, --mode=<list>          Comma separated mode names, or the group names\n"
         "                             all, bc, pp. Default: pp0,bc0\n"
         "  -c, --count=<number>       Measured messages per run. Default: 100000\n"
@@ -236,6 +258,8 @@ void loclat::print_usage()
         "Examples:\n"
         "  31_loclatency\n"
         "  31_loclatency -t=cross -m=pp0,bc0 -c=200000 -w=20000\n"
+        "  31_loclatency -t=strand -s=2 -m=pp0,bc0 -c=200000 -w=20000\n"
+        "  31_loclatency -t=spin -p=200 -m=pp0,bc0 -c=200000 -w=20000\n"
         "  31_loclatency -t=same -m=all -c=50000 -o=result.csv -l=baseline\n"
         "\n"
         "Compare with example 30: example 30 measures the same modes between two\n"
@@ -280,9 +304,17 @@ bool loclat::parse_command_line(int argc, char ** argv, loclat::RunOptions & out
             {
                 options.mTopology = loclat::Topology::CrossThread;
             }
+            else if (value == "strand")
+            {
+                options.mTopology = loclat::Topology::Strand;
+            }
+            else if (value == "spin")
+            {
+                options.mTopology = loclat::Topology::Spin;
+            }
             else
             {
-                std::printf("ERROR: --topology accepts only 'same' or 'cross'.\n\n");
+                std::printf("ERROR: --topology accepts only 'same', 'cross', 'strand' or 'spin'.\n\n");
                 loclat::print_usage();
                 return false;
             }
@@ -300,6 +332,24 @@ bool loclat::parse_command_line(int argc, char ** argv, loclat::RunOptions & out
                 return false;
             }
         }
+        else if (_matches(arg, "-s", "--workers"))
+        {
+            if (!_to_uint(value, options.mWorkers))
+            {
+                std::printf("ERROR: --workers needs a number.\n\n");
+                loclat::print_usage();
+                return false;
+            }
+        }
+        else if (_matches(arg, "-p", "--spin"))
+        {
+            if (!_to_uint(value, options.mSpinUs))
+            {
+                std::printf("ERROR: --spin needs a number.\n\n");
+                loclat::print_usage();
+                return false;
+            }
+        }
         else if (_matches(arg, "-w", "--warmup"))
         {
             if (!_to_uint(value, options.mWarmup))
@@ -41,6 +41,13 @@ enum class Topology : uint8_t
                     //!< of the same process. Every message crosses one thread boundary:
                     //!< the sending thread puts it into the queue of the receiving thread
                     //!< and wakes that thread up.
+    , Strand        //!< The model of CrossThread, but the two component threads run as strands
+                    //!< on a shared pool of worker threads. A message is put into the queue of
+                    //!< the receiving strand and schedules its turn on a worker, which may be
+                    //!< the running one. See `--workers`.
+    , Spin          //!< The model of CrossThread, but a thread with an empty queue spins on it
+                    //!< for a while before it goes to sleep. A message arriving meanwhile is
+                    //!< taken without a wake-up, at the price of a busy core. See `--spin`.
 };
 
 /**
@@ -78,6 +85,14 @@ struct RunOptions
     //!< It lets you tell apart measurements taken before and after a change.
     areg::String                            mLabel      {};
 
+    //!< The number of the worker threads running the strands of the Strand topology. 0 means
+    //!< one worker per CPU core.
+    uint32_t                                mWorkers    { 0u };
+
+    //!< The time in microseconds the threads of the Spin topology spin on their empty queue
+    //!< before they go to sleep.
+    uint32_t                                mSpinUs     { 100u };
+
     //!< When true, only the result table is printed and the progress lines are left out.
     bool                                    mQuiet      { false };
 };
@@ -142,7 +157,7 @@ LocalLatency::LatencyMode string_as_mode(std::string_view name) noexcept;
 
 /**
  * \brief   Converts a topology into the short name used on the command line and in
- *          reports: "same" or "cross".
+ *          reports: "same", "cross", "strand" or "spin".
  **/
 [[nodiscard]]
 const char * topology_as_str(Topology topology) noexcept;
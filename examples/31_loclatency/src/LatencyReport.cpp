@@ -139,13 +139,13 @@ void loclat::print_environment(double clockCostNs)
 
 void loclat::print_table_header()
 {
-    std::printf(" topo  | mode     | bytes | rep |  samples |     min |     p50 |     p90 |     p99 |     p99.9 |       max |    mean |  stddev |   in-leg |      msg/s\n");
-    std::printf(" ------+----------+-------+-----+----------+---------+---------+---------+---------+-----------+-----------+---------+---------+----------+-----------\n");
+    std::printf(" topo   | mode     | bytes | rep |  samples |     min |     p50 |     p90 |     p99 |     p99.9 |       max |    mean |  stddev |   in-leg |      msg/s\n");
+    std::printf(" -------+----------+-------+-----+----------+---------+---------+---------+---------+-----------+-----------+---------+---------+----------+-----------\n");
 }
 
 void loclat::print_table_row(const loclat::RunResult & result)
 {
-    std::printf(" %-5s | %-8s | %5u | %3u | %8u | %7.3f | %7.3f | %7.3f | %7.3f | %9.3f | %9.3f | %7.3f | %7.3f | %8.3f | %10.0f\n"
+    std::printf(" %-6s | %-8s | %5u | %3u | %8u | %7.3f | %7.3f | %7.3f | %7.3f | %9.3f | %9.3f | %7.3f | %7.3f | %8.3f | %10.0f\n"
               , loclat::topology_as_str(result.mTopology)
               , loclat::mode_as_str(result.mMode)
               , result.mPayload
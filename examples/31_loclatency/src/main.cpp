@@ -5,8 +5,10 @@
 // Copyright   : (c) 2021-2026 Aregtech (Artak Avetyan).
 // Description : Local latency benchmark. Measures how long one message needs
 //               inside a single process: between two components of one thread,
-//               and between two components of two threads. The message router
-//               is not involved, so nothing else has to be started.
+//               between two components of two threads, between two threads
+//               running as strands on a pool of workers, and between two threads
+//               spinning on their empty queues. The message router is not
+//               involved, so nothing else has to be started.
 //============================================================================
 
 #include "areg/base/areg_global.h"
@@ -37,6 +39,10 @@ namespace
     constexpr char const MODEL_SAME[]       { "LocalLatencySameThread" };
     //!< Model in which each component has its OWN component thread.
     constexpr char const MODEL_CROSS[]      { "LocalLatencyCrossThread" };
+    //!< Model in which each component has its OWN component thread, running as a strand.
+    constexpr char const MODEL_STRAND[]     { "LocalLatencyStrand" };
+    //!< Model in which each component has its OWN component thread, spinning on its empty queue.
+    constexpr char const MODEL_SPIN[]       { "LocalLatencySpin" };
 
     constexpr char const THREAD_SHARED[]    { "LocalLatencySharedThread" };
     constexpr char const THREAD_PROVIDER[]  { "LocalLatencyProviderThread" };
@@ -87,24 +93,45 @@ namespace
      *          message into the queue of the receiving thread and wakes that thread up.
      *          The difference to the "same thread" model is therefore the price of one
      *          thread wake-up, which is what this benchmark is meant to show.
+     *
+     *          The "strand" model has the same threads, but both run as strands on the
+     *          shared pool of worker threads. A message is put into the queue of the
+     *          receiving strand and schedules its turn. A worker that is awake takes the
+     *          turn, which may be the very worker that sent the message, so the wake-up of
+     *          a sleeping thread is often saved. The events of each component thread are
+     *          still processed one after another.
+     *
+     *          The "spin" model has the same threads, but a thread with an empty queue
+     *          spins on it before it goes to sleep. The sending thread sees the receiving
+     *          thread awake and does not wake it up, so the price of the wake-up is traded
+     *          for a busy core.
+     *
+     * \param   modelName   The name of the model to register.
+     * \param   asStrands   If true, the component threads run as strands.
+     * \param   spinUs      The time in microseconds the threads spin on the empty queue, 0 not to spin.
      **/
-    void _register_cross_thread_model()
+    void _register_cross_thread_model(const char * modelName, bool asStrands, uint32_t spinUs)
     {
-        BEGIN_MODEL_LOCAL(MODEL_CROSS)
+        BEGIN_MODEL_LOCAL(modelName)
 
-            BEGIN_REGISTER_THREAD_EX2(THREAD_PROVIDER, areg::WATCHDOG_IGNORE, areg::DEFAULT_STACK_SIZE, QUEUE_SIZE, areg::Bool::Undefined, areg::WAIT_INFINITE)
+            if (asStrands)
+            {
+                MODEL_RUN_STRANDS(loclat::run_options().mWorkers)
+            }
+
+            BEGIN_REGISTER_THREAD_EX3(THREAD_PROVIDER, areg::WATCHDOG_IGNORE, areg::DEFAULT_STACK_SIZE, QUEUE_SIZE, areg::Bool::Undefined, areg::WAIT_INFINITE, spinUs)
                 BEGIN_REGISTER_COMPONENT(PROVIDER_ROLE, LocalLatencyProvider)
                     REGISTER_IMPLEMENT_SERVICE(LocalLatency::ServiceName, LocalLatency::InterfaceVersion)
                 END_REGISTER_COMPONENT(PROVIDER_ROLE)
             END_REGISTER_THREAD(THREAD_PROVIDER)
 
-            BEGIN_REGISTER_THREAD_EX2(THREAD_CONSUMER, areg::WATCHDOG_IGNORE, areg::DEFAULT_STACK_SIZE, QUEUE_SIZE, areg::Bool::Undefined, areg::WAIT_INFINITE)
+            BEGIN_REGISTER_THREAD_EX3(THREAD_CONSUMER, areg::WATCHDOG_IGNORE, areg::DEFAULT_STACK_SIZE, QUEUE_SIZE, areg::Bool::Undefined, areg::WAIT_INFINITE, spinUs)
                 BEGIN_REGISTER_COMPONENT(CONSUMER_ROLE, LocalLatencyConsumer)
                     REGISTER_DEPENDENCY(PROVIDER_ROLE)
                 END_REGISTER_COMPONENT(CONSUMER_ROLE)
             END_REGISTER_THREAD(THREAD_CONSUMER)
 
-        END_MODEL_LOCAL(MODEL_CROSS)
+        END_MODEL_LOCAL(modelName)
     }
 }
 
@@ -124,13 +151,27 @@ int main(int argc, char * argv[])
     if (exitNow)
         return 0;
 
-    const bool sameThread{ loclat::run_options().mTopology == loclat::Topology::SameThread };
-    const char * modelName{ sameThread ? MODEL_SAME : MODEL_CROSS };
+    const loclat::Topology topology{ loclat::run_options().mTopology };
+    const char * modelName{ MODEL_CROSS };
+    switch (topology)
+    {
+    case loclat::Topology::SameThread:
+        modelName = MODEL_SAME;
+        break;
+    case loclat::Topology::Strand:
+        modelName = MODEL_STRAND;
+        break;
+    case loclat::Topology::Spin:
+        modelName = MODEL_SPIN;
+        break;
+    default:
+        break;
+    }
 
-    if (sameThread)
+    if (topology == loclat::Topology::SameThread)
         _register_same_thread_model();
     else
-        _register_cross_thread_model();
+        _register_cross_thread_model(modelName, topology == loclat::Topology::Strand, topology == loclat::Topology::Spin ? loclat::run_options().mSpinUs : 0u);
 
     // Logging and the message router stay switched off: both would add work to the very
     // path that is being measured, and a Private service needs neither.
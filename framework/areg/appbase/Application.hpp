@@ -21,6 +21,7 @@
 #include "areg/base/areg_global.h"
 #include "areg/appbase/AppDefs.hpp"
 
+#include "areg/base/RawBufferPool.hpp"
 #include "areg/base/String.hpp"
 #include "areg/base/SyncPrimitives.hpp"
 #include "areg/persist/ConfigManager.hpp"
@@ -378,6 +379,43 @@ public:
      **/
     static void query_data_received(uint64_t& sizeRecv, uint32_t& msgRecv) noexcept;
 
+    /**
+     * \brief   Queries the number of droppable messages lost since the last call, and resets counters.
+     *          The sent ones are refused by the full send queue, the received ones are missing in
+     *          the sequence of the datagrams, arrived too late or are refused by the full queue
+     *          of the target.
+     *
+     * \param[out] lostSent     On output, contains the number of droppable messages lost on sending.
+     * \param[out] lostRecv     On output, contains the number of droppable messages lost on receiving.
+     **/
+    static void query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept;
+
+    /**
+     * \brief   Queries the number of system calls that wrote the sent messages since the last call,
+     *          and resets the counter. The messages sent, see query_data_sent(), divided by it give
+     *          the messages per system call, which shows how well the send batches are filled.
+     *
+     * \param[out] sendCalls    On output, contains the number of send system calls.
+     **/
+    static void query_send_calls(uint32_t& sendCalls) noexcept;
+
+    /**
+     * \brief   Queries the number of bytes the kernel sent without copying them since the last
+     *          call, and resets the counter. Only the messages at least as large as the
+     *          'net::*::tcpip::zerocopy' entry of the configuration are sent so, on Linux.
+     *
+     * \param[out] savedBytes   On output, contains the number of bytes the send did not copy.
+     **/
+    static void query_zerocopy_saved(uint64_t& savedBytes) noexcept;
+
+    /**
+     * \brief   Queries the counters of the raw buffer pool, which allocates message buffers.
+     *          Unlike the data rate queries, the counters are cumulative and are not reset.
+     *
+     * \param[out] stats    On output, contains hits, misses and bytes retained by the pool.
+     **/
+    static void query_buffer_pool(RawBufferPool::Stats& stats) noexcept;
+
     /**
      * \brief   Enables or disables data and message rate verbosity.
      **/
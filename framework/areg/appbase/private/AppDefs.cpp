@@ -52,9 +52,10 @@ constexpr LogTypeEntry _defaultConnections[]
 {
       { static_cast<uint32_t>(areg::ConnectionType::Undefined)   , {"unknown"}, false }
     , { static_cast<uint32_t>(areg::ConnectionType::Tcpip)       , {"tcpip"  }, true  }
-    , { static_cast<uint32_t>(areg::ConnectionType::Udp)         , {"udp"    }, false }
+    , { static_cast<uint32_t>(areg::ConnectionType::Udp)         , {"udp"    }, true  }
     , { static_cast<uint32_t>(areg::ConnectionType::Web)         , {"web"    }, false }
-    , { static_cast<uint32_t>(areg::ConnectionType::SharedMemory), {"sm"     }, false }
+    , { static_cast<uint32_t>(areg::ConnectionType::SharedMemory), {"sm"     }, true  }
+    , { static_cast<uint32_t>(areg::ConnectionType::UnixSocket)  , {"uds"    }, true  }
 };
 
 /**
@@ -92,6 +93,7 @@ AREG_API_IMPL const std::vector<areg::Identifier>   areg::ConnectionIdentifiers
     , { static_cast<uint32_t>(areg::ConnectionType::Udp)        , _defaultConnections[2].ltIdName      }
     , { static_cast<uint32_t>(areg::ConnectionType::Web)        , _defaultConnections[3].ltIdName      }
     , { static_cast<uint32_t>(areg::ConnectionType::SharedMemory),_defaultConnections[4].ltIdName      }
+    , { static_cast<uint32_t>(areg::ConnectionType::UnixSocket)  , _defaultConnections[5].ltIdName      }
 };
 
 //! Remote service identifiers
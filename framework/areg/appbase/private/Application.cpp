@@ -387,6 +387,26 @@ void Application::query_data_received(uint64_t& sizeRecv, uint32_t& msgRecv) noe
     ServiceManager::query_data_received(sizeRecv, msgRecv);
 }
 
+void Application::query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept
+{
+    ServiceManager::query_data_lost(lostSent, lostRecv);
+}
+
+void Application::query_send_calls(uint32_t& sendCalls) noexcept
+{
+    ServiceManager::query_send_calls(sendCalls);
+}
+
+void Application::query_zerocopy_saved(uint64_t& savedBytes) noexcept
+{
+    ServiceManager::query_zerocopy_saved(savedBytes);
+}
+
+void Application::query_buffer_pool(RawBufferPool::Stats& stats) noexcept
+{
+    stats = RawBufferPool::stats();
+}
+
 void Application::enable_data_rate(bool enable) noexcept
 {
     ServiceManager::enable_data_rate(enable);
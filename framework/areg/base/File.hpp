@@ -28,6 +28,11 @@
 #include <filesystem>
 namespace areg {
 
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+struct IoBuffer;
+
 //////////////////////////////////////////////////////////////////////////
 // File class declaration
 //////////////////////////////////////////////////////////////////////////
@@ -286,6 +291,15 @@ public:
      **/
     uint32_t write( const uint8_t* buffer, uint32_t size ) noexcept override;
 
+    /**
+     * \brief   Writes the list of buffers one after another with a single call if the OS supports it
+     *          (writev() on POSIX) and returns the number of bytes written.
+     *
+     * \param   buffers     The list of buffers to write.
+     * \param   count       The number of entries in the list.
+     **/
+    uint32_t write_gather( const areg::IoBuffer * buffers, uint32_t count ) noexcept;
+
     /**
      * \brief   Flushes buffered file data to the file system.
      **/
@@ -568,6 +582,14 @@ private:
      **/
     uint32_t _os_write_file( const uint8_t* buffer, uint32_t size ) noexcept;
 
+    /**
+     * \brief   OS-specific implementation to write the list of buffers; returns the number of bytes written.
+     *
+     * \param   buffers     The list of buffers to write.
+     * \param   count       The number of entries in the list.
+     **/
+    uint32_t _os_write_gather( const areg::IoBuffer * buffers, uint32_t count ) noexcept;
+
     /**
      * \brief   OS-specific implementation to move the file pointer; returns new position or
      *          INVALID_CURSOR_POSITION on failure.
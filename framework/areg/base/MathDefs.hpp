@@ -413,6 +413,20 @@ inline constexpr uint32_t crc32_finish( uint32_t crc ) noexcept;
 [[nodiscard]]
 inline constexpr uint32_t crc32_hardware(const uint8_t* data, int32_t size) noexcept;
 
+/**
+ * \brief   Calculates 32-bit CRC of a binary buffer with the fastest kernel of the running CPU:
+ *          the SSE4.2 crc32 instruction on x86/x64 if the CPU has it, the CRC32C instructions on
+ *          ARM builds, which target them, otherwise the table. The kernel is chosen once, by the
+ *          first call, so the build does not need to target SSE4.2. All kernels compute the same
+ *          CRC32C as crc32_calculate().
+ *
+ * \param   data    Pointer to binary data buffer.
+ * \param   size    Number of bytes to process. Negative or zero: returns CRC of empty input.
+ * \return  32-bit CRC value.
+ **/
+[[nodiscard]]
+AREG_API uint32_t crc32_runtime(const uint8_t* data, int32_t size) noexcept;
+
 /**
  * \brief   Return true if CRC32 number is valid, i.e. it is neither 0x00000000, nor 0xFFFFFFFF.
  **/
@@ -749,16 +763,17 @@ inline constexpr uint32_t crc32_calculate( std::string_view str ) noexcept
     }
 #endif
 
-// At compile time uses the pure-software path (`constexpr`); at runtime on SSE4.2 x86/x64 uses hardware intrinsics.
+// At compile time uses the pure-software path (`constexpr`); at runtime on SSE4.2 x86/x64 uses hardware intrinsics,
+// in other builds the kernel selected by the running CPU, see crc32_runtime().
 // __builtin_is_constant_evaluated() is a C++17 extension supported by all three toolchains this SDK targets.
 inline constexpr uint32_t crc32_hardware(const uint8_t* data, int32_t size) noexcept
 {
-#if defined(__SSE4_2__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
     if (__builtin_is_constant_evaluated())
         return crc32_calculate(data, size);  // compile-time: software path
+#if defined(__SSE4_2__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
     return _crc32_hardware(data, size);      // runtime: SIMD hardware path
 #else
-    return crc32_calculate(data, size);
+    return crc32_runtime(data, size);        // runtime: kernel of the running CPU
 #endif
 }
 
@@ -22,6 +22,7 @@
 #include "areg/base/areg_global.h"
 #include "areg/base/IOStream.hpp"
 #include "areg/base/MathDefs.hpp"
+#include "areg/base/RawBufferPool.hpp"
 
 #include <algorithm>
 #include <new>
@@ -310,11 +311,11 @@ inline uint16_t atomic_load16(const uint16_t & ref) noexcept
  *          needed a SECOND allocation for its separate control block.
  *
  *          Copy semantics mirror std::shared_ptr exactly: copy = atomic increment, destroy /
- *          reset = atomic decrement, free (delete[]) when the count reaches 0. Move transfers
+ *          reset = atomic decrement, return to the pool when the count reaches 0. Move transfers
  *          ownership without touching the count.
  *
- * \note    The block must have been allocated as `new uint8_t[]` and reinterpreted as
- *          RawBuffer* / RawEnvelope*; release frees it with the matching `delete[]`.
+ * \note    The block must have been allocated by areg::RawBufferPool::allocate() and
+ *          reinterpreted as RawBuffer* / RawEnvelope*; release returns it to the pool.
  *          ThreadSafe for the reference count only; the pointed-to buffer is not thread-safe.
  **/
 class RawBufferPtr
@@ -333,7 +334,7 @@ public:
      *          The block is not yet visible to any other thread, so the count is set with a
      *          plain store (no atomic needed).
      *
-     * \param   adopt   Pointer to a `new uint8_t[]` block reinterpreted as RawBuffer*, or nullptr.
+     * \param   adopt   Pointer to a RawBufferPool block reinterpreted as RawBuffer*, or nullptr.
      **/
     explicit RawBufferPtr(RawBuffer * adopt) noexcept
         : mBuffer(adopt)
@@ -443,7 +444,7 @@ private:
     {
         if ((mBuffer != nullptr) && (areg::atomic_dec16(mBuffer->bufHeader.biRefCount) == 0u))
         {
-            delete [] reinterpret_cast<uint8_t *>(mBuffer);
+            areg::RawBufferPool::release(mBuffer);
         }
     }
 
@@ -584,12 +585,116 @@ static_assert(offsetof(areg::EventHeader, rawService)== 64  , "EventHeader.rawSe
 static_assert(offsetof(areg::EventHeader, channel)   == 72  , "EventHeader.channel must be at offset 72");
 
 // Portability guard: BufferHeader, RawBuffer, EventHeader and RawEnvelope are all
-// placement-constructed into plain `new uint8_t[]` heap blocks.
+// placement-constructed into RawBufferPool blocks, which have the alignment of `new uint8_t[]`.
 static_assert(alignof(areg::BufferHeader) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "BufferHeader is over-aligned vs the new uint8_t[] block it is constructed into (would fault on 32-bit)");
 static_assert(alignof(areg::RawBuffer)    <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "RawBuffer is over-aligned vs the new uint8_t[] block it is constructed into (would fault on 32-bit)");
 static_assert(alignof(areg::EventHeader)  <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "EventHeader is over-aligned vs the new uint8_t[] block it is constructed into (would fault on 32-bit)");
 static_assert(alignof(areg::RawEnvelope)  <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "RawEnvelope is over-aligned vs the new uint8_t[] block it is constructed into (would fault on 32-bit)");
 
+//////////////////////////////////////////////////////////////////////////
+// areg::CompactSession and areg::CompactHeader structures declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   areg::CompactSession
+ *          The routing part of the EventHeader, bytes [16..75], which is the same for all
+ *          messages of one proxy and one stub. The compact framing of a connection sends it
+ *          once, and the next frames refer to it by the slot of the session dictionary.
+ *
+ *  Field        Offset  Size  Description
+ *  target            0     4  routing destination cookie
+ *  source            4     4  routing source cookie
+ *  provider          8    20  Endpoint: stub side
+ *  consumer         28    20  Endpoint: proxy side
+ *  rawService       48     8  RawService: service interface identity
+ *  channel          56     4  routing thread magic
+ *                   60
+ **/
+struct CompactSession
+{
+    uint32_t            target      { 0 };  //!< [0..3]     routing destination cookie
+    uint32_t            source      { 0 };  //!< [4..7]     routing source cookie
+    areg::Endpoint      provider    {   };  //!< [8..27]    stub endpoint
+    areg::Endpoint      consumer    {   };  //!< [28..47]   proxy endpoint
+    areg::RawService    rawService  {   };  //!< [48..55]   service interface identity
+    uint32_t            channel     { 0 };  //!< [56..59]   routing thread magic
+};                                          //!< 60 bytes
+
+/**
+ * \brief   areg::CompactHeader
+ *          The header of a compact frame, which replaces the 128 bytes of the EventHeader on a
+ *          stream connection, which negotiated it. It carries the fields of the message, which
+ *          change with every message, and the slot of the session with the routing fields.
+ *          If the frame defines the session, the CompactSession follows the header, then the
+ *          payload. The local-only fields of the EventHeader are never sent.
+ *
+ *          The first word has the bits of COMPACT_FRAME_TAG set. The first word of a full
+ *          frame is the allocated length of the buffer, which never reaches these bits, so the
+ *          receiver tells the frames apart by the first word and both may follow each other.
+ *
+ *  Field        Offset  Size  Description
+ *  frame             0     4  COMPACT_FRAME_TAG | flags (COMPACT_FLAG_DEFINE) | session slot
+ *  used              4     4  payload size in bytes
+ *  sequenceNr        8     8  per-proxy sequence number
+ *  messageId        16     4  service message or attribute ID
+ *  result           20     4  ResultType / ServiceConnectionState / eRequestType
+ *  checksum         24     4  checksum of the message, as in the EventHeader
+ *  eventId          28     4  class ID of the final event class
+ *  eventType        32     2  EventType flags
+ *  callType         34     1  EventCallType
+ *  priority         35     1  EventPriority
+ *  bufType          36     2  BufferType of the message
+ *  reserved         38     2  always 0
+ *                   40
+ **/
+struct CompactHeader
+{
+    uint32_t            frame       { 0 };  //!< [0..3]     tag, flags and session slot
+    uint32_t            used        { 0 };  //!< [4..7]     payload size
+    SequenceNumber      sequenceNr  { 0 };  //!< [8..15]    per-proxy sequence number
+    uint32_t            messageId   { 0 };  //!< [16..19]   function or attribute ID
+    uint32_t            result      { 0 };  //!< [20..23]   ResultType / ServiceConnectionState
+    uint32_t            checksum    { 0 };  //!< [24..27]   checksum of the message
+    uint32_t            eventId     { 0 };  //!< [28..31]   class ID of the final event class
+    uint16_t            eventType   { 0 };  //!< [32..33]   EventType flags
+    uint8_t             callType    { 0 };  //!< [34]       Event actions
+    uint8_t             priority    { 0 };  //!< [35]       EventPriority
+    areg::BufferType    bufType     { areg::BufferType::Unknown };  //!< [36..37] BufferType
+    uint16_t            reserved    { 0 };  //!< [38..39]   always 0
+};                                          //!< 40 bytes
+
+//!< The bits of the first word, which mark a compact frame.
+constexpr uint32_t  COMPACT_FRAME_TAG   { 0xC500'0000u };
+//!< The mask of the tag in the first word of a frame.
+constexpr uint32_t  COMPACT_TAG_MASK    { 0xFF00'0000u };
+//!< The flag of the first word, set if the CompactSession follows the header.
+constexpr uint32_t  COMPACT_FLAG_DEFINE { 0x0001'0000u };
+//!< The mask of the session slot in the first word.
+constexpr uint32_t  COMPACT_SLOT_MASK   { 0x0000'FFFFu };
+
+static_assert(sizeof(areg::CompactSession) == 60                , "CompactSession must be exactly 60 bytes");
+static_assert(sizeof(areg::CompactHeader)  == 40                , "CompactHeader must be exactly 40 bytes");
+static_assert(offsetof(areg::CompactHeader, sequenceNr) == 8    , "CompactHeader.sequenceNr must be at offset 8");
+static_assert(offsetof(areg::CompactHeader, bufType)    == 36   , "CompactHeader.bufType must be at offset 36");
+static_assert(offsetof(areg::EventHeader, messageId) - offsetof(areg::EventHeader, target) == sizeof(areg::CompactSession), "CompactSession must cover EventHeader bytes [16..75]");
+static_assert((areg::MAX_BUF_LENGTH + sizeof(areg::EventHeader)) < areg::COMPACT_FRAME_TAG, "The length of a full frame must never look like a compact frame");
+
+/**
+ * \brief   Returns true if the first word of a frame received from a stream marks a compact frame.
+ *
+ * \param   frameWord   The first 4 bytes of the frame.
+ **/
+[[nodiscard]]
+inline constexpr bool is_compact_frame( uint32_t frameWord ) noexcept;
+
+/**
+ * \brief   Returns the number of bytes of the frame received from a stream, either the full
+ *          frame with the EventHeader or the compact one.
+ *
+ * \param   frame   The beginning of the frame, at least sizeof(areg::CompactHeader) bytes.
+ **/
+[[nodiscard]]
+inline uint32_t wire_frame_size( const uint8_t * frame ) noexcept;
+
 /**
  * \brief   Returns writable pointer to data buffer, or nullptr if buffer pointer is invalid.
  *
@@ -997,6 +1102,30 @@ inline const uint8_t * buffer_data_read(const RawBuffer * byteBuffer) noexcept
     return (byteBuffer != nullptr ? reinterpret_cast<const uint8_t *>(byteBuffer) + byteBuffer->bufHeader.biOffset : nullptr);
 }
 
+/************************************************************************/
+// Wire frame functions
+/************************************************************************/
+
+inline constexpr bool is_compact_frame( uint32_t frameWord ) noexcept
+{
+    return ((frameWord & areg::COMPACT_TAG_MASK) == areg::COMPACT_FRAME_TAG);
+}
+
+inline uint32_t wire_frame_size( const uint8_t * frame ) noexcept
+{
+    uint32_t word[2]{ 0u, 0u };
+    ::memcpy(word, frame, sizeof(word));
+    if (areg::is_compact_frame(word[0]))
+    {
+        const uint32_t session{ (word[0] & areg::COMPACT_FLAG_DEFINE) != 0u ? static_cast<uint32_t>(sizeof(areg::CompactSession)) : 0u };
+        return (static_cast<uint32_t>(sizeof(areg::CompactHeader)) + session + word[1]);
+    }
+
+    areg::BufferHeader bufHeader{ };
+    ::memcpy(&bufHeader, frame, sizeof(areg::BufferHeader));
+    return (static_cast<uint32_t>(sizeof(areg::EventHeader)) + bufHeader.biUsed);
+}
+
 /************************************************************************/
 // Function templates
 /************************************************************************/
@@ -0,0 +1,131 @@
+#ifndef AREG_BASE_RAWBUFFERPOOL_HPP
+#define AREG_BASE_RAWBUFFERPOOL_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/RawBufferPool.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, size-classed slab pool for the raw heap blocks
+ *              owned by areg::RawBufferPtr (BufferBase, SharedBuffer, MessageEnvelope).
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+
+#include <cstdint>
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// RawBufferPool class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Process-wide, size-classed slab allocator for raw buffer blocks.
+ *
+ *          Every block handed out is a multiple of areg::BLOCK_SIZE and belongs to one
+ *          of SIZE_CLASS_COUNT size classes (256 bytes .. 64 KiB, two classes per power
+ *          of two). Freed blocks are kept in a per-thread cache of the releasing thread,
+ *          so the common "allocate, send, free" cycle of a thread never touches the heap
+ *          or a shared lock. When a thread cache of a class overflows, half of it is
+ *          moved to a shared depot in one lock acquisition; a thread whose cache is empty
+ *          refills from the depot the same way. This is how blocks allocated by a producer
+ *          thread and released by a consumer thread flow back to the producer.
+ *
+ *          Requests larger than MAX_SLOT_SIZE bypass the pool and go to the heap directly.
+ *          Each block carries a small hidden prefix with its size class, so release()
+ *          needs only the pointer.
+ *
+ * \note    The class is stateless from the caller's point of view and has only static
+ *          methods. All methods are thread-safe.
+ **/
+class AREG_API RawBufferPool
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Snapshot of pool counters.
+     *          The counters are accumulated per thread and published in batches,
+     *          so a snapshot may lag behind the real values by a few hundred operations
+     *          per active thread.
+     **/
+    struct Stats
+    {
+        uint64_t    hits            { 0u }; //!< Allocations served from a thread cache or the depot.
+        uint64_t    misses          { 0u }; //!< Allocations served by the heap (empty class or oversize).
+        uint64_t    retainedBytes   { 0u }; //!< Bytes currently held by thread caches and the depot.
+    };
+
+    /**
+     * \brief   The number of size classes.
+     **/
+    static constexpr uint32_t   SIZE_CLASS_COUNT    { 17u };
+
+    /**
+     * \brief   The smallest slot size, including the hidden block prefix.
+     **/
+    static constexpr uint32_t   MIN_SLOT_SIZE       { 256u };
+
+    /**
+     * \brief   The largest pooled slot size, including the hidden block prefix.
+     **/
+    static constexpr uint32_t   MAX_SLOT_SIZE       { 64u * 1024u };
+
+//////////////////////////////////////////////////////////////////////////
+// Static operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates a raw block of at least \a size bytes. The returned memory
+     *          has the same alignment as `new uint8_t[]` and must be freed by release().
+     *
+     * \param   size    The requested size in bytes.
+     * \return  Returns pointer to the allocated block, or nullptr if \a size is 0.
+     **/
+    [[nodiscard]]
+    static uint8_t* allocate(uint32_t size);
+
+    /**
+     * \brief   Returns a block allocated by allocate() back to the pool.
+     *          The block goes to the cache of the calling thread, independent of
+     *          which thread allocated it. Passing nullptr is a no-op.
+     *
+     * \param   block   The block returned by allocate().
+     **/
+    static void release(void* block) noexcept;
+
+    /**
+     * \brief   Returns a snapshot of the pool counters.
+     **/
+    [[nodiscard]]
+    static RawBufferPool::Stats stats() noexcept;
+
+    /**
+     * \brief   Frees all blocks retained by the cache of the calling thread and by the
+     *          shared depot. Caches of other threads are not touched.
+     **/
+    static void trim() noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    RawBufferPool() = delete;
+    ~RawBufferPool() = delete;
+    AREG_NOCOPY_NOMOVE(RawBufferPool);
+};
+
+} // namespace areg
+
+#endif  // AREG_BASE_RAWBUFFERPOOL_HPP
@@ -25,6 +25,12 @@
 #include "areg/base/Containers.hpp"
 #include "areg/base/SyncPrimitives.hpp"
 
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
 namespace areg {
 
 /************************************************************************
@@ -36,6 +42,8 @@ namespace areg {
             , typename LOCKABLE
             , class MapContainer 
             , class Deleter      > class ResourceMapBase;
+    template <typename RESOURCE_KEY
+            , typename RESOURCE_OBJECT> class ReadMostlyResourceMap;
 
 /************************************************************************
  * \brief   This file contains declarations of following class templates:
@@ -49,6 +57,10 @@ namespace areg {
  *              3.  ResourceMap<RESOURCE_KEY, RESOURCE_OBJECT, MapContainer, Deleter>,
  *                  which is a resource mapping class template, but no thread safe;
  *
+ *              4.  ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>,
+ *                  which is a thread safe resource mapping class template with lock-free
+ *                  lookups, for the maps, which are searched far more often than changed;
+ *
  *          For more information, see descriptions bellow
  ************************************************************************/
 
@@ -281,6 +293,196 @@ template <typename RESOURCE_KEY
         , class Deleter = ResourceMapImpl<RESOURCE_KEY, RESOURCE_OBJECT>>
 using ResourceMap = ResourceMapBase<RESOURCE_KEY, RESOURCE_OBJECT, NolockSyncObject, MapContainer, Deleter>;
 
+//////////////////////////////////////////////////////////////////////////
+// ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT> class template declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Thread-safe resource map for the resources, which are searched by many threads and
+ *          rarely registered or unregistered. The lookups take no lock and write no shared
+ *          cache line, while the changes are serialized by the resource lock.
+ *
+ *          The map is an immutable snapshot published through an atomic pointer. A change copies
+ *          the current snapshot, modifies the copy and publishes it, then waits for the grace
+ *          period and deletes the old snapshot: a reader marks itself in one of the reader slots
+ *          before it loads the snapshot, so the writer deletes the old snapshot once no reader
+ *          marked before the publish is left. The slots have two counters each, the writer
+ *          switches the readers to the other counter before it waits, so the new readers never
+ *          delay the writer.
+ *
+ *          A change costs a copy of the map, so use it for small maps of long-living resources,
+ *          and register the resources known at once with one call. The lookups see either the
+ *          state before or after each single change, also while the map is locked with lock():
+ *          to give a resource another key, move it with one change, so that no lookup misses it.
+ *
+ * \tparam  RESOURCE_KEY        The type of Key to access resource element. Should be possible to compute hash.
+ * \tparam  RESOURCE_OBJECT     The type of resource objects: a pointer or a shared pointer, which is
+ *                              copied by the lookup.
+ **/
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+class ReadMostlyResourceMap
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The immutable state of the map, which the readers search.
+    using Snapshot = std::unordered_map<RESOURCE_KEY, RESOURCE_OBJECT>;
+
+    //!< The number of the reader slots, the threads are spread over them.
+    static constexpr uint32_t   READER_SLOTS    { 32u };
+
+    /**
+     * \brief   The counters of the readers of one slot, per parity of the epoch.
+     **/
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<uint32_t>   rsReaders[2]    { };
+    };
+
+    /**
+     * \brief   Marks the calling thread as a reader during the lifetime of the object.
+     **/
+    class ReadGuard
+    {
+    public:
+        inline explicit ReadGuard(const ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT> & map) noexcept;
+        inline ~ReadGuard() noexcept;
+        inline const Snapshot & snapshot() const noexcept;
+    private:
+        std::atomic<uint32_t> & mReaders;   //!< The counter, which marks the reader.
+        const Snapshot *        mSnapshot;  //!< The snapshot, which stays valid while marked.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    inline ReadMostlyResourceMap();
+
+    inline ~ReadMostlyResourceMap();
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the number of resources in the map.
+     **/
+    [[nodiscard]]
+    inline uint32_t size() const noexcept;
+
+    /**
+     * \brief   Returns true if the resource map is empty.
+     **/
+    [[nodiscard]]
+    inline bool is_empty() const noexcept;
+
+    /**
+     * \brief   Checks whether a resource with the specified key is registered. Takes no lock.
+     *
+     * \param   Key     The unique key of the resource to check.
+     * \return  Returns true if the resource is registered with the specified key.
+     **/
+    [[nodiscard]]
+    inline bool exist(const RESOURCE_KEY & Key) const;
+
+    /**
+     * \brief   Searches for a resource object by the given key. Takes no lock.
+     *
+     * \param   Key     The unique key of the resource to find.
+     * \return  Returns the resource object if found; nullptr otherwise.
+     **/
+    [[nodiscard]]
+    inline RESOURCE_OBJECT find_resource_object(const RESOURCE_KEY & Key) const;
+
+    /**
+     * \brief   Registers a resource object under the given key, replacing the previous one.
+     *
+     * \param   Key         The unique key for the resource.
+     * \param   Resource    The resource object, which must remain valid until unregistered.
+     **/
+    inline void register_resource_object(const RESOURCE_KEY & Key, RESOURCE_OBJECT Resource);
+
+    /**
+     * \brief   Registers the resource objects under their keys in one change, replacing the
+     *          previous ones. Costs one copy of the map for all of them.
+     *
+     * \param   Resources   The pairs of the unique keys and the resource objects.
+     * \param   Count       The number of pairs.
+     **/
+    inline void register_resource_objects(const std::pair<RESOURCE_KEY, RESOURCE_OBJECT> * Resources, uint32_t Count);
+
+    /**
+     * \brief   Removes the entry of the old key and registers the resource object under the new
+     *          key in one change. A lookup finds the resource by either the old or the new key,
+     *          it never sees the state without it.
+     *
+     * \param   OldKey      The key the resource was registered with.
+     * \param   NewKey      The new unique key of the resource.
+     * \param   Resource    The resource object, which must remain valid until unregistered.
+     **/
+    inline void move_resource_object(const RESOURCE_KEY & OldKey, const RESOURCE_KEY & NewKey, RESOURCE_OBJECT Resource);
+
+    /**
+     * \brief   Unregisters the resource for the given key and returns the resource object.
+     *          On return, no lookup uses the removed entry anymore.
+     *
+     * \param   Key     The unique key of the resource to unregister.
+     * \return  Returns the resource object if found; nullptr otherwise.
+     **/
+    inline RESOURCE_OBJECT unregister_resource_object(const RESOURCE_KEY & Key);
+
+    /**
+     * \brief   Removes all registered resources.
+     **/
+    inline void remove_all_resources();
+
+    /**
+     * \brief   Locks the changes of the map. The lookups are not blocked.
+     **/
+    inline void lock() const;
+
+    /**
+     * \brief   Unlocks the changes of the map.
+     **/
+    inline void unlock() const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the reader slot of the calling thread.
+     **/
+    inline ReaderSlot & _reader_slot() const noexcept;
+
+    /**
+     * \brief   Publishes the new snapshot and returns the old one, which no reader uses anymore.
+     *          Call while holding the lock.
+     **/
+    inline std::unique_ptr<const Snapshot> _publish(std::unique_ptr<const Snapshot> next);
+
+    /**
+     * \brief   Waits until no reader is marked in the counters of the given parity.
+     **/
+    inline void _wait_readers(uint32_t parity) const noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member Variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    std::atomic<const Snapshot *>   mSnapshot;              //!< The snapshot, which the readers search.
+    std::atomic<uint32_t>           mEpoch;                 //!< The epoch, its parity selects the counters of the new readers.
+    mutable ReaderSlot              mSlots[READER_SLOTS];   //!< The counters of the readers.
+    mutable ResourceLock            mLock;                  //!< Serializes the changes.
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden / Forbidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( ReadMostlyResourceMap );
+};
+
 //////////////////////////////////////////////////////////////////////////
 // Function implementation
 //////////////////////////////////////////////////////////////////////////
@@ -473,5 +675,207 @@ inline void ResourceMapBase<RESOURCE_KEY, RESOURCE_OBJECT, LOCKABLE, MapContaine
     Deleter::impl_clean_resource(Key, Resource);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT> class template implementation
+//////////////////////////////////////////////////////////////////////////
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::ReadGuard::ReadGuard(const ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT> & map) noexcept
+    : mReaders  ( map._reader_slot().rsReaders[map.mEpoch.load(std::memory_order_acquire) & 1u] )
+    , mSnapshot ( nullptr )
+{
+    // Marked before the load: the writer, which publishes later, waits for this reader.
+    mReaders.fetch_add(1u, std::memory_order_seq_cst);
+    mSnapshot = map.mSnapshot.load(std::memory_order_seq_cst);
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::ReadGuard::~ReadGuard() noexcept
+{
+    mReaders.fetch_sub(1u, std::memory_order_release);
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline const typename ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::Snapshot & ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::ReadGuard::snapshot() const noexcept
+{
+    return *mSnapshot;
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::ReadMostlyResourceMap()
+    : mSnapshot ( new Snapshot() )
+    , mEpoch    ( 0u )
+    , mSlots    { }
+    , mLock     ( )
+{
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::~ReadMostlyResourceMap()
+{
+    delete mSnapshot.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline uint32_t ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::size() const noexcept
+{
+    ReadGuard guard(*this);
+    return static_cast<uint32_t>(guard.snapshot().size());
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline bool ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::is_empty() const noexcept
+{
+    ReadGuard guard(*this);
+    return guard.snapshot().empty();
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline bool ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::exist(const RESOURCE_KEY & Key) const
+{
+    ReadGuard guard(*this);
+    return (guard.snapshot().find(Key) != guard.snapshot().end());
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline RESOURCE_OBJECT ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::find_resource_object(const RESOURCE_KEY & Key) const
+{
+    ReadGuard guard(*this);
+    const Snapshot & snapshot{ guard.snapshot() };
+    const auto pos{ snapshot.find(Key) };
+    return (pos != snapshot.end() ? pos->second : RESOURCE_OBJECT{ nullptr });
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline void ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::register_resource_object(const RESOURCE_KEY & Key, RESOURCE_OBJECT Resource)
+{
+    std::unique_ptr<const Snapshot> retired;
+    do
+    {
+        Lock lock(mLock);
+        std::unique_ptr<Snapshot> next{ std::make_unique<Snapshot>(*mSnapshot.load(std::memory_order_relaxed)) };
+        (*next)[Key] = Resource;
+        retired = _publish(std::move(next));
+    } while (false);
+    // The old snapshot is deleted out of the lock: it may release the last reference of a resource.
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline void ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::register_resource_objects(const std::pair<RESOURCE_KEY, RESOURCE_OBJECT> * Resources, uint32_t Count)
+{
+    if ((Resources == nullptr) || (Count == 0u))
+        return;
+
+    std::unique_ptr<const Snapshot> retired;
+    do
+    {
+        Lock lock(mLock);
+        std::unique_ptr<Snapshot> next{ std::make_unique<Snapshot>(*mSnapshot.load(std::memory_order_relaxed)) };
+        next->reserve(next->size() + Count);
+        for (uint32_t i = 0u; i < Count; ++ i)
+        {
+            (*next)[Resources[i].first] = Resources[i].second;
+        }
+
+        retired = _publish(std::move(next));
+    } while (false);
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline void ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::move_resource_object(const RESOURCE_KEY & OldKey, const RESOURCE_KEY & NewKey, RESOURCE_OBJECT Resource)
+{
+    std::unique_ptr<const Snapshot> retired;
+    do
+    {
+        Lock lock(mLock);
+        std::unique_ptr<Snapshot> next{ std::make_unique<Snapshot>(*mSnapshot.load(std::memory_order_relaxed)) };
+        next->erase(OldKey);
+        (*next)[NewKey] = Resource;
+        retired = _publish(std::move(next));
+    } while (false);
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline RESOURCE_OBJECT ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::unregister_resource_object(const RESOURCE_KEY & Key)
+{
+    RESOURCE_OBJECT result{ nullptr };
+    std::unique_ptr<const Snapshot> retired;
+    do
+    {
+        Lock lock(mLock);
+        const Snapshot & current{ *mSnapshot.load(std::memory_order_relaxed) };
+        const auto pos{ current.find(Key) };
+        if (pos == current.end())
+            break;
+
+        result = pos->second;
+        std::unique_ptr<Snapshot> next{ std::make_unique<Snapshot>(current) };
+        next->erase(Key);
+        retired = _publish(std::move(next));
+    } while (false);
+
+    return result;
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline void ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::remove_all_resources()
+{
+    std::unique_ptr<const Snapshot> retired;
+    do
+    {
+        Lock lock(mLock);
+        retired = _publish(std::make_unique<Snapshot>());
+    } while (false);
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline void ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::lock() const
+{
+    mLock.lock(areg::WAIT_INFINITE);
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline void ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::unlock() const
+{
+    mLock.unlock();
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline typename ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::ReaderSlot & ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::_reader_slot() const noexcept
+{
+    static std::atomic<uint32_t> _nextSlot{ 0u };
+    static thread_local const uint32_t _slot{ _nextSlot.fetch_add(1u, std::memory_order_relaxed) % READER_SLOTS };
+    return mSlots[_slot];
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline std::unique_ptr<const typename ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::Snapshot> ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::_publish(std::unique_ptr<const Snapshot> next)
+{
+    std::unique_ptr<const Snapshot> retired{ mSnapshot.exchange(next.release(), std::memory_order_seq_cst) };
+
+    // A reader of the old snapshot marked itself before loading it. It may have taken the parity
+    // of the previous epoch, if it was delayed: the two switches wait for both counters, and the
+    // readers, which mark after the switch, load the new snapshot.
+    for (uint32_t i = 0u; i < 2u; ++ i)
+    {
+        const uint32_t parity{ mEpoch.fetch_add(1u, std::memory_order_seq_cst) & 1u };
+        _wait_readers(parity);
+    }
+
+    return retired;
+}
+
+template <typename RESOURCE_KEY, typename RESOURCE_OBJECT>
+inline void ReadMostlyResourceMap<RESOURCE_KEY, RESOURCE_OBJECT>::_wait_readers(uint32_t parity) const noexcept
+{
+    for (const ReaderSlot & slot : mSlots)
+    {
+        while (slot.rsReaders[parity].load(std::memory_order_seq_cst) != 0u)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
 } // namespace areg
 #endif  // AREG_BASE_RESOURCEMAP_HPP
@@ -0,0 +1,372 @@
+#ifndef AREG_BASE_SHAREDMEMORYCHANNEL_HPP
+#define AREG_BASE_SHAREDMEMORYCHANNEL_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/SharedMemoryChannel.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, two byte rings in a named shared memory segment
+ *              to exchange data between two processes of the same host.
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/String.hpp"
+
+#include <atomic>
+
+namespace areg {
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+struct IoBuffer;
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryChannel class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   A duplex byte stream between two processes of the same host. One process creates
+ *          the named segment, the other opens it by name. The segment contains two single
+ *          producer, single consumer rings, one for each direction, and the data is copied
+ *          once into the ring by the sender and once out of it by the receiver.
+ *
+ *          The waiting side spins for a short while and then parks on a doorbell word of the
+ *          ring (futex on Linux, ulock on macOS, named event on Windows). The writing side
+ *          rings the doorbell only if the peer is parked, so that a busy stream costs no
+ *          system calls at all.
+ *
+ *          Like a socket, the channel transports a stream of bytes: the message framing is
+ *          up to the caller. A message larger than the ring is streamed through it.
+ *
+ * \note    One thread may send and one thread may receive at a time. Callers that send from
+ *          several threads serialize them, for example with the writer lock of the socket.
+ **/
+class AREG_API SharedMemoryChannel
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The smallest size of a ring in bytes.
+    static constexpr uint32_t   MIN_RING_SIZE   { 64u * areg::ONE_KILOBYTE };
+
+    //!< The largest size of a ring in bytes.
+    static constexpr uint32_t   MAX_RING_SIZE   { 256u * areg::ONE_MEGABYTE };
+
+private:
+    //!< The number of polls of the ring before the waiting thread parks.
+    static constexpr uint32_t   SPIN_COUNT      { 2'000u };
+
+    //!< Identifies the segment created by this class.
+    static constexpr uint32_t   SEGMENT_MAGIC   { 0x4D534741u };
+
+    //!< The version of the layout of the segment.
+    static constexpr uint32_t   SEGMENT_VERSION { 1u };
+
+    //!< The size of the cache line the hot fields are aligned to.
+    static constexpr uint32_t   CACHE_LINE      { 64u };
+
+    //!< The number of doorbells of a segment: data and space of both rings.
+    static constexpr uint32_t   DOORBELL_COUNT  { 4u };
+
+    /**
+     * \brief   The control block of one ring in the segment. The producer and the consumer
+     *          write different cache lines.
+     **/
+    struct alignas(CACHE_LINE) RingControl
+    {
+        //!< The number of bytes ever written by the producer.
+        alignas(CACHE_LINE) std::atomic<uint64_t>   rcHead;
+        //!< The number of bytes ever read by the consumer.
+        alignas(CACHE_LINE) std::atomic<uint64_t>   rcTail;
+        //!< The doorbell word of the consumer, changed by the producer after every write.
+        alignas(CACHE_LINE) std::atomic<uint32_t>   rcDataBell;
+        //!< The number of consumer threads parked on the data doorbell.
+        std::atomic<uint32_t>                       rcDataWaiters;
+        //!< The doorbell word of the producer, changed by the consumer after every read.
+        alignas(CACHE_LINE) std::atomic<uint32_t>   rcSpaceBell;
+        //!< The number of producer threads parked on the space doorbell.
+        std::atomic<uint32_t>                       rcSpaceWaiters;
+    };
+
+    /**
+     * \brief   The header of the segment, followed by the control blocks and the data of the
+     *          two rings. Ring 0 carries the data of the creator, ring 1 the data of the peer.
+     **/
+    struct alignas(CACHE_LINE) SegmentHeader
+    {
+        //!< Always SEGMENT_MAGIC.
+        uint32_t                shMagic;
+        //!< Always SEGMENT_VERSION.
+        uint32_t                shVersion;
+        //!< The sizes of the data of the rings, powers of two.
+        uint32_t                shSizes[2];
+        //!< Set to non-zero when any side shuts the channel down.
+        std::atomic<uint32_t>   shClosed;
+    };
+
+    /**
+     * \brief   One direction of the channel, as seen by this process.
+     **/
+    struct Ring
+    {
+        //!< The control block in the segment.
+        RingControl *   rControl{ nullptr };
+        //!< The data of the ring in the segment.
+        uint8_t *       rData   { nullptr };
+        //!< The size of the data, a power of two.
+        uint32_t        rSize   { 0u };
+        //!< The index of the data doorbell, the space doorbell follows it.
+        uint32_t        rBell   { 0u };
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    SharedMemoryChannel() noexcept;
+
+    /**
+     * \brief   Unmaps the segment. Does not shut the channel down for the peer.
+     **/
+    ~SharedMemoryChannel();
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the name of the segment the peer process passes to open().
+     **/
+    [[nodiscard]]
+    inline const String & name() const noexcept;
+
+    /**
+     * \brief   Returns true if the segment is mapped.
+     **/
+    [[nodiscard]]
+    inline bool is_open() const noexcept;
+
+    /**
+     * \brief   Returns true if any side shut the channel down, or if the segment is not mapped.
+     **/
+    [[nodiscard]]
+    bool is_shutdown() const noexcept;
+
+    /**
+     * \brief   Creates a new segment with a unique name and maps it. The sizes are rounded up
+     *          to a power of two between MIN_RING_SIZE and MAX_RING_SIZE.
+     *
+     * \param   sendSize    The size of the ring to send data to the peer.
+     * \param   recvSize    The size of the ring to receive data from the peer.
+     * \return  Returns true if the segment is created.
+     **/
+    bool create( uint32_t sendSize, uint32_t recvSize );
+
+    /**
+     * \brief   Opens and maps the segment created by the peer process.
+     *
+     * \param   name    The name of the segment, created by the peer.
+     * \return  Returns true if the segment exists and has a valid layout.
+     **/
+    bool open( const String & name );
+
+    /**
+     * \brief   Unmaps the segment and removes its name if this process created it.
+     *          No other thread may use the channel at this time.
+     **/
+    void close() noexcept;
+
+    /**
+     * \brief   Removes the name of the segment, so that no other process can open it. The
+     *          mapped memory stays valid until both sides close it.
+     **/
+    void remove_name() noexcept;
+
+    /**
+     * \brief   Marks the channel closed for both sides and wakes all parked threads. Any
+     *          further send or receive fails. Thread safe.
+     **/
+    void shutdown() noexcept;
+
+    /**
+     * \brief   Writes the buffers to the ring. Waits for free space if the ring is full.
+     *
+     * \param   buffers     The list of buffers to write.
+     * \param   count       The number of entries in the list.
+     * \param   totalSize   The total size of the buffers. If 0, it is calculated.
+     * \param   timeoutMs   The maximum time to wait for free space in milliseconds.
+     * \return  Returns the number of written bytes, which is the complete data, on success.
+     *          Returns negative value if the channel is shut down or the peer did not free the
+     *          space in time; a part of the data may be written in this case.
+     **/
+    int32_t send( const IoBuffer * buffers, uint32_t count, uint32_t totalSize, uint32_t timeoutMs ) noexcept;
+
+    /**
+     * \brief   Writes the buffers to the ring only if all of them fit, never waits.
+     *
+     * \return  Returns the number of written bytes, which is the complete data, on success.
+     *          Returns zero if the ring has no space for the data and nothing is written.
+     *          Returns negative value if the channel is shut down.
+     **/
+    int32_t try_send( const IoBuffer * buffers, uint32_t count, uint32_t totalSize ) noexcept;
+
+    /**
+     * \brief   Reads exactly the given number of bytes from the ring. Waits for the data.
+     *
+     * \param   buffer      The buffer to copy the data to.
+     * \param   size        The number of bytes to read.
+     * \param   timeoutMs   The maximum time in milliseconds to wait for each part of the data.
+     * \return  Returns the size on success. Returns negative value if the channel is shut
+     *          down or the data did not arrive in time; a part of the data may be read.
+     **/
+    int32_t receive( uint8_t * buffer, uint32_t size, uint32_t timeoutMs ) noexcept;
+
+    /**
+     * \brief   Returns the number of bytes that can be read without waiting.
+     **/
+    [[nodiscard]]
+    uint32_t size_readable() const noexcept;
+
+    /**
+     * \brief   Waits until there is data to read.
+     *
+     * \param   timeoutMs   The maximum time to wait in milliseconds.
+     * \return  Returns true if there is data to read. Returns false on timeout or if the
+     *          channel is shut down.
+     **/
+    bool wait_readable( uint32_t timeoutMs ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Sets the rings on the mapped segment.
+     *
+     * \param   isCreator   True if this process created the segment.
+     **/
+    void _setup_rings( bool isCreator ) noexcept;
+
+    /**
+     * \brief   Waits until the value of the bell changes. The producer of the ring is the
+     *          single writer of the data bell, the consumer of the space bell.
+     *
+     * \param   ring        The ring to wait on.
+     * \param   dataBell    True to wait for data, false to wait for free space.
+     * \param   timeoutMs   The maximum time to wait in milliseconds.
+     **/
+    void _park( Ring & ring, bool dataBell, uint32_t timeoutMs ) noexcept;
+
+    /**
+     * \brief   Changes the value of the bell and wakes the parked peer, if any.
+     **/
+    void _ring_bell( Ring & ring, bool dataBell ) noexcept;
+
+    /**
+     * \brief   Returns the total size of the segment with the rings of the given sizes.
+     **/
+    [[nodiscard]]
+    static uint32_t _segment_size( uint32_t sendSize, uint32_t recvSize ) noexcept;
+
+    /**
+     * \brief   Rounds the size of a ring to a power of two in the allowed range.
+     **/
+    [[nodiscard]]
+    static uint32_t _ring_size( uint32_t size ) noexcept;
+
+    /**
+     * \brief   OS specific creation of the segment with a new unique name. Sets the name,
+     *          the mapped address and the doorbells.
+     **/
+    bool _os_create( uint32_t segmentSize );
+
+    /**
+     * \brief   OS specific opening of an existing segment. Sets the name, the mapped address
+     *          and the doorbells, and returns the size of the mapped segment.
+     **/
+    bool _os_open( const String & name, uint32_t & segmentSize );
+
+    /**
+     * \brief   OS specific unmapping of the segment and releasing of the doorbells.
+     **/
+    void _os_close() noexcept;
+
+    /**
+     * \brief   OS specific removal of the name of the segment.
+     **/
+    void _os_remove_name() noexcept;
+
+    /**
+     * \brief   OS specific wait while the word has the given value.
+     **/
+    void _os_wait( std::atomic<uint32_t> & word, uint32_t value, uint32_t bell, uint32_t timeoutMs ) noexcept;
+
+    /**
+     * \brief   OS specific wake up of the threads waiting on the word.
+     **/
+    void _os_wake( std::atomic<uint32_t> & word, uint32_t bell ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< The name of the segment.
+    String          mName;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+    //!< The mapped segment.
+    uint8_t *       mSegment;
+    //!< The size of the mapped segment.
+    uint32_t        mSegmentSize;
+    //!< The header of the mapped segment.
+    SegmentHeader * mHeader;
+    //!< The ring to send data to the peer.
+    Ring            mSend;
+    //!< The ring to receive data from the peer.
+    Ring            mRecv;
+    //!< The OS specific handles: the mapping and the doorbells, if the OS needs them.
+    void *          mHandles[DOORBELL_COUNT + 1u];
+    //!< True if this process created the segment and did not remove its name yet.
+    bool            mOwnsName;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( SharedMemoryChannel );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryChannel class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline const String & SharedMemoryChannel::name() const noexcept
+{
+    return mName;
+}
+
+inline bool SharedMemoryChannel::is_open() const noexcept
+{
+    return (mSegment != nullptr);
+}
+
+} // namespace areg
+
+#endif  // AREG_BASE_SHAREDMEMORYCHANNEL_HPP
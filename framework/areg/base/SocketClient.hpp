@@ -88,19 +88,48 @@ public:
     /**
      * \brief   Creates a socket file descriptor without connecting. Use connect_to() to establish the
      *          connection (e.g. from a dedicated I/O thread). mAddress must be set beforehand.
+     *          Creates a local stream socket if the local path is set and exists, and the previous
+     *          attempt to connect through it did not fail, see set_local_path().
      *
      * \return  Returns true if the socket descriptor was created.
      **/
     bool create_fd();
 
     /**
-     * \brief   Blocking TCP connect to the stored remote address. Must be called after create_fd().
-     *          On failure the socket is closed and invalidated. On success applies TCP_NODELAY.
+     * \brief   Blocking connect to the stored remote address, or to the local path if create_fd()
+     *          created a local socket. Must be called after create_fd(). On failure the socket is
+     *          closed and invalidated; if the local path failed, the next create_fd() falls back to
+     *          TCP. On TCP success applies TCP_NODELAY.
      *
      * \return  Returns true if the connection was established.
      **/
     bool connect_to();
 
+    /**
+     * \brief   Sets the path of the local stream socket of the server, which create_fd() prefers
+     *          over TCP. An empty path connects via TCP only.
+     *
+     * \param   path    The path of the local socket of the server, see areg::local_socket_path().
+     **/
+    void set_local_path(const String & path);
+
+    /**
+     * \brief   Returns true if the socket is connected, or going to connect, through the local path.
+     **/
+    [[nodiscard]]
+    inline bool is_local() const noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The path of the local stream socket of the server, empty to use TCP only.
+    String  mLocalPath  { };
+    //!< Flag, indicating whether the socket is a local stream socket.
+    bool    mIsLocal    { false };
+    //!< Flag, indicating that the last connect through the local path failed.
+    bool    mLocalFailed{ false };
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -108,5 +137,14 @@ private:
     AREG_NOCOPY_NOMOVE( SocketClient );
 };
 
+//////////////////////////////////////////////////////////////////////////
+// SocketClient class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SocketClient::is_local() const noexcept
+{
+    return mIsLocal;
+}
+
 } // namespace areg
 #endif  // AREG_BASE_SOCKETCLIENT_HPP
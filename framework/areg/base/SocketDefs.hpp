@@ -336,8 +336,14 @@ constexpr const uint32_t    DEFAULT_THREAD_CACHE    { 256 * areg::ONE_KILOBYTE }
 //!< Maximum aggregate wire bytes coalesced into one send_data_v() / scatter-gather send call.
 constexpr uint32_t          MAX_SEND_BATCH_BYTES    { 0x7000'0000u };   // 1.75 GiB, < INT32_MAX
 
+//!< The longest time in microseconds a send thread may wait for more messages of a batch,
+//!< configurable via net::*::tcpip::batchwait in areg.init. 0, the default, sends at once.
+constexpr uint32_t          MAX_SEND_BATCH_WAIT_US  { 1'000u };
+
 //!< The minimum size of the block to send without copying to the cache.
 constexpr uint32_t          MIN_BIG_BLOCK           { 64 * areg::ONE_KILOBYTE };
+//!< The smallest buffer sent with MSG_ZEROCOPY. Pinning the pages of a smaller one costs more than copying it.
+constexpr uint32_t          MIN_ZEROCOPY_BLOCK      { 16 * areg::ONE_KILOBYTE };
 //!< Number of per-socket writer locks. Must be a power of two.
 constexpr uint32_t          SOCKET_WRITER_SLOTS     { 128u };
 
@@ -361,6 +367,26 @@ AREG_API uint32_t   thread_cache_size() noexcept;
  **/
 AREG_API uint32_t   send_batch_limit() noexcept;
 
+/**
+ * \brief   Returns the latency budget of a send batch in microseconds: how long a send thread
+ *          may wait for more messages before it writes a batch that is not full. Read from the
+ *          configuration entry 'net::*::tcpip::batchwait' and clamped to
+ *          areg::MAX_SEND_BATCH_WAIT_US. 0 means the batch is written at once.
+ *
+ * \note    Same as send_batch_limit(), call it once per connection and keep the result.
+ **/
+AREG_API uint32_t   send_batch_wait() noexcept;
+
+/**
+ * \brief   Returns the size in bytes from which a buffer is sent without copying it into the
+ *          kernel (MSG_ZEROCOPY). Read from the configuration entry 'net::*::tcpip::zerocopy' in
+ *          kilobytes; 0, the default, disables the zero-copy send, smaller values are raised to
+ *          areg::MIN_ZEROCOPY_BLOCK.
+ *
+ * \note    Same as send_batch_limit(), call it once per connection and keep the result.
+ **/
+AREG_API uint32_t   zerocopy_threshold() noexcept;
+
 //!< Thread local cache to send / receive data
 struct ThreadCache
 {
@@ -407,6 +433,65 @@ struct IoBuffer
     std::size_t     size;   //!< Number of bytes to send from this region.
 };
 
+/**
+ * \brief   Describes the buffers to send into one socket with send_data_groups(), and the
+ *          result of the send.
+ **/
+struct IoGroup
+{
+    SOCKETHANDLE        socket;     //!< The socket to send the buffers into.
+    const IoBuffer *    buffers;    //!< The buffers of the group.
+    uint32_t            count;      //!< The number of buffers of the group.
+    uint32_t            totalSize;  //!< The total number of bytes of the group.
+    int32_t             result;     //!< On output, the result of send_data_v() for the group.
+};
+
+/**
+ * \brief   The completion of the zero-copy sends of a socket: the kernel released the buffers
+ *          of the sends with the ids from first to last. The ids count the zero-copy sends of
+ *          the socket, starting at 0.
+ **/
+struct ZeroCopyDone
+{
+    uint32_t            first;      //!< The id of the first completed send.
+    uint32_t            last;       //!< The id of the last completed send, inclusive.
+    bool                copied;     //!< True if the kernel copied the data anyway, as it does on the loopback.
+};
+
+//////////////////////////////////////////////////////////////////////////
+// areg::DatagramEndpoint, areg::DatagramOut, areg::DatagramIn
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The IPv4 address and port of a datagram peer, both in network byte order, so that
+ *          the batches of datagrams are addressed without conversions.
+ **/
+struct DatagramEndpoint
+{
+    uint32_t        address;    //!< The IPv4 address in network byte order.
+    uint16_t        port;       //!< The port number in network byte order.
+};
+
+/**
+ * \brief   Describes one datagram to send: up to two regions sent as a single datagram,
+ *          for example, a small prefix and a message, without copying them together.
+ **/
+struct DatagramOut
+{
+    IoBuffer            parts[2];   //!< The regions of the datagram, an empty region is skipped.
+    DatagramEndpoint    peer;       //!< The receiver of the datagram.
+};
+
+/**
+ * \brief   Describes the buffer of one datagram to receive.
+ **/
+struct DatagramIn
+{
+    uint8_t *           data;       //!< The buffer to receive the datagram.
+    uint32_t            capacity;   //!< The size of the buffer in bytes.
+    uint32_t            size;       //!< On output, the size of the received datagram.
+    DatagramEndpoint    peer;       //!< On output, the sender of the datagram.
+};
+
 //////////////////////////////////////////////////////////////////////////
 // areg namespace free functions
 //////////////////////////////////////////////////////////////////////////
@@ -492,6 +577,7 @@ AREG_API void socket_configure(SOCKETHANDLE hSocket) noexcept;
  * \brief   Disables the Nagle algorithm (TCP_NODELAY) on a connected socket.
  *          Also applies platform-specific keepalive and broken-pipe handling.
  *          Call this only on client or accepted sockets, never on listening sockets.
+ *          Does nothing on a local stream socket, see is_local_socket().
  *
  * \param   hSocket     Valid connected socket descriptor.
  **/
@@ -590,6 +676,136 @@ AREG_API SOCKETHANDLE server_accept(SocketMultiplexer& multiplexer, SOCKETHANDLE
 [[nodiscard]]
 AREG_API SOCKETHANDLE server_accept(SOCKETHANDLE serverSocket, const SOCKETHANDLE* masterList, int32_t entriesCount, SocketAddress* socketAddr = nullptr);
 
+/**
+ * \brief   Returns the path of the local stream socket (AF_UNIX) of the server, which listens
+ *          on the TCP port \a portNr. The path depends only on the user and the port, so that
+ *          the processes of the same user find it without configuration. It is in a directory
+ *          only the user can access: $XDG_RUNTIME_DIR, or else the 'areg-<uid>' subdirectory
+ *          of the temporary directory with the mode 0700. On Windows it is the temporary
+ *          directory of the user.
+ * \return  Returns the path; empty if no private directory is available, then the local
+ *          socket is not used.
+ **/
+[[nodiscard]]
+AREG_API String local_socket_path(uint16_t portNr);
+
+/**
+ * \brief   Returns true if the local socket \a path exists, i.e. a server may listen on it.
+ **/
+[[nodiscard]]
+AREG_API bool local_socket_exists(const String& path) noexcept;
+
+/**
+ * \brief   Removes the local socket \a path from the file system. No process can connect to
+ *          the server afterward, the accepted connections remain.
+ **/
+AREG_API void local_socket_remove(const String& path) noexcept;
+
+/**
+ * \brief   Creates a local stream socket (AF_UNIX).
+ *
+ * \return  Valid descriptor on success; InvalidSocketHandle on failure.
+ **/
+[[nodiscard]]
+AREG_API SOCKETHANDLE local_socket_create() noexcept;
+
+/**
+ * \brief   Returns true if \a hSocket is a local stream socket (AF_UNIX). The TCP options do
+ *          not apply to such socket.
+ **/
+[[nodiscard]]
+AREG_API bool is_local_socket(SOCKETHANDLE hSocket) noexcept;
+
+/**
+ * \brief   Connects a socket created by local_socket_create() to the local server at \a path
+ *          (blocking, 1-second timeout). The connect fails if the path or the server process
+ *          belongs to another user. On failure the socket is NOT closed by this function.
+ *
+ * \param   hSocket     A valid, unconnected local socket handle.
+ * \param   path        The path of the local server socket, see local_socket_path().
+ * \return  Returns true if the connection was established within the timeout.
+ **/
+AREG_API bool local_connect_fd(SOCKETHANDLE hSocket, const String& path);
+
+/**
+ * \brief   Creates a local server socket (AF_UNIX) and binds it to \a path. A path left by a
+ *          server, which did not exit cleanly, is removed first.
+ *          Call server_listen() before accepting connections.
+ *
+ * \param   path    The path to bind, see local_socket_path().
+ * \return  Valid descriptor on success; InvalidSocketHandle on failure.
+ **/
+[[nodiscard]]
+AREG_API SOCKETHANDLE local_server_connect(const String& path);
+
+/**
+ * \brief   Accepts one pending connection on the listening local \a serverSocket. Call when
+ *          the multiplexer reports the server socket readable.
+ *
+ * \return  Valid descriptor for the new connection; InvalidSocketHandle on failure.
+ **/
+[[nodiscard]]
+AREG_API SOCKETHANDLE local_server_accept(SOCKETHANDLE serverSocket) noexcept;
+
+/**
+ * \brief   Converts the host name or IPv4 address and the port number to the endpoint of a
+ *          datagram peer. An empty host name is the wildcard address.
+ *
+ * \param   hostName    Numeric IP or host name to resolve.
+ * \param   portNr      The port number in host byte order.
+ * \param[out]  endpoint    On output, the address and the port in network byte order.
+ * \return  Returns true if the host name is resolved.
+ **/
+AREG_API bool datagram_endpoint(const String& hostName, uint16_t portNr, DatagramEndpoint& endpoint);
+
+/**
+ * \brief   Creates a non-blocking UDP socket and binds it to \a hostName and \a portNr.
+ *          The socket never waits on sending: a datagram, which does not fit into the send
+ *          buffer, is not sent.
+ *
+ * \param   hostName    The address to bind. If empty, binds the wildcard address.
+ * \param   portNr      The port to bind. If zero, the system selects a free port,
+ *                      see datagram_socket_port().
+ * \return  Valid descriptor on success; InvalidSocketHandle on failure.
+ **/
+[[nodiscard]]
+AREG_API SOCKETHANDLE datagram_socket_create(const String& hostName, uint16_t portNr);
+
+/**
+ * \brief   Returns the port in host byte order the UDP socket is bound to, or InvalidPort.
+ **/
+[[nodiscard]]
+AREG_API uint16_t datagram_socket_port(SOCKETHANDLE hSocket) noexcept;
+
+/**
+ * \brief   Sends a batch of datagrams through the UDP socket without waiting. On Linux the
+ *          batch is passed to the kernel by a single sendmmsg() call, other systems send the
+ *          datagrams one by one. A datagram, which is refused, is not retried: the receiver
+ *          detects the loss, if it needs to.
+ *
+ * \param   hSocket     Valid UDP socket descriptor, see datagram_socket_create().
+ * \param   datagrams   The datagrams to send.
+ * \param   count       The number of datagrams.
+ * \return  Returns the number of the sent datagrams, which is less than \a count if the send
+ *          buffer is full; negative value if the socket is not usable anymore.
+ **/
+AREG_API int32_t datagram_send(SOCKETHANDLE hSocket, const DatagramOut* datagrams, uint32_t count) noexcept;
+
+/**
+ * \brief   Waits up to \a timeoutMs milliseconds for a datagram and receives at once all
+ *          datagrams that are available, up to \a count. On Linux the batch is read by a single
+ *          recvmmsg() call, other systems read the datagrams one by one. The datagrams larger
+ *          than the buffer are truncated and reported with size zero.
+ *
+ * \param   hSocket     Valid UDP socket descriptor, see datagram_socket_create().
+ * \param[in,out] datagrams  The buffers to receive the datagrams.
+ * \param   count       The number of buffers.
+ * \param   timeoutMs   The time in milliseconds to wait for the first datagram.
+ * \return  Returns the number of received datagrams, zero on timeout, negative value if the
+ *          socket is closed or failed.
+ **/
+AREG_API int32_t datagram_receive(SOCKETHANDLE hSocket, DatagramIn* datagrams, uint32_t count, uint32_t timeoutMs) noexcept;
+
 /**
  * \brief   Returns the OS send-buffer size in bytes for \a hSocket.
  **/
@@ -660,6 +876,25 @@ AREG_API int32_t send_data_v(SOCKETHANDLE hSocket, const IoBuffer* buffers, uint
  **/
 AREG_API int32_t try_send_data_v(SOCKETHANDLE hSocket, const IoBuffer* buffers, uint32_t count, uint32_t totalSize = 0) noexcept;
 
+/**
+ * \brief   Sends every group of buffers into its socket as send_data_v() does, and sets the
+ *          result of each group. The groups of one socket are sent in the order of the array.
+ *
+ *          On Linux built with AREG_IO_URING, all groups are passed to the kernel with one
+ *          system call and written in parallel. Otherwise, and if the kernel lacks io_uring,
+ *          the groups are sent one after another.
+ *
+ * \note    Hold the writer locks of the sockets, see SocketWriter.
+ *
+ * \param   groups      The groups to send, the total number of buffers of all groups must not
+ *                      exceed areg::DEFAULT_DRAIN_LIMIT.
+ * \param   count       The number of groups.
+ * \param   timeoutMs   The time to wait for a socket, which does not accept data, before the
+ *                      send into it fails. Zero waits infinitely. Used with io_uring only, the
+ *                      classic sends use the SO_SNDTIMEO of the sockets.
+ **/
+AREG_API void send_data_groups(IoGroup* groups, uint32_t count, uint32_t timeoutMs) noexcept;
+
 /**
  * \brief   Receives up to \a dataLength bytes from \a hSocket into \a dataBuffer.
  *          Loops internally on partial receives; returns when the buffer is full,
@@ -686,6 +921,51 @@ AREG_API int32_t receive_data(SOCKETHANDLE hSocket, uint8_t* dataBuffer, uint32_
  **/
 AREG_API int32_t receive_data_window(SOCKETHANDLE hSocket, uint8_t* dataBuffer, uint32_t dataLength) noexcept;
 
+/**
+ * \brief   Enables the zero-copy send (SO_ZEROCOPY) on the connected TCP socket.
+ *
+ * \param   hSocket     Valid connected socket descriptor.
+ * \return  Returns true if the socket sends with send_data_zerocopy() without copying. Returns
+ *          false if the platform or the kind of the socket has no zero-copy send.
+ **/
+AREG_API bool zerocopy_enable(SOCKETHANDLE hSocket) noexcept;
+
+/**
+ * \brief   Sends the data without copying it into the kernel (MSG_ZEROCOPY). The data must not
+ *          change until zerocopy_completions() reports the ids of the sends. Stops early if the
+ *          kernel cannot pin more pages; the caller sends the rest as usual.
+ *
+ * \param   hSocket     Valid connected socket descriptor, zerocopy_enable() succeeded on it.
+ * \param   dataBuffer  The data to send.
+ * \param   dataLength  The size of the data in bytes.
+ * \param[out]  sends   On output, the number of the send calls, each of them uses the next id.
+ * \return  Returns the number of bytes sent without copying, which is less than \a dataLength
+ *          if the send stopped early; negative on error.
+ **/
+AREG_API int32_t send_data_zerocopy(SOCKETHANDLE hSocket, const uint8_t* dataBuffer, uint32_t dataLength, uint32_t& sends) noexcept;
+
+/**
+ * \brief   Reads the completions of the zero-copy sends from the error queue of the socket.
+ *
+ * \param   hSocket     Valid connected socket descriptor.
+ * \param[out]  done    The completions to fill.
+ * \param   count       The number of entries of \a done.
+ * \param   timeoutMs   The time to wait for the first completion in milliseconds, 0 does not wait.
+ * \return  Returns the number of the completions read; negative if the socket failed.
+ **/
+AREG_API int32_t zerocopy_completions(SOCKETHANDLE hSocket, ZeroCopyDone* done, uint32_t count, uint32_t timeoutMs) noexcept;
+
+/**
+ * \brief   Returns another handle of the socket to read the completions of the zero-copy sends
+ *          after the connection closed its own handle. The kernel keeps the socket and its
+ *          error queue until the returned handle is closed with socket_close().
+ *
+ * \param   hSocket     Valid connected socket descriptor, zerocopy_enable() succeeded on it.
+ * \return  Returns the new handle, or InvalidSocketHandle if the platform has no zero-copy send
+ *          or the handle cannot be created.
+ **/
+AREG_API SOCKETHANDLE zerocopy_retain(SOCKETHANDLE hSocket) noexcept;
+
 /**
  * \brief   Returns the number of bytes of received data that are cached in
  *          the calling thread's read-ahead buffer for \a hSocket.
@@ -697,6 +977,30 @@ AREG_API int32_t receive_data_window(SOCKETHANDLE hSocket, uint8_t* dataBuffer,
  **/
 AREG_API uint32_t recv_data_available(SOCKETHANDLE hSocket) noexcept;
 
+/**
+ * \brief   Makes the next wire frame of \a hSocket available in the calling thread's read-ahead
+ *          buffer and returns it without copying. Reads from the socket only if the buffer has
+ *          no complete frame: each recv() takes as many bytes as fit, so the frames following
+ *          the requested one are served from the buffer. The frame stays valid until
+ *          receive_frame_done() or the next receive on the socket.
+ *
+ * \param   hSocket     Valid connected socket descriptor.
+ * \param   frame       On output, the first byte of the frame or nullptr.
+ * \return  The size of the frame in bytes (> 0); zero if the thread does not cache the received
+ *          data or the frame is larger than the buffer, so it must be received with
+ *          receive_data(); negative if the socket failed or the peer closed the connection.
+ **/
+AREG_API int32_t receive_frame(SOCKETHANDLE hSocket, const uint8_t*& frame) noexcept;
+
+/**
+ * \brief   Moves the read cursor of the calling thread's read-ahead buffer of \a hSocket past
+ *          the frame returned by receive_frame().
+ *
+ * \param   hSocket     The socket, which frame is consumed.
+ * \param   frameSize   The size of the frame returned by receive_frame().
+ **/
+AREG_API void receive_frame_done(SOCKETHANDLE hSocket, uint32_t frameSize) noexcept;
+
 /**
  * \brief   Sets SO_SNDTIMEO on \a hSocket so that a blocking send() cannot hang 
  *          longer than \a timeoutMs milliseconds.  This is a kernel-level safety net.
@@ -749,6 +1053,18 @@ AREG_API bool is_socket_alive(SOCKETHANDLE hSocket) noexcept;
  **/
 AREG_API uint32_t pending_read(SOCKETHANDLE hSocket) noexcept;
 
+/**
+ * \brief   Waits up to \a timeoutMs milliseconds until \a hSocket has data to read, or until
+ *          the peer closes the connection or the socket fails, so that the next receive call
+ *          does not block.
+ *
+ * \param   hSocket     Valid connected socket descriptor.
+ * \param   timeoutMs   The time to wait in milliseconds, 0 checks and returns immediately.
+ * \return  Returns true if the next receive call returns without waiting.
+ **/
+[[nodiscard]]
+AREG_API bool is_socket_readable(SOCKETHANDLE hSocket, uint32_t timeoutMs = 0u) noexcept;
+
 /**
  * \brief   Returns the local machine host name, or an empty string on failure.
  **/
@@ -856,6 +1172,12 @@ public:
      **/
     void release() noexcept;
 
+    /**
+     * \brief   Returns true if the calling thread owns the lock.
+     **/
+    [[nodiscard]]
+    bool is_owner() const noexcept;
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
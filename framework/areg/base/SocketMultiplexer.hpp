@@ -40,6 +40,9 @@ namespace areg {
  *
  *          Platform-specific wait backend:
  *          - Linux        : \c epoll_wait() -- O(1) regardless of socket count.
+ *                           Built with AREG_IO_URING, the readiness comes from the poll
+ *                           requests of an io_uring instance, and epoll is the fallback
+ *                           when the kernel lacks io_uring.
  *          - macOS        : \c kevent() (kqueue) -- O(1) like epoll.
  *          - Windows      : \c WSAPoll.
  *          - other POSIX  : \c poll() (Cygwin, FreeBSD, etc.).
@@ -212,6 +215,11 @@ private:
 
 #if defined(__linux__)
     SOCKETHANDLE    mEpollFd;       //!< epoll instance fd (not a socket; POSIX int fd).
+
+    struct RingState;
+    //!< The io_uring readiness backend, nullptr if the multiplexer uses epoll.
+    //!< Created only when the framework is built with AREG_IO_URING and the kernel supports it.
+    RingState *     mRing;
 #elif defined(__APPLE__)
     SOCKETHANDLE    mKqueueFd;      //!< kqueue instance fd (macOS/BSD; POSIX int fd).
 #endif
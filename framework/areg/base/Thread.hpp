@@ -35,6 +35,7 @@
 #include <atomic>
 #include <string_view>
 #include <limits>
+#include <vector>
 
 #ifdef _MSC_VER
     #include <intrin.h>     // _mm_pause() for Thread::cpu_pause()
@@ -110,6 +111,51 @@ public:
     [[nodiscard]]
     inline static constexpr const char * as_string( Thread::ThreadPriority threadPriority ) noexcept;
 
+    /**
+     * \brief   Thread::SchedPolicy
+     *          The scheduling policy the thread sets when it starts.
+     **/
+    enum class SchedPolicy : uint8_t
+    {
+          Default       = 0 //!< Keeps the policy inherited from the creating thread.
+        , Normal        = 1 //!< The time-sharing policy of the OS (SCHED_OTHER).
+        , Fifo          = 2 //!< Real-time first-in first-out policy (SCHED_FIFO). Requires the privilege.
+        , RoundRobin    = 3 //!< Real-time round-robin policy (SCHED_RR). Requires the privilege.
+    };
+
+    [[nodiscard]]
+    inline static constexpr const char * as_string( Thread::SchedPolicy schedPolicy ) noexcept;
+
+    /**
+     * \brief   Thread::NUMA_NODE_ANY
+     *          The thread is not bound to a NUMA node.
+     **/
+    static constexpr int32_t            NUMA_NODE_ANY           { -1 };
+
+    /**
+     * \brief   Thread::ThreadPlacement
+     *          The CPU cores, the NUMA node and the scheduling policy of the thread. The thread
+     *          applies them when it starts, before it runs the consumer. A setting the OS rejects,
+     *          for example a real-time policy without the privilege, is reported in the debug
+     *          output and the thread runs without it.
+     **/
+    struct ThreadPlacement
+    {
+        //!< The CPU cores to run on, a list like "3", "0-3" or "0,2,4-7". Empty runs on any core.
+        String          cpus        { };
+        //!< The scheduling policy.
+        SchedPolicy     policy      { SchedPolicy::Default };
+        //!< The priority of the real-time policies, clamped to the range of the OS. 0 is the lowest.
+        int32_t         priority    { 0 };
+        //!< The NUMA node to allocate the memory of the thread on. If no CPU core is set, the
+        //!< thread also runs on the cores of the node. NUMA_NODE_ANY does not bind.
+        int32_t         numaNode    { NUMA_NODE_ANY };
+
+        //!< Returns true if the placement changes nothing.
+        [[nodiscard]]
+        inline bool is_empty() const noexcept;
+    };
+
     /**
      * \brief   Thread::RunState
      *          The states of the thread routine with respect to the thread object. The object
@@ -251,6 +297,14 @@ public:
     [[nodiscard]]
     inline bool is_valid() const noexcept;
 
+    /**
+     * \brief   Returns true if the thread runs as a strand: it has no OS thread of its own and
+     *          an executor runs it in turns on the threads of a pool. The ID of a strand is a
+     *          logical ID, which no OS thread has.
+     **/
+    [[nodiscard]]
+    inline bool is_strand() const noexcept;
+
     /**
      * \brief   Returns the thread ID.
      **/
@@ -300,10 +354,65 @@ public:
     [[nodiscard]]
     inline uint32_t stack_size() const noexcept;
 
+    /**
+     * \brief   Sets the CPU cores, the NUMA node and the scheduling policy of the thread. The
+     *          thread applies them when it starts, the running thread is not changed.
+     *
+     * \param   placement   The placement to apply when the thread starts.
+     **/
+    inline void set_placement( const Thread::ThreadPlacement & placement );
+
+    /**
+     * \brief   Returns the placement the thread applies when it starts.
+     **/
+    [[nodiscard]]
+    inline Thread::ThreadPlacement placement() const;
+
 //////////////////////////////////////////////////////////////////////////
 // static operations
 //////////////////////////////////////////////////////////////////////////
 
+    /**
+     * \brief   Parses the list of CPU cores in the format of Linux 'cpulist': the numbers and
+     *          ranges of numbers separated by commas, for example "0-3,8,10-11".
+     *
+     * \param   cpuList     The list of CPU cores to parse.
+     * \param   result      On output, contains the sorted numbers of the CPU cores without duplicates.
+     * \return  Returns true if the list is not empty and has no syntax error.
+     **/
+    static bool parse_cpu_list( const String & cpuList, std::vector<uint32_t> & result );
+
+    /**
+     * \brief   Parses the name of the scheduling policy: "normal" (or "other"), "fifo",
+     *          "rr" (or "roundrobin"). The case is ignored.
+     *
+     * \param   policy  The name of the scheduling policy.
+     * \return  Returns the scheduling policy, Default if the name is not known.
+     **/
+    [[nodiscard]]
+    static Thread::SchedPolicy parse_sched_policy( const String & policy ) noexcept;
+
+    /**
+     * \brief   Allocates the zero-filled memory block of whole pages of its own, which the OS
+     *          places on the NUMA node when it is first written. The block shares no page with
+     *          other data. Free it with free_node_memory().
+     *
+     * \param   size        The size of the memory block in bytes.
+     * \param   numaNode    The NUMA node to place the pages on, NUMA_NODE_ANY for no node.
+     * \return  Returns the page aligned block. Returns nullptr if the memory is not allocated or
+     *          the OS cannot place it on the node.
+     **/
+    [[nodiscard]]
+    static void * allocate_node_memory( size_t size, int32_t numaNode ) noexcept;
+
+    /**
+     * \brief   Frees the memory block allocated by allocate_node_memory().
+     *
+     * \param   block       The memory block, nullptr is ignored.
+     * \param   size        The size of the block passed to allocate_node_memory().
+     **/
+    static void free_node_memory( void * block, size_t size ) noexcept;
+
     /**
      * \brief   Searches for thread by CRC32 number and returns its pointer. Returns nullptr if not found.
      *
@@ -438,6 +547,13 @@ public:
     [[nodiscard]]
     inline static id_type current_thread_id() noexcept;
 
+    /**
+     * \brief   Returns the ID of the current thread object: the logical ID of the strand whose
+     *          turn runs on the calling thread, otherwise the ID of the calling thread.
+     **/
+    [[nodiscard]]
+    inline static id_type current_logical_id() noexcept;
+
     /**
      * \brief   Returns the thread object of the current thread. The current thread must be registered.
      **/
@@ -550,6 +666,68 @@ protected:
      **/
     static Thread * next_thread( id_type & threadId ) noexcept;
 
+/************************************************************************/
+// Strand support. The executor runs the strand in turns on its threads.
+/************************************************************************/
+    /**
+     * \brief   Starts the thread as a strand instead of creating an OS thread: registers the
+     *          object in the thread maps with a logical ID. The caller then schedules the first
+     *          turn on the executor.
+     *
+     * \return  Returns true if the strand is registered.
+     **/
+    bool strand_register();
+
+    /**
+     * \brief   Waits until the first turn of the strand called strand_begin().
+     *
+     * \param   waitForStartMs  The timeout in milliseconds.
+     * \return  Returns true if the strand started within the timeout.
+     **/
+    bool strand_wait_run( uint32_t waitForStartMs ) noexcept;
+
+    /**
+     * \brief   Called by the executor thread at the beginning of a turn. Makes the strand the
+     *          current thread and the current consumer of the calling OS thread for the turn.
+     *          The startup-phase flag stays in the storage of the OS thread: the threads of the
+     *          executor never set it, and the strand sets and resets it in its first turn.
+     *
+     * \return  Returns the thread object of the executor thread, to pass to strand_leave().
+     **/
+    [[nodiscard]]
+    Thread * strand_enter() noexcept;
+
+    /**
+     * \brief   Called by the executor thread at the end of a turn. Makes the executor thread
+     *          the current thread again.
+     *
+     * \param   executorThread  The thread object returned by strand_enter().
+     **/
+    static void strand_leave( Thread * executorThread ) noexcept;
+
+    /**
+     * \brief   Called in the first turn of the strand. Marks the strand running and calls
+     *          on_pre_run(), which releases the thread waiting in strand_wait_run().
+     *
+     * \return  Returns the result of on_pre_run(), false to stop the strand.
+     **/
+    bool strand_begin();
+
+    /**
+     * \brief   Called in the last turn of the strand. Marks the strand exiting and calls the
+     *          exit callbacks of the consumer and of the thread.
+     *
+     * \return  Returns the exit code of the consumer.
+     **/
+    int32_t strand_end();
+
+    /**
+     * \brief   Called after the last turn of the strand, after strand_leave(). Unregisters the
+     *          strand and signals its completion. This is the last access of the executor to
+     *          the object, which may be deleted right after it.
+     **/
+    void strand_release();
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -588,6 +766,10 @@ protected:
      * \brief   The thread stack size in kilobytes.
      **/
     uint32_t                mStackSizeKB;
+    /**
+     * \brief   The CPU cores, NUMA node and scheduling policy applied when the thread starts.
+     **/
+    ThreadPlacement         mPlacement;
     /**
      * \brief   Object to synchronize data access
      **/
@@ -610,6 +792,8 @@ protected:
     std::atomic<bool>       mExitRequested;
     //!< True while this object is present in the thread maps.
     std::atomic<bool>       mRegistered;
+    //!< True while the thread is started as a strand, see is_strand().
+    std::atomic<bool>       mIsStrand;
     //!< Counts every thread registration and unregistration, see registry_generation().
     static std::atomic<uint32_t> mRegistryGeneration;
 #if defined(_MSC_VER)
@@ -801,12 +985,25 @@ private:
      **/
     Thread::ThreadCompletion _os_destroy_thread( uint32_t waitForStopMs );
 
+    /**
+     * \brief   Stops the strand. A strand cannot be terminated, the timeout leaves it running.
+     * \param   waitForStopMs       Waiting timeout in milliseconds.
+     **/
+    Thread::ThreadCompletion _strand_destroy( uint32_t waitForStopMs );
+
     /**
      * \brief   OS-specific implementation to set thread priority and return the previous priority.
      * \param   newPriority     The new priority level.
      **/
     Thread::ThreadPriority _os_set_priority( ThreadPriority newPriority ) noexcept;
 
+    /**
+     * \brief   OS-specific implementation to apply the placement to the calling thread.
+     *          Called by the started thread before it runs the consumer.
+     * \param   placement   The placement to apply.
+     **/
+    static void _os_apply_placement( const Thread::ThreadPlacement & placement );
+
     /**
      * \brief   OS-specific implementation to yield thread processing time to allow other threads to run.
      **/
@@ -866,7 +1063,7 @@ inline THREADHANDLE Thread::_find_handle( id_type threadId) noexcept
 
 inline bool Thread::_is_valid_no_lock() const noexcept
 {
-    return ((mThreadHandle != INVALID_THREAD_HANDLE) && (mThreadId != 0));
+    return (((mThreadHandle != INVALID_THREAD_HANDLE) || mIsStrand.load(std::memory_order_relaxed)) && (mThreadId != 0));
 }
 
 inline bool Thread::is_running() const noexcept
@@ -880,6 +1077,11 @@ inline bool Thread::is_valid() const noexcept
     return _is_valid_no_lock();
 }
 
+inline bool Thread::is_strand() const noexcept
+{
+    return mIsStrand.load(std::memory_order_acquire);
+}
+
 inline id_type Thread::id() const noexcept
 {
     Lock lock(mSyncObject);
@@ -953,12 +1155,18 @@ inline uint32_t Thread::registry_generation() noexcept
 
 inline String Thread::current_thread_name() noexcept
 {
-    return Thread::thread_name( Thread::_os_thread_id() );
+    return Thread::thread_name( Thread::current_logical_id() );
 }
 
 inline ThreadAddress Thread::current_thread_address() noexcept
 {
-    return Thread::thread_address( Thread::_os_thread_id() );
+    return Thread::thread_address( Thread::current_logical_id() );
+}
+
+inline id_type Thread::current_logical_id() noexcept
+{
+    const Thread * self{ Thread::_self_thread() };
+    return ((self != nullptr) && self->is_strand()) ? self->mThreadId : Thread::_os_thread_id();
 }
 
 inline Thread::ThreadPriority Thread::priority() const noexcept
@@ -1005,6 +1213,23 @@ inline Thread::ThreadPriority Thread::set_priority( ThreadPriority newPriority )
     return _os_set_priority( newPriority );
 }
 
+inline void Thread::set_placement( const Thread::ThreadPlacement & placement )
+{
+    Lock lock(mSyncObject);
+    mPlacement = placement;
+}
+
+inline Thread::ThreadPlacement Thread::placement() const
+{
+    Lock lock(mSyncObject);
+    return mPlacement;
+}
+
+inline bool Thread::ThreadPlacement::is_empty() const noexcept
+{
+    return cpus.is_empty() && (policy == Thread::SchedPolicy::Default) && (numaNode == Thread::NUMA_NODE_ANY);
+}
+
 inline constexpr const char * Thread::as_string( Thread::ThreadPriority threadPriority ) noexcept
 {
     switch ( threadPriority )
@@ -1026,5 +1251,22 @@ inline constexpr const char * Thread::as_string( Thread::ThreadPriority threadPr
     }
 }
 
+inline constexpr const char * Thread::as_string( Thread::SchedPolicy schedPolicy ) noexcept
+{
+    switch ( schedPolicy )
+    {
+    case Thread::SchedPolicy::Default:
+        return "Thread::SchedPolicy::Default";
+    case Thread::SchedPolicy::Normal:
+        return "Thread::SchedPolicy::Normal";
+    case Thread::SchedPolicy::Fifo:
+        return "Thread::SchedPolicy::Fifo";
+    case Thread::SchedPolicy::RoundRobin:
+        return "Thread::SchedPolicy::RoundRobin";
+    default:
+        return "ERR: Invalid Thread::SchedPolicy value!";
+    }
+}
+
 } // namespace areg
 #endif  // AREG_BASE_THREAD_HPP
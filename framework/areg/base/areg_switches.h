@@ -90,6 +90,11 @@
     #define AREG_EXTENDED   0
 #endif  // AREG_EXTENDED
 
+// By default, the sockets on Linux use epoll, not io_uring.
+#if !defined(AREG_IO_URING)
+    #define AREG_IO_URING   0
+#endif  // AREG_IO_URING
+
 // By default, compile with logs
 #ifndef AREG_LOGGING
     #define AREG_LOGGING       1
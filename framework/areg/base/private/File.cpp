@@ -440,6 +440,20 @@ uint32_t File::write(const uint8_t* buffer, uint32_t size) noexcept
     return result;
 }
 
+uint32_t File::write_gather(const areg::IoBuffer* buffers, uint32_t count) noexcept
+{
+    uint32_t result = 0;
+    if (is_opened() && can_write())
+    {
+        if ((buffers != nullptr) && (count > 0))
+        {
+            result = _os_write_gather(buffers, count);
+        }
+    }
+
+    return result;
+}
+
 uint32_t File::set_position(int32_t offset, Cursor::SeekOrigin startAt) const noexcept
 {
     return (is_opened() ? _os_set_position(offset, startAt) : Cursor::INVALID_CURSOR_POSITION);
@@ -0,0 +1,134 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/private/MathDefs.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the CRC kernel selected by the running CPU.
+ ************************************************************************/
+#include "areg/base/MathDefs.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__amd64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define AREG_CRC32C_X86
+    #include <nmmintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#elif defined(__ARM_FEATURE_CRC32)
+    #define AREG_CRC32C_ARM
+    #include <arm_acle.h>
+#endif
+
+namespace
+{
+    //!< The CRC32C kernel.
+    using Crc32Kernel = uint32_t (*)(const uint8_t*, int32_t) noexcept;
+
+    //!< The table kernel, used if the CPU has no CRC32C instruction.
+    uint32_t _crc32c_table(const uint8_t* data, int32_t size) noexcept
+    {
+        return areg::crc32_calculate(data, size);
+    }
+
+#if defined(AREG_CRC32C_X86)
+
+    // The function is compiled for SSE4.2, the rest of the build is not. It runs only if the CPU has it.
+#if !defined(_MSC_VER)
+    __attribute__((target("sse4.2")))
+#endif
+    uint32_t _crc32c_sse42(const uint8_t* data, int32_t size) noexcept
+    {
+        uint32_t crc{ areg::crc32_init() };
+    #if defined(__x86_64__) || defined(__amd64__) || defined(_M_X64)
+        uint64_t crc64{ crc };
+        for (; size >= 8; size -= 8, data += 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+        }
+
+        crc = static_cast<uint32_t>(crc64);
+    #endif
+        for (; size >= 4; size -= 4, data += 4)
+        {
+            uint32_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc = _mm_crc32_u32(crc, word);
+        }
+
+        for (; size > 0; --size, ++data)
+        {
+            crc = _mm_crc32_u8(crc, *data);
+        }
+
+        return areg::crc32_finish(crc);
+    }
+
+    //!< Returns true if the CPU has the SSE4.2 instructions.
+    bool _has_sse42() noexcept
+    {
+    #if defined(_MSC_VER)
+        int info[4]{ 0, 0, 0, 0 };
+        __cpuid(info, 1);
+        return ((info[2] & (1 << 20)) != 0);
+    #else
+        unsigned int eax{ 0u }, ebx{ 0u }, ecx{ 0u }, edx{ 0u };
+        return (__get_cpuid(1u, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & bit_SSE4_2) != 0u);
+    #endif
+    }
+
+#elif defined(AREG_CRC32C_ARM)
+
+    uint32_t _crc32c_arm(const uint8_t* data, int32_t size) noexcept
+    {
+        uint32_t crc{ areg::crc32_init() };
+        for (; size >= 8; size -= 8, data += 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc = __crc32cd(crc, word);
+        }
+
+        for (; size > 0; --size, ++data)
+        {
+            crc = __crc32cb(crc, *data);
+        }
+
+        return areg::crc32_finish(crc);
+    }
+
+#endif
+
+    //!< Selects the fastest kernel the running CPU supports.
+    Crc32Kernel _crc32_select() noexcept
+    {
+    #if defined(AREG_CRC32C_X86)
+        return (_has_sse42() ? &_crc32c_sse42 : &_crc32c_table);
+    #elif defined(AREG_CRC32C_ARM)
+        return &_crc32c_arm;
+    #else
+        return &_crc32c_table;
+    #endif
+    }
+}
+
+namespace areg {
+
+uint32_t crc32_runtime(const uint8_t* data, int32_t size) noexcept
+{
+    static const Crc32Kernel _kernel{ _crc32_select() };
+    return _kernel(data, size);
+}
+
+} // namespace areg
@@ -0,0 +1,489 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/private/RawBufferPool.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, size-classed slab pool for raw buffer blocks.
+ *
+ ************************************************************************/
+#include "areg/base/RawBufferPool.hpp"
+
+#include "areg/base/MemoryDefs.hpp"
+#include "areg/base/SyncPrimitives.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+namespace
+{
+    /**
+     * \brief   Hidden prefix in front of every block returned by RawBufferPool::allocate().
+     *          16 bytes, so the user part keeps the alignment of `new uint8_t[]`.
+     **/
+    struct BlockPrefix
+    {
+        uint32_t    magic;      //!< Guard value, validated on release.
+        uint32_t    sizeClass;  //!< Size class index, or NO_SIZE_CLASS for heap blocks.
+        uint32_t    slotSize;   //!< Full slot size in bytes, including this prefix.
+        uint32_t    reserved;   //!< Padding, keeps the prefix 16 bytes.
+    };
+
+    static_assert(sizeof(BlockPrefix) == 16u, "BlockPrefix must be exactly 16 bytes");
+
+    /**
+     * \brief   A free block in a cache list. Overlays the user part of the block.
+     **/
+    struct FreeNode
+    {
+        FreeNode*   next;
+    };
+
+    constexpr uint32_t  PREFIX_SIZE     { static_cast<uint32_t>(sizeof(BlockPrefix)) };
+    constexpr uint32_t  BLOCK_MAGIC     { 0xA8EB10C5u };
+    constexpr uint32_t  NO_SIZE_CLASS   { 0xFFFFFFFFu };
+
+    //!< The slot sizes of the size classes. Two classes per power of two, all multiple of areg::BLOCK_SIZE.
+    constexpr uint32_t  _slotSizes[areg::RawBufferPool::SIZE_CLASS_COUNT]
+    {
+          256u,   384u,   512u,   768u,  1024u,  1536u,  2048u,  3072u,  4096u
+        , 6144u,  8192u, 12288u, 16384u, 24576u, 32768u, 49152u, 65536u
+    };
+
+    static_assert(_slotSizes[0] == areg::RawBufferPool::MIN_SLOT_SIZE, "The first size class must be MIN_SLOT_SIZE");
+    static_assert(_slotSizes[areg::RawBufferPool::SIZE_CLASS_COUNT - 1u] == areg::RawBufferPool::MAX_SLOT_SIZE, "The last size class must be MAX_SLOT_SIZE");
+    static_assert((areg::RawBufferPool::MIN_SLOT_SIZE % areg::BLOCK_SIZE) == 0u, "Slot sizes must be multiple of areg::BLOCK_SIZE");
+
+    //!< Bytes a single thread cache may keep per size class before spilling to the depot.
+    constexpr uint32_t  THREAD_CACHE_BYTES  { 256u * 1024u };
+    //!< Bytes the shared depot may keep per size class before freeing to the heap.
+    constexpr uint32_t  DEPOT_CACHE_BYTES   { 4u * 1024u * 1024u };
+    //!< Minimum number of blocks a thread cache may keep per size class.
+    constexpr uint32_t  MIN_CACHE_BLOCKS    { 4u };
+    //!< Number of thread cache operations after which the counters are published.
+    constexpr uint32_t  STATS_FLUSH_OPS     { 256u };
+
+    /**
+     * \brief   Returns the size class index of a slot, which fits \a slotSize bytes.
+     *          The caller guarantees slotSize <= MAX_SLOT_SIZE.
+     **/
+    inline uint32_t _size_class(uint32_t slotSize) noexcept
+    {
+        uint32_t result{ 0u };
+        while (_slotSizes[result] < slotSize)
+            ++ result;
+
+        return result;
+    }
+
+    inline uint32_t _cache_limit(uint32_t sizeClass, uint32_t cacheBytes) noexcept
+    {
+        return std::max(MIN_CACHE_BLOCKS, cacheBytes / _slotSizes[sizeClass]);
+    }
+
+    inline BlockPrefix* _prefix(void* block) noexcept
+    {
+        return reinterpret_cast<BlockPrefix*>(reinterpret_cast<uint8_t*>(block) - PREFIX_SIZE);
+    }
+
+    inline uint8_t* _user_block(BlockPrefix* prefix) noexcept
+    {
+        return reinterpret_cast<uint8_t*>(prefix) + PREFIX_SIZE;
+    }
+
+    inline uint8_t* _heap_allocate(uint32_t slotSize, uint32_t sizeClass)
+    {
+        BlockPrefix* prefix = reinterpret_cast<BlockPrefix*>(new uint8_t[slotSize]);
+        prefix->magic       = BLOCK_MAGIC;
+        prefix->sizeClass   = sizeClass;
+        prefix->slotSize    = slotSize;
+        prefix->reserved    = 0u;
+        return _user_block(prefix);
+    }
+
+    inline void _heap_free(FreeNode* node) noexcept
+    {
+        delete [] reinterpret_cast<uint8_t*>(_prefix(node));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Published counters
+    //////////////////////////////////////////////////////////////////////////
+    std::atomic_uint64_t    _statHits       { 0u };
+    std::atomic_uint64_t    _statMisses     { 0u };
+    std::atomic_int64_t     _statRetained   { 0  };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Depot, the shared per size class free list
+    //////////////////////////////////////////////////////////////////////////
+    /**
+     * \brief   The shared depot. Thread caches spill surplus blocks to it and refill
+     *          from it in batches. The depot is intentionally never destroyed, because
+     *          blocks may still be released while static objects are destroyed on exit.
+     **/
+    class Depot
+    {
+    public:
+        struct ClassList
+        {
+            areg::SpinLock  lock    { };
+            FreeNode*       head    { nullptr };
+            uint32_t        count   { 0u };
+        };
+
+        static Depot& instance()
+        {
+            static Depot* _depot{ new Depot() };
+            return *_depot;
+        }
+
+        /**
+         * \brief   Moves a chain of \a count blocks to the depot. Blocks exceeding the
+         *          depot limit are freed to the heap.
+         **/
+        void push(uint32_t sizeClass, FreeNode* first, FreeNode* last, uint32_t count) noexcept
+        {
+            ClassList& list{ mLists[sizeClass] };
+            const uint32_t limit{ _cache_limit(sizeClass, DEPOT_CACHE_BYTES) };
+            FreeNode* surplus{ nullptr };
+            do
+            {
+                areg::Lock lock(list.lock);
+                if (list.count + count <= limit)
+                {
+                    last->next  = list.head;
+                    list.head   = first;
+                    list.count += count;
+                    return;
+                }
+
+                surplus = first;
+            } while (false);
+
+            uint32_t freed{ 0u };
+            while (surplus != nullptr)
+            {
+                FreeNode* next = surplus->next;
+                _heap_free(surplus);
+                surplus = next;
+                ++ freed;
+            }
+
+            _statRetained.fetch_sub(static_cast<int64_t>(freed) * _slotSizes[sizeClass], std::memory_order_relaxed);
+        }
+
+        /**
+         * \brief   Takes up to \a maxCount blocks from the depot.
+         *          Returns the chain head and sets \a count to the number of taken blocks.
+         **/
+        FreeNode* pop(uint32_t sizeClass, uint32_t maxCount, uint32_t& count) noexcept
+        {
+            ClassList& list{ mLists[sizeClass] };
+            areg::Lock lock(list.lock);
+            FreeNode* head{ list.head };
+            FreeNode* last{ nullptr };
+            count = 0u;
+            for (FreeNode* node = head; (node != nullptr) && (count < maxCount); node = node->next)
+            {
+                last = node;
+                ++ count;
+            }
+
+            if (last != nullptr)
+            {
+                list.head   = last->next;
+                list.count -= count;
+                last->next  = nullptr;
+            }
+
+            return (count != 0u ? head : nullptr);
+        }
+
+        /**
+         * \brief   Frees all blocks of the depot to the heap.
+         **/
+        void trim() noexcept
+        {
+            for (uint32_t i = 0u; i < areg::RawBufferPool::SIZE_CLASS_COUNT; ++ i)
+            {
+                FreeNode* head{ nullptr };
+                uint32_t count{ 0u };
+                do
+                {
+                    areg::Lock lock(mLists[i].lock);
+                    head = mLists[i].head;
+                    count = mLists[i].count;
+                    mLists[i].head  = nullptr;
+                    mLists[i].count = 0u;
+                } while (false);
+
+                while (head != nullptr)
+                {
+                    FreeNode* next = head->next;
+                    _heap_free(head);
+                    head = next;
+                }
+
+                _statRetained.fetch_sub(static_cast<int64_t>(count) * _slotSizes[i], std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        Depot() = default;
+
+        ClassList   mLists[areg::RawBufferPool::SIZE_CLASS_COUNT];
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // ThreadCache, the per-thread free lists
+    //////////////////////////////////////////////////////////////////////////
+    /**
+     * \brief   Per-thread free lists, accessed without any lock.
+     **/
+    class ThreadCache
+    {
+    public:
+        ThreadCache() = default;
+
+        ~ThreadCache()
+        {
+            drain();
+            sCacheState = CacheState::Destroyed;
+        }
+
+        //!< The lifetime state of the cache of the calling thread.
+        enum class CacheState : uint8_t
+        {
+              Uninitialized = 0 //!< The cache was not used yet by the thread.
+            , Active            //!< The cache is constructed and usable.
+            , Destroyed         //!< The thread exits, the cache cannot be used anymore.
+        };
+
+        /**
+         * \brief   Returns the cache of the calling thread, or nullptr if the thread
+         *          is exiting and its cache was already destroyed.
+         **/
+        static ThreadCache* current() noexcept
+        {
+            if (sCacheState == CacheState::Destroyed)
+                return nullptr;
+
+            static thread_local ThreadCache _cache;
+            sCacheState = CacheState::Active;
+            return &_cache;
+        }
+
+        inline FreeNode* pop(uint32_t sizeClass) noexcept
+        {
+            ClassList& list{ mLists[sizeClass] };
+            if (list.head == nullptr)
+            {
+                uint32_t count{ 0u };
+                list.head   = Depot::instance().pop(sizeClass, std::max(1u, _cache_limit(sizeClass, THREAD_CACHE_BYTES) / 2u), count);
+                list.count  = count;
+                if (list.head == nullptr)
+                {
+                    _count(mMisses);
+                    return nullptr;
+                }
+            }
+
+            FreeNode* result{ list.head };
+            list.head = result->next;
+            -- list.count;
+            mRetained -= static_cast<int64_t>(_slotSizes[sizeClass]);
+            _count(mHits);
+            return result;
+        }
+
+        inline void push(uint32_t sizeClass, FreeNode* node) noexcept
+        {
+            ClassList& list{ mLists[sizeClass] };
+            node->next  = list.head;
+            list.head   = node;
+            ++ list.count;
+            mRetained  += static_cast<int64_t>(_slotSizes[sizeClass]);
+
+            const uint32_t limit{ _cache_limit(sizeClass, THREAD_CACHE_BYTES) };
+            if (list.count > limit)
+            {
+                _spill(sizeClass, list.count / 2u);
+            }
+        }
+
+        /**
+         * \brief   Moves all cached blocks to the depot and publishes the counters.
+         **/
+        void drain() noexcept
+        {
+            for (uint32_t i = 0u; i < areg::RawBufferPool::SIZE_CLASS_COUNT; ++ i)
+            {
+                _spill(i, mLists[i].count);
+            }
+
+            _publish();
+        }
+
+        /**
+         * \brief   Frees all cached blocks to the heap and publishes the counters.
+         **/
+        void trim() noexcept
+        {
+            for (uint32_t i = 0u; i < areg::RawBufferPool::SIZE_CLASS_COUNT; ++ i)
+            {
+                ClassList& list{ mLists[i] };
+                while (list.head != nullptr)
+                {
+                    FreeNode* next = list.head->next;
+                    _heap_free(list.head);
+                    list.head = next;
+                }
+
+                mRetained -= static_cast<int64_t>(list.count) * _slotSizes[i];
+                list.count = 0u;
+            }
+
+            _publish();
+        }
+
+    private:
+        struct ClassList
+        {
+            FreeNode*   head    { nullptr };
+            uint32_t    count   { 0u };
+        };
+
+        //!< Moves \a count blocks from the head of the list to the depot.
+        void _spill(uint32_t sizeClass, uint32_t count) noexcept
+        {
+            ClassList& list{ mLists[sizeClass] };
+            if ((count == 0u) || (list.head == nullptr))
+                return;
+
+            FreeNode* first{ list.head };
+            FreeNode* last { first };
+            for (uint32_t i = 1u; i < count; ++ i)
+                last = last->next;
+
+            list.head   = last->next;
+            list.count -= count;
+            last->next  = nullptr;
+
+            // The blocks stay retained, they only change the owner.
+            Depot::instance().push(sizeClass, first, last, count);
+        }
+
+        inline void _count(uint32_t& counter) noexcept
+        {
+            ++ counter;
+            if (++ mOps >= STATS_FLUSH_OPS)
+            {
+                _publish();
+            }
+        }
+
+        void _publish() noexcept
+        {
+            _statHits.fetch_add(mHits, std::memory_order_relaxed);
+            _statMisses.fetch_add(mMisses, std::memory_order_relaxed);
+            _statRetained.fetch_add(mRetained, std::memory_order_relaxed);
+            mHits       = 0u;
+            mMisses     = 0u;
+            mRetained   = 0;
+            mOps        = 0u;
+        }
+
+    private:
+        ClassList   mLists[areg::RawBufferPool::SIZE_CLASS_COUNT];
+        uint32_t    mHits       { 0u };
+        uint32_t    mMisses     { 0u };
+        uint32_t    mOps        { 0u };
+        int64_t     mRetained   { 0  };
+
+        static thread_local CacheState  sCacheState;
+    };
+
+    thread_local ThreadCache::CacheState ThreadCache::sCacheState{ ThreadCache::CacheState::Uninitialized };
+}
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// RawBufferPool class implementation
+//////////////////////////////////////////////////////////////////////////
+
+uint8_t* RawBufferPool::allocate(uint32_t size)
+{
+    if (size == 0u)
+        return nullptr;
+
+    const uint32_t slotSize{ areg::align_size(size + PREFIX_SIZE, areg::BLOCK_SIZE) };
+    if (slotSize > RawBufferPool::MAX_SLOT_SIZE)
+    {
+        _statMisses.fetch_add(1u, std::memory_order_relaxed);
+        return _heap_allocate(slotSize, NO_SIZE_CLASS);
+    }
+
+    const uint32_t sizeClass{ _size_class(slotSize) };
+    ThreadCache* cache{ ThreadCache::current() };
+    FreeNode* node{ cache != nullptr ? cache->pop(sizeClass) : nullptr };
+    if (node != nullptr)
+    {
+        return reinterpret_cast<uint8_t*>(node);
+    }
+    else if (cache == nullptr)
+    {
+        _statMisses.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    return _heap_allocate(_slotSizes[sizeClass], sizeClass);
+}
+
+void RawBufferPool::release(void* block) noexcept
+{
+    if (block == nullptr)
+        return;
+
+    BlockPrefix* prefix{ _prefix(block) };
+    ASSERT(prefix->magic == BLOCK_MAGIC);
+    const uint32_t sizeClass{ prefix->sizeClass };
+    ThreadCache* cache{ sizeClass != NO_SIZE_CLASS ? ThreadCache::current() : nullptr };
+    if (cache != nullptr)
+    {
+        cache->push(sizeClass, reinterpret_cast<FreeNode*>(block));
+    }
+    else
+    {
+        delete [] reinterpret_cast<uint8_t*>(prefix);
+    }
+}
+
+RawBufferPool::Stats RawBufferPool::stats() noexcept
+{
+    RawBufferPool::Stats result;
+    const int64_t retained{ _statRetained.load(std::memory_order_relaxed) };
+    result.hits         = _statHits.load(std::memory_order_relaxed);
+    result.misses       = _statMisses.load(std::memory_order_relaxed);
+    result.retainedBytes= retained > 0 ? static_cast<uint64_t>(retained) : 0u;
+    return result;
+}
+
+void RawBufferPool::trim() noexcept
+{
+    ThreadCache* cache{ ThreadCache::current() };
+    if (cache != nullptr)
+    {
+        cache->trim();
+    }
+
+    Depot::instance().trim();
+}
+
+} // namespace areg
@@ -0,0 +1,378 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/private/SharedMemoryChannel.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, two byte rings in a named shared memory segment.
+ *              OS independent part.
+ ************************************************************************/
+#include "areg/base/SharedMemoryChannel.hpp"
+
+#include "areg/base/SocketDefs.hpp"
+#include "areg/base/Thread.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <new>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * \brief   Returns the time point when the wait of the given duration expires.
+     **/
+    inline Clock::time_point _deadline( uint32_t timeoutMs ) noexcept
+    {
+        return (timeoutMs == areg::WAIT_INFINITE ? Clock::time_point::max() : Clock::now() + std::chrono::milliseconds(timeoutMs));
+    }
+
+    /**
+     * \brief   Returns the milliseconds left until the deadline, 0 if it expired.
+     **/
+    inline uint32_t _remaining( const Clock::time_point & deadline ) noexcept
+    {
+        if (deadline == Clock::time_point::max())
+            return areg::WAIT_INFINITE;
+
+        const Clock::time_point now{ Clock::now() };
+        if (now >= deadline)
+            return 0u;
+
+        // Round up, so that a wait of less than a millisecond does not spin.
+        const auto left{ std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1 };
+        return static_cast<uint32_t>(left);
+    }
+
+} // namespace
+
+namespace areg {
+
+SharedMemoryChannel::SharedMemoryChannel() noexcept
+    : mName         ( )
+    , mSegment      ( nullptr )
+    , mSegmentSize  ( 0u )
+    , mHeader       ( nullptr )
+    , mSend         ( )
+    , mRecv         ( )
+    , mHandles      { }
+    , mOwnsName     ( false )
+{
+}
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+    close();
+}
+
+bool SharedMemoryChannel::is_shutdown() const noexcept
+{
+    return ((mHeader == nullptr) || (mHeader->shClosed.load(std::memory_order_acquire) != 0u));
+}
+
+bool SharedMemoryChannel::create( uint32_t sendSize, uint32_t recvSize )
+{
+    close();
+
+    const uint32_t sizeSend{ SharedMemoryChannel::_ring_size(sendSize) };
+    const uint32_t sizeRecv{ SharedMemoryChannel::_ring_size(recvSize) };
+    if (_os_create(SharedMemoryChannel::_segment_size(sizeSend, sizeRecv)) == false)
+        return false;
+
+    mOwnsName = true;
+    mHeader = reinterpret_cast<SegmentHeader *>(mSegment);
+    RingControl * control{ reinterpret_cast<RingControl *>(mSegment + sizeof(SegmentHeader)) };
+    new (mHeader) SegmentHeader{ SEGMENT_MAGIC, SEGMENT_VERSION, {sizeSend, sizeRecv}, {0u} };
+    new (control + 0) RingControl{ };
+    new (control + 1) RingControl{ };
+    _setup_rings(true);
+    return true;
+}
+
+bool SharedMemoryChannel::open( const String & name )
+{
+    close();
+
+    uint32_t size{ 0u };
+    if (_os_open(name, size) == false)
+        return false;
+
+    mHeader = reinterpret_cast<SegmentHeader *>(mSegment);
+    const uint32_t size0{ mHeader->shSizes[0] };
+    const uint32_t size1{ mHeader->shSizes[1] };
+    if ( (size < sizeof(SegmentHeader))
+      || (mHeader->shMagic != SEGMENT_MAGIC)
+      || (mHeader->shVersion != SEGMENT_VERSION)
+      || (SharedMemoryChannel::_ring_size(size0) != size0)
+      || (SharedMemoryChannel::_ring_size(size1) != size1)
+      || (SharedMemoryChannel::_segment_size(size0, size1) > size))
+    {
+        close();
+        return false;
+    }
+
+    _setup_rings(false);
+    return true;
+}
+
+void SharedMemoryChannel::close() noexcept
+{
+    if (mSegment != nullptr)
+    {
+        remove_name();
+        _os_close();
+    }
+
+    mName.clear();
+    mSegment    = nullptr;
+    mSegmentSize= 0u;
+    mHeader     = nullptr;
+    mSend       = Ring{ };
+    mRecv       = Ring{ };
+    mOwnsName   = false;
+}
+
+void SharedMemoryChannel::remove_name() noexcept
+{
+    if (mOwnsName)
+    {
+        mOwnsName = false;
+        _os_remove_name();
+    }
+}
+
+void SharedMemoryChannel::shutdown() noexcept
+{
+    if (mHeader == nullptr)
+        return;
+
+    mHeader->shClosed.store(1u, std::memory_order_seq_cst);
+    for (Ring * ring : { &mSend, &mRecv })
+    {
+        ring->rControl->rcDataBell.fetch_add(1u, std::memory_order_seq_cst);
+        ring->rControl->rcSpaceBell.fetch_add(1u, std::memory_order_seq_cst);
+        _os_wake(ring->rControl->rcDataBell, ring->rBell);
+        _os_wake(ring->rControl->rcSpaceBell, ring->rBell + 1u);
+    }
+}
+
+int32_t SharedMemoryChannel::send( const IoBuffer * buffers, uint32_t count, uint32_t totalSize, uint32_t timeoutMs ) noexcept
+{
+    if (is_shutdown())
+        return -1;
+
+    RingControl & control{ *mSend.rControl };
+    const uint64_t mask{ static_cast<uint64_t>(mSend.rSize) - 1u };
+    uint64_t head{ control.rcHead.load(std::memory_order_relaxed) };
+    uint32_t written{ 0u };
+
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        const uint8_t * data{ buffers[i].data };
+        uint32_t remain{ static_cast<uint32_t>(buffers[i].size) };
+        while (remain != 0u)
+        {
+            uint64_t space{ mSend.rSize - (head - control.rcTail.load(std::memory_order_acquire)) };
+            if (space == 0u)
+            {
+                // Publish the written part, the peer may wait for it to free the space.
+                control.rcHead.store(head, std::memory_order_seq_cst);
+                _ring_bell(mSend, true);
+
+                const Clock::time_point deadline{ _deadline(timeoutMs) };
+                do
+                {
+                    const uint32_t waitMs{ _remaining(deadline) };
+                    if ((waitMs == 0u) || is_shutdown())
+                        return -1;
+
+                    _park(mSend, false, waitMs);
+                    space = mSend.rSize - (head - control.rcTail.load(std::memory_order_acquire));
+                } while (space == 0u);
+            }
+
+            const uint32_t chunk{ static_cast<uint32_t>(std::min<uint64_t>(space, remain)) };
+            const uint32_t offset{ static_cast<uint32_t>(head & mask) };
+            const uint32_t first{ std::min<uint32_t>(chunk, mSend.rSize - offset) };
+            std::memcpy(mSend.rData + offset, data, first);
+            std::memcpy(mSend.rData, data + first, chunk - first);
+            head   += chunk;
+            data   += chunk;
+            remain -= chunk;
+            written+= chunk;
+        }
+    }
+
+    control.rcHead.store(head, std::memory_order_seq_cst);
+    _ring_bell(mSend, true);
+    return (totalSize == 0u) || (written == totalSize) ? static_cast<int32_t>(written) : -1;
+}
+
+int32_t SharedMemoryChannel::try_send( const IoBuffer * buffers, uint32_t count, uint32_t totalSize ) noexcept
+{
+    if (is_shutdown())
+        return -1;
+
+    if (totalSize == 0u)
+    {
+        for (uint32_t i = 0u; i < count; ++ i)
+        {
+            totalSize += static_cast<uint32_t>(buffers[i].size);
+        }
+    }
+
+    RingControl & control{ *mSend.rControl };
+    const uint64_t head{ control.rcHead.load(std::memory_order_relaxed) };
+    if (mSend.rSize - (head - control.rcTail.load(std::memory_order_acquire)) < totalSize)
+        return 0;
+
+    return send(buffers, count, totalSize, 0u);
+}
+
+int32_t SharedMemoryChannel::receive( uint8_t * buffer, uint32_t size, uint32_t timeoutMs ) noexcept
+{
+    if (mHeader == nullptr)
+        return -1;
+
+    RingControl & control{ *mRecv.rControl };
+    const uint64_t mask{ static_cast<uint64_t>(mRecv.rSize) - 1u };
+    uint64_t tail{ control.rcTail.load(std::memory_order_relaxed) };
+    uint32_t remain{ size };
+
+    while (remain != 0u)
+    {
+        uint64_t avail{ control.rcHead.load(std::memory_order_acquire) - tail };
+        if (avail == 0u)
+        {
+            const Clock::time_point deadline{ _deadline(timeoutMs) };
+            do
+            {
+                const uint32_t waitMs{ _remaining(deadline) };
+                if ((waitMs == 0u) || is_shutdown())
+                    return -1;
+
+                _park(mRecv, true, waitMs);
+                avail = control.rcHead.load(std::memory_order_acquire) - tail;
+            } while (avail == 0u);
+        }
+
+        const uint32_t chunk{ static_cast<uint32_t>(std::min<uint64_t>(avail, remain)) };
+        const uint32_t offset{ static_cast<uint32_t>(tail & mask) };
+        const uint32_t first{ std::min<uint32_t>(chunk, mRecv.rSize - offset) };
+        std::memcpy(buffer, mRecv.rData + offset, first);
+        std::memcpy(buffer + first, mRecv.rData, chunk - first);
+        tail   += chunk;
+        buffer += chunk;
+        remain -= chunk;
+
+        control.rcTail.store(tail, std::memory_order_seq_cst);
+        _ring_bell(mRecv, false);
+    }
+
+    return static_cast<int32_t>(size);
+}
+
+uint32_t SharedMemoryChannel::size_readable() const noexcept
+{
+    if (mHeader == nullptr)
+        return 0u;
+
+    const RingControl & control{ *mRecv.rControl };
+    return static_cast<uint32_t>(control.rcHead.load(std::memory_order_acquire) - control.rcTail.load(std::memory_order_relaxed));
+}
+
+bool SharedMemoryChannel::wait_readable( uint32_t timeoutMs ) noexcept
+{
+    if (size_readable() != 0u)
+        return true;
+
+    const Clock::time_point deadline{ _deadline(timeoutMs) };
+    while (size_readable() == 0u)
+    {
+        const uint32_t waitMs{ _remaining(deadline) };
+        if ((waitMs == 0u) || is_shutdown())
+            return false;
+
+        _park(mRecv, true, waitMs);
+    }
+
+    return true;
+}
+
+void SharedMemoryChannel::_setup_rings( bool isCreator ) noexcept
+{
+    RingControl * control{ reinterpret_cast<RingControl *>(mSegment + sizeof(SegmentHeader)) };
+    uint8_t * data{ reinterpret_cast<uint8_t *>(control + 2) };
+
+    Ring ring0{ control + 0, data, mHeader->shSizes[0], 0u };
+    Ring ring1{ control + 1, data + mHeader->shSizes[0], mHeader->shSizes[1], 2u };
+    mSend = isCreator ? ring0 : ring1;
+    mRecv = isCreator ? ring1 : ring0;
+}
+
+void SharedMemoryChannel::_park( Ring & ring, bool dataBell, uint32_t timeoutMs ) noexcept
+{
+    RingControl & control{ *ring.rControl };
+    const auto isReady = [&control, &ring, dataBell]() -> bool
+        {
+            const uint64_t used{ control.rcHead.load(std::memory_order_seq_cst) - control.rcTail.load(std::memory_order_seq_cst) };
+            return (dataBell ? used != 0u : used < ring.rSize);
+        };
+
+    for (uint32_t i = 0u; i < SPIN_COUNT; ++ i)
+    {
+        if (isReady() || is_shutdown())
+            return;
+
+        Thread::cpu_pause();
+    }
+
+    std::atomic<uint32_t> & bell{ dataBell ? control.rcDataBell : control.rcSpaceBell };
+    std::atomic<uint32_t> & waiters{ dataBell ? control.rcDataWaiters : control.rcSpaceWaiters };
+    const uint32_t value{ bell.load(std::memory_order_seq_cst) };
+    waiters.fetch_add(1u, std::memory_order_seq_cst);
+    if ((isReady() == false) && (is_shutdown() == false))
+    {
+        // The wait returns at once if the peer changed the bell after it was read.
+        _os_wait(bell, value, ring.rBell + (dataBell ? 0u : 1u), timeoutMs);
+    }
+
+    waiters.fetch_sub(1u, std::memory_order_seq_cst);
+}
+
+void SharedMemoryChannel::_ring_bell( Ring & ring, bool dataBell ) noexcept
+{
+    RingControl & control{ *ring.rControl };
+    std::atomic<uint32_t> & bell{ dataBell ? control.rcDataBell : control.rcSpaceBell };
+    std::atomic<uint32_t> & waiters{ dataBell ? control.rcDataWaiters : control.rcSpaceWaiters };
+    bell.fetch_add(1u, std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_seq_cst) != 0u)
+    {
+        _os_wake(bell, ring.rBell + (dataBell ? 0u : 1u));
+    }
+}
+
+uint32_t SharedMemoryChannel::_segment_size( uint32_t sendSize, uint32_t recvSize ) noexcept
+{
+    return static_cast<uint32_t>(sizeof(SegmentHeader) + 2u * sizeof(RingControl)) + sendSize + recvSize;
+}
+
+uint32_t SharedMemoryChannel::_ring_size( uint32_t size ) noexcept
+{
+    uint32_t result{ MIN_RING_SIZE };
+    while ((result < size) && (result < MAX_RING_SIZE))
+    {
+        result <<= 1u;
+    }
+
+    return result;
+}
+
+} // namespace areg
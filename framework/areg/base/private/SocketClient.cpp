@@ -68,7 +68,8 @@ bool SocketClient::create_fd()
 
     if ( mAddress.is_valid() )
     {
-        const SOCKETHANDLE hSocket = areg::socket_create();
+        mIsLocal = !mLocalFailed && areg::local_socket_exists(mLocalPath);
+        const SOCKETHANDLE hSocket = mIsLocal ? areg::local_socket_create() : areg::socket_create();
         if ( hSocket != areg::InvalidSocketHandle )
         {
             mSocket   = SocketHandle(hSocket);
@@ -85,15 +86,30 @@ bool SocketClient::connect_to()
     if ( !is_valid() || !mAddress.is_valid() )
         return false;
 
-    if ( !areg::client_connect_fd(handle(), mAddress) )
+    const bool connected{ mIsLocal ? areg::local_connect_fd(handle(), mLocalPath) : areg::client_connect_fd(handle(), mAddress) };
+    if ( !connected )
     {
+        // A path left by a server, which did not exit cleanly, or a server without local socket:
+        // the next attempt connects via TCP.
+        mLocalFailed = mIsLocal;
         close();
         return false;
     }
 
+    mLocalFailed = false;
+
     mSendSize = areg::max_send_size(handle());
     mRecvSize = areg::max_receive_size(handle());
     return true;
 }
 
+void SocketClient::set_local_path(const String & path)
+{
+    if (path != mLocalPath)
+    {
+        mLocalPath   = path;
+        mLocalFailed = false;
+    }
+}
+
 } // namespace areg
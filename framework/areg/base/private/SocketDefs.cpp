@@ -14,13 +14,16 @@
  ************************************************************************/
 #include "areg/base/SocketDefs.hpp"
 
+#include "areg/base/File.hpp"
 #include "areg/base/MemoryDefs.hpp"
 #include "areg/base/SocketMultiplexer.hpp"
 #include "areg/base/Thread.hpp"
+#include "areg/base/private/linux/IoUring.hpp"
 #include "areg/appbase/Application.hpp"
 
 #include "areg/logging/areg_log.h"
 
+#include <algorithm>
 #include <cstring>
 
 #ifdef   _WIN32
@@ -32,6 +35,7 @@
     #endif  // NOMINMAX
     #include <WinSock2.h>
     #include <WS2tcpip.h>
+    #include <afunix.h>
 #else
     #include <arpa/inet.h>
     #include <ctype.h>      // IEEE Std 1003.1-2001
@@ -41,9 +45,11 @@
     #include <poll.h>
     #include <sys/socket.h>
     #include <sys/ioctl.h>
+    #include <sys/un.h>
     #include <unistd.h>
 #endif
 
+#include <filesystem>
 #include <regex>
 #include <unordered_map>
 
@@ -111,6 +117,38 @@ namespace areg::os {
      **/
     int32_t _os_recv_data_window(SOCKETHANDLE hSocket, uint8_t* dataBuffer, int32_t dataLength);
 
+    /**
+     * \brief   OS specific single receive: waits until any data arrives and takes at most
+     *          \a dataLength bytes, does not wait to fill the buffer.
+     * \return  Returns number of bytes received; negative on error or peer disconnect.
+     **/
+    int32_t _os_recv_some(SOCKETHANDLE hSocket, uint8_t* dataBuffer, int32_t dataLength);
+
+    /**
+     * \brief   OS specific switch of the socket to the zero-copy send.
+     * \return  Returns true if the socket sends without copying.
+     **/
+    bool _os_zerocopy_enable(SOCKETHANDLE hSocket) noexcept;
+
+    /**
+     * \brief   OS specific zero-copy send. All checkups and validations should be done before
+     *          calling the method.
+     * \return  Returns number of bytes sent without copying; negative on error.
+     **/
+    int32_t _os_send_data_zerocopy(SOCKETHANDLE hSocket, const uint8_t* dataBuffer, int32_t dataLength, uint32_t& sends) noexcept;
+
+    /**
+     * \brief   OS specific read of the zero-copy completions from the error queue.
+     * \return  Returns the number of the completions read; negative on error.
+     **/
+    int32_t _os_zerocopy_completions(SOCKETHANDLE hSocket, areg::ZeroCopyDone* done, uint32_t count, uint32_t timeoutMs) noexcept;
+
+    /**
+     * \brief   OS specific second handle of the socket, which reads the zero-copy completions.
+     * \return  Returns the new handle; InvalidSocketHandle on error.
+     **/
+    SOCKETHANDLE _os_zerocopy_retain(SOCKETHANDLE hSocket) noexcept;
+
     /**
      * \brief   OS specific implementation of socket control call.
      * \return  Returns true if operation succeeded.
@@ -124,6 +162,12 @@ namespace areg::os {
      **/
     bool _os_get_option(SOCKETHANDLE hSocket, int32_t level, int32_t name, unsigned long & value);
 
+    /**
+     * \brief   OS specific wait for the socket to become readable or closed.
+     * \return  Returns true if the socket has data to read, is closed by the peer or failed.
+     **/
+    bool _os_wait_readable(SOCKETHANDLE hSocket, uint32_t timeoutMs);
+
     /**
      * \brief   OS specific non-blocking connect with timeout.
      *          Sets the socket to non-blocking mode, initiates a connect, then waits
@@ -142,6 +186,44 @@ namespace areg::os {
      **/
     void _os_configure_connected_socket(SOCKETHANDLE hSocket) noexcept;
 
+    /**
+     * \brief   OS specific setup of a new UDP socket: switches it to the non-blocking mode.
+     * \return  Returns true if the socket is ready to bind.
+     **/
+    bool _os_datagram_configure(SOCKETHANDLE hSocket) noexcept;
+
+    /**
+     * \brief   OS specific non-blocking send of a batch of datagrams. All checkups and
+     *          validations should be done before calling the method.
+     * \return  Returns the number of sent datagrams; negative if the socket failed.
+     **/
+    int32_t _os_datagram_send(SOCKETHANDLE hSocket, const areg::DatagramOut* datagrams, uint32_t count) noexcept;
+
+    /**
+     * \brief   OS specific non-blocking receive of the available datagrams. All checkups and
+     *          validations should be done before calling the method.
+     * \return  Returns the number of received datagrams; negative if the socket failed.
+     **/
+    int32_t _os_datagram_receive(SOCKETHANDLE hSocket, areg::DatagramIn* datagrams, uint32_t count) noexcept;
+
+    /**
+     * \brief   OS specific directory of the local sockets, which only the current user can
+     *          access. Creates the directory if needed.
+     * \return  Returns the path of the directory; empty if no private directory is available.
+     **/
+    areg::String _os_local_socket_dir();
+
+    /**
+     * \brief   OS specific check that the local socket \a path is a socket of the current user.
+     **/
+    bool _os_local_socket_owned(const areg::String& path) noexcept;
+
+    /**
+     * \brief   OS specific check that the process on the other side of the connected local
+     *          socket runs as the current user.
+     **/
+    bool _os_local_peer_owned(SOCKETHANDLE hSocket) noexcept;
+
 } // namespace areg::os
 
 namespace
@@ -157,6 +239,21 @@ namespace
         static thread_local std::unordered_map<SOCKETHANDLE, areg::ThreadCache> _rx_caches;
         return _rx_caches;
     }
+
+    /**
+     * \brief   Fills the address of the local socket \a path.
+     * \return  Returns the length of the address, or zero if the path is empty or too long.
+     **/
+    socklen_t _local_address(const areg::String& path, sockaddr_un& addr) noexcept
+    {
+        areg::mem_zero(&addr, sizeof(sockaddr_un));
+        addr.sun_family = AF_UNIX;
+        if (path.is_empty() || (static_cast<uint32_t>(path.length()) >= sizeof(addr.sun_path)))
+            return 0;
+
+        std::memcpy(addr.sun_path, path.as_string(), static_cast<size_t>(path.length()));
+        return static_cast<socklen_t>(sizeof(sockaddr_un));
+    }
 }
 
 
@@ -437,6 +534,7 @@ bool areg::UserData::is_valid() const noexcept
 //////////////////////////////////////////////////////////////////////////
 DEF_LOG_SCOPE(areg_base_areg, client_connect);
 DEF_LOG_SCOPE(areg_base_areg, server_connect);
+DEF_LOG_SCOPE(areg_base_areg, local_server_connect);
 DEF_LOG_SCOPE(areg_base_areg, set_recv_size);
 
 AREG_API_IMPL uint32_t areg::thread_cache_size() noexcept
@@ -454,6 +552,21 @@ AREG_API_IMPL uint32_t areg::send_batch_limit() noexcept
     return configured;
 }
 
+AREG_API_IMPL uint32_t areg::send_batch_wait() noexcept
+{
+    const uint32_t configured{ Application::config_manager().network_batch_wait() };
+    return (configured > areg::MAX_SEND_BATCH_WAIT_US ? areg::MAX_SEND_BATCH_WAIT_US : configured);
+}
+
+AREG_API_IMPL uint32_t areg::zerocopy_threshold() noexcept
+{
+    const uint32_t configured{ Application::config_manager().network_zerocopy() };
+    if (configured == 0u)
+        return 0u;
+
+    const uint32_t threshold{ configured < (areg::MAX_SEND_BATCH_BYTES / areg::ONE_KILOBYTE) ? configured * areg::ONE_KILOBYTE : areg::MAX_SEND_BATCH_BYTES };
+    return std::max(threshold, areg::MIN_ZEROCOPY_BLOCK);
+}
 
 AREG_API_IMPL SOCKETHANDLE areg::socket_create() noexcept
 {
@@ -478,6 +591,9 @@ AREG_API_IMPL void areg::socket_configure(SOCKETHANDLE hSocket) noexcept
 AREG_API_IMPL void areg::socket_set_no_delay(SOCKETHANDLE hSocket) noexcept
 {
     ASSERT(is_valid_socket(hSocket));
+    if (areg::is_local_socket(hSocket))
+        return;
+
     // Disable Nagle algorithm, small RPC messages are sent immediately
     // Only meaningful on connected sockets, do NOT call on listening sockets.
     constexpr int32_t noDelay{ 1 };
@@ -862,6 +978,183 @@ AREG_API_IMPL SOCKETHANDLE areg::server_accept(SOCKETHANDLE serverSocket, const
     return result;
 }
 
+AREG_API_IMPL areg::String areg::local_socket_path(uint16_t portNr)
+{
+    const String dir{ areg::os::_os_local_socket_dir() };
+    if (dir.is_empty())
+        return String();
+
+    String name;
+    name.format("areg.%u.sock", static_cast<uint32_t>(portNr));
+    return String((std::filesystem::path(dir.as_string()) / name.as_string()).string());
+}
+
+AREG_API_IMPL bool areg::local_socket_exists(const String& path) noexcept
+{
+    std::error_code err;
+    return (!path.is_empty() && std::filesystem::exists(path.as_string(), err));
+}
+
+AREG_API_IMPL void areg::local_socket_remove(const String& path) noexcept
+{
+    std::error_code err;
+    if (!path.is_empty())
+    {
+        std::filesystem::remove(path.as_string(), err);
+    }
+}
+
+AREG_API_IMPL SOCKETHANDLE areg::local_socket_create() noexcept
+{
+    return static_cast<SOCKETHANDLE>( socket(AF_UNIX, SOCK_STREAM, 0) );
+}
+
+AREG_API_IMPL bool areg::is_local_socket(SOCKETHANDLE hSocket) noexcept
+{
+    struct sockaddr_storage addr;
+    areg::mem_zero(&addr, sizeof(sockaddr_storage));
+    socklen_t len = sizeof(sockaddr_storage);
+    return (::getsockname(hSocket, reinterpret_cast<sockaddr *>(&addr), &len) == areg::RETURNED_OK) && (addr.ss_family == AF_UNIX);
+}
+
+AREG_API_IMPL bool areg::local_connect_fd(SOCKETHANDLE hSocket, const String& path)
+{
+    sockaddr_un localAddr;
+    const socklen_t len{ _local_address(path, localAddr) };
+
+    // Another user may not stand in for the server: both the path and the peer must be ours.
+    return areg::is_valid_socket(hSocket) && (len != 0) && areg::os::_os_local_socket_owned(path) &&
+           areg::os::_os_connect_socket(hSocket, &localAddr, static_cast<uint32_t>(len), SOCKET_CONNECT_TIMEOUT_MS) &&
+           areg::os::_os_local_peer_owned(hSocket);
+}
+
+AREG_API_IMPL SOCKETHANDLE areg::local_server_connect(const String& path)
+{
+    LOG_SCOPE( areg_base_areg, local_server_connect );
+
+    sockaddr_un localAddr;
+    const socklen_t len{ _local_address(path, localAddr) };
+    if (len == 0)
+    {
+        LOG_ERR("The local socket path [ %s ] is empty or too long, no local server is created", path.as_string());
+        return areg::InvalidSocketHandle;
+    }
+
+    SOCKETHANDLE result = areg::local_socket_create();
+    if ( result != areg::InvalidSocketHandle )
+    {
+        // The server owns the TCP port, the path is left by a server, which did not exit cleanly.
+        areg::local_socket_remove(path);
+        areg::socket_configure(result);
+        if (areg::RETURNED_OK != bind(result, reinterpret_cast<sockaddr *>(&localAddr), len))
+        {
+            LOG_ERR("Server failed to bind the local socket [ %s ]. Closing socket [ %u ]"
+                        , path.as_string()
+                        , static_cast<uint32_t>(result));
+
+            areg::socket_close( result );
+            result = areg::InvalidSocketHandle;
+        }
+        else
+        {
+            LOG_DBG("Server socket [ %u ] succeeded to bind the local socket [ %s ]. Ready to listen."
+                        , static_cast<uint32_t>(result)
+                        , path.as_string());
+        }
+    }
+    else
+    {
+        LOG_ERR("Failed to create local socket, cannot create server!");
+    }
+
+    return result;
+}
+
+AREG_API_IMPL SOCKETHANDLE areg::local_server_accept(SOCKETHANDLE serverSocket) noexcept
+{
+    if (serverSocket == areg::InvalidSocketHandle)
+        return areg::InvalidSocketHandle;
+
+    SOCKETHANDLE result = ::accept(serverSocket, nullptr, nullptr);
+    if (result != areg::InvalidSocketHandle)
+    {
+        areg::socket_configure(result);
+    }
+
+    return result;
+}
+
+AREG_API_IMPL bool areg::datagram_endpoint(const String& hostName, uint16_t portNr, DatagramEndpoint& endpoint)
+{
+    endpoint.port   = htons(portNr);
+    endpoint.address= htonl(INADDR_ANY);
+    if (hostName.is_empty())
+        return true;
+
+    const String ipAddress{ areg::is_ip_address(hostName) ? hostName : areg::host_to_ip(hostName) };
+    struct in_addr addr;
+    areg::mem_zero(&addr, sizeof(in_addr));
+    if (ipAddress.is_empty() || (::inet_pton(AF_INET, ipAddress.as_string(), &addr) != 1))
+        return false;
+
+    endpoint.address = static_cast<uint32_t>(addr.s_addr);
+    return true;
+}
+
+AREG_API_IMPL SOCKETHANDLE areg::datagram_socket_create(const String& hostName, uint16_t portNr)
+{
+    DatagramEndpoint endpoint{ };
+    if (areg::datagram_endpoint(hostName, portNr, endpoint) == false)
+        return areg::InvalidSocketHandle;
+
+    SOCKETHANDLE result = static_cast<SOCKETHANDLE>( ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP) );
+    if (result == areg::InvalidSocketHandle)
+        return areg::InvalidSocketHandle;
+
+    struct sockaddr_in addr;
+    areg::mem_zero(&addr, sizeof(sockaddr_in));
+    addr.sin_family     = AF_INET;
+    addr.sin_port       = endpoint.port;
+    addr.sin_addr.s_addr= endpoint.address;
+    if ((areg::os::_os_datagram_configure(result) == false) ||
+        (::bind(result, reinterpret_cast<const sockaddr *>(&addr), sizeof(sockaddr_in)) != areg::RETURNED_OK))
+    {
+        areg::os::_os_close_socket(result);
+        result = areg::InvalidSocketHandle;
+    }
+
+    return result;
+}
+
+AREG_API_IMPL uint16_t areg::datagram_socket_port(SOCKETHANDLE hSocket) noexcept
+{
+    struct sockaddr_in addr;
+    areg::mem_zero(&addr, sizeof(sockaddr_in));
+    socklen_t len = sizeof(sockaddr_in);
+    return (areg::is_valid_socket(hSocket) && (::getsockname(hSocket, reinterpret_cast<sockaddr *>(&addr), &len) == areg::RETURNED_OK) && (addr.sin_family == AF_INET)
+            ? ntohs(addr.sin_port)
+            : areg::InvalidPort);
+}
+
+AREG_API_IMPL int32_t areg::datagram_send(SOCKETHANDLE hSocket, const DatagramOut* datagrams, uint32_t count) noexcept
+{
+    if (areg::is_valid_socket(hSocket) == false)
+        return -1;
+
+    return ((datagrams != nullptr) && (count != 0u) ? areg::os::_os_datagram_send(hSocket, datagrams, count) : 0);
+}
+
+AREG_API_IMPL int32_t areg::datagram_receive(SOCKETHANDLE hSocket, DatagramIn* datagrams, uint32_t count, uint32_t timeoutMs) noexcept
+{
+    if (areg::is_valid_socket(hSocket) == false)
+        return -1;
+
+    if ((datagrams == nullptr) || (count == 0u) || (areg::os::_os_wait_readable(hSocket, timeoutMs) == false))
+        return 0;
+
+    return areg::os::_os_datagram_receive(hSocket, datagrams, count);
+}
+
 AREG_API_IMPL bool areg::is_socket_alive(SOCKETHANDLE hSocket) noexcept
 {
     unsigned long error = 0;
@@ -874,6 +1167,11 @@ AREG_API_IMPL uint32_t areg::pending_read(SOCKETHANDLE hSocket) noexcept
     return (areg::is_valid_socket(hSocket) && areg::os::_os_control(hSocket, FIONREAD, result) ? static_cast<uint32_t>(result) : 0);
 }
 
+AREG_API_IMPL bool areg::is_socket_readable(SOCKETHANDLE hSocket, uint32_t timeoutMs /*= 0u*/) noexcept
+{
+    return (areg::is_valid_socket(hSocket) == false) || areg::os::_os_wait_readable(hSocket, timeoutMs);
+}
+
 AREG_API_IMPL bool areg::socket_initialize() noexcept
 {
     return areg::os::_os_init_socket();
@@ -941,15 +1239,47 @@ AREG_API_IMPL int32_t areg::try_send_data_v(SOCKETHANDLE hSocket, const areg::Io
     return areg::os::_os_try_send_data_v(hSocket, buffers, count, totalSize);
 }
 
+AREG_API_IMPL void areg::send_data_groups(areg::IoGroup* groups, uint32_t count, [[maybe_unused]] uint32_t timeoutMs) noexcept
+{
+    if ((groups == nullptr) || (count == 0u))
+        return;
+
+#if defined(__linux__) && (AREG_IO_URING != 0)
+    if (areg::os::ring_send_data_groups(groups, count, timeoutMs))
+        return;
+#endif  // defined(__linux__) && (AREG_IO_URING != 0)
+
+    for (uint32_t i = 0u; i < count; ++i)
+    {
+        areg::IoGroup & group{ groups[i] };
+        group.result = areg::send_data_v(group.socket, group.buffers, group.count, group.totalSize);
+    }
+}
+
 AREG_API_IMPL areg::SocketWriter & areg::SocketWriter::writer_of(SOCKETHANDLE hSocket) noexcept
 {
     static areg::SocketWriter _writers[areg::SOCKET_WRITER_SLOTS];
     return _writers[static_cast<uint32_t>(hSocket) & (areg::SOCKET_WRITER_SLOTS - 1u)];
 }
 
+namespace
+{
+    //!< The writer lock owned by the calling thread, if any.
+    thread_local const areg::SocketWriter * _ownedWriter{ nullptr };
+}
+
 AREG_API_IMPL bool areg::SocketWriter::try_acquire() noexcept
 {
-    return (mBusy.exchange(true, std::memory_order_acquire) == false);
+    if (mBusy.exchange(true, std::memory_order_acquire))
+        return false;
+
+    _ownedWriter = this;
+    return true;
+}
+
+AREG_API_IMPL bool areg::SocketWriter::is_owner() const noexcept
+{
+    return (_ownedWriter == this);
 }
 
 AREG_API_IMPL void areg::SocketWriter::acquire() noexcept
@@ -969,10 +1299,13 @@ AREG_API_IMPL void areg::SocketWriter::acquire() noexcept
             Thread::switch_thread();
         }
     }
+
+    _ownedWriter = this;
 }
 
 AREG_API_IMPL void areg::SocketWriter::release() noexcept
 {
+    _ownedWriter = nullptr;
     mBusy.store(false, std::memory_order_release);
 }
 
@@ -1007,15 +1340,104 @@ AREG_API_IMPL uint32_t areg::recv_data_available(SOCKETHANDLE hSocket) noexcept
     if (tc.unread == 0u)
         return 0u;
 
-    if (tc.unread < static_cast<uint32_t>(sizeof(areg::EventHeader)))
+    // The compact header is the shortest one, it holds the size of either kind of frame.
+    if (tc.unread < static_cast<uint32_t>(sizeof(areg::CompactHeader)))
         return 0u;
 
-    areg::BufferHeader bufHeader{ };
-    std::memcpy(&bufHeader, tc.buffer.get() + tc.head, sizeof(areg::BufferHeader));
-    const uint32_t msg_total = static_cast<uint32_t>(sizeof(areg::EventHeader)) + bufHeader.biUsed;
+    const uint32_t msg_total = areg::wire_frame_size(tc.buffer.get() + tc.head);
     return (tc.unread >= msg_total) ? tc.unread : 0u;
 }
 
+AREG_API_IMPL bool areg::zerocopy_enable(SOCKETHANDLE hSocket) noexcept
+{
+    return areg::is_valid_socket(hSocket) && !areg::is_local_socket(hSocket) && areg::os::_os_zerocopy_enable(hSocket);
+}
+
+AREG_API_IMPL int32_t areg::send_data_zerocopy(SOCKETHANDLE hSocket, const uint8_t* dataBuffer, uint32_t dataLength, uint32_t& sends) noexcept
+{
+    sends = 0u;
+    if (!areg::is_valid_socket(hSocket))
+        return -1;
+
+    if ((dataBuffer == nullptr) || (dataLength == 0u))
+        return 0;
+
+    return areg::os::_os_send_data_zerocopy(hSocket, dataBuffer, static_cast<int32_t>(dataLength), sends);
+}
+
+AREG_API_IMPL int32_t areg::zerocopy_completions(SOCKETHANDLE hSocket, areg::ZeroCopyDone* done, uint32_t count, uint32_t timeoutMs) noexcept
+{
+    if (!areg::is_valid_socket(hSocket))
+        return -1;
+
+    return ((done != nullptr) && (count != 0u) ? areg::os::_os_zerocopy_completions(hSocket, done, count, timeoutMs) : 0);
+}
+
+AREG_API_IMPL SOCKETHANDLE areg::zerocopy_retain(SOCKETHANDLE hSocket) noexcept
+{
+    return (areg::is_valid_socket(hSocket) ? areg::os::_os_zerocopy_retain(hSocket) : areg::InvalidSocketHandle);
+}
+
+AREG_API_IMPL int32_t areg::receive_frame(SOCKETHANDLE hSocket, const uint8_t*& frame) noexcept
+{
+    frame = nullptr;
+    if ((areg::receive_mode() == areg::ReceiveMode::NoCache) || !areg::is_valid_socket(hSocket))
+        return 0;
+
+    areg::ThreadCache& tc = areg::thread_rx_cache(hSocket);
+    uint8_t* const cache = tc.cache();
+    if ((cache == nullptr) || (tc.space < static_cast<uint32_t>(sizeof(areg::EventHeader))))
+        return 0;
+
+    constexpr uint32_t minSize{ static_cast<uint32_t>(sizeof(areg::CompactHeader)) };
+    uint32_t frameSize{ 0u };
+    while ((frameSize == 0u) || (tc.unread < frameSize))
+    {
+        if (tc.unread >= minSize)
+        {
+            frameSize = areg::wire_frame_size(cache + tc.head);
+            if ((frameSize < minSize) || (frameSize > tc.space))
+                return 0;   // Not a frame to decode in place, received by the caller.
+            else if (tc.unread >= frameSize)
+                break;
+        }
+
+        // The partial frame moves to the front only if the rest does not fit behind it.
+        const uint32_t needed{ frameSize != 0u ? frameSize : minSize };
+        if ((tc.head != 0u) && ((tc.head + needed) > tc.space))
+        {
+            ::memmove(cache, cache + tc.head, tc.unread);
+            tc.head = 0u;
+        }
+
+        const uint32_t tail{ tc.head + tc.unread };
+        const int32_t filled{ areg::os::_os_recv_some(hSocket, cache + tail, static_cast<int32_t>(tc.space - tail)) };
+        if (filled <= 0)
+        {
+            tc.head   = 0u;
+            tc.unread = 0u;
+            return -1;
+        }
+
+        tc.unread += static_cast<uint32_t>(filled);
+    }
+
+    frame = cache + tc.head;
+    return static_cast<int32_t>(frameSize);
+}
+
+AREG_API_IMPL void areg::receive_frame_done(SOCKETHANDLE hSocket, uint32_t frameSize) noexcept
+{
+    areg::ThreadCache& tc = areg::thread_rx_cache(hSocket);
+    const uint32_t consumed{ std::min(frameSize, tc.unread) };
+    tc.head   += consumed;
+    tc.unread -= consumed;
+    if (tc.unread == 0u)
+    {
+        tc.head = 0u;
+    }
+}
+
 AREG_API_IMPL bool areg::disable_send(SOCKETHANDLE hSocket) noexcept
 {
 #ifdef _WIN32
@@ -19,6 +19,8 @@
 #include "areg/base/ThreadLocalStorage.hpp"
 
 #include <algorithm>
+#include <cstdlib>
+#include <utility>
 
 namespace
 {
@@ -179,12 +181,14 @@ Thread::Thread(ThreadConsumer &threadConsumer, const String & threadName, uint32
     , mThreadPriority   (Thread::ThreadPriority::Undefined)
     , mRunState         ( Thread::RunState::NotRunning )
     , mStackSizeKB      ( stackSizeKb )
+    , mPlacement        ( )
     , mSyncObject       ( )
     , mWaitForRun       (false, false)
     , mWaitForExit      (false, false)
     , mExitRequest      (true, false)
     , mExitRequested    ( false )
     , mRegistered       ( false )
+    , mIsStrand         ( false )
 {
     mWaitForExit.set_signaled();
 }
@@ -198,12 +202,14 @@ Thread::Thread( areg::NullTag, ThreadConsumer & threadConsumer, const String & t
     , mThreadPriority   ( Thread::ThreadPriority::Undefined )
     , mRunState         ( Thread::RunState::NotRunning )
     , mStackSizeKB      ( 0u )
+    , mPlacement        ( )
     , mSyncObject       ( )
     , mWaitForRun       ( areg::NullTag{} )
     , mWaitForExit      ( areg::NullTag{} )
     , mExitRequest      ( areg::NullTag{} )
     , mExitRequested    ( false )
     , mRegistered       ( false )
+    , mIsStrand         ( false )
 {
     // Null thread: not registered in thread maps, no OS handle, no sync events allocated.
 }
@@ -283,6 +289,85 @@ void Thread::sleep( uint32_t msTimeout )
     Thread::_os_sleep(msTimeout);
 }
 
+bool Thread::parse_cpu_list( const String & cpuList, std::vector<uint32_t> & result )
+{
+    result.clear();
+
+    const char * pos{ cpuList.as_string() };
+    while (*pos != String::EmptyChar)
+    {
+        while ((*pos == ' ') || (*pos == '\t'))
+            ++ pos;
+
+        if ((*pos < '0') || (*pos > '9'))
+            break;
+
+        char * next{ nullptr };
+        const uint32_t first{ static_cast<uint32_t>(std::strtoul(pos, &next, 10)) };
+        uint32_t last{ first };
+        pos = next;
+        if (*pos == '-')
+        {
+            ++ pos;
+            if ((*pos < '0') || (*pos > '9'))
+                break;
+
+            last = static_cast<uint32_t>(std::strtoul(pos, &next, 10));
+            pos = next;
+        }
+
+        // Bounds the size of the list, no machine has that many cores.
+        if ((last < first) || (last >= 0xFFFFu))
+            break;
+
+        for (uint32_t cpu = first; cpu <= last; ++ cpu)
+        {
+            result.push_back(cpu);
+        }
+
+        while ((*pos == ' ') || (*pos == '\t'))
+            ++ pos;
+
+        if (*pos == ',')
+        {
+            ++ pos;
+        }
+        else if (*pos != String::EmptyChar)
+        {
+            break;
+        }
+    }
+
+    if (*pos != String::EmptyChar)
+    {
+        result.clear();
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return (result.empty() == false);
+}
+
+Thread::SchedPolicy Thread::parse_sched_policy( const String & policy ) noexcept
+{
+    constexpr std::pair<std::string_view, Thread::SchedPolicy> _policies[]
+    {
+          { "normal"    , Thread::SchedPolicy::Normal       }
+        , { "other"     , Thread::SchedPolicy::Normal       }
+        , { "fifo"      , Thread::SchedPolicy::Fifo         }
+        , { "rr"        , Thread::SchedPolicy::RoundRobin   }
+        , { "roundrobin", Thread::SchedPolicy::RoundRobin   }
+    };
+
+    for (const auto & entry : _policies)
+    {
+        if (areg::compare_ignore_case<char, char>(policy.as_string(), entry.first.data()) == areg::Ordering::Equal)
+            return entry.second;
+    }
+
+    return Thread::SchedPolicy::Default;
+}
+
 bool Thread::wait_exit( uint32_t msTimeout )
 {
     Thread * current = Thread::current_thread();
@@ -300,7 +385,7 @@ Thread::ThreadCompletion Thread::shutdown( uint32_t waitForStopMs /* = areg::WAI
 {
     request_exit();
 
-    Thread::ThreadCompletion result{ _os_destroy_thread( waitForStopMs ) };
+    Thread::ThreadCompletion result{ is_strand() ? _strand_destroy( waitForStopMs ) : _os_destroy_thread( waitForStopMs ) };
     _clean_resources( true, true );
 
     return result;
@@ -315,7 +400,8 @@ bool Thread::wait_completion( uint32_t waitForCompleteMs /*= areg::WAIT_INFINITE
     if (waitForCompleteMs == areg::DO_NOT_WAIT)
         return true;
 
-    const bool completed{ (handle == Thread::INVALID_THREAD_HANDLE) || mWaitForExit.lock(waitForCompleteMs) };
+    // A strand has no handle, its completion is signaled by its last turn.
+    const bool completed{ ((handle == Thread::INVALID_THREAD_HANDLE) && (is_strand() == false)) || mWaitForExit.lock(waitForCompleteMs) };
     if (completed)
     {
         // The handle is reset and the exit event is signaled while the routine still runs.
@@ -373,6 +459,12 @@ int32_t Thread::_thread_entry()
         tls.set_item(STORAGE_THREAD_CONSUMER, reinterpret_cast<void *>(&mThreadConsumer));
         tls.set_item(STORAGE_STARTUP_PHASE, static_cast<uint32_t>(0u));
 
+        const Thread::ThreadPlacement threadPlacement{ placement() };
+        if (threadPlacement.is_empty() == false)
+        {
+            Thread::_os_apply_placement(threadPlacement);
+        }
+
         _set_running(true);
 
         if (on_pre_run())
@@ -412,6 +504,7 @@ void Thread::_clean_resources(bool unregister, bool releaseHandle)
             mThreadHandle   = Thread::INVALID_THREAD_HANDLE;
             mThreadId       = Thread::INVALID_THREAD_ID;
             mThreadPriority = Thread::ThreadPriority::Undefined;
+            mIsStrand.store(false, std::memory_order_release);
         }
     } while (false);
 
@@ -450,7 +543,11 @@ bool Thread::_register_thread()
     mRegistered.store(true, std::memory_order_release);
     Thread::_bump_registry_generation();
 
-    _os_set_name(mThreadId, mThreadAddress.name());
+    if (mThreadHandle != Thread::INVALID_THREAD_HANDLE)
+    {
+        _os_set_name(mThreadId, mThreadAddress.name());
+    }
+
     return mThreadConsumer.on_thread_registered(this);
 }
 
@@ -489,13 +586,115 @@ void Thread::set_startup_phase(bool isStartup) noexcept
 
 ThreadConsumer& Thread::current_thread_consumer() noexcept
 {
-    ASSERT(current_thread() != nullptr );
+    // The current thread object, and not the storage of the OS thread, knows the consumer of a strand.
+    Thread * current = Thread::current_thread();
+    ASSERT(current != nullptr );
+    if (current->is_strand())
+    {
+        return current->mThreadConsumer;
+    }
+
     ThreadLocalStorage& localStorage = Thread::current_thread_storage();
     ThreadConsumer* consumer = reinterpret_cast<ThreadConsumer *>(localStorage.item(STORAGE_THREAD_CONSUMER).valPtr.mElement);
     ASSERT(consumer != nullptr );
     return (*consumer);
 }
 
+bool Thread::strand_register()
+{
+    Lock lock(mSyncObject);
+    if (_is_valid_no_lock() || mThreadAddress.name().is_empty())
+        return false;
+
+    mExitRequested.store(false, std::memory_order_release);
+    mExitRequest.reset();
+    mWaitForRun.reset();
+    mWaitForExit.reset();
+    _set_run_state(Thread::RunState::Starting);
+
+    // The IDs of the OS threads are aligned addresses or multiples of 4, so the odd address
+    // of the object is an ID that no OS thread and no other strand has.
+    mThreadId       = static_cast<id_type>(reinterpret_cast<uintptr_t>(this) | 1u);
+    mThreadPriority = Thread::ThreadPriority::Normal;
+    mIsStrand.store(true, std::memory_order_release);
+    if (_register_thread() == false)
+    {
+        _unregister_thread();
+        mThreadId       = Thread::INVALID_THREAD_ID;
+        mThreadPriority = Thread::ThreadPriority::Undefined;
+        mIsStrand.store(false, std::memory_order_release);
+        mWaitForExit.set_signaled();
+        _set_run_state(Thread::RunState::NotRunning);
+        return false;
+    }
+
+    return true;
+}
+
+bool Thread::strand_wait_run( uint32_t waitForStartMs ) noexcept
+{
+    return mWaitForRun.lock(waitForStartMs);
+}
+
+Thread * Thread::strand_enter() noexcept
+{
+    Thread * executorThread{ Thread::_self_thread() };
+    Thread::_set_self_thread(this);
+    return executorThread;
+}
+
+void Thread::strand_leave( Thread * executorThread ) noexcept
+{
+    Thread::_set_self_thread(executorThread);
+}
+
+bool Thread::strand_begin()
+{
+    _set_running(true);
+    return on_pre_run();
+}
+
+int32_t Thread::strand_end()
+{
+    _set_running(false);
+    const int32_t result{ mThreadConsumer.on_exit() };
+    on_post_exit();
+    return result;
+}
+
+void Thread::strand_release()
+{
+    _clean_resources(true, false);
+    mWaitForExit.set_signaled();
+    _set_run_state(Thread::RunState::NotRunning);
+}
+
+Thread::ThreadCompletion Thread::_strand_destroy( uint32_t waitForStopMs )
+{
+    do
+    {
+        Lock lock(mSyncObject);
+        if (_is_valid_no_lock() == false)
+        {
+            return Thread::ThreadCompletion::Invalid;
+        }
+
+        // Unregistering stops the dispatcher, which schedules the last turn of the strand.
+        _unregister_thread();
+
+    } while (false);
+
+    if (mWaitForExit.lock(waitForStopMs == DO_NOT_WAIT ? 0u : waitForStopMs) == false)
+    {
+        // The turn runs on a thread of the pool, which is not killed for one strand.
+        AREG_OUTPUT_DBG("The strand [ %s ] did not stop and cannot be terminated", mThreadAddress.name().as_string());
+        return Thread::ThreadCompletion::Stuck;
+    }
+
+    _wait_exit_completed();
+    return Thread::ThreadCompletion::Completed;
+}
+
 Thread * Thread::first_thread( id_type & threadId ) noexcept
 {
     return _map_thread_id().resource_first_key( threadId );
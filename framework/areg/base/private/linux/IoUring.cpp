@@ -0,0 +1,403 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/private/linux/IoUring.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, minimal io_uring instance on top of the raw system calls.
+ ************************************************************************/
+#include "areg/base/private/linux/IoUring.hpp"
+
+#if defined(__linux__) && (AREG_IO_URING != 0)
+
+#include <errno.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <linux/io_uring.h>
+
+namespace {
+    //!< The features required from the kernel: one mapping of both rings, no lost
+    //!< completions and the wait with the timeout.
+    constexpr uint32_t  REQUIRED_FEATURES   { IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG };
+
+    //!< The user data of the cancel requests, their completions are not counted.
+    constexpr uint64_t  CANCEL_TAG          { ~static_cast<uint64_t>(0u) };
+
+    //!< The result of a group, which the kernel did not complete yet.
+    constexpr int32_t   RESULT_PENDING      { INT32_MIN };
+} // namespace
+
+namespace areg::os {
+
+bool IoUring::is_supported() noexcept
+{
+    static const bool _supported{ []() -> bool { IoUring ring; return ring.open(2u); }() };
+    return _supported;
+}
+
+IoUring::IoUring() noexcept
+    : mRingFd       ( -1 )
+    , mRings        ( MAP_FAILED )
+    , mRingsSize    ( 0u )
+    , mSqes         ( nullptr )
+    , mSqesSize     ( 0u )
+    , mSqHead       ( nullptr )
+    , mSqTail       ( nullptr )
+    , mSqArray      ( nullptr )
+    , mSqMask       ( 0u )
+    , mSqEntries    ( 0u )
+    , mSqLocalTail  ( 0u )
+    , mCqHead       ( nullptr )
+    , mCqTail       ( nullptr )
+    , mCqMask       ( 0u )
+    , mCqes         ( nullptr )
+{
+}
+
+IoUring::~IoUring() noexcept
+{
+    close();
+}
+
+bool IoUring::open(uint32_t entries) noexcept
+{
+    close();
+
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CLAMP;
+
+    const int fd{ static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params)) };
+    if (fd < 0)
+        return false;
+
+    if ((params.features & REQUIRED_FEATURES) != REQUIRED_FEATURES)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    const std::size_t sqSize{ params.sq_off.array + params.sq_entries * sizeof(uint32_t) };
+    const std::size_t cqSize{ params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe) };
+    const std::size_t ringsSize{ std::max(sqSize, cqSize) };
+    void * rings{ ::mmap(nullptr, ringsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING) };
+    if (rings == MAP_FAILED)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    const std::size_t sqesSize{ params.sq_entries * sizeof(struct io_uring_sqe) };
+    void * sqes{ ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES) };
+    if (sqes == MAP_FAILED)
+    {
+        ::munmap(rings, ringsSize);
+        ::close(fd);
+        return false;
+    }
+
+    uint8_t * const base{ static_cast<uint8_t *>(rings) };
+    mRingFd     = fd;
+    mRings      = rings;
+    mRingsSize  = ringsSize;
+    mSqes       = static_cast<struct io_uring_sqe *>(sqes);
+    mSqesSize   = sqesSize;
+
+    mSqHead     = reinterpret_cast<uint32_t *>(base + params.sq_off.head);
+    mSqTail     = reinterpret_cast<uint32_t *>(base + params.sq_off.tail);
+    mSqArray    = reinterpret_cast<uint32_t *>(base + params.sq_off.array);
+    mSqMask     = *reinterpret_cast<uint32_t *>(base + params.sq_off.ring_mask);
+    mSqEntries  = params.sq_entries;
+    mSqLocalTail= __atomic_load_n(mSqTail, __ATOMIC_RELAXED);
+
+    mCqHead     = reinterpret_cast<uint32_t *>(base + params.cq_off.head);
+    mCqTail     = reinterpret_cast<uint32_t *>(base + params.cq_off.tail);
+    mCqMask     = *reinterpret_cast<uint32_t *>(base + params.cq_off.ring_mask);
+    mCqes       = reinterpret_cast<struct io_uring_cqe *>(base + params.cq_off.cqes);
+
+    return true;
+}
+
+void IoUring::close() noexcept
+{
+    if (mRingFd == -1)
+        return;
+
+    ::munmap(mSqes, mSqesSize);
+    ::munmap(mRings, mRingsSize);
+    ::close(mRingFd);
+
+    mRingFd     = -1;
+    mRings      = MAP_FAILED;
+    mRingsSize  = 0u;
+    mSqes       = nullptr;
+    mSqesSize   = 0u;
+    mSqHead     = mSqTail = mSqArray = nullptr;
+    mSqMask     = mSqEntries = mSqLocalTail = 0u;
+    mCqHead     = mCqTail = nullptr;
+    mCqMask     = 0u;
+    mCqes       = nullptr;
+}
+
+struct io_uring_sqe * IoUring::next_sqe() noexcept
+{
+    if ((mRingFd == -1) || ((mSqLocalTail - __atomic_load_n(mSqHead, __ATOMIC_ACQUIRE)) >= mSqEntries))
+        return nullptr;
+
+    const uint32_t index{ mSqLocalTail & mSqMask };
+    struct io_uring_sqe * sqe{ &mSqes[index] };
+    std::memset(sqe, 0, sizeof(struct io_uring_sqe));
+    mSqArray[index] = index;
+    ++ mSqLocalTail;
+    return sqe;
+}
+
+uint32_t IoUring::flush() noexcept
+{
+    if (mRingFd == -1)
+        return 0u;
+
+    __atomic_store_n(mSqTail, mSqLocalTail, __ATOMIC_RELEASE);
+    return (mSqLocalTail - __atomic_load_n(mSqHead, __ATOMIC_ACQUIRE));
+}
+
+int32_t IoUring::enter(uint32_t toSubmit, uint32_t waitCount, int32_t timeoutMs) noexcept
+{
+    if (mRingFd == -1)
+        return -EBADF;
+
+    uint32_t flags{ waitCount != 0u ? IORING_ENTER_GETEVENTS : 0u };
+    struct __kernel_timespec timeout { };
+    struct io_uring_getevents_arg arg { };
+    void * argPtr{ nullptr };
+    std::size_t argSize{ 0u };
+    if ((waitCount != 0u) && (timeoutMs >= 0))
+    {
+        timeout.tv_sec  = timeoutMs / 1000;
+        timeout.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000000LL;
+        arg.sigmask_sz  = _NSIG / 8;
+        arg.ts          = reinterpret_cast<uint64_t>(&timeout);
+        flags          |= IORING_ENTER_EXT_ARG;
+        argPtr          = &arg;
+        argSize         = sizeof(arg);
+    }
+
+    const long result{ ::syscall(__NR_io_uring_enter, mRingFd, toSubmit, waitCount, flags, argPtr, argSize) };
+    return (result < 0 ? -errno : static_cast<int32_t>(result));
+}
+
+const struct io_uring_cqe * IoUring::peek_cqe() const noexcept
+{
+    if (mRingFd == -1)
+        return nullptr;
+
+    const uint32_t head{ __atomic_load_n(mCqHead, __ATOMIC_RELAXED) };
+    return (head != __atomic_load_n(mCqTail, __ATOMIC_ACQUIRE) ? &mCqes[head & mCqMask] : nullptr);
+}
+
+void IoUring::cqe_seen() noexcept
+{
+    __atomic_store_n(mCqHead, __atomic_load_n(mCqHead, __ATOMIC_RELAXED) + 1u, __ATOMIC_RELEASE);
+}
+
+bool ring_send_data_groups(areg::IoGroup * groups, uint32_t count, uint32_t timeoutMs) noexcept
+{
+    thread_local IoUring _ring;
+    thread_local bool _failed{ false };
+
+    if (_ring.is_open() == false)
+    {
+        if (_failed || (IoUring::is_supported() == false) || (_ring.open(areg::DEFAULT_DRAIN_LIMIT) == false))
+        {
+            _failed = true;
+            return false;
+        }
+    }
+
+    uint32_t buffers{ 0u };
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        buffers += groups[i].count;
+    }
+
+    if ((count > _ring.entries()) || (buffers > areg::DEFAULT_DRAIN_LIMIT))
+        return false;
+
+    struct iovec iov[areg::DEFAULT_DRAIN_LIMIT];
+    struct msghdr msg[areg::DEFAULT_DRAIN_LIMIT];
+    uint32_t wanted[areg::DEFAULT_DRAIN_LIMIT];
+    const auto is_sent{ [groups](uint32_t i) { return areg::is_valid_socket(groups[i].socket) && (groups[i].count != 0u); } };
+
+    // Every group is one vectored send. A group is linked to the next one of the same socket,
+    // so that the kernel starts the next send only after the previous one is complete.
+    uint32_t used{ 0u };
+    uint32_t active{ 0u };
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        areg::IoGroup & group{ groups[i] };
+        if (is_sent(i) == false)
+        {
+            group.result = areg::is_valid_socket(group.socket) ? 0 : -1;
+            continue;
+        }
+
+        wanted[i] = 0u;
+        for (uint32_t k = 0u; k < group.count; ++ k)
+        {
+            iov[used + k].iov_base  = const_cast<uint8_t *>(group.buffers[k].data);
+            iov[used + k].iov_len   = group.buffers[k].size;
+            wanted[i]              += static_cast<uint32_t>(group.buffers[k].size);
+        }
+
+        std::memset(&msg[i], 0, sizeof(struct msghdr));
+        msg[i].msg_iov      = &iov[used];
+        msg[i].msg_iovlen   = group.count;
+        used               += group.count;
+
+        struct io_uring_sqe * sqe{ _ring.next_sqe() };
+        sqe->opcode         = IORING_OP_SENDMSG;
+        sqe->fd             = static_cast<int>(group.socket);
+        sqe->addr           = reinterpret_cast<uint64_t>(&msg[i]);
+        sqe->len            = 1u;
+        sqe->msg_flags      = MSG_NOSIGNAL | MSG_WAITALL;
+        sqe->user_data      = i;
+        if ((i + 1u < count) && (groups[i + 1u].socket == group.socket) && is_sent(i + 1u))
+        {
+            sqe->flags      = IOSQE_IO_LINK;
+        }
+
+        group.result = RESULT_PENDING;
+        ++ active;
+    }
+
+    uint32_t toSubmit{ _ring.flush() };
+    bool timedOut{ false };
+    while (active != 0u)
+    {
+        const struct io_uring_cqe * cqe{ _ring.peek_cqe() };
+        if (cqe != nullptr)
+        {
+            if (cqe->user_data != CANCEL_TAG)
+            {
+                groups[cqe->user_data].result = cqe->res;
+                -- active;
+            }
+
+            _ring.cqe_seen();
+            continue;
+        }
+
+        const int32_t entered{ _ring.enter(toSubmit, 1u, (timedOut || (timeoutMs == 0u)) ? -1 : static_cast<int32_t>(timeoutMs)) };
+        if (entered >= 0)
+        {
+            toSubmit -= std::min(static_cast<uint32_t>(entered), toSubmit);
+        }
+        else if ((entered == -ETIME) && (timedOut == false))
+        {
+            // A peer does not read its data: cancel the sends still waiting for it.
+            timedOut = true;
+            for (uint32_t i = 0u; i < count; ++ i)
+            {
+                if (groups[i].result != RESULT_PENDING)
+                    continue;
+
+                struct io_uring_sqe * sqe{ _ring.next_sqe() };
+                if (sqe == nullptr)
+                    break;
+
+                sqe->opcode     = IORING_OP_ASYNC_CANCEL;
+                sqe->fd         = -1;
+                sqe->addr       = i;
+                sqe->user_data  = CANCEL_TAG;
+            }
+
+            toSubmit = _ring.flush();
+        }
+        else if ((entered != -EINTR) && (entered != -ETIME) && (entered != -EBUSY) && (entered != -EAGAIN))
+        {
+            // The instance is broken, closing it cancels the requests in flight.
+            _ring.close();
+            _failed = true;
+            break;
+        }
+    }
+
+    if ((toSubmit != 0u) && _ring.is_open())
+    {
+        // The cancel requests of the sends, which completed before them, find nothing to cancel.
+        static_cast<void>(_ring.enter(toSubmit, 0u, 0));
+    }
+
+    // The results are checked in the order of the groups, the rest of a short send and the
+    // sends of a broken link are completed with the classic calls.
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        areg::IoGroup & group{ groups[i] };
+        if (is_sent(i) == false)
+            continue;
+
+        const bool previousFailed{ (i != 0u) && (groups[i - 1u].socket == group.socket) && (groups[i - 1u].result < 0) };
+        const int32_t result{ group.result };
+        if (previousFailed || (result == RESULT_PENDING))
+        {
+            group.result = -1;
+        }
+        else if ((result >= 0) && (static_cast<uint32_t>(result) == wanted[i]))
+        {
+            continue;
+        }
+        else if (timedOut)
+        {
+            group.result = -1;
+        }
+        else if (result == -ECANCELED)
+        {
+            group.result = areg::send_data_v(group.socket, group.buffers, group.count, wanted[i]);
+        }
+        else if (result >= 0)
+        {
+            areg::IoBuffer rest[areg::DEFAULT_DRAIN_LIMIT];
+            uint32_t restCount{ 0u };
+            std::size_t skip{ static_cast<std::size_t>(result) };
+            for (uint32_t k = 0u; k < group.count; ++ k)
+            {
+                const areg::IoBuffer & buffer{ group.buffers[k] };
+                if (skip >= buffer.size)
+                {
+                    skip -= buffer.size;
+                    continue;
+                }
+
+                rest[restCount ++] = areg::IoBuffer{ buffer.data + skip, buffer.size - skip };
+                skip = 0u;
+            }
+
+            const int32_t sent{ areg::send_data_v(group.socket, rest, restCount, wanted[i] - static_cast<uint32_t>(result)) };
+            group.result = (sent < 0 ? -1 : static_cast<int32_t>(wanted[i]));
+        }
+        else
+        {
+            group.result = -1;
+        }
+    }
+
+    return true;
+}
+
+} // namespace areg::os
+
+#endif  // defined(__linux__) && (AREG_IO_URING != 0)
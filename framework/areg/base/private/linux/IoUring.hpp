@@ -0,0 +1,222 @@
+#ifndef AREG_BASE_PRIVATE_LINUX_IOURING_HPP
+#define AREG_BASE_PRIVATE_LINUX_IOURING_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/private/linux/IoUring.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, minimal io_uring instance on top of the raw system calls.
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+
+#if defined(__linux__) && (AREG_IO_URING != 0)
+
+#include "areg/base/SocketDefs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// <linux/io_uring.h> defines the macro BLOCK_SIZE, which breaks areg::BLOCK_SIZE.
+// Only the sources using the entries of the rings include it, after the Areg headers.
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace areg::os {
+
+//////////////////////////////////////////////////////////////////////////
+// IoUring class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   One io_uring instance: the submission and the completion rings mapped into the
+ *          process. It uses the system calls directly and needs no liburing.
+ *
+ *          open() fails on the kernels without io_uring, the ones older than 5.11 (no timeout
+ *          in the wait, no single mapping of the rings) and the ones where io_uring is disabled
+ *          by the administrator. The callers then keep using the classic system calls.
+ *
+ * \note    The object is not thread safe. Only one thread at a time may fill the submission
+ *          ring, and only one thread may consume the completion ring.
+ **/
+class IoUring
+{
+//////////////////////////////////////////////////////////////////////////
+// Static operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the kernel supports the io_uring features used by Areg.
+     *          The check runs once per process.
+     **/
+    [[nodiscard]]
+    static bool is_supported() noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    IoUring() noexcept;
+
+    ~IoUring() noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the instance is opened.
+     **/
+    [[nodiscard]]
+    inline bool is_open() const noexcept;
+
+    /**
+     * \brief   Returns the number of entries of the submission ring.
+     **/
+    [[nodiscard]]
+    inline uint32_t entries() const noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the instance and maps the rings.
+     *
+     * \param   entries     The number of entries of the submission ring, rounded up by the
+     *                      kernel to a power of two. The completion ring is twice as large.
+     * \return  Returns true if succeeded. Returns false if the kernel lacks the support.
+     **/
+    bool open(uint32_t entries) noexcept;
+
+    /**
+     * \brief   Closes the instance. The kernel cancels the requests still in flight.
+     **/
+    void close() noexcept;
+
+    /**
+     * \brief   Returns the next free entry of the submission ring, cleared. The entry is passed
+     *          to the kernel by the next flush(). Returns nullptr if the ring is full.
+     **/
+    [[nodiscard]]
+    struct io_uring_sqe * next_sqe() noexcept;
+
+    /**
+     * \brief   Publishes the entries filled since the previous call.
+     *
+     * \return  Returns the number of the published entries, which the kernel did not take yet.
+     **/
+    uint32_t flush() noexcept;
+
+    /**
+     * \brief   Passes the published entries to the kernel and waits for the completions.
+     *
+     * \param   toSubmit    The number of entries to pass, see flush().
+     * \param   waitCount   The number of completions to wait for. Zero does not wait.
+     * \param   timeoutMs   The timeout of the wait in milliseconds, negative waits infinitely.
+     * \return  Returns the number of the entries taken by the kernel, or the negative error code,
+     *          -ETIME if the timeout expired and -EINTR if a signal interrupted the wait.
+     **/
+    int32_t enter(uint32_t toSubmit, uint32_t waitCount, int32_t timeoutMs) noexcept;
+
+    /**
+     * \brief   Publishes and passes the filled entries to the kernel without waiting.
+     **/
+    inline int32_t submit() noexcept;
+
+    /**
+     * \brief   Returns the oldest completion not consumed yet, or nullptr if there is none.
+     *          Call cqe_seen() when done with it.
+     **/
+    [[nodiscard]]
+    const struct io_uring_cqe * peek_cqe() const noexcept;
+
+    /**
+     * \brief   Consumes the completion returned by peek_cqe().
+     **/
+    void cqe_seen() noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The file descriptor of the instance.
+    int                     mRingFd;
+    //!< The single mapping of both rings and its size.
+    void *                  mRings;
+    std::size_t             mRingsSize;
+    //!< The array of the submission entries and its size.
+    struct io_uring_sqe *   mSqes;
+    std::size_t             mSqesSize;
+
+    //!< The shared indexes of the submission ring.
+    uint32_t *              mSqHead;
+    uint32_t *              mSqTail;
+    uint32_t *              mSqArray;
+    uint32_t                mSqMask;
+    uint32_t                mSqEntries;
+    //!< The tail of the entries filled by next_sqe(), published by flush().
+    uint32_t                mSqLocalTail;
+
+    //!< The shared indexes of the completion ring and the completions.
+    uint32_t *              mCqHead;
+    uint32_t *              mCqTail;
+    uint32_t                mCqMask;
+    struct io_uring_cqe *   mCqes;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( IoUring );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Scatter/gather sends of many sockets in one submission
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * \brief   Sends the groups through the io_uring instance of the calling thread, see
+ *          areg::send_data_groups(). The consecutive groups of one socket are linked, so that
+ *          the kernel writes them in order. The short and the broken sends are completed with
+ *          the classic system calls.
+ *
+ * \return  Returns false if the thread has no io_uring instance, nothing is sent then.
+ **/
+bool ring_send_data_groups(areg::IoGroup * groups, uint32_t count, uint32_t timeoutMs) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// IoUring class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool IoUring::is_open() const noexcept
+{
+    return (mRingFd != -1);
+}
+
+inline uint32_t IoUring::entries() const noexcept
+{
+    return mSqEntries;
+}
+
+inline int32_t IoUring::submit() noexcept
+{
+    const uint32_t toSubmit{ flush() };
+    return (toSubmit != 0u ? enter(toSubmit, 0u, 0) : 0);
+}
+
+} // namespace areg::os
+
+#endif  // defined(__linux__) && (AREG_IO_URING != 0)
+
+#endif  // AREG_BASE_PRIVATE_LINUX_IOURING_HPP
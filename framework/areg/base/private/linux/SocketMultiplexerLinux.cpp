@@ -11,7 +11,8 @@
  * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
  * \author      Artak Avetyan
  * \brief       Areg Platform, Linux SocketMultiplexer implementation.
- *              Uses epoll + eventfd for O(1) readiness and wakeup.
+ *              Uses epoll + eventfd for O(1) readiness and wakeup, or the poll
+ *              requests of io_uring when built with AREG_IO_URING.
  ************************************************************************/
 #ifdef __linux__
 
@@ -23,6 +24,18 @@
 #include <sys/eventfd.h>
 #include <errno.h>
 
+#if (AREG_IO_URING != 0)
+    #include "areg/base/SyncPrimitives.hpp"
+    #include "areg/base/private/linux/IoUring.hpp"
+
+    #include <poll.h>
+    #include <new>
+    #include <unordered_map>
+    #include <vector>
+
+    #include <linux/io_uring.h>
+#endif  // (AREG_IO_URING != 0)
+
 namespace {
 // A single read() resets the accumulated counter to zero (no EFD_SEMAPHORE).
 inline void drain_eventfd(int fd) noexcept
@@ -44,11 +57,300 @@ inline void drain_eventfd(int fd) noexcept
 //   Instead, reset() removes every real socket via epoll_ctl(DEL) and then signals the eventfd.
 // -----------------------------------------------------------------------
 
+#if (AREG_IO_URING != 0)
+
+// -----------------------------------------------------------------------
+// IO_URING DESIGN:
+//   Every registered socket and the wakeup eventfd have one poll request in the ring.
+//   The requests are one-shot: a delivered socket is polled again by the next wait() that
+//   enters the kernel, after the caller has read it. The new request reports the data left
+//   in the socket at once, which keeps the level-triggered behavior of epoll, and costs no
+//   system call of its own: it is submitted by the same io_uring_enter() that waits.
+//   wait(0) with nothing to submit and no completion returns without any system call.
+//
+//   The user data of a request is the descriptor and its generation, so that the
+//   completions of an unregistered socket are ignored even if the descriptor is reused.
+//   A socket is removed from the ring before it is closed, the pending request would keep
+//   the closed socket alive.
+//
+//   The submission ring is shared by the threads registering the sockets and the thread
+//   waiting, it is guarded by mLock. The completion ring belongs to the waiting thread.
+// -----------------------------------------------------------------------
+
+struct areg::SocketMultiplexer::RingState
+{
+    //!< The entries of the submission ring.
+    static constexpr uint32_t   RING_ENTRIES    { 256u };
+
+    //!< The user data of the requests, which completions are ignored.
+    static constexpr uint64_t   IGNORE_TAG      { ~static_cast<uint64_t>(0u) };
+
+    //!< The events of the poll requests.
+    static constexpr uint32_t   POLL_EVENTS     { POLLIN | POLLRDHUP | POLLERR | POLLHUP };
+
+    /**
+     * \brief   The state of a descriptor in the ring.
+     **/
+    struct Entry
+    {
+        uint32_t    generation; //!< The generation of the registration of the descriptor.
+        bool        armed;      //!< True if the poll request of the descriptor is in the ring.
+    };
+
+    /**
+     * \brief   Returns the new ring state, or nullptr if the kernel lacks io_uring.
+     **/
+    static RingState * create() noexcept
+    {
+        if (areg::os::IoUring::is_supported() == false)
+            return nullptr;
+
+        RingState * state{ new (std::nothrow) RingState() };
+        if ((state != nullptr) && (state->mRing.open(RING_ENTRIES) == false))
+        {
+            delete state;
+            state = nullptr;
+        }
+
+        return state;
+    }
+
+    /**
+     * \brief   Adds the descriptor to the ring and submits its poll request.
+     **/
+    bool add(int fd) noexcept
+    {
+        Lock lock(mLock);
+        Entry & entry{ mEntries[fd] };
+        entry.generation = ++ mGeneration;
+        entry.armed      = false;
+        _arm(fd, entry);
+        if (mRing.submit() < 0)
+        {
+            mEntries.erase(fd);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief   Removes the descriptor from the ring, its pending poll request is cancelled.
+     **/
+    void remove(int fd) noexcept
+    {
+        Lock lock(mLock);
+        auto pos{ mEntries.find(fd) };
+        if (pos == mEntries.end())
+            return;
+
+        const bool armed{ pos->second.armed };
+        if (armed)
+        {
+            _disarm(fd, pos->second);
+        }
+
+        mEntries.erase(pos);
+        if (armed)
+        {
+            static_cast<void>(mRing.submit());
+        }
+    }
+
+    /**
+     * \brief   Removes all descriptors, except the wakeup eventfd, from the ring.
+     **/
+    void remove_all(int wakeupFd) noexcept
+    {
+        Lock lock(mLock);
+        for (auto pos{ mEntries.begin() }; pos != mEntries.end(); )
+        {
+            if (pos->first == wakeupFd)
+            {
+                ++ pos;
+                continue;
+            }
+
+            if (pos->second.armed)
+            {
+                _disarm(pos->first, pos->second);
+            }
+
+            pos = mEntries.erase(pos);
+        }
+
+        static_cast<void>(mRing.submit());
+    }
+
+    /**
+     * \brief   Polls again the descriptors delivered by the previous call, waits for the
+     *          completions and fills the batch cache of the multiplexer with the ready ones.
+     *
+     * \param   mux         The multiplexer to fill the batch cache.
+     * \param   timeoutMs   The timeout of the wait, negative waits infinitely.
+     * \param   result      On output, if nothing is ready, the value wait() returns.
+     * \return  Returns true if the batch cache has ready descriptors.
+     **/
+    bool collect(const SocketMultiplexer & mux, int32_t timeoutMs, SOCKETHANDLE & result) noexcept
+    {
+        uint32_t toSubmit{ 0u };
+        {
+            Lock lock(mLock);
+            for (int fd : mRearm)
+            {
+                auto pos{ mEntries.find(fd) };
+                if ((pos != mEntries.end()) && (pos->second.armed == false))
+                {
+                    _arm(fd, pos->second);
+                }
+            }
+
+            mRearm.clear();
+            toSubmit = mRing.flush();
+        }
+
+        if (mRing.peek_cqe() == nullptr)
+        {
+            if ((timeoutMs == 0) && (toSubmit == 0u))
+            {
+                result = areg::InvalidSocketHandle;
+                return false;
+            }
+
+            const int32_t entered{ mRing.enter(toSubmit, 1u, timeoutMs) };
+            if ((entered < 0) && (entered != -ETIME) && (entered != -EINTR) && (entered != -EBUSY) && (entered != -EAGAIN))
+            {
+                result = areg::FailedSocketHandle;
+                return false;
+            }
+        }
+
+        Lock lock(mLock);
+        mux.mBatchCount = mux.mBatchIdx = 0u;
+        const struct io_uring_cqe * cqe{ nullptr };
+        while ((mux.mBatchCount < areg::DEFAULT_DRAIN_LIMIT) && ((cqe = mRing.peek_cqe()) != nullptr))
+        {
+            const uint64_t tag{ cqe->user_data };
+            const int32_t  res{ cqe->res };
+            mRing.cqe_seen();
+
+            if (tag == IGNORE_TAG)
+                continue;
+
+            const int fd{ static_cast<int>(static_cast<uint32_t>(tag)) };
+            auto pos{ mEntries.find(fd) };
+            if ((pos == mEntries.end()) || (pos->second.generation != static_cast<uint32_t>(tag >> 32)))
+                continue;   // the completion of an unregistered descriptor
+
+            pos->second.armed = false;
+            const uint32_t events{ res >= 0 ? static_cast<uint32_t>(res) : static_cast<uint32_t>(POLLERR) };
+
+            // Same as the epoll backend: a descriptor with an error or a hang-up and no data
+            // is not polled again, so that it does not fire in a loop.
+            if (((events & POLLIN) != 0u) || ((events & (POLLERR | POLLHUP | POLLRDHUP)) == 0u) || (res == -ECANCELED))
+            {
+                mRearm.push_back(fd);
+            }
+
+            if (res == -ECANCELED)
+                continue;
+
+            mux.mBatchFds[mux.mBatchCount]    = static_cast<SOCKETHANDLE>(fd);
+            mux.mBatchEvents[mux.mBatchCount] = events;
+            ++ mux.mBatchCount;
+        }
+
+        result = areg::InvalidSocketHandle;   // timeout, or only the ignored completions
+        return (mux.mBatchCount != 0u);
+    }
+
+private:
+    RingState() noexcept
+        : mRing         ( )
+        , mLock         ( )
+        , mEntries      ( )
+        , mRearm        ( )
+        , mGeneration   ( 0u )
+    {
+        mRearm.reserve(areg::DEFAULT_DRAIN_LIMIT);
+    }
+
+    /**
+     * \brief   Returns a free entry of the submission ring, submitting the filled ones if full.
+     **/
+    struct io_uring_sqe * _next_sqe() noexcept
+    {
+        struct io_uring_sqe * sqe{ mRing.next_sqe() };
+        if (sqe == nullptr)
+        {
+            static_cast<void>(mRing.submit());
+            sqe = mRing.next_sqe();
+        }
+
+        return sqe;
+    }
+
+    /**
+     * \brief   Queues the poll request of the descriptor.
+     **/
+    void _arm(int fd, Entry & entry) noexcept
+    {
+        struct io_uring_sqe * sqe{ _next_sqe() };
+        if (sqe == nullptr)
+            return;
+
+        uint32_t events{ POLL_EVENTS };
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        events = (events << 16) | (events >> 16);   // the kernel expects the words swapped
+#endif  // defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+
+        sqe->opcode         = IORING_OP_POLL_ADD;
+        sqe->fd             = fd;
+        sqe->poll32_events  = events;
+        sqe->user_data      = RingState::_tag(fd, entry.generation);
+        entry.armed         = true;
+    }
+
+    /**
+     * \brief   Queues the removal of the poll request of the descriptor.
+     **/
+    void _disarm(int fd, Entry & entry) noexcept
+    {
+        struct io_uring_sqe * sqe{ _next_sqe() };
+        if (sqe == nullptr)
+            return;
+
+        sqe->opcode     = IORING_OP_POLL_REMOVE;
+        sqe->fd         = -1;
+        sqe->addr       = RingState::_tag(fd, entry.generation);
+        sqe->user_data  = IGNORE_TAG;
+        entry.armed     = false;
+    }
+
+    /**
+     * \brief   Returns the user data of the poll request of the descriptor.
+     **/
+    static inline uint64_t _tag(int fd, uint32_t generation) noexcept
+    {
+        return ((static_cast<uint64_t>(generation) << 32) | static_cast<uint32_t>(fd));
+    }
+
+private:
+    areg::os::IoUring                   mRing;      //!< The io_uring instance.
+    CriticalSection                     mLock;      //!< Guards the submission ring and the entries.
+    std::unordered_map<int, Entry>      mEntries;   //!< The descriptors in the ring.
+    std::vector<int>                    mRearm;     //!< The descriptors delivered, polled again by the next wait.
+    uint32_t                            mGeneration;//!< The last generation of the registrations.
+};
+
+#endif  // (AREG_IO_URING != 0)
+
 areg::SocketMultiplexer::SocketMultiplexer(uint32_t maxConnections /*= areg::DEFAULT_CONNECTIONS*/) noexcept
     : mSockets      { }
     , mMaxCount     { (maxConnections < MIN_CONNECTIONS) ? MIN_CONNECTIONS : (maxConnections > MAX_CONNECTIONS) ? MAX_CONNECTIONS : maxConnections }
     , mIsReset      { false }
-    , mEpollFd      { static_cast<SOCKETHANDLE>(::epoll_create1(EPOLL_CLOEXEC)) }
+    , mEpollFd      { areg::InvalidSocketHandle }
+    , mRing         { nullptr }
     , mWakeupReadFd { areg::InvalidSocketHandle }
     , mWakeupWriteFd{ areg::InvalidSocketHandle }
     , mBatchCount   { 0 }
@@ -58,8 +360,17 @@ areg::SocketMultiplexer::SocketMultiplexer(uint32_t maxConnections /*= areg::DEF
 {
     mSockets.reserve(DEFAULT_CONNECTIONS);
 
-    if (mEpollFd == areg::InvalidSocketHandle)
-        return;
+#if (AREG_IO_URING != 0)
+    // io_uring is the first choice, epoll is the fallback on the kernels without it.
+    mRing = RingState::create();
+#endif  // (AREG_IO_URING != 0)
+
+    if (mRing == nullptr)
+    {
+        mEpollFd = static_cast<SOCKETHANDLE>(::epoll_create1(EPOLL_CLOEXEC));
+        if (mEpollFd == areg::InvalidSocketHandle)
+            return;
+    }
 
     const int efd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
     if (efd == -1)
@@ -69,10 +380,22 @@ areg::SocketMultiplexer::SocketMultiplexer(uint32_t maxConnections /*= areg::DEF
     mWakeupReadFd  = static_cast<SOCKETHANDLE>(efd);
     mWakeupWriteFd = static_cast<SOCKETHANDLE>(efd);
 
-    struct epoll_event ev;
-    ev.events  = EPOLLIN;
-    ev.data.fd = efd;
-    if (::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_ADD, efd, &ev) != areg::RETURNED_OK)
+    bool added{ false };
+#if (AREG_IO_URING != 0)
+    if (mRing != nullptr)
+    {
+        added = mRing->add(efd);
+    }
+    else
+#endif  // (AREG_IO_URING != 0)
+    {
+        struct epoll_event ev;
+        ev.events  = EPOLLIN;
+        ev.data.fd = efd;
+        added = (::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_ADD, efd, &ev) == areg::RETURNED_OK);
+    }
+
+    if (added == false)
     {
         ::close(efd);
         mWakeupReadFd  = areg::InvalidSocketHandle;
@@ -82,6 +405,12 @@ areg::SocketMultiplexer::SocketMultiplexer(uint32_t maxConnections /*= areg::DEF
 
 areg::SocketMultiplexer::~SocketMultiplexer() noexcept
 {
+#if (AREG_IO_URING != 0)
+    // Closing the ring cancels its poll requests, before the descriptors are closed.
+    delete mRing;
+    mRing = nullptr;
+#endif  // (AREG_IO_URING != 0)
+
     if (mWakeupReadFd != areg::InvalidSocketHandle)
     {
         ::close(static_cast<int>(mWakeupReadFd));
@@ -101,7 +430,7 @@ areg::SocketMultiplexer::~SocketMultiplexer() noexcept
 bool areg::SocketMultiplexer::register_socket(SOCKETHANDLE hSocket, bool search) noexcept
 {
     if (    !areg::is_valid_socket(hSocket)
-         || (mEpollFd == areg::InvalidSocketHandle)
+         || ((mEpollFd == areg::InvalidSocketHandle) && (mRing == nullptr))
          || (hSocket == mWakeupReadFd)
          || (static_cast<uint32_t>(mSockets.size()) >= mMaxCount) )
     {
@@ -111,14 +440,24 @@ bool areg::SocketMultiplexer::register_socket(SOCKETHANDLE hSocket, bool search)
     if (search && is_registered(hSocket))
         return false;
 
-    struct epoll_event ev;
-    // EPOLLIN    -- data available or peer sent FIN (recv returns 0)
-    // EPOLLRDHUP -- peer shut down.
-    // EPOLLERR / EPOLLHUP - reported automatically by the kernel regardless of the mask.
-    ev.events   = EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP;
-    ev.data.fd  = static_cast<int>(hSocket);
-    if (::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_ADD, static_cast<int>(hSocket), &ev) != 0)
-        return false;
+#if (AREG_IO_URING != 0)
+    if (mRing != nullptr)
+    {
+        if (mRing->add(static_cast<int>(hSocket)) == false)
+            return false;
+    }
+    else
+#endif  // (AREG_IO_URING != 0)
+    {
+        struct epoll_event ev;
+        // EPOLLIN    -- data available or peer sent FIN (recv returns 0)
+        // EPOLLRDHUP -- peer shut down.
+        // EPOLLERR / EPOLLHUP - reported automatically by the kernel regardless of the mask.
+        ev.events   = EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP;
+        ev.data.fd  = static_cast<int>(hSocket);
+        if (::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_ADD, static_cast<int>(hSocket), &ev) != 0)
+            return false;
+    }
 
     // Transition out of reset state. Drain here to start new cycle clean.
     if (mIsReset.exchange(false, std::memory_order_acq_rel) && (mWakeupReadFd != areg::InvalidSocketHandle))
@@ -136,8 +475,17 @@ bool areg::SocketMultiplexer::unregister_socket(SOCKETHANDLE hSocket) noexcept
     {
         if (*it == hSocket)
         {
-            struct epoll_event ev{};
-            ::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_DEL, static_cast<int>(hSocket), &ev);
+#if (AREG_IO_URING != 0)
+            if (mRing != nullptr)
+            {
+                mRing->remove(static_cast<int>(hSocket));
+            }
+            else
+#endif  // (AREG_IO_URING != 0)
+            {
+                struct epoll_event ev{};
+                ::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_DEL, static_cast<int>(hSocket), &ev);
+            }
 
             *it = mSockets.back();
             mSockets.pop_back();
@@ -153,10 +501,19 @@ bool areg::SocketMultiplexer::unregister_socket(SOCKETHANDLE hSocket) noexcept
 
 void areg::SocketMultiplexer::reset() noexcept
 {
-    for (SOCKETHANDLE s : mSockets)
+#if (AREG_IO_URING != 0)
+    if (mRing != nullptr)
     {
-        struct epoll_event ev{};
-        ::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_DEL, static_cast<int>(s), &ev);
+        mRing->remove_all(static_cast<int>(mWakeupReadFd));
+    }
+    else
+#endif  // (AREG_IO_URING != 0)
+    {
+        for (SOCKETHANDLE s : mSockets)
+        {
+            struct epoll_event ev{};
+            ::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_DEL, static_cast<int>(s), &ev);
+        }
     }
 
     mSockets.clear();
@@ -194,69 +551,62 @@ SOCKETHANDLE areg::SocketMultiplexer::wait(int32_t timeoutMs) const noexcept
         return areg::FailedSocketHandle;
     }
 
-    if (mEpollFd == areg::InvalidSocketHandle)
+    if ((mEpollFd == areg::InvalidSocketHandle) && (mRing == nullptr))
         return areg::FailedSocketHandle;
 
-    // Serve cached results from the previous epoll_wait batch before issuing another syscall.
-    if (mBatchIdx < mBatchCount)
+    // Serve cached results from the previous batch before issuing another syscall.
+    if (mBatchIdx >= mBatchCount)
     {
-        const SOCKETHANDLE fd   = mBatchFds[mBatchIdx];
-        const uint32_t evFlags  = mBatchEvents[mBatchIdx];
-        ++mBatchIdx;
-
-        if (fd == mWakeupReadFd)
+#if (AREG_IO_URING != 0)
+        if (mRing != nullptr)
         {
-            drain_eventfd(static_cast<int>(mWakeupReadFd));
-            mBatchCount = mBatchIdx = 0u;
-            // Hard reset -> FailedSocketHandle; soft wakeup() -> InvalidSocketHandle.
-            return mIsReset.load(std::memory_order_acquire) ? areg::FailedSocketHandle : areg::InvalidSocketHandle;
+            SOCKETHANDLE result{ areg::InvalidSocketHandle };
+            if (mRing->collect(*this, timeoutMs, result) == false)
+                return result;
         }
-
-        // If the socket has error/hangup with NO readable data, remove it from
-        // the epoll interest list to prevent busy re-firing.
-        if ((evFlags & EPOLLIN) == 0 && (evFlags & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) != 0)
+        else
+#endif  // (AREG_IO_URING != 0)
         {
-            struct epoll_event ev{};
-            ::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_DEL, static_cast<int>(fd), &ev);
-        }
-
-        return fd;
-    }
+            struct epoll_event events[DEFAULT_DRAIN_LIMIT];
+            const int n = ::epoll_wait(static_cast<int>(mEpollFd), events, DEFAULT_DRAIN_LIMIT, timeoutMs);
 
-    struct epoll_event events[DEFAULT_DRAIN_LIMIT];
-    const int n = ::epoll_wait(static_cast<int>(mEpollFd), events, DEFAULT_DRAIN_LIMIT, timeoutMs);
+            if (n < 0)
+                return (errno == EINTR) ? areg::InvalidSocketHandle : areg::FailedSocketHandle;
+            else if (n == 0)
+                return areg::InvalidSocketHandle;   // timeout
 
-    if (n < 0)
-        return (errno == EINTR) ? areg::InvalidSocketHandle : areg::FailedSocketHandle;
-    else if (n == 0)
-        return areg::InvalidSocketHandle;   // timeout
-
-    mBatchCount = mBatchIdx = 0u;
-    for (int i = 1; i < n; ++i)
-    {
-        mBatchFds[mBatchCount]    = static_cast<SOCKETHANDLE>(events[i].data.fd);
-        mBatchEvents[mBatchCount] = events[i].events;
-        ++mBatchCount; 
+            mBatchCount = mBatchIdx = 0u;
+            for (int i = 0; i < n; ++i)
+            {
+                mBatchFds[mBatchCount]    = static_cast<SOCKETHANDLE>(events[i].data.fd);
+                mBatchEvents[mBatchCount] = events[i].events;
+                ++mBatchCount;
+            }
+        }
     }
 
-    const SOCKETHANDLE first    = static_cast<SOCKETHANDLE>(events[0].data.fd);
-    const uint32_t     firstEv  = events[0].events;
-    if (first == mWakeupReadFd)
+    const SOCKETHANDLE fd   = mBatchFds[mBatchIdx];
+    const uint32_t evFlags  = mBatchEvents[mBatchIdx];
+    ++mBatchIdx;
+
+    if (fd == mWakeupReadFd)
     {
         drain_eventfd(static_cast<int>(mWakeupReadFd));
         mBatchCount = mBatchIdx = 0u;
-        // Hard reset --> FailedSocketHandle; soft wakeup() --> InvalidSocketHandle.
+        // Hard reset -> FailedSocketHandle; soft wakeup() -> InvalidSocketHandle.
         return mIsReset.load(std::memory_order_acquire) ? areg::FailedSocketHandle : areg::InvalidSocketHandle;
     }
 
-    // Same error-only handling for the first event returned directly.
-    if ((firstEv & EPOLLIN) == 0 && (firstEv & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) != 0)
+    // If the socket has error/hangup with NO readable data, remove it from
+    // the epoll interest list to prevent busy re-firing. The io_uring backend
+    // does not poll such a socket again.
+    if ((mRing == nullptr) && ((evFlags & EPOLLIN) == 0) && ((evFlags & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) != 0))
     {
         struct epoll_event ev{};
-        ::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_DEL, static_cast<int>(first), &ev);
+        ::epoll_ctl(static_cast<int>(mEpollFd), EPOLL_CTL_DEL, static_cast<int>(fd), &ev);
     }
 
-    return first;
+    return fd;
 }
 
 #endif  // __linux__
@@ -24,6 +24,7 @@
 #include "areg/base/DateTime.hpp"
 #include "areg/base/UtilityDefs.hpp"
 #include "areg/base/Containers.hpp"
+#include "areg/base/SocketDefs.hpp"
 
 #include <fcntl.h>
 #include <dirent.h>
@@ -35,6 +36,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <filesystem>
@@ -291,6 +293,52 @@ uint32_t File::_os_write_file(const uint8_t* buffer, uint32_t size) noexcept
     return result;
 }
 
+uint32_t File::_os_write_gather(const areg::IoBuffer* buffers, uint32_t count) noexcept
+{
+    ASSERT(mFileHandle != _os_invalid_handle());
+    ASSERT((buffers != nullptr) && (count != 0));
+
+    constexpr uint32_t  MAX_IOV{ 64u };
+    PosixFile file{ mFileHandle };
+    struct iovec iov[MAX_IOV];
+    uint32_t result{ 0u };
+
+    while (count != 0u)
+    {
+        const uint32_t chunk{ count < MAX_IOV ? count : MAX_IOV };
+        size_t expected{ 0u };
+        for (uint32_t i = 0u; i < chunk; ++i)
+        {
+            iov[i].iov_base = const_cast<uint8_t*>(buffers[i].data);
+            iov[i].iov_len  = buffers[i].size;
+            expected       += buffers[i].size;
+        }
+
+        // Writes to a regular file complete, short writes only happen on errors (disk full).
+        const ssize_t written = ::writev(file.fd, iov, static_cast<int>(chunk));
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            AREG_OUTPUT_ERR("Failed to write [ %d ] buffers of data to file [ %s ]. Error code [ %p ].", static_cast<int32_t>(chunk), mFileName.as_string(), static_cast<id_type>(errno));
+            break;
+        }
+
+        result += static_cast<uint32_t>(written);
+        if (static_cast<size_t>(written) != expected)
+        {
+            AREG_OUTPUT_ERR("Wrote [ %d ] of [ %d ] bytes of data to file [ %s ].", static_cast<int32_t>(written), static_cast<int32_t>(expected), mFileName.as_string());
+            break;
+        }
+
+        buffers += chunk;
+        count   -= chunk;
+    }
+
+    return result;
+}
+
 uint32_t File::_os_set_position(int32_t offset, Cursor::SeekOrigin startAt) const noexcept
 {
     ASSERT(mFileHandle != _os_invalid_handle());
@@ -0,0 +1,212 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/private/posix/SharedMemoryChannelPosix.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, two byte rings in a named shared memory segment.
+ *              POSIX part: shm_open / mmap segment, futex doorbells.
+ ************************************************************************/
+
+#if defined(_POSIX) || defined(POSIX)
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/SharedMemoryChannel.hpp"
+
+#include "areg/base/Process.hpp"
+#include "areg/base/Thread.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+
+#if defined(__APPLE__)
+
+extern "C" {
+    int __ulock_wait(uint32_t operation, void* addr, uint64_t value, uint32_t timeout_us);
+    int __ulock_wake(uint32_t operation, void* addr, uint64_t wake_value);
+}
+
+#elif defined(__linux__)
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#endif  // defined(__APPLE__) / defined(__linux__)
+
+namespace {
+
+    //!< The prefix of the names of the segments.
+    constexpr std::string_view  SEGMENT_PREFIX  { "/areg." };
+
+#if defined(__APPLE__)
+    //!< __ulock operation to wait on a word shared between processes (UL_COMPARE_AND_WAIT_SHARED).
+    constexpr uint32_t          ULOCK_SHARED    { 3u };
+    //!< __ulock_wake flag to release every parked waiter (ULF_WAKE_ALL).
+    constexpr uint32_t          ULOCK_WAKE_ALL  { 0x00000100u };
+#endif  // defined(__APPLE__)
+
+    //!< The sequence number of the segments created by this process.
+    std::atomic<uint32_t>       _sequence       { 0u };
+
+    /**
+     * \brief   Maps the segment of the opened shared memory object and closes the descriptor.
+     **/
+    uint8_t * _map_segment( int fd, uint32_t size )
+    {
+        void * addr{ ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) };
+        ::close(fd);
+        return (addr != MAP_FAILED ? reinterpret_cast<uint8_t *>(addr) : nullptr);
+    }
+
+} // namespace
+
+namespace areg {
+
+bool SharedMemoryChannel::_os_create( uint32_t segmentSize )
+{
+    const uint32_t seq{ _sequence.fetch_add(1u, std::memory_order_relaxed) };
+    String name;
+    name.format("%.*s%u.%u", static_cast<int>(SEGMENT_PREFIX.length()), SEGMENT_PREFIX.data(), static_cast<uint32_t>(Process::instance().id()), seq);
+
+    int fd{ ::shm_open(name.as_string(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR) };
+    if ((fd < 0) && (errno == EEXIST))
+    {
+        // The name is left by a crashed process that had the same process ID.
+        ::shm_unlink(name.as_string());
+        fd = ::shm_open(name.as_string(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    }
+
+    if (fd < 0)
+        return false;
+
+    uint8_t * segment{ nullptr };
+    if (::ftruncate(fd, static_cast<off_t>(segmentSize)) == 0)
+    {
+        segment = _map_segment(fd, segmentSize);
+    }
+    else
+    {
+        ::close(fd);
+    }
+
+    if (segment == nullptr)
+    {
+        ::shm_unlink(name.as_string());
+        return false;
+    }
+
+    mName       = name;
+    mSegment    = segment;
+    mSegmentSize= segmentSize;
+    return true;
+}
+
+bool SharedMemoryChannel::_os_open( const String & name, uint32_t & segmentSize )
+{
+    if (name.starts_with(SEGMENT_PREFIX) == false)
+        return false;
+
+    const int fd{ ::shm_open(name.as_string(), O_RDWR, 0) };
+    if (fd < 0)
+        return false;
+
+    struct stat info {};
+    if ((::fstat(fd, &info) != 0) || (info.st_size <= 0) || (static_cast<uint64_t>(info.st_size) > UINT32_MAX))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    const uint32_t size{ static_cast<uint32_t>(info.st_size) };
+    uint8_t * segment{ _map_segment(fd, size) };
+    if (segment == nullptr)
+        return false;
+
+    mName       = name;
+    mSegment    = segment;
+    mSegmentSize= size;
+    segmentSize = size;
+    return true;
+}
+
+void SharedMemoryChannel::_os_close() noexcept
+{
+    ::munmap(mSegment, mSegmentSize);
+}
+
+void SharedMemoryChannel::_os_remove_name() noexcept
+{
+    ::shm_unlink(mName.as_string());
+}
+
+void SharedMemoryChannel::_os_wait( std::atomic<uint32_t> & word, uint32_t value, uint32_t /*bell*/, uint32_t timeoutMs ) noexcept
+{
+#if defined(__linux__)
+
+    struct timespec   ts {};
+    struct timespec * pts { nullptr };
+    if (timeoutMs != areg::WAIT_INFINITE)
+    {
+        ts.tv_sec  = static_cast<time_t>(timeoutMs / 1000u);
+        ts.tv_nsec = static_cast<long>(timeoutMs % 1000u) * 1000000L;
+        pts = &ts;
+    }
+
+    // Not the private futex: the word is shared with the other process.
+    ::syscall(SYS_futex, &word, FUTEX_WAIT, value, pts, nullptr, 0);
+
+#elif defined(__APPLE__)
+
+    uint32_t us { 0u };     // 0 == infinite for __ulock_wait
+    if (timeoutMs != areg::WAIT_INFINITE)
+    {
+        const uint64_t micros { static_cast<uint64_t>(timeoutMs) * 1000u };
+        us = static_cast<uint32_t>(std::min<uint64_t>(micros, static_cast<uint64_t>(UINT32_MAX)));
+    }
+
+    ::__ulock_wait(ULOCK_SHARED, &word, value, us);
+
+#else   // Other POSIX systems have no address wait between processes.
+
+    if (word.load(std::memory_order_acquire) == value)
+    {
+        Thread::sleep(std::min<uint32_t>(timeoutMs, 1u));
+    }
+
+#endif  // defined(__linux__) / defined(__APPLE__)
+}
+
+void SharedMemoryChannel::_os_wake( std::atomic<uint32_t> & word, uint32_t /*bell*/ ) noexcept
+{
+#if defined(__linux__)
+
+    ::syscall(SYS_futex, &word, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+
+#elif defined(__APPLE__)
+
+    ::__ulock_wake(ULOCK_SHARED | ULOCK_WAKE_ALL, &word, 0u);
+
+#else   // The waiting side polls.
+
+    (void)word;
+
+#endif  // defined(__linux__) / defined(__APPLE__)
+}
+
+} // namespace areg
+
+#endif  // defined(_POSIX) || defined(POSIX)
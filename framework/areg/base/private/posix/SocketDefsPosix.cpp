@@ -22,6 +22,7 @@
 #include "areg/base/SyncPrimitives.hpp"
 #include "areg/base/areg_macros.h"
 #include "areg/base/MemoryDefs.hpp"
+#include "areg/base/File.hpp"
 #include "areg/logging/areg_log.h"
 #include "areg/ipc/private/ConnectionDefs.hpp"
 
@@ -30,6 +31,7 @@
 #include <sys/select.h>
 #include <sys/ioctl.h>
 #include <sys/uio.h>
+#include <sys/stat.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <netdb.h>
@@ -37,6 +39,18 @@
 #include <arpa/inet.h>
 #include <ctype.h>      // IEEE Std 1003.1-2001
 #include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+    #include <linux/errqueue.h>
+#endif
+
+#if defined(__linux__) && defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+    #define AREG_MSG_ZEROCOPY
+#endif
+
+#include <algorithm>
 
 namespace areg::os {
 
@@ -480,6 +494,135 @@ int32_t _os_recv_data_window(SOCKETHANDLE hSocket, uint8_t* dataBuffer, int32_t
     return total;
 }
 
+int32_t _os_recv_some(SOCKETHANDLE hSocket, uint8_t* dataBuffer, int32_t dataLength)
+{
+    ASSERT(areg::is_valid_socket(hSocket));
+    ASSERT((dataBuffer != nullptr) && (dataLength > 0));
+
+    for ( ; ; )
+    {
+        const ssize_t received = ::recv(hSocket, reinterpret_cast<char*>(dataBuffer), static_cast<size_t>(dataLength), 0);
+        if (received > 0)
+            return static_cast<int32_t>(received);
+        else if (received == 0 || errno != EINTR)
+            return -1;
+    }
+}
+
+bool _os_zerocopy_enable(SOCKETHANDLE hSocket) noexcept
+{
+#if defined(AREG_MSG_ZEROCOPY)
+    int enable{ 1 };
+    return (::setsockopt(hSocket, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) == 0);
+#else   // defined(AREG_MSG_ZEROCOPY)
+    return false;
+#endif  // defined(AREG_MSG_ZEROCOPY)
+}
+
+int32_t _os_send_data_zerocopy(SOCKETHANDLE hSocket, const uint8_t* dataBuffer, int32_t dataLength, uint32_t& sends) noexcept
+{
+    ASSERT(areg::is_valid_socket(hSocket));
+    ASSERT((dataBuffer != nullptr) && (dataLength > 0));
+
+    sends = 0u;
+#if defined(AREG_MSG_ZEROCOPY)
+    int32_t written{ 0 };
+    while (written < dataLength)
+    {
+        const ssize_t sent = ::send(hSocket, reinterpret_cast<const char*>(dataBuffer + written), static_cast<size_t>(dataLength - written), MSG_NOSIGNAL | MSG_ZEROCOPY);
+        if (sent > 0)
+        {
+            // Every send that took data uses the next id, even if it took only a part.
+            ++ sends;
+            written += static_cast<int32_t>(sent);
+        }
+        else if ((sent < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else if ((sent < 0) && (errno == ENOBUFS))
+        {
+            // The kernel cannot pin more pages, the rest is sent by copying.
+            break;
+        }
+        else
+        {
+            return -1;
+        }
+    }
+
+    return written;
+#else   // defined(AREG_MSG_ZEROCOPY)
+    return 0;
+#endif  // defined(AREG_MSG_ZEROCOPY)
+}
+
+int32_t _os_zerocopy_completions(SOCKETHANDLE hSocket, areg::ZeroCopyDone* done, uint32_t count, uint32_t timeoutMs) noexcept
+{
+    ASSERT(areg::is_valid_socket(hSocket));
+    ASSERT((done != nullptr) && (count != 0u));
+
+#if defined(AREG_MSG_ZEROCOPY)
+    if (timeoutMs != 0u)
+    {
+        // The pending completion sets POLLERR, which poll() reports without asking for it.
+        struct pollfd pfd { hSocket, 0, 0 };
+        const int result = ::poll(&pfd, 1, static_cast<int>(timeoutMs));
+        if ((result < 0) && (errno != EINTR))
+            return -1;
+    }
+
+    int32_t result{ 0 };
+    while (static_cast<uint32_t>(result) < count)
+    {
+        alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(struct sock_extended_err)) + CMSG_SPACE(sizeof(struct sockaddr_in6))];
+        struct msghdr msg {};
+        msg.msg_control     = control;
+        msg.msg_controllen  = sizeof(control);
+
+        if (::recvmsg(hSocket, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            return ((errno == EAGAIN) || (errno == EWOULDBLOCK) ? result : -1);
+        }
+
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            const bool isError{ ((cmsg->cmsg_level == SOL_IP) && (cmsg->cmsg_type == IP_RECVERR)) || ((cmsg->cmsg_level == SOL_IPV6) && (cmsg->cmsg_type == IPV6_RECVERR)) };
+            if (!isError)
+                continue;
+
+            struct sock_extended_err err {};
+            ::memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+            if ((err.ee_errno != 0) || (err.ee_origin != SO_EE_ORIGIN_ZEROCOPY))
+                continue;
+
+            areg::ZeroCopyDone& entry{ done[result ++] };
+            entry.first  = err.ee_info;
+            entry.last   = err.ee_data;
+            entry.copied = ((err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0);
+            break;
+        }
+    }
+
+    return result;
+#else   // defined(AREG_MSG_ZEROCOPY)
+    return 0;
+#endif  // defined(AREG_MSG_ZEROCOPY)
+}
+
+SOCKETHANDLE _os_zerocopy_retain(SOCKETHANDLE hSocket) noexcept
+{
+#if defined(AREG_MSG_ZEROCOPY)
+    const int result{ ::fcntl(hSocket, F_DUPFD_CLOEXEC, 0) };
+    return (result >= 0 ? static_cast<SOCKETHANDLE>(result) : areg::InvalidSocketHandle);
+#else   // defined(AREG_MSG_ZEROCOPY)
+    return areg::InvalidSocketHandle;
+#endif  // defined(AREG_MSG_ZEROCOPY)
+}
+
 bool _os_connect_socket(SOCKETHANDLE hSocket, const void* addr, uint32_t addrLen, uint32_t timeoutMs)
 {
     ASSERT(areg::is_valid_socket(hSocket));
@@ -532,6 +675,55 @@ bool _os_connect_socket(SOCKETHANDLE hSocket, const void* addr, uint32_t addrLen
     return true;
 }
 
+namespace
+{
+    /**
+     * \brief   Returns true if \a dir is a directory, not a link, of the user \a uid, which
+     *          the other users can neither read nor write.
+     **/
+    bool _is_private_dir(const char* dir, uid_t uid) noexcept
+    {
+        struct stat info;
+        return (::lstat(dir, &info) == RETURNED_OK) && S_ISDIR(info.st_mode) &&
+               (info.st_uid == uid) && ((info.st_mode & (S_IRWXG | S_IRWXO)) == 0);
+    }
+}
+
+areg::String _os_local_socket_dir()
+{
+    const uid_t uid{ ::geteuid() };
+    const char* runtime{ ::getenv("XDG_RUNTIME_DIR") };
+    if ((runtime != nullptr) && (*runtime == '/') && _is_private_dir(runtime, uid))
+        return areg::String(runtime);
+
+    // The directory is created with the mode 0700. If another user created it first, it fails the check.
+    areg::String dir;
+    dir.format("%s/areg-%u", areg::File::temp_dir().as_string(), static_cast<uint32_t>(uid));
+    if ((::mkdir(dir.as_string(), S_IRWXU) != RETURNED_OK) && (errno != EEXIST))
+        return areg::String();
+
+    return (_is_private_dir(dir.as_string(), uid) ? dir : areg::String());
+}
+
+bool _os_local_socket_owned(const areg::String& path) noexcept
+{
+    struct stat info;
+    return (::lstat(path.as_string(), &info) == RETURNED_OK) && S_ISSOCK(info.st_mode) && (info.st_uid == ::geteuid());
+}
+
+bool _os_local_peer_owned(SOCKETHANDLE hSocket) noexcept
+{
+#if defined(SO_PEERCRED)
+    struct ucred cred;
+    socklen_t len{ sizeof(cred) };
+    return (::getsockopt(hSocket, SOL_SOCKET, SO_PEERCRED, &cred, &len) == RETURNED_OK) && (cred.uid == ::geteuid());
+#else   // defined(SO_PEERCRED)
+    uid_t uid{ };
+    gid_t gid{ };
+    return (::getpeereid(hSocket, &uid, &gid) == RETURNED_OK) && (uid == ::geteuid());
+#endif  // defined(SO_PEERCRED)
+}
+
 bool _os_control(SOCKETHANDLE hSocket, int32_t cmd, unsigned long& arg)
 {
     ASSERT(areg::is_valid_socket(hSocket));
@@ -545,6 +737,240 @@ bool _os_get_option(SOCKETHANDLE hSocket, int32_t level, int32_t name, unsigned
     return (RETURNED_OK == ::getsockopt(static_cast<int>(hSocket), level, name, reinterpret_cast<char*>(&value), &len));
 }
 
+bool _os_wait_readable(SOCKETHANDLE hSocket, uint32_t timeoutMs)
+{
+    struct pollfd fd { static_cast<int>(hSocket), POLLIN, 0 };
+    int result{ 0 };
+    do
+    {
+        result = ::poll(&fd, 1, static_cast<int>(timeoutMs));
+    } while ((result < 0) && (errno == EINTR));
+
+    // POLLHUP, POLLERR and POLLNVAL are reported as readable: the receive call fails at once.
+    return (result != 0);
+}
+
+bool _os_datagram_configure(SOCKETHANDLE hSocket) noexcept
+{
+    const int flags{ ::fcntl(static_cast<int>(hSocket), F_GETFL, 0) };
+    return (flags != -1) && (::fcntl(static_cast<int>(hSocket), F_SETFL, flags | O_NONBLOCK) != -1);
+}
+
+namespace
+{
+    //!< The flags of the datagram calls, the socket never waits and never raises SIGPIPE.
+#if defined(MSG_NOSIGNAL)
+    constexpr int   DATAGRAM_FLAGS  { MSG_NOSIGNAL | MSG_DONTWAIT };
+#else
+    constexpr int   DATAGRAM_FLAGS  { MSG_DONTWAIT };
+#endif
+
+    //!< The largest batch passed to the kernel in one call.
+    constexpr uint32_t  DATAGRAM_BATCH  { 64u };
+
+    //!< Returns true if the error of a datagram call means the socket itself is not usable.
+    inline bool _socket_failed(int error) noexcept
+    {
+        return (error == EBADF) || (error == ENOTSOCK) || (error == EINVAL) || (error == EFAULT);
+    }
+
+    //!< Fills the message header and the address of one outgoing datagram.
+    inline void _datagram_out(const areg::DatagramOut& datagram, struct msghdr& msg, struct iovec* iov, struct sockaddr_in& addr) noexcept
+    {
+        addr.sin_family     = AF_INET;
+        addr.sin_port       = datagram.peer.port;
+        addr.sin_addr.s_addr= datagram.peer.address;
+
+        uint32_t parts{ 0u };
+        for (const areg::IoBuffer& part : datagram.parts)
+        {
+            if (part.size != 0u)
+            {
+                iov[parts].iov_base = const_cast<uint8_t *>(part.data);
+                iov[parts].iov_len  = part.size;
+                ++ parts;
+            }
+        }
+
+        msg.msg_name    = &addr;
+        msg.msg_namelen = sizeof(sockaddr_in);
+        msg.msg_iov     = iov;
+        msg.msg_iovlen  = parts;
+    }
+}
+
+int32_t _os_datagram_send(SOCKETHANDLE hSocket, const areg::DatagramOut* datagrams, uint32_t count) noexcept
+{
+    uint32_t sent{ 0u };
+
+#if defined(__linux__)
+
+    struct mmsghdr msgs[DATAGRAM_BATCH];
+    struct iovec iov[DATAGRAM_BATCH][2];
+    struct sockaddr_in addr[DATAGRAM_BATCH];
+
+    while (sent < count)
+    {
+        const uint32_t batch{ std::min<uint32_t>(count - sent, DATAGRAM_BATCH) };
+        areg::mem_zero(msgs, sizeof(mmsghdr) * batch);
+        areg::mem_zero(addr, sizeof(sockaddr_in) * batch);
+        for (uint32_t i = 0u; i < batch; ++ i)
+        {
+            _datagram_out(datagrams[sent + i], msgs[i].msg_hdr, iov[i], addr[i]);
+        }
+
+        const int result{ ::sendmmsg(static_cast<int>(hSocket), msgs, batch, DATAGRAM_FLAGS) };
+        if (result > 0)
+        {
+            sent += static_cast<uint32_t>(result);
+            if (static_cast<uint32_t>(result) < batch)
+                break;  // the send buffer is full
+        }
+        else if (errno == EINTR)
+        {
+            continue;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == ENOBUFS))
+        {
+            break;
+        }
+        else if (_socket_failed(errno))
+        {
+            return (sent != 0u ? static_cast<int32_t>(sent) : -1);
+        }
+        else
+        {
+            // The first datagram of the batch is refused, e.g. it is too large: skip it.
+            ++ sent;
+        }
+    }
+
+#else   // !defined(__linux__)
+
+    struct iovec iov[2];
+    struct sockaddr_in addr;
+    while (sent < count)
+    {
+        struct msghdr msg { };
+        areg::mem_zero(&addr, sizeof(sockaddr_in));
+        _datagram_out(datagrams[sent], msg, iov, addr);
+        if (::sendmsg(static_cast<int>(hSocket), &msg, DATAGRAM_FLAGS) >= 0)
+        {
+            ++ sent;
+        }
+        else if (errno == EINTR)
+        {
+            continue;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == ENOBUFS))
+        {
+            break;
+        }
+        else if (_socket_failed(errno))
+        {
+            return (sent != 0u ? static_cast<int32_t>(sent) : -1);
+        }
+        else
+        {
+            ++ sent;
+        }
+    }
+
+#endif  // defined(__linux__)
+
+    return static_cast<int32_t>(sent);
+}
+
+int32_t _os_datagram_receive(SOCKETHANDLE hSocket, areg::DatagramIn* datagrams, uint32_t count) noexcept
+{
+    uint32_t received{ 0u };
+
+#if defined(__linux__)
+
+    struct mmsghdr msgs[DATAGRAM_BATCH];
+    struct iovec iov[DATAGRAM_BATCH];
+    struct sockaddr_in addr[DATAGRAM_BATCH];
+
+    while (received < count)
+    {
+        const uint32_t batch{ std::min<uint32_t>(count - received, DATAGRAM_BATCH) };
+        areg::mem_zero(msgs, sizeof(mmsghdr) * batch);
+        for (uint32_t i = 0u; i < batch; ++ i)
+        {
+            areg::DatagramIn & datagram{ datagrams[received + i] };
+            iov[i].iov_base = datagram.data;
+            iov[i].iov_len  = datagram.capacity;
+            msgs[i].msg_hdr.msg_name    = &addr[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            msgs[i].msg_hdr.msg_iov     = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        const int result{ ::recvmmsg(static_cast<int>(hSocket), msgs, batch, DATAGRAM_FLAGS, nullptr) };
+        if (result > 0)
+        {
+            for (int i = 0; i < result; ++ i)
+            {
+                areg::DatagramIn & datagram{ datagrams[received + static_cast<uint32_t>(i)] };
+                const bool truncated{ (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) != 0 };
+                datagram.size       = truncated ? 0u : static_cast<uint32_t>(msgs[i].msg_len);
+                datagram.peer.address = static_cast<uint32_t>(addr[i].sin_addr.s_addr);
+                datagram.peer.port  = addr[i].sin_port;
+            }
+
+            received += static_cast<uint32_t>(result);
+            if (static_cast<uint32_t>(result) < batch)
+                break;  // no more datagrams
+        }
+        else if ((result < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else if ((result == 0) || (errno == EAGAIN) || (errno == EWOULDBLOCK) || (_socket_failed(errno) == false))
+        {
+            break;
+        }
+        else
+        {
+            return (received != 0u ? static_cast<int32_t>(received) : -1);
+        }
+    }
+
+#else   // !defined(__linux__)
+
+    while (received < count)
+    {
+        areg::DatagramIn & datagram{ datagrams[received] };
+        struct sockaddr_in addr;
+        areg::mem_zero(&addr, sizeof(sockaddr_in));
+        socklen_t len{ sizeof(sockaddr_in) };
+        const ssize_t result{ ::recvfrom(static_cast<int>(hSocket), datagram.data, datagram.capacity, DATAGRAM_FLAGS, reinterpret_cast<sockaddr *>(&addr), &len) };
+        if (result >= 0)
+        {
+            datagram.size       = static_cast<uint32_t>(result);
+            datagram.peer.address = static_cast<uint32_t>(addr.sin_addr.s_addr);
+            datagram.peer.port  = addr.sin_port;
+            ++ received;
+        }
+        else if (errno == EINTR)
+        {
+            continue;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (_socket_failed(errno) == false))
+        {
+            break;
+        }
+        else
+        {
+            return (received != 0u ? static_cast<int32_t>(received) : -1);
+        }
+    }
+
+#endif  // defined(__linux__)
+
+    return static_cast<int32_t>(received);
+}
+
 } // namespace areg::os
 
 #endif  // defined(_POSIX) || defined(POSIX)
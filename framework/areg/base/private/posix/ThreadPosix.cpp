@@ -32,14 +32,22 @@
 #include <sched.h>
 #include <time.h>
 #include <errno.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 
+#if defined(__linux__)
+    #include <stdio.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif  // defined(__linux__)
+
 #ifdef min
     #undef min
 #endif // min
 #ifdef max
     #undef max
 #endif // max
+#include <algorithm>
 #include <limits>
 
 #if __has_include(<sys/unistd.h>)
@@ -59,6 +67,50 @@ namespace {
         pthread_attr_t  pthreadAttr;    //!< The POSIX thread attribute
     };
 
+#if defined(__linux__)
+
+    //!< The memory policy preferring the node, see <linux/mempolicy.h>.
+    constexpr int               LINUX_MPOL_PREFERRED    { 1 };
+    //!< The highest NUMA node the node masks can address.
+    constexpr int32_t           LINUX_MAX_NUMA_NODE     { 1023 };
+    constexpr uint32_t          LINUX_MASK_BITS         { static_cast<uint32_t>(sizeof(unsigned long) * 8u) };
+
+    //!< The node mask of the system calls with the bit of one node set.
+    struct NumaNodeMask
+    {
+        unsigned long   mask[(LINUX_MAX_NUMA_NODE + 1) / LINUX_MASK_BITS]{ };
+
+        explicit NumaNodeMask(int32_t numaNode) noexcept
+        {
+            mask[static_cast<uint32_t>(numaNode) / LINUX_MASK_BITS] = 1ul << (static_cast<uint32_t>(numaNode) % LINUX_MASK_BITS);
+        }
+
+        //!< The number of bits in the mask, plus one as the system calls expect.
+        static constexpr unsigned long max_node() noexcept
+        {
+            return static_cast<unsigned long>(LINUX_MAX_NUMA_NODE) + 2ul;
+        }
+    };
+
+    //!< Reads the CPU cores of the NUMA node from sysfs.
+    areg::String _numa_node_cpus(int32_t numaNode)
+    {
+        char path[64]{ 0 };
+        char line[1024]{ 0 };
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", static_cast<int>(numaNode));
+        FILE* file = fopen(path, "r");
+        if (file == nullptr)
+            return areg::String();
+
+        const bool read{ fgets(line, sizeof(line), file) != nullptr };
+        fclose(file);
+        areg::String result(read ? line : "");
+        result.trim_all();
+        return result;
+    }
+
+#endif  // defined(__linux__)
+
 } // namespace
 
 namespace areg {
@@ -303,6 +355,117 @@ Thread::ThreadPriority Thread::_os_set_priority(ThreadPriority newPriority) noex
     return oldPrio;
 }
 
+void Thread::_os_apply_placement(const Thread::ThreadPlacement& placement)
+{
+    const pthread_t self{ ::pthread_self() };
+
+#if defined(__linux__)
+
+    const bool hasNode{ (placement.numaNode >= 0) && (placement.numaNode <= LINUX_MAX_NUMA_NODE) };
+    std::vector<uint32_t> cpus;
+    if (Thread::parse_cpu_list(placement.cpus, cpus) || (hasNode && Thread::parse_cpu_list(_numa_node_cpus(placement.numaNode), cpus)))
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (uint32_t cpu : cpus)
+        {
+            if (cpu < static_cast<uint32_t>(CPU_SETSIZE))
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+
+        if (::pthread_setaffinity_np(self, sizeof(cpu_set_t), &cpuSet) != RETURNED_OK)
+        {
+            AREG_OUTPUT_ERR("Cannot set the CPU affinity [ %s ] of the thread, failed with error code [ %d ].", placement.cpus.as_string(), errno);
+        }
+    }
+
+    if (hasNode)
+    {
+        // The memory the thread allocates from now on prefers the node.
+        NumaNodeMask nodeMask(placement.numaNode);
+        if (::syscall(SYS_set_mempolicy, LINUX_MPOL_PREFERRED, nodeMask.mask, NumaNodeMask::max_node()) != 0)
+        {
+            AREG_OUTPUT_ERR("Cannot set the NUMA node [ %d ] of the thread, failed with error code [ %d ].", placement.numaNode, errno);
+        }
+    }
+
+#endif  // defined(__linux__)
+
+    int32_t schedPolicy{ -1 };
+    switch (placement.policy)
+    {
+    case Thread::SchedPolicy::Normal:
+        schedPolicy = SCHED_OTHER;
+        break;
+
+    case Thread::SchedPolicy::Fifo:
+        schedPolicy = SCHED_FIFO;
+        break;
+
+    case Thread::SchedPolicy::RoundRobin:
+        schedPolicy = SCHED_RR;
+        break;
+
+    case Thread::SchedPolicy::Default:  // fall through
+    default:
+        break;
+    }
+
+    if (schedPolicy != -1)
+    {
+        const int32_t minPriority{ sched_get_priority_min(schedPolicy) };
+        const int32_t maxPriority{ sched_get_priority_max(schedPolicy) };
+
+        struct sched_param schedParam {};
+        schedParam.sched_priority = std::clamp(placement.priority, minPriority, maxPriority);
+        if (::pthread_setschedparam(self, schedPolicy, &schedParam) != RETURNED_OK)
+        {
+            AREG_OUTPUT_ERR("Cannot set the scheduling policy [ %s ] with priority [ %d ] of the thread, failed with error code [ %d ]."
+                            , Thread::as_string(placement.policy)
+                            , schedParam.sched_priority
+                            , errno);
+        }
+    }
+}
+
+void * Thread::allocate_node_memory(size_t size, int32_t numaNode) noexcept
+{
+    if ((size == 0u) || (numaNode < Thread::NUMA_NODE_ANY))
+        return nullptr;
+
+    void * block{ ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+    if (block == MAP_FAILED)
+        return nullptr;
+
+    if (numaNode == Thread::NUMA_NODE_ANY)
+        return block;
+
+#if defined(__linux__)
+
+    // No page is touched yet: the policy decides where the pages are allocated, nothing is moved.
+    if (numaNode <= LINUX_MAX_NUMA_NODE)
+    {
+        NumaNodeMask nodeMask(numaNode);
+        if (::syscall(SYS_mbind, block, size, LINUX_MPOL_PREFERRED, nodeMask.mask, NumaNodeMask::max_node(), 0u) == 0)
+            return block;
+    }
+
+#endif  // defined(__linux__)
+
+    ::munmap(block, size);
+    return nullptr;
+}
+
+void Thread::free_node_memory(void * block, size_t size) noexcept
+{
+    if (block != nullptr)
+    {
+        ::munmap(block, size);
+    }
+}
+
 size_t Thread::_os_stack_size(THREADHANDLE handle) noexcept
 {
     size_t size{ 0u };
@@ -35,6 +35,7 @@
 #include "areg/base/Process.hpp"
 #include "areg/base/DateTime.hpp"
 #include "areg/base/UtilityDefs.hpp"
+#include "areg/base/SocketDefs.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // File class implementation
@@ -130,8 +131,9 @@ bool File::_os_open_file() noexcept
             if ((mFileMode & static_cast<uint32_t>(FileBase::OpenFlag::BitShareRead)) != 0)
                 shared |= FILE_SHARE_READ;
             
+            // The file shared for writing may also be renamed while it is open, as on POSIX.
             if ((mFileMode & static_cast<uint32_t>(FileBase::OpenFlag::BitShareWrite)) != 0)
-                shared |= FILE_SHARE_WRITE;
+                shared |= FILE_SHARE_WRITE | FILE_SHARE_DELETE;
             
             if ((mFileMode & static_cast<uint32_t>(FileBase::OpenFlag::BitCreateNew)) != 0)
                 creation |= CREATE_ALWAYS;
@@ -198,6 +200,28 @@ uint32_t File::_os_write_file(const uint8_t* buffer, uint32_t size) noexcept
     return static_cast<uint32_t>(sizeWrite);
 }
 
+uint32_t File::_os_write_gather(const areg::IoBuffer* buffers, uint32_t count) noexcept
+{
+    ASSERT(mFileHandle != _os_invalid_handle());
+    ASSERT((buffers != nullptr) && (count != 0));
+
+    // WriteFileGather() requires unbuffered page-aligned writes, the buffers are written one by one.
+    uint32_t result{ 0u };
+    for (uint32_t i = 0u; i < count; ++i)
+    {
+        if (buffers[i].size == 0u)
+            continue;
+
+        const uint32_t size{ static_cast<uint32_t>(buffers[i].size) };
+        const uint32_t written{ _os_write_file(buffers[i].data, size) };
+        result += written;
+        if (written != size)
+            break;
+    }
+
+    return result;
+}
+
 uint32_t File::_os_set_position(int32_t offset, Cursor::SeekOrigin startAt) const noexcept
 {
     ASSERT(mFileHandle != nullptr);
@@ -0,0 +1,179 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/base/private/win32/SharedMemoryChannelWin32.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, two byte rings in a named shared memory segment.
+ *              Windows part: named file mapping, named auto-reset event doorbells.
+ ************************************************************************/
+
+#ifdef  _WIN32
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/SharedMemoryChannel.hpp"
+
+#include "areg/base/Process.hpp"
+
+#ifndef NOMINMAX
+    #define NOMINMAX
+#endif  // NOMINMAX
+#include <Windows.h>
+
+namespace {
+
+    //!< The prefix of the names of the segments.
+    constexpr std::string_view  SEGMENT_PREFIX  { "Local\\areg." };
+
+    //!< The index of the file mapping handle, the doorbells use the indexes before it.
+    constexpr uint32_t          MAPPING_INDEX   { 4u };
+
+    //!< The sequence number of the segments created by this process.
+    std::atomic<uint32_t>       _sequence       { 0u };
+
+    /**
+     * \brief   Returns the name of the event of the doorbell of the segment.
+     **/
+    inline areg::String _bell_name( const areg::String & segment, uint32_t bell )
+    {
+        areg::String result;
+        result.format("%s.%u", segment.as_string(), bell);
+        return result;
+    }
+
+} // namespace
+
+namespace areg {
+
+bool SharedMemoryChannel::_os_create( uint32_t segmentSize )
+{
+    const uint32_t seq{ _sequence.fetch_add(1u, std::memory_order_relaxed) };
+    String name;
+    name.format("%.*s%u.%u", static_cast<int>(SEGMENT_PREFIX.length()), SEGMENT_PREFIX.data(), static_cast<uint32_t>(Process::instance().id()), seq);
+
+    HANDLE hMapping{ ::CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, segmentSize, name.as_string()) };
+    if ((hMapping != nullptr) && (::GetLastError() == ERROR_ALREADY_EXISTS))
+    {
+        ::CloseHandle(hMapping);
+        hMapping = nullptr;
+    }
+
+    void * addr{ hMapping != nullptr ? ::MapViewOfFile(hMapping, FILE_MAP_ALL_ACCESS, 0, 0, segmentSize) : nullptr };
+    if (addr == nullptr)
+    {
+        if (hMapping != nullptr)
+        {
+            ::CloseHandle(hMapping);
+        }
+
+        return false;
+    }
+
+    mName       = name;
+    mSegment    = reinterpret_cast<uint8_t *>(addr);
+    mSegmentSize= segmentSize;
+    mHandles[MAPPING_INDEX] = hMapping;
+
+    for (uint32_t i = 0u; i < DOORBELL_COUNT; ++ i)
+    {
+        mHandles[i] = ::CreateEventA(nullptr, FALSE, FALSE, _bell_name(name, i).as_string());
+        if (mHandles[i] == nullptr)
+        {
+            _os_close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SharedMemoryChannel::_os_open( const String & name, uint32_t & segmentSize )
+{
+    if (name.starts_with(SEGMENT_PREFIX) == false)
+        return false;
+
+    HANDLE hMapping{ ::OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.as_string()) };
+    void * addr{ hMapping != nullptr ? ::MapViewOfFile(hMapping, FILE_MAP_ALL_ACCESS, 0, 0, 0) : nullptr };
+    MEMORY_BASIC_INFORMATION info{ };
+    if ((addr == nullptr) || (::VirtualQuery(addr, &info, sizeof(info)) == 0) || (info.RegionSize > UINT32_MAX))
+    {
+        if (addr != nullptr)
+        {
+            ::UnmapViewOfFile(addr);
+        }
+
+        if (hMapping != nullptr)
+        {
+            ::CloseHandle(hMapping);
+        }
+
+        return false;
+    }
+
+    mName       = name;
+    mSegment    = reinterpret_cast<uint8_t *>(addr);
+    mSegmentSize= static_cast<uint32_t>(info.RegionSize);
+    mHandles[MAPPING_INDEX] = hMapping;
+
+    for (uint32_t i = 0u; i < DOORBELL_COUNT; ++ i)
+    {
+        mHandles[i] = ::OpenEventA(EVENT_MODIFY_STATE | SYNCHRONIZE, FALSE, _bell_name(name, i).as_string());
+        if (mHandles[i] == nullptr)
+        {
+            _os_close();
+            return false;
+        }
+    }
+
+    segmentSize = mSegmentSize;
+    return true;
+}
+
+void SharedMemoryChannel::_os_close() noexcept
+{
+    if (mSegment != nullptr)
+    {
+        ::UnmapViewOfFile(mSegment);
+        mSegment = nullptr;
+    }
+
+    for (void *& handle : mHandles)
+    {
+        if (handle != nullptr)
+        {
+            ::CloseHandle(handle);
+            handle = nullptr;
+        }
+    }
+}
+
+void SharedMemoryChannel::_os_remove_name() noexcept
+{
+    // The named objects are removed when the last handle is closed.
+}
+
+void SharedMemoryChannel::_os_wait( std::atomic<uint32_t> & word, uint32_t value, uint32_t bell, uint32_t timeoutMs ) noexcept
+{
+    // The auto-reset event stays signaled if the peer rang the bell before the wait.
+    if (word.load(std::memory_order_acquire) == value)
+    {
+        ::WaitForSingleObject(mHandles[bell], timeoutMs == areg::WAIT_INFINITE ? INFINITE : static_cast<DWORD>(timeoutMs));
+    }
+}
+
+void SharedMemoryChannel::_os_wake( std::atomic<uint32_t> & /*word*/, uint32_t bell ) noexcept
+{
+    ::SetEvent(mHandles[bell]);
+}
+
+} // namespace areg
+
+#endif  // _WIN32
@@ -22,6 +22,7 @@
 #include "areg/base/SyncPrimitives.hpp"
 #include "areg/base/areg_macros.h"
 #include "areg/base/MemoryDefs.hpp"
+#include "areg/base/File.hpp"
 
 #ifndef WIN32_LEAN_AND_MEAN
     #define WIN32_LEAN_AND_MEAN
@@ -271,6 +272,43 @@ int32_t _os_recv_data_window(SOCKETHANDLE hSocket, uint8_t* dataBuffer, int32_t
     return total;
 }
 
+int32_t _os_recv_some(SOCKETHANDLE hSocket, uint8_t* dataBuffer, int32_t dataLength)
+{
+    ASSERT(areg::is_valid_socket(hSocket));
+    ASSERT((dataBuffer != nullptr) && (dataLength > 0));
+
+    for ( ; ; )
+    {
+        const int32_t received = ::recv(hSocket, reinterpret_cast<char*>(dataBuffer), dataLength, 0);
+        if (received > 0)
+            return received;
+        else if (received == 0 || ::WSAGetLastError() != WSAEINTR)
+            return -1;
+    }
+}
+
+bool _os_zerocopy_enable(SOCKETHANDLE /*hSocket*/) noexcept
+{
+    // Winsock has no zero-copy send of the user buffers.
+    return false;
+}
+
+int32_t _os_send_data_zerocopy(SOCKETHANDLE /*hSocket*/, const uint8_t* /*dataBuffer*/, int32_t /*dataLength*/, uint32_t& sends) noexcept
+{
+    sends = 0u;
+    return 0;
+}
+
+int32_t _os_zerocopy_completions(SOCKETHANDLE /*hSocket*/, areg::ZeroCopyDone* /*done*/, uint32_t /*count*/, uint32_t /*timeoutMs*/) noexcept
+{
+    return 0;
+}
+
+SOCKETHANDLE _os_zerocopy_retain(SOCKETHANDLE /*hSocket*/) noexcept
+{
+    return areg::InvalidSocketHandle;
+}
+
 // Blocking exact read -- MSG_WAITALL, no speculative buffering, no cache access.
 static inline int32_t _recv_exact(SOCKETHANDLE hSocket, uint8_t* dataBuffer, int32_t dataLength)
 {
@@ -420,6 +458,22 @@ bool _os_connect_socket(SOCKETHANDLE hSocket, const void* addr, uint32_t addrLen
     return true;
 }
 
+areg::String _os_local_socket_dir()
+{
+    // The temporary directory is in the profile of the user, the other users have no access.
+    return areg::File::temp_dir();
+}
+
+bool _os_local_socket_owned(const areg::String& /*path*/) noexcept
+{
+    return true;
+}
+
+bool _os_local_peer_owned(SOCKETHANDLE /*hSocket*/) noexcept
+{
+    return true;
+}
+
 bool _os_control(SOCKETHANDLE hSocket, int32_t cmd, unsigned long& arg)
 {
     ASSERT(areg::is_valid_socket(hSocket));
@@ -433,6 +487,106 @@ bool _os_get_option(SOCKETHANDLE hSocket, int32_t level, int32_t name, unsigned
     return (RETURNED_OK == ::getsockopt(static_cast<SOCKET>(hSocket), level, name, reinterpret_cast<char*>(&value), &len));
 }
 
+bool _os_wait_readable(SOCKETHANDLE hSocket, uint32_t timeoutMs)
+{
+    WSAPOLLFD fd{ };
+    fd.fd       = static_cast<SOCKET>(hSocket);
+    fd.events   = POLLRDNORM;
+
+    // POLLHUP and POLLERR are reported as readable: the receive call fails at once.
+    return (::WSAPoll(&fd, 1, static_cast<INT>(timeoutMs)) != 0);
+}
+
+bool _os_datagram_configure(SOCKETHANDLE hSocket) noexcept
+{
+    // The ICMP "port unreachable" of an earlier datagram must not fail the next receive call.
+    BOOL reportReset{ FALSE };
+    DWORD bytes{ 0 };
+    ::WSAIoctl(static_cast<SOCKET>(hSocket), SIO_UDP_CONNRESET, &reportReset, sizeof(reportReset), nullptr, 0, &bytes, nullptr, nullptr);
+
+    u_long nonBlocking{ 1 };
+    return (::ioctlsocket(static_cast<SOCKET>(hSocket), FIONBIO, &nonBlocking) == 0);
+}
+
+int32_t _os_datagram_send(SOCKETHANDLE hSocket, const areg::DatagramOut* datagrams, uint32_t count) noexcept
+{
+    uint32_t sent{ 0u };
+    while (sent < count)
+    {
+        const areg::DatagramOut & datagram{ datagrams[sent] };
+        WSABUF buffers[2]{ };
+        DWORD parts{ 0 };
+        for (const areg::IoBuffer & part : datagram.parts)
+        {
+            if (part.size != 0u)
+            {
+                buffers[parts].buf = reinterpret_cast<CHAR *>(const_cast<uint8_t *>(part.data));
+                buffers[parts].len = static_cast<ULONG>(part.size);
+                ++ parts;
+            }
+        }
+
+        sockaddr_in addr{ };
+        addr.sin_family         = AF_INET;
+        addr.sin_port           = datagram.peer.port;
+        addr.sin_addr.s_addr    = datagram.peer.address;
+
+        DWORD bytes{ 0 };
+        if (::WSASendTo(static_cast<SOCKET>(hSocket), buffers, parts, &bytes, 0, reinterpret_cast<const sockaddr *>(&addr), sizeof(sockaddr_in), nullptr, nullptr) == 0)
+        {
+            ++ sent;
+            continue;
+        }
+
+        const int error{ ::WSAGetLastError() };
+        if ((error == WSAEWOULDBLOCK) || (error == WSAENOBUFS))
+            break;
+
+        if ((error == WSAENOTSOCK) || (error == WSAEINVAL) || (error == WSANOTINITIALISED))
+            return (sent != 0u ? static_cast<int32_t>(sent) : -1);
+
+        ++ sent;    // the datagram is refused, skip it
+    }
+
+    return static_cast<int32_t>(sent);
+}
+
+int32_t _os_datagram_receive(SOCKETHANDLE hSocket, areg::DatagramIn* datagrams, uint32_t count) noexcept
+{
+    uint32_t received{ 0u };
+    while (received < count)
+    {
+        areg::DatagramIn & datagram{ datagrams[received] };
+        sockaddr_in addr{ };
+        int len{ static_cast<int>(sizeof(sockaddr_in)) };
+        const int result{ ::recvfrom(static_cast<SOCKET>(hSocket), reinterpret_cast<char *>(datagram.data), static_cast<int>(datagram.capacity), 0, reinterpret_cast<sockaddr *>(&addr), &len) };
+        if (result >= 0)
+        {
+            datagram.size           = static_cast<uint32_t>(result);
+            datagram.peer.address   = static_cast<uint32_t>(addr.sin_addr.s_addr);
+            datagram.peer.port      = addr.sin_port;
+            ++ received;
+            continue;
+        }
+
+        const int error{ ::WSAGetLastError() };
+        if (error == WSAEMSGSIZE)
+        {
+            // The datagram is truncated, report it with size zero.
+            datagram.size = 0u;
+            ++ received;
+            continue;
+        }
+
+        if ((error == WSAENOTSOCK) || (error == WSAEINVAL) || (error == WSANOTINITIALISED))
+            return (received != 0u ? static_cast<int32_t>(received) : -1);
+
+        break;
+    }
+
+    return static_cast<int32_t>(received);
+}
+
 } // namespace areg::os
 
 #endif  // _WIN32
@@ -29,6 +29,7 @@
 #include <Windows.h>
 #include <processthreadsapi.h>
 #include <limits>
+#include <vector>
 
 namespace areg {
 
@@ -244,6 +245,79 @@ Thread::ThreadPriority Thread::_os_set_priority( ThreadPriority newPriority ) no
     return oldPrio;
 }
 
+void Thread::_os_apply_placement( const Thread::ThreadPlacement & placement )
+{
+    HANDLE self{ ::GetCurrentThread() };
+
+    // Windows pins a thread to the cores of one processor group, the group of the first core.
+    std::vector<uint32_t> cpus;
+    GROUP_AFFINITY affinity{ };
+    if (Thread::parse_cpu_list(placement.cpus, cpus))
+    {
+        constexpr uint32_t GROUP_SIZE{ static_cast<uint32_t>(sizeof(KAFFINITY) * 8u) };
+        affinity.Group = static_cast<WORD>(cpus.front() / GROUP_SIZE);
+        for (uint32_t cpu : cpus)
+        {
+            if ((cpu / GROUP_SIZE) == affinity.Group)
+            {
+                affinity.Mask |= static_cast<KAFFINITY>(1) << (cpu % GROUP_SIZE);
+            }
+        }
+    }
+    else if (placement.numaNode >= 0)
+    {
+        // The memory of a thread is allocated on the node of its core by default.
+        ::GetNumaNodeProcessorMaskEx(static_cast<USHORT>(placement.numaNode), &affinity);
+    }
+
+    if ((affinity.Mask != 0) && (::SetThreadGroupAffinity(self, &affinity, nullptr) == FALSE))
+    {
+        AREG_OUTPUT_ERR("Cannot set the CPU affinity [ %s ] of the thread, failed with error code [ %u ].", placement.cpus.as_string(), ::GetLastError());
+    }
+
+    // Windows has no real-time policies per thread, the closest is the time-critical priority.
+    int32_t prio{ std::numeric_limits<int32_t>::min() };
+    switch (placement.policy)
+    {
+    case Thread::SchedPolicy::Normal:
+        prio = THREAD_PRIORITY_NORMAL;
+        break;
+
+    case Thread::SchedPolicy::Fifo:         // fall through
+    case Thread::SchedPolicy::RoundRobin:
+        prio = THREAD_PRIORITY_TIME_CRITICAL;
+        break;
+
+    case Thread::SchedPolicy::Default:      // fall through
+    default:
+        break;
+    }
+
+    if ((prio != std::numeric_limits<int32_t>::min()) && (::SetThreadPriority(self, prio) == FALSE))
+    {
+        AREG_OUTPUT_ERR("Cannot set the scheduling policy [ %s ] of the thread, failed with error code [ %u ].", Thread::as_string(placement.policy), ::GetLastError());
+    }
+}
+
+void * Thread::allocate_node_memory( size_t size, int32_t numaNode ) noexcept
+{
+    if ((size == 0u) || (numaNode < Thread::NUMA_NODE_ANY))
+        return nullptr;
+
+    constexpr DWORD allocType{ MEM_RESERVE | MEM_COMMIT };
+    return ( numaNode == Thread::NUMA_NODE_ANY
+           ? ::VirtualAlloc(nullptr, size, allocType, PAGE_READWRITE)
+           : ::VirtualAllocExNuma(::GetCurrentProcess(), nullptr, size, allocType, PAGE_READWRITE, static_cast<DWORD>(numaNode)) );
+}
+
+void Thread::free_node_memory( void * block, size_t /*size*/ ) noexcept
+{
+    if (block != nullptr)
+    {
+        ::VirtualFree(block, 0, MEM_RELEASE);
+    }
+}
+
 size_t Thread::_os_stack_size(THREADHANDLE handle) noexcept
 {
     ULONG size{ 0u };
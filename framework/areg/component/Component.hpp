@@ -246,6 +246,7 @@ public:
      * \param   maxQeueue           Event-queue ring capacity; areg::IGNORE_VALUE (0) reads from configuration.
      * \param   dropOnFull          Full-ring policy; areg::Bool::Undefined reads from configuration.
      * \param   waitMs              Lossless full-ring block timeout; areg::WAIT_INFINITE reads from configuration.
+     * \param   placement           The CPU cores, scheduling policy and NUMA node of the thread; empty reads from configuration.
      * \return  Pointer to the created worker thread.
      **/
     WorkerThread * create_worker_thread( const String & threadName
@@ -255,7 +256,8 @@ public:
                                        , uint32_t stackSizeKb     = areg::DEFAULT_STACK_SIZE
                                        , uint32_t maxQeueue       = areg::IGNORE_VALUE
                                        , areg::Bool dropOnFull     = areg::Bool::Undefined
-                                       , uint32_t waitMs           = areg::WAIT_INFINITE );
+                                       , uint32_t waitMs           = areg::WAIT_INFINITE
+                                       , const Thread::ThreadPlacement & placement = Thread::ThreadPlacement() );
 
     /**
      * \brief   Stops and deletes a worker thread by name.
@@ -65,6 +65,17 @@
     /*  End of local Model. This will add model to model list of Loader             */                      \
     areg::ModelDataCreator _modelData( areg_model_ );
 
+/**
+ * \brief   Runs the component threads of the model as strands on a pool of worker threads
+ *          instead of running each on its own thread. This should be called between scopes
+ *          BEGIN_MODEL and END_MODEL. The events of every component thread are still processed
+ *          one at a time and in the order of the queue. The watchdog of the threads is ignored.
+ *
+ * \param   workers     The number of the worker threads. 0 starts one worker per CPU core.
+ **/
+#define MODEL_RUN_STRANDS(workers)                                                                          \
+        areg_model_.set_strand_executor(true, (workers));
+
 /**
  * \brief   Register thread to start component thread.
  *          This should be called between scopes BEGIN_MODEL and END_MODEL
@@ -88,6 +99,17 @@
             /*  Begin registering component thread                                  */                      \
             areg::ComponentThreadEntry  thrEntry((thread_name), (timeout), (stackSizeKb), queueSize, dropOnFull, queueWait);
 
+/**
+ * \brief   Register component thread like BEGIN_REGISTER_THREAD_EX2, with the time the thread
+ *          spins on its empty queue before it parks. Spinning saves the wake-up of the thread
+ *          at the price of a busy core, use it for the threads pinned to a core.
+ *
+ * \param   spinUs          The spin time in microseconds. 0 reads the value from the configuration.
+ **/
+#define BEGIN_REGISTER_THREAD_EX3(thread_name, timeout, stackSizeKb, queueSize, dropOnFull, queueWait, spinUs) \
+            BEGIN_REGISTER_THREAD_EX2((thread_name), (timeout), (stackSizeKb), (queueSize), (dropOnFull), (queueWait)) \
+            thrEntry.mQueueSpin = (spinUs);
+
 /**
  * \brief   Register component thread with the watchdog timeout and system default thread stack size.
  *          The watchdog timeout is set if `timeout` is not 0.
@@ -101,6 +123,29 @@
 #define BEGIN_REGISTER_THREAD(thread_name)                                                                  \
             BEGIN_REGISTER_THREAD_EX((thread_name), areg::WATCHDOG_IGNORE)
 
+/**
+ * \brief   Sets the CPU cores, scheduling policy and NUMA node of the component thread.
+ *          This should be called between BEGIN_REGISTER_THREAD and END_REGISTER_THREAD.
+ *          The placement replaces the one set in the configuration for the thread.
+ *
+ * \param   cpus        The list of CPU cores to pin the thread, like "2,4-7". Empty not to pin.
+ * \param   policy      The scheduling policy of the thread, a value of areg::Thread::SchedPolicy.
+ * \param   priority    The real-time priority, meaningful for the Fifo and RoundRobin policies.
+ * \param   numaNode    The NUMA node of the thread and its event queue, or areg::Thread::NUMA_NODE_ANY.
+ **/
+#define REGISTER_THREAD_PLACEMENT(cpus, policy, priority, numaNode)                                         \
+            thrEntry.mPlacement = areg::Thread::ThreadPlacement{ areg::String(cpus), (policy), (priority), (numaNode) };
+
+/**
+ * \brief   Sets the number of events the component thread takes from its queue at once.
+ *          This should be called between BEGIN_REGISTER_THREAD and END_REGISTER_THREAD.
+ *          The batch replaces the one set in the configuration for the thread.
+ *
+ * \param   batchSize   The batch size, up to areg::DISPATCH_MAX_BATCH. 1 dispatches event by event.
+ **/
+#define REGISTER_THREAD_DISPATCH_BATCH(batchSize)                                                           \
+            thrEntry.mDispatchBatch = (batchSize);
+
 /**
  * \brief   Closes component thread registration.
  **/
@@ -228,6 +273,20 @@
 #define REGISTER_WORKER_THREAD(worker_thread_name, consumer_name)                                           \
             REGISTER_WORKER_THREAD_EX((worker_thread_name), (consumer_name), areg::WATCHDOG_IGNORE)
 
+/**
+ * \brief   Register worker thread with no watchdog, system default stack size, and the CPU cores,
+ *          scheduling policy and NUMA node of the thread. See REGISTER_THREAD_PLACEMENT.
+ **/
+#define REGISTER_WORKER_THREAD_PLACEMENT(worker_thread_name, consumer_name, cpus, policy, priority, numaNode) \
+                {                                                                                           \
+                    areg::WorkerThreadEntry wtEntry(  comEntry.mThreadName                                  \
+                                                    , (worker_thread_name)                                  \
+                                                    , comEntry.mRoleName                                    \
+                                                    , (consumer_name) );                                    \
+                    wtEntry.mPlacement = areg::Thread::ThreadPlacement{ areg::String(cpus), (policy), (priority), (numaNode) }; \
+                    comEntry.add_worker_thread(wtEntry);                                                    \
+                }
+
 /**
  * \brief   Declare and register component dependency. Optional.
  *          If registered component has dependency on other
@@ -621,6 +680,13 @@ private:
      **/
     void _shutdown_threads( const ThreadList & threadList ) const;
 
+    /**
+     * \brief   Releases the strand executor used by the unloaded model, if its threads ran as strands.
+     *
+     * \param   whichModel      The model whose threads are stopped and deleted.
+     **/
+    inline void _unload_strands( const areg::Model & whichModel ) const;
+
     /**
      * \brief   Adds a new model with globally unique names for the model, threads, and components.
      *
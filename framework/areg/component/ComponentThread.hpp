@@ -24,6 +24,7 @@
 #include "areg/base/areg_global.h"
 #include "areg/component/DispatcherThread.hpp"
 
+#include "areg/component/private/StrandExecutor.hpp"
 #include "areg/component/private/Watchdog.hpp"
 #include "areg/base/ResourceMap.hpp"
 
@@ -45,8 +46,16 @@ namespace areg {
  *          same thread. This ensures that no component function call
  *          and no component data is shared between several threads.
  *          Every component thread can have several component objects.
+ *
+ *          A component thread created to run as a strand has no own thread. Its events are
+ *          dispatched in turns on the worker threads of the StrandExecutor. The turns of one
+ *          strand never overlap, so the components keep the guarantee of a single thread:
+ *          no two events of the thread are processed at the same time and all of them are
+ *          processed in the order of the queue, only the worker thread may change between
+ *          the turns. A handler that blocks occupies a worker thread for that time.
  **/
-class AREG_API ComponentThread final : public DispatcherThread
+class AREG_API ComponentThread final   : public    DispatcherThread
+                                        , private   Strand
 {
 //////////////////////////////////////////////////////////////////////////
 // Local types and constants
@@ -117,13 +126,18 @@ public:
      * \param   waitMs              The lossless full-ring block timeout in milliseconds (used only when
      *                              the resolved policy is "block"). 0 means do not wait; areg::WAIT_INFINITE
      *                              reads the value from configuration.
+     * \param   runAsStrand         If true, the thread runs as a strand on the threads of the
+     *                              StrandExecutor, which must be attached before the thread starts.
+     *                              The watchdog is ignored and the stack size is the one of the
+     *                              worker threads.
      **/
     explicit ComponentThread( const String & threadName
                             , uint32_t watchdogTimeout  = areg::WATCHDOG_IGNORE
                             , uint32_t stackSizeKb      = areg::DEFAULT_STACK_SIZE
                             , uint32_t maxQeueue        = areg::IGNORE_VALUE
                             , areg::Bool dropOnFull      = areg::Bool::Undefined
-                            , uint32_t waitMs            = areg::WAIT_INFINITE );
+                            , uint32_t waitMs            = areg::WAIT_INFINITE
+                            , bool runAsStrand           = false );
 
     virtual ~ComponentThread() = default;
 
@@ -153,10 +167,25 @@ public:
      **/
     inline uint32_t watchdog_timeout() const noexcept;
 
+    /**
+     * \brief   Returns true if the component thread runs as a strand of the StrandExecutor.
+     **/
+    [[nodiscard]]
+    inline bool runs_as_strand() const noexcept;
+
 /************************************************************************/
 // Thread overrides
 /************************************************************************/
 
+    /**
+     * \brief   Starts the thread. A strand is registered and scheduled on the StrandExecutor,
+     *          its first turn creates and starts the components.
+     *
+     * \param   waitForStartMs  The timeout in milliseconds to wait for the thread to run.
+     * \return  Returns true if the thread started.
+     **/
+    bool start( uint32_t waitForStartMs = areg::DO_NOT_WAIT ) final;
+
     /**
      * \brief   Shuts down the thread and frees resources. If waiting timeout is not 'DO_NOT_WAIT
      *          and it expires, the function terminates the thread. The shutdown thread can be
@@ -283,10 +312,31 @@ protected:
      **/
     bool dispatch_event( Event & eventElem ) final;
 
+/************************************************************************/
+// Strand overrides
+/************************************************************************/
+
+    /**
+     * \brief   Runs one turn of the strand on a worker thread of the StrandExecutor. The first
+     *          turn starts the components, the next ones dispatch the queued events, the turn
+     *          dispatching the exit event stops the components and releases the strand.
+     *
+     * \param   budget  The maximum number of events to dispatch in the turn.
+     * \return  Returns the result of the turn.
+     **/
+    Strand::StrandRun run_strand( uint32_t budget ) final;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
 private:
+    /**
+     * \brief   Creates and starts the components, then registers the proxies created meanwhile.
+     *
+     * \return  Returns false if the thread has no component to run.
+     **/
+    inline bool _start_thread_components();
+
     /**
      * \brief   Returns reference to component thread.
      **/
@@ -352,6 +402,11 @@ private:
      **/
     bool            mIsRestarting;
 
+    /**
+     * \brief   True if the thread runs as a strand of the StrandExecutor.
+     **/
+    const bool      mRunAsStrand;
+
 #if defined(_MSC_VER)
     #pragma warning(push)
     #pragma warning(disable: 4251)
@@ -393,5 +448,10 @@ inline uint32_t ComponentThread::watchdog_timeout() const noexcept
     return mWatchdog.timeout();
 }
 
+inline bool ComponentThread::runs_as_strand() const noexcept
+{
+    return mRunAsStrand;
+}
+
 } // namespace areg
 #endif  // AREG_COMPONENT_COMPONENTTHREAD_HPP
@@ -184,6 +184,15 @@ public:
      **/
     inline bool wait_start( uint32_t waitTimeout = areg::WAIT_INFINITE ) noexcept;
 
+    /**
+     * \brief   Sets how long the thread spins on its empty event queue before it parks. Spinning
+     *          saves the wake-up of a thread that receives events often, at the price of a busy
+     *          core. Meant for the threads pinned to a core. Call before the thread starts.
+     *
+     * \param   spinUs  The spin time in microseconds. 0 parks at once.
+     **/
+    inline void set_queue_spin( uint32_t spinUs ) noexcept;
+
 //////////////////////////////////////////////////////////////////////////
 // Operations and overrides.
 //////////////////////////////////////////////////////////////////////////
@@ -224,6 +233,17 @@ public:
      **/
     Thread::ThreadCompletion shutdown( uint32_t waitForStopMs = areg::WAIT_INFINITE ) override;
 
+    /**
+     * \brief   Places the event queue on the NUMA node of the thread, if the placement of the
+     *          thread sets one, and starts the thread. No one sends events to the thread before
+     *          it starts, so the queue is allocated anew on the node before it is used.
+     *
+     * \param   waitForStartMs      Waiting timeout in milliseconds until the thread is created
+     *                              and started, see Thread::start().
+     * \return  Returns true if the thread is successfully created and started.
+     **/
+    bool start( uint32_t waitForStartMs = areg::DO_NOT_WAIT ) override;
+
 protected:
 /************************************************************************/
 // EventRouter interface overrides
@@ -341,6 +361,11 @@ inline EventDispatcher & DispatcherThread::current_dispatcher() noexcept
     return current_dispatcher_thread().event_dispatcher();
 }
 
+inline void DispatcherThread::set_queue_spin( uint32_t spinUs ) noexcept
+{
+    mExternalEvents.set_spin_time(spinUs);
+}
+
 inline EventDispatcher & DispatcherThread::event_dispatcher() noexcept
 {
     return static_cast<EventDispatcher &>(self());
@@ -338,6 +338,19 @@ public:
      **/
     inline void set_event_priority( areg::EventPriority eventPrio ) noexcept;
 
+    /**
+     * \brief   Returns true if the event is a droppable update to the consumer: a full queue
+     *          drops it instead of waiting and the router link may send it as a datagram.
+     **/
+    [[nodiscard]]
+    inline bool is_droppable() const noexcept;
+
+    /**
+     * \brief   Marks the update to the consumer as droppable, see EventCallType::CallDroppable.
+     *          Only the events sent to the consumer can be droppable.
+     **/
+    inline void set_droppable( bool droppable ) noexcept;
+
     /**
      * \brief   Returns the consumer registered to process this event, or null if none is set.
      *          Stored in EventHeader::internal2 (LOCAL-ONLY); zeroed on IPC wire.
@@ -523,6 +536,21 @@ inline void Event::set_event_priority( areg::EventPriority eventPrio ) noexcept
     MessageEnvelope::set_priority(static_cast<uint8_t>(eventPrio));
 }
 
+inline bool Event::is_droppable() const noexcept
+{
+    const areg::EventHeader* hdr{ MessageEnvelope::header() };
+    return (hdr != nullptr) && areg::is_droppable(hdr->eventType, hdr->callType);
+}
+
+inline void Event::set_droppable( bool droppable ) noexcept
+{
+    ASSERT(areg::is_to_consumer(event_type()) || (droppable == false));
+    if (droppable != is_droppable())
+    {
+        MessageEnvelope::set_call_type(static_cast<uint8_t>(droppable ? areg::EventCallType::CallDroppable : areg::EventCallType::Undefined));
+    }
+}
+
 inline EventConsumer * Event::event_consumer() const noexcept
 {
     const areg::EventHeader* hdr{ MessageEnvelope::header() };
@@ -52,6 +52,9 @@ namespace areg {
     constexpr uint32_t  QUEUE_WAIT_WARN_MS          { areg::WAIT_1_SECOND };
     constexpr bool      QUEUE_DROP_WHEN_FULL        {               false };    //!< Default action if queue is full, wait for free slot.
 
+    constexpr uint32_t  DISPATCH_DEFAULT_BATCH      {                 32u };    //!< Default number of events a dispatcher takes from its queue at once.
+    constexpr uint32_t  DISPATCH_MAX_BATCH          {                256u };    //!< Largest number of events a dispatcher takes from its queue at once.
+
 /************************************************************************
  * areg::EventType
  * Bitmask enum. Composite values OR together the primitive bits below.
@@ -161,6 +164,9 @@ constexpr areg::EventPriority DefaultPriority { areg::EventPriority::NormalPrio
  *   bit 1 (0x02)  IsRemote   IPC via mtrouter
  *   bit 2 (0x04)  IsCustom   developer-defined (EventCustomBit set)
  *   bit 3 (0x08)  IsService  framework service-interface call
+ *   bit 4 (0x10)  IsMulticast remote response to a list of consumers
+ *   bit 5 (0x20)  IsDroppable remote update of a latest-value attribute,
+ *                 the next update replaces it, so it may be lost
  ************************************************************************/
 enum class EventCallType : uint8_t
 {
@@ -171,6 +177,8 @@ enum class EventCallType : uint8_t
     , CallService       = 0x08u   //!< Service call base (use Local or Remote variant).
     , CallServiceLocal  = 0x09u   //!< Service call, local delivery.
     , CallServiceRemote = 0x0Au   //!< Service call, remote delivery.
+    , CallMulticast     = 0x12u   //!< Remote response, the consumer list follows the payload.
+    , CallDroppable     = 0x22u   //!< Remote attribute update, may be dropped when a queue is full or sent as a datagram.
 };
 
 [[nodiscard]]
@@ -356,6 +364,15 @@ inline constexpr bool is_valid(areg::EventType eventType) noexcept;
 [[nodiscard]]
 inline constexpr bool is_request_failure(areg::EventType eventType) noexcept;
 
+/**
+ * \brief   Returns true if the message with the given event and call types is a droppable
+ *          update to the consumer: it may be dropped when a queue is full and may travel
+ *          through the best-effort datagram channel. The requests use the call type field
+ *          differently, so the event type must be sent to the consumer.
+ **/
+[[nodiscard]]
+inline constexpr bool is_droppable(uint32_t eventType, uint8_t callType) noexcept;
+
 
 AREG_IMPLEMENT_STREAMABLE(areg::EventCallType)
 AREG_IMPLEMENT_STREAMABLE(areg::EventType)
@@ -435,6 +452,12 @@ inline constexpr bool areg::is_to_consumer(areg::EventType eventType) noexcept
     return areg::is_matching_any(static_cast<uint32_t>(eventType), areg::EventType::EventToConsumerMask);
 }
 
+inline constexpr bool areg::is_droppable(uint32_t eventType, uint8_t callType) noexcept
+{
+    return (callType == static_cast<uint8_t>(areg::EventCallType::CallDroppable))
+        && areg::is_matching_any(eventType, areg::EventType::EventToConsumerMask);
+}
+
 inline constexpr bool areg::is_connect(areg::EventType eventType) noexcept
 {
     return areg::is_matching_any(static_cast<uint32_t>(eventType), areg::EventType::EventConnectMask);
@@ -664,6 +687,10 @@ inline constexpr const char* areg::as_string(areg::EventCallType callType) noexc
         return "areg::EventCallType::CallServiceLocal";
     case areg::EventCallType::CallServiceRemote:
         return "areg::EventCallType::CallServiceRemote";
+    case areg::EventCallType::CallMulticast:
+        return "areg::EventCallType::CallMulticast";
+    case areg::EventCallType::CallDroppable:
+        return "areg::EventCallType::CallDroppable";
     default:
         ASSERT(false);
         return "ERR: Undefined areg::EventCallType value!";
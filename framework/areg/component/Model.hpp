@@ -26,6 +26,7 @@
 #include "areg/base/String.hpp"
 #include "areg/base/MemoryDefs.hpp"
 #include "areg/base/UtilityDefs.hpp"
+#include "areg/base/Thread.hpp"
 
 #include <functional>
 #include <any>
@@ -404,6 +405,11 @@ public:
      *          Meaningful only if `mDropOnFull` is `False`. Otherwise, ignored.
      **/
     uint32_t    mQueueTimeout;
+    /**
+     * \brief   The CPU cores, scheduling policy and NUMA node of the worker thread. If empty,
+     *          the placement is read from the configuration.
+     **/
+    Thread::ThreadPlacement mPlacement;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -1390,6 +1396,24 @@ public:
      *          Meaningful only if `mDropOnFull` is `True`. Otherwise, ignored.
      **/
     uint32_t        mQueueTimeout;
+
+    /**
+     * \brief   The CPU cores, scheduling policy and NUMA node of the thread. If empty, the
+     *          placement is read from the configuration.
+     **/
+    Thread::ThreadPlacement mPlacement;
+
+    /**
+     * \brief   The time in microseconds the thread spins on its empty queue before it parks.
+     *          0 reads the value from the configuration.
+     **/
+    uint32_t        mQueueSpin;
+
+    /**
+     * \brief   The number of events the thread takes from its queue at once.
+     *          0 reads the value from the configuration.
+     **/
+    uint32_t        mDispatchBatch;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -1716,6 +1740,31 @@ public:
     [[nodiscard]]
     inline TIME64 alive_duration() const noexcept;
 
+    /**
+     * \brief   Sets whether the component threads of the model run as strands on the threads of
+     *          the StrandExecutor instead of running each on its own thread. The events of every
+     *          component thread are still processed one at a time and in the order of the queue.
+     *          Must be set before the model is loaded.
+     *
+     * \param   runAsStrands    If true, the component threads run as strands.
+     * \param   workers         The number of the worker threads of the executor. The value 0
+     *                          starts one worker per CPU core. The first loaded model running
+     *                          strands sets the number of the workers, the others share them.
+     **/
+    inline void set_strand_executor( bool runAsStrands, uint32_t workers = 0u ) noexcept;
+
+    /**
+     * \brief   Returns true if the component threads of the model run as strands.
+     **/
+    [[nodiscard]]
+    inline bool runs_as_strands() const noexcept;
+
+    /**
+     * \brief   Returns the number of the worker threads requested for the strands, 0 for one per CPU core.
+     **/
+    [[nodiscard]]
+    inline uint32_t strand_workers() const noexcept;
+
 //////////////////////////////////////////////////////////////////////////
 // areg::Model class, Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -1739,6 +1788,16 @@ private:
      * \brief   The duration of time where model was loaded and alive.
      **/
     areg::Duration   mAliveDuration;
+
+    /**
+     * \brief   True if the component threads of the model run as strands.
+     **/
+    bool                    mRunAsStrands;
+
+    /**
+     * \brief   The number of the worker threads requested for the strands, 0 for one per CPU core.
+     **/
+    uint32_t                mStrandWorkers;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -1846,6 +1905,22 @@ inline TIME64 areg::Model::alive_duration() const noexcept
     return (mLoadState == ModelState::Initialized ? 0 : mAliveDuration.duration_since_start());
 }
 
+inline void areg::Model::set_strand_executor( bool runAsStrands, uint32_t workers /*= 0u*/ ) noexcept
+{
+    mRunAsStrands   = runAsStrands;
+    mStrandWorkers  = workers;
+}
+
+inline bool areg::Model::runs_as_strands() const noexcept
+{
+    return mRunAsStrands;
+}
+
+inline uint32_t areg::Model::strand_workers() const noexcept
+{
+    return mStrandWorkers;
+}
+
 template<typename ComponentType>
 inline areg::ComponentEntry& areg::ComponentThreadEntry::add_component(const String& roleName)
 {
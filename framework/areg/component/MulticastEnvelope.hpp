@@ -0,0 +1,187 @@
+#ifndef AREG_COMPONENT_MULTICASTENVELOPE_HPP
+#define AREG_COMPONENT_MULTICASTENVELOPE_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/component/MulticastEnvelope.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, multicast form of the remote response envelope.
+ *              Carries one payload and a list of consumers to deliver it to.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/ArrayList.hpp"
+#include "areg/base/MemoryDefs.hpp"
+
+namespace areg {
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class MessageEnvelope;
+
+//////////////////////////////////////////////////////////////////////////
+// MulticastEnvelope class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Helpers to build and split the multicast form of a remote response envelope.
+ *
+ *          A stub notifying many remote consumers of the same attribute update sends one
+ *          multicast envelope instead of one deep copy per consumer. The wire layout is:
+ *
+ *          [EventHeader 128B][payload][0..3B padding][Endpoint targets[N]][Trailer]
+ *
+ *          The header is marked with areg::EventCallType::CallMulticast and is addressed
+ *          to the router. The router splits the envelope per destination process: a process
+ *          with one consumer gets a plain unicast envelope, a process with several consumers
+ *          gets a multicast envelope with its own part of the target list. The receiving
+ *          process delivers the payload to every listed proxy, reusing the received block
+ *          for the last one.
+ *
+ *          The other proxies of the receiving process get a copy of the header and the payload.
+ *          An event carries its header in its block, and the dispatching uses the per-proxy
+ *          fields of it (consumer, target, channel, target dispatcher) until the proxy handles
+ *          the event, so the proxies on different threads cannot share one block. The saving
+ *          is on the wire and in the router, where one envelope replaces N.
+ *
+ * \note    ThreadSafe: all methods are stateless static functions.
+ **/
+class AREG_API MulticastEnvelope
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The block at the very end of the multicast payload, describing the target list.
+     **/
+    struct Trailer
+    {
+        uint32_t    payloadSize { 0u }; //!< Bytes of the event payload, the target list starts 4-byte aligned after it.
+        uint32_t    targetCount { 0u }; //!< Number of areg::Endpoint entries in the target list.
+        uint32_t    callType    { 0u }; //!< The call type of the event before it was marked multicast.
+    };
+
+    /**
+     * \brief   The minimal number of consumers for which a multicast envelope is built.
+     *          Fewer consumers are served by plain clones.
+     **/
+    static constexpr uint32_t   MIN_TARGETS     { 2u };
+
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Appends the target list to the fully serialized remote response envelope
+     *          and marks the header as multicast. The payload is not touched.
+     *
+     * \param   envelope    The remote response envelope with complete payload.
+     * \param   targets     The consumer endpoints to deliver the payload to.
+     * \param   count       The number of entries in \a targets, at least 1.
+     * \return  Returns true if the target list is attached; false if the envelope is invalid,
+     *          already multicast or could not grow. On failure the envelope is left unchanged.
+     **/
+    static bool attach_targets( MessageEnvelope & envelope, const areg::Endpoint * targets, uint32_t count );
+
+    /**
+     * \brief   Returns true if the envelope is marked multicast and has a consistent target list.
+     **/
+    [[nodiscard]]
+    static bool is_multicast( const MessageEnvelope & envelope ) noexcept;
+
+    /**
+     * \brief   Returns the number of targets of the multicast envelope, 0 if not multicast.
+     **/
+    [[nodiscard]]
+    static uint32_t target_count( const MessageEnvelope & envelope ) noexcept;
+
+    /**
+     * \brief   Returns pointer to the first entry of the target list, nullptr if not multicast.
+     *          The pointer is valid until the envelope is modified.
+     **/
+    [[nodiscard]]
+    static const areg::Endpoint * targets( const MessageEnvelope & envelope ) noexcept;
+
+    /**
+     * \brief   Returns the size of the event payload of the multicast envelope, without the
+     *          target list. Returns the used size of the envelope if it is not multicast.
+     **/
+    [[nodiscard]]
+    static uint32_t payload_size( const MessageEnvelope & envelope ) noexcept;
+
+    /**
+     * \brief   Creates a unicast copy of the multicast envelope for the given consumer.
+     *          The copy has the payload only, its consumer endpoint and target cookie are
+     *          set to the consumer and the original call type is restored.
+     *
+     * \param   envelope    The multicast envelope.
+     * \param   target      The consumer to address the copy to.
+     * \return  The unicast envelope with its own heap block, invalid on failure.
+     **/
+    [[nodiscard]]
+    static MessageEnvelope extract_unicast( const MessageEnvelope & envelope, const areg::Endpoint & target );
+
+    /**
+     * \brief   Converts the multicast envelope into the unicast envelope for the given consumer
+     *          in place: the target list is cut, the consumer endpoint, target cookie and the
+     *          original call type are set. No data is copied.
+     *
+     * \param   envelope    The multicast envelope to convert.
+     * \param   target      The consumer to address the envelope to. Must not point into
+     *                      the target list of \a envelope.
+     * \return  Returns true if converted; false if the envelope is not multicast.
+     **/
+    static bool restore_unicast( MessageEnvelope & envelope, const areg::Endpoint & target ) noexcept;
+
+    /**
+     * \brief   Splits the multicast envelope into one envelope per destination process.
+     *          Targets are grouped by the process cookie. A group of one target results in a
+     *          unicast envelope, a bigger group in a multicast envelope with the group targets.
+     *          Every resulting envelope is addressed to the process cookie of its group.
+     *
+     * \param   envelope    The multicast envelope received by the router.
+     * \param   result      On output, contains the envelopes to forward.
+     * \return  Returns the number of envelopes added to \a result.
+     **/
+    static uint32_t split_by_process( const MessageEnvelope & envelope, ArrayList<MessageEnvelope> & result );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns pointer to the trailer of a multicast envelope, nullptr if not multicast.
+     **/
+    [[nodiscard]]
+    static const MulticastEnvelope::Trailer * _trailer( const MessageEnvelope & envelope ) noexcept;
+
+    /**
+     * \brief   Copies the header and payload of the multicast envelope into a new envelope,
+     *          reserving \a extra bytes for a target list.
+     **/
+    [[nodiscard]]
+    static MessageEnvelope _copy_payload( const MessageEnvelope & envelope, uint32_t extra );
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    MulticastEnvelope() = delete;
+    ~MulticastEnvelope() = delete;
+    AREG_NOCOPY_NOMOVE( MulticastEnvelope );
+};
+
+} // namespace areg
+
+#endif  // AREG_COMPONENT_MULTICASTENVELOPE_HPP
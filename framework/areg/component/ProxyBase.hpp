@@ -175,23 +175,14 @@ private:
      *          in the same thread. As a Key, it is using Proxy Address
      *          and value is instance of Proxy.
      ************************************************************************/
-    /**
-     * \brief   Proxy hash map
-     **/
-    using MapProxy          = HashMap<uint32_t, std::shared_ptr<ProxyBase>>;
-    /**
-     * \brief   Proxy resource map helper.
-     **/
-    using ImplProxyResource = ResourceMapImpl<uint32_t, std::shared_ptr<ProxyBase>>;
-
     /**
      * \brief   ProxyBase::MapProxyResource
      *          Proxy Resource Map declaration to keep controlling of all instantiated Proxy objects.
      *          ProxyAddress  The Key of Resource map is a Proxy address object.
      *          ProxyBase     The Values are pointers of Proxy object.
-     *          ProxyMap      The type of Hash Mapping object used as container
+     *          Every received response searches the map, so the lookups take no lock.
      **/
-    using MapProxyResource  = ConcurrentResourceMap<uint32_t, std::shared_ptr<ProxyBase>, MapProxy, ImplProxyResource>;
+    using MapProxyResource  = ReadMostlyResourceMap<uint32_t, std::shared_ptr<ProxyBase>>;
 
     //////////////////////////////////////////////////////////////////////////
     // ProxyBase::ThreadProxyList internal class declaration
@@ -65,9 +65,11 @@ public:
      * \brief   Translates an inbound wire envelope and delivers it to the target stub or proxy thread.
      *          Must be called directly on the receive thread.
      *
+     *          A multicast response is delivered to every proxy of its target list.
+     *
      * \param   wire        Received wire envelope; consumed (moved-from) only when this returns true.
      * \param   comChannel  Communication channel of the receiving Router Client thread.
-     * \return  true if delivered;
+     * \return  true if delivered (to at least one proxy of a multicast response);
      *          false when the target stub/proxy is not found (wire left intact).
      **/
     static bool route_incoming_message( MessageEnvelope & wire, const Channel & comChannel );
@@ -83,6 +85,21 @@ public:
     [[nodiscard]]
     static ServiceResponseEvent create_request_failed_event( const MessageEnvelope & wire, const Channel & comChannel );
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+
+    /**
+     * \brief   Delivers a multicast response to every proxy of its target list.
+     *          The last proxy takes over the block of \a wire.
+     *
+     * \param   wire        Received multicast response envelope.
+     * \param   comChannel  Communication channel of the receiving Router Client thread.
+     * \return  true if delivered to at least one proxy.
+     **/
+    static bool _route_multicast_response( MessageEnvelope & wire, const Channel & comChannel );
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor. Hidden
 //////////////////////////////////////////////////////////////////////////
@@ -462,6 +462,10 @@ enum class FuncIdRange  : uint32_t
     , ServiceLogConfigurationSaved
     //!< Sent by log collector service or client applications to log the messages.
     , ServiceLogMessage
+    //!< Sent by log collector service to the log source to accept the compact format of the log records offered with the scope registration.
+    , ServiceLogRecordFormat
+    //!< Sent by log source to log the messages in the compact record format accepted by the log collector service.
+    , ServiceLogCompactMessage
     //!< The last ID of service calls.
     , ServiceLastId         = SERVICE_ID_LAST  //!< Servicing call last ID
 
@@ -1691,6 +1695,10 @@ inline constexpr const char* areg::as_string( areg::FuncIdRange value ) noexcept
         return "areg::FuncIdRange::ServiceLogConfigurationSaved";
     case areg::FuncIdRange::ServiceLogMessage:
         return "areg::FuncIdRange::ServiceLogMessage";
+    case areg::FuncIdRange::ServiceLogRecordFormat:
+        return "areg::FuncIdRange::ServiceLogRecordFormat";
+    case areg::FuncIdRange::ServiceLogCompactMessage:
+        return "areg::FuncIdRange::ServiceLogCompactMessage";
     case areg::FuncIdRange::RequestFirstId:
         return "areg::FuncIdRange::RequestFirstId";
     case areg::FuncIdRange::ResponseFirstId:
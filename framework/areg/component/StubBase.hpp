@@ -29,6 +29,7 @@
 
 #include <limits>
 #include <utility>
+#include <vector>
 
 /************************************************************************
  * Dependencies
@@ -79,6 +80,42 @@ private:
      */
     static constexpr uint32_t   INVALID_MESSAGE_ID  { static_cast<uint32_t>(areg::INVALID_MESSAGE_ID) };
 
+public:
+    //////////////////////////////////////////////////////////////////////////
+    // StubBase::RegistrationBatch class declaration
+    //////////////////////////////////////////////////////////////////////////
+    /**
+     * \brief   Collects the stubs created by the calling thread while the object exists and
+     *          registers them in one change of the registry when it is destroyed, because every
+     *          change copies the registry. The collected stubs are not found until then.
+     *          The component thread opens a batch while it creates its components.
+     **/
+    class AREG_API RegistrationBatch
+    {
+        friend class StubBase;
+
+    public:
+        RegistrationBatch() noexcept;
+
+        ~RegistrationBatch();
+
+    private:
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+        //!< The keys and the stubs to register.
+        std::vector<std::pair<uint32_t, StubBase *>>    mEntries;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+        //!< The batch of the thread, which was open before this one.
+        RegistrationBatch *                             mPrevious;
+
+    private:
+        AREG_NOCOPY_NOMOVE( RegistrationBatch );
+    };
+
 protected:
     //////////////////////////////////////////////////////////////////////////
     // StubBase::Listener class declaration
@@ -202,15 +239,11 @@ protected:
     //////////////////////////////////////////////////////////////////////////
     // StubBase resource tracking
     //////////////////////////////////////////////////////////////////////////
-    using MapProvider = HashMap<uint32_t, StubBase *>;
-    /**
-     * \brief   Stub resource helper definition.
-     **/
-    using ImplProviderResource  = ResourceMapImpl<uint32_t, StubBase *>;
     /**
-     * \brief   Resource Map definition.
+     * \brief   Resource Map definition. Searched by the stub address of every request, the lookups
+     *          take no lock.
      **/
-    using MapProviderResource   = ConcurrentResourceMap<uint32_t, StubBase *, MapProvider, ImplProviderResource>;
+    using MapProviderResource   = ReadMostlyResourceMap<uint32_t, StubBase *>;
 
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
@@ -273,6 +306,25 @@ public:
     [[nodiscard]]
     inline const String & service_name() const noexcept;
 
+    /**
+     * \brief   Marks the updates of the attribute as droppable or lossless. The droppable
+     *          updates of a latest-value attribute never wait for a full queue and may be sent
+     *          to the remote consumers through the best-effort datagram channel; a lost update
+     *          is replaced by the next one and counted as lost. An update still waiting in the
+     *          queue of a consumer is replaced by a newer one of the same attribute in place.
+     *          By default all updates are lossless. Call it on the component thread of the stub.
+     *
+     * \param   attrId      The ID of the attribute.
+     * \param   droppable   If true, the updates of the attribute are droppable.
+     **/
+    void set_attribute_droppable( uint32_t attrId, bool droppable );
+
+    /**
+     * \brief   Returns true if the updates of the attribute are droppable.
+     **/
+    [[nodiscard]]
+    inline bool is_attribute_droppable( uint32_t attrId ) const noexcept;
+
     /**
      * \brief   Sends error responses to all pending requests and notification subscriptions.
      **/
@@ -602,7 +654,9 @@ protected:
 
     /**
      * \brief   Broadcasts an attribute update to all specified listeners.
-     *          Ownership of masterEvent is transferred to the dispatcher
+     *          Ownership of masterEvent is transferred to the dispatcher.
+     *          Two or more remote listeners are reached by a single multicast envelope,
+     *          which the router splits per process, see areg::MulticastEnvelope.
      *
      * \param   whichListeners      The list of listeners containing proxy addresses.
      * \param   masterEvent         The event to broadcast. Ownership is transferred to the dispatcher.
@@ -677,6 +731,18 @@ protected:
     [[nodiscard]]
     bool can_execute_request( StubBase::Listener & whichListener, uint32_t whichResponse, const SequenceNumber & seqNr);
 
+    /**
+     * \brief   Returns true if the update for the listener can be carried by the multicast envelope
+     *          of the remote listeners: the listener is remote and has the service identity of the
+     *          update. The thread of the consumer does not matter, the receiving process addresses
+     *          each target of the envelope separately.
+     *
+     * \param   listener    The listener to check.
+     * \param   service     The service identity of the update event.
+     **/
+    [[nodiscard]]
+    static bool is_multicast_listener( const StubBase::Listener & listener, const areg::RawService & service ) noexcept;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
@@ -693,6 +759,18 @@ private:
     [[nodiscard]]
     static MapProviderResource& map_providers() noexcept;
 
+    /**
+     * \brief   Registers the stub under the key, or collects it in the registration batch of the
+     *          calling thread if one is open.
+     **/
+    static void register_provider( uint32_t key, StubBase & stub );
+
+    /**
+     * \brief   Unregisters the key of the stub, also removes the stub from the registration batch
+     *          of the calling thread.
+     **/
+    static void unregister_provider( uint32_t key, const StubBase & stub );
+
     /**
      * \brief   Removes one listener matching toRemove from the sub-vector for msgId using
      *          swap-and-pop. No-op if msgId or the matching listener is not found.
@@ -779,6 +857,11 @@ private:
      **/
     MapProviderSession              mMapSessions;
 
+    /**
+     * \brief   The IDs of the attributes with droppable updates.
+     **/
+    ArrayList<uint32_t>             mDroppable;
+
 #if defined(_MSC_VER)
     #pragma warning(pop)
 #endif  // _MSC_VER
@@ -896,5 +979,10 @@ inline const String& StubBase::service_name() const noexcept
     return mAddress.service_name();
 }
 
+inline bool StubBase::is_attribute_droppable( uint32_t attrId ) const noexcept
+{
+    return (mDroppable.is_empty() == false) && mDroppable.contains(attrId);
+}
+
 } // namespace areg
 #endif  // AREG_COMPONENT_STUBBASE_HPP
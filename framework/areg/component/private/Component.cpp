@@ -64,7 +64,8 @@ Component* Component::load_component(const areg::ComponentEntry &entry, Componen
                                                                 , wtEntry.mStackSizeKb
                                                                 , wtEntry.mMaxQueue
                                                                 , wtEntry.mDropOnFull
-                                                                , wtEntry.mQueueTimeout);
+                                                                , wtEntry.mQueueTimeout
+                                                                , wtEntry.mPlacement);
 
         if (wThread != nullptr)
         {
@@ -144,7 +145,8 @@ WorkerThread* Component::create_worker_thread(  const String & threadName
                                             , uint32_t stackSizeKb      /* = areg::DEFAULT_STACK_SIZE */
                                             , uint32_t maxQeueue        /* = areg::IGNORE_VALUE */
                                             , areg::Bool dropOnFull      /* = areg::Bool::Undefined */
-                                            , uint32_t waitMs            /* = areg::WAIT_INFINITE */)
+                                            , uint32_t waitMs            /* = areg::WAIT_INFINITE */
+                                            , const Thread::ThreadPlacement & placement /* = Thread::ThreadPlacement() */)
 {
     WorkerThread* workThread = mComponentInfo.find_worker_thread(threadName);
     if (workThread != nullptr)
@@ -153,7 +155,12 @@ WorkerThread* Component::create_worker_thread(  const String & threadName
     workThread = new WorkerThread(threadName, self(), consumer, watchdogTimeout, stackSizeKb, maxQeueue, dropOnFull, waitMs);
     if (workThread == nullptr)
         return nullptr;
-    
+
+    if (placement.is_empty() == false)
+    {
+        workThread->set_placement(placement);
+    }
+
     if (workThread->start(areg::WAIT_INFINITE))
     {
         mComponentInfo.register_worker_thread(*workThread);
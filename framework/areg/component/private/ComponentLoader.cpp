@@ -18,6 +18,7 @@
 #include "areg/component/Component.hpp"
 #include "areg/component/ComponentThread.hpp"
 #include "areg/component/private/ServiceManager.hpp"
+#include "areg/component/private/StrandExecutor.hpp"
 #include "areg/base/CommonDefs.hpp"
 namespace areg {
 
@@ -401,7 +402,7 @@ bool ComponentLoader::load_model( areg::Model & whichModel ) const
 
     const areg::ComponentThreadList& thrList = whichModel.thread_list( );
     whichModel.mark_model_loaded( true );
-    bool result{ true };
+    bool result{ (whichModel.runs_as_strands() == false) || StrandExecutor::instance().attach(whichModel.strand_workers()) };
     for ( uint32_t i = 0; result && i < thrList.mListThreads.size( ); ++ i )
     {
         Lock lock( mLock );
@@ -418,11 +419,25 @@ bool ComponentLoader::load_model( areg::Model & whichModel ) const
             continue;
         }
 
-        ComponentThread* thrObject = new ComponentThread( entry.mThreadName, entry.mWatchdogTimeout, entry.mStackSizeKB, entry.mMaxQueue, entry.mDropOnFull, entry.mQueueTimeout );
+        ComponentThread* thrObject = new ComponentThread( entry.mThreadName, entry.mWatchdogTimeout, entry.mStackSizeKB, entry.mMaxQueue, entry.mDropOnFull, entry.mQueueTimeout, whichModel.runs_as_strands() );
         if (thrObject == nullptr)
             result = false;
 
-        
+        if (entry.mPlacement.is_empty() == false)
+        {
+            thrObject->set_placement(entry.mPlacement);
+        }
+
+        if (entry.mQueueSpin != 0u)
+        {
+            thrObject->set_queue_spin(entry.mQueueSpin);
+        }
+
+        if (entry.mDispatchBatch != 0u)
+        {
+            thrObject->set_dispatch_batch(entry.mDispatchBatch);
+        }
+
         if ( thrObject->start( areg::WAIT_INFINITE ) == false )
         {
             thrObject->shutdown( areg::DO_NOT_WAIT );
@@ -493,6 +508,7 @@ void ComponentLoader::unload_model( bool waitComplete, areg::Model & whichModel
         _shutdown_threads(threadList);
 
         // The threads are joined and deleted, the model is off.
+        _unload_strands(whichModel);
         whichModel.mark_model_loaded(false);
     }
     else
@@ -568,6 +584,7 @@ void ComponentLoader::wait_threads(areg::Model & whichModel)
 
     lock.lock();
     _shutdown_threads(threadList);
+    _unload_strands(whichModel);
     whichModel.mark_model_loaded(false);
 }
 
@@ -596,6 +613,15 @@ void ComponentLoader::_wait_threads( const ThreadList & threadList ) const
     }
 }
 
+inline void ComponentLoader::_unload_strands( const areg::Model & whichModel ) const
+{
+    // The strands of the model are finished, the workers stop if no other model needs them.
+    if (whichModel.runs_as_strands() && (whichModel.is_model_loaded() || whichModel.is_model_unloading()))
+    {
+        StrandExecutor::instance().detach();
+    }
+}
+
 void ComponentLoader::_shutdown_threads( const ThreadList & threadList ) const
 {
     for ( uint32_t i = 0; i < threadList.size(); ++ i )
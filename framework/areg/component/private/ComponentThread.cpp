@@ -17,6 +17,7 @@
 
 #include "areg/component/Component.hpp"
 #include "areg/component/ProxyBase.hpp"
+#include "areg/component/StubBase.hpp"
 #include "areg/component/ComponentLoader.hpp"
 #include "areg/component/Model.hpp"
 #include "areg/component/private/ServiceManager.hpp"
@@ -75,14 +76,22 @@ ComponentThread::ComponentThread( const String & threadName
                                 , uint32_t stackSizeKb      /* = areg::DEFAULT_STACK_SIZE   */
                                 , uint32_t maxQueue         /* = areg::IGNORE_VALUE         */
                                 , areg::Bool dropOnFull      /* = areg::Bool::Undefined      */
-                                , uint32_t waitMs            /* = areg::WAIT_INFINITE        */ )
+                                , uint32_t waitMs            /* = areg::WAIT_INFINITE        */
+                                , bool runAsStrand           /* = false                      */ )
     : DispatcherThread  ( threadName, stackSizeKb, maxQueue, dropOnFull, waitMs )
+    , Strand            ( )
 
     , mCurrentComponent ( nullptr )
-    , mWatchdog         ( self(), watchdogTimeout )
+    , mWatchdog         ( self(), runAsStrand ? areg::WATCHDOG_IGNORE : watchdogTimeout )
     , mIsRestarting     ( false )
+    , mRunAsStrand      ( runAsStrand )
     , mListComponent    ( )
 {
+    if (runAsStrand)
+    {
+        // The queue schedules a turn of the strand instead of waking up a thread.
+        mExternalEvents.set_strand(static_cast<Strand *>(this));
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -93,7 +102,20 @@ bool ComponentThread::post_event( Event& eventElem )
     return EventDispatcher::post_event(eventElem);
 }
 
-bool ComponentThread::run_dispatcher()
+bool ComponentThread::start( uint32_t waitForStartMs /*= areg::DO_NOT_WAIT*/ )
+{
+    if (mRunAsStrand == false)
+        return DispatcherThread::start(waitForStartMs);
+
+    reset_strand();
+    if (strand_register() == false)
+        return false;
+
+    StrandExecutor::instance().schedule(static_cast<Strand &>(self()));
+    return ((waitForStartMs == areg::DO_NOT_WAIT) || strand_wait_run(waitForStartMs));
+}
+
+inline bool ComponentThread::_start_thread_components()
 {
     // Mark startup phase: proxy registration is deferred until start_components() completes.
     set_startup_phase(true);
@@ -117,7 +139,45 @@ bool ComponentThread::run_dispatcher()
     }
 
     set_startup_phase(false);
-    return DispatcherThread::run_dispatcher();
+    return true;
+}
+
+bool ComponentThread::run_dispatcher()
+{
+    return (_start_thread_components() && DispatcherThread::run_dispatcher());
+}
+
+Strand::StrandRun ComponentThread::run_strand( uint32_t budget )
+{
+    Thread * executorThread{ strand_enter() };
+
+    bool hasMore{ false };
+    bool isRunning{ false };
+    if (is_running() == false)
+    {
+        // The first turn starts the components, the queued events wait for the next one.
+        isRunning = strand_begin() && _start_thread_components();
+        hasMore = isRunning;
+    }
+    else
+    {
+        isRunning = dispatch_turn(budget, hasMore);
+    }
+
+    if (isRunning)
+    {
+        strand_leave(executorThread);
+        return (hasMore ? Strand::StrandRun::Yield : Strand::StrandRun::Idle);
+    }
+
+    // No more turns: the events posted while the components stop do not schedule the strand.
+    finish_strand();
+    static_cast<void>(strand_end());
+
+    // The waiting thread may delete the object as soon as it is released.
+    strand_release();
+    strand_leave(executorThread);
+    return Strand::StrandRun::Finished;
 }
 
 int32_t ComponentThread::create_components()
@@ -126,6 +186,8 @@ int32_t ComponentThread::create_components()
     if (!comList.is_valid())
         return 0;
     
+    // The stubs of the components are registered at once, when the batch is destroyed.
+    StubBase::RegistrationBatch batch;
     int32_t result{ 0 };
     for (uint32_t i = 0; i < comList.mListComponents.size(); ++ i)
     {
@@ -331,7 +393,7 @@ Thread::ThreadCompletion ComponentThread::shutdown( uint32_t waitForStopMs /*= a
 {
     // Another thread that asks for the shutdown must not walk it.
     // The components are notified and stopped by the exit sequence of this thread.
-    if ( id( ) == Thread::current_thread_id( ) )
+    if ( Thread::current_thread( ) == this )
     {
         ListComponent::LISTPOS pos = mListComponent.first_position( );
         while ( mListComponent.is_valid_position( pos ) )
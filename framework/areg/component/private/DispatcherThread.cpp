@@ -17,6 +17,8 @@
 
 #include "areg/component/Event.hpp"
 #include "areg/component/ExitEvent.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/persist/ConfigManager.hpp"
 #include "areg/logging/areg_log.h"
 
 //////////////////////////////////////////////////////////////////////////
@@ -186,6 +188,7 @@ int32_t NullDispatcherThread::on_exit()
 
 DEF_LOG_SCOPE(areg_component_private_DispatcherThread, destroy_thread);
 DEF_LOG_SCOPE(areg_component_private_DispatcherThread, trigger_exit);
+DEF_LOG_SCOPE(areg_component_private_DispatcherThread, start);
 
 //////////////////////////////////////////////////////////////////////////
 // DispatcherThread class runtime implementation
@@ -225,6 +228,10 @@ DispatcherThread::DispatcherThread (const String & threadName, uint32_t stackSiz
     , Thread          ( static_cast<ThreadConsumer &>(*this), threadName, stackSizeKb )
     , mEventStarted   ( true, false )
 {
+    // The placement, the spin time and the batch set in the model replace the ones of the configuration.
+    set_placement(areg::Application::config_manager().thread_placement(threadName));
+    set_queue_spin(areg::Application::config_manager().thread_spin_time(threadName));
+    set_dispatch_batch(areg::Application::config_manager().thread_dispatch_batch(threadName));
 }
 
 DispatcherThread::DispatcherThread( areg::NullTag, const String & threadName ) noexcept
@@ -261,6 +268,20 @@ void DispatcherThread::trigger_exit_drained()
     stop_dispatcher_drained();
 }
 
+bool DispatcherThread::start( uint32_t waitForStartMs /*= areg::DO_NOT_WAIT*/ )
+{
+    LOG_SCOPE( areg_component_private_DispatcherThread, start );
+
+    // The queue is empty until the thread starts, the ring is allocated anew on the node.
+    const int32_t numaNode{ placement().numaNode };
+    if ((numaNode != Thread::NUMA_NODE_ANY) && (is_strand() == false) && (mExternalEvents.bind_to_node(numaNode) == false))
+    {
+        LOG_WARN("The queue of the thread [ %s ] is not placed on the NUMA node [ %d ]", name().as_string(), numaNode);
+    }
+
+    return Thread::start(waitForStartMs);
+}
+
 Thread::ThreadCompletion DispatcherThread::shutdown( uint32_t waitForStopMs /*= areg::WAIT_INFINITE*/ )
 {
     LOG_SCOPE( areg_component_private_DispatcherThread, destroy_thread );
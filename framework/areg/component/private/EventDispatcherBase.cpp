@@ -23,6 +23,7 @@
 #include "areg/persist/ConfigManager.hpp"
 #include "areg/base/private/DebugDefs.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #if defined(__GLIBC__)
@@ -88,6 +89,8 @@ EventDispatcherBase::EventDispatcherBase(const String & name, uint32_t maxQeueue
     , mInternalEvents( )
     , mHasStarted    ( false )
     , mConsumerMap   ( )
+    , mDispatchBatch ( areg::DISPATCH_DEFAULT_BATCH )
+    , mBatchEvents   ( )
 {
 }
 
@@ -97,6 +100,8 @@ EventDispatcherBase::EventDispatcherBase( areg::NullTag ) noexcept
     , mInternalEvents( )
     , mHasStarted    ( false )
     , mConsumerMap   ( )
+    , mDispatchBatch ( areg::DISPATCH_DEFAULT_BATCH )
+    , mBatchEvents   ( )
 {
 }
 
@@ -138,6 +143,11 @@ void EventDispatcherBase::shutdown_dispatcher() noexcept
     stop_dispatcher();
 }
 
+void EventDispatcherBase::set_dispatch_batch( uint32_t batchSize ) noexcept
+{
+    mDispatchBatch = (batchSize == 0u) ? areg::DISPATCH_DEFAULT_BATCH : std::min(batchSize, areg::DISPATCH_MAX_BATCH);
+}
+
 bool EventDispatcherBase::queue_event( Event& eventElem )
 {
     areg::EventType eventType = eventElem.event_type();
@@ -238,6 +248,41 @@ bool EventDispatcherBase::take_inline_send_credit() noexcept
     return granted;
 }
 
+inline void EventDispatcherBase::_process_event( Event & eventElem )
+{
+    if ( prepare_dispatch_event(eventElem) )
+    {
+#if defined(AREG_LATENCY_TRACE) && (AREG_LATENCY_TRACE)
+        const uint64_t _ltDisp{ AREG_LT_NOW() };
+        dispatch_event(eventElem);
+        AREG_LT_SAMPLE(areg::LtStage::CompDispatch, AREG_LT_NOW() - _ltDisp);
+#else   // defined(AREG_LATENCY_TRACE) && (AREG_LATENCY_TRACE)
+        dispatch_event(eventElem);
+#endif  // defined(AREG_LATENCY_TRACE) && (AREG_LATENCY_TRACE)
+    }
+
+    post_dispatch_event(eventElem);
+
+    // Drain internal events generated by the dispatch above
+    while (!mInternalEvents.is_empty())
+    {
+        Event intEvent{ mInternalEvents.pop_event() };
+        if (prepare_dispatch_event(intEvent))
+            dispatch_event(intEvent);
+    }
+}
+
+inline uint32_t EventDispatcherBase::_pop_batch( uint32_t limit )
+{
+    if (mBatchEvents.size() != mDispatchBatch)
+    {
+        mBatchEvents.resize(mDispatchBatch);
+    }
+
+    // Every batch starts with the priority lane, a priority event waits at most one batch.
+    return mExternalEvents.pop_events(mBatchEvents.data(), std::min(limit, mDispatchBatch));
+}
+
 bool EventDispatcherBase::run_dispatcher()
 {
     ready_for_events( true );
@@ -247,38 +292,28 @@ bool EventDispatcherBase::run_dispatcher()
 
     do
     {
-        // Tight drain loop: process all available events before considering a wait.
+        // Tight drain loop: process all available events in batches before considering a wait.
         for (;;)
         {
-            Event eventElem = pick_event();  // returns Event by value; invalid if queue empty
-            if (!eventElem.is_valid() || eventElem.is_exit_prio())
+            const uint32_t count{ _pop_batch(mDispatchBatch) };
+            if ((count == 0u) || mBatchEvents[0].is_exit_prio())
             {
-                isExit = eventElem.is_exit_prio();
+                isExit = (count != 0u);
                 break;
             }
 
-            if ( prepare_dispatch_event(eventElem) )
+            for (uint32_t i = 0u; i < count; ++ i)
             {
-#if defined(AREG_LATENCY_TRACE) && (AREG_LATENCY_TRACE)
-                const uint64_t _ltDisp{ AREG_LT_NOW() };
-                dispatch_event(eventElem);
-                AREG_LT_SAMPLE(areg::LtStage::CompDispatch, AREG_LT_NOW() - _ltDisp);
-#else   // defined(AREG_LATENCY_TRACE) && (AREG_LATENCY_TRACE)
-                dispatch_event(eventElem);
-#endif  // defined(AREG_LATENCY_TRACE) && (AREG_LATENCY_TRACE)
-            }
-
-            post_dispatch_event(eventElem);
+                // An immediate exit drops the rest of the batch, the next pop returns the ExitEvent.
+                if (mExternalEvents.is_exit_triggered() == false)
+                {
+                    _process_event(mBatchEvents[i]);
+                }
 
-            // Drain internal events generated by the dispatch above
-            while (!mInternalEvents.is_empty())
-            {
-                Event intEvent{ mInternalEvents.pop_event() };
-                if (prepare_dispatch_event(intEvent))
-                    dispatch_event(intEvent);
+                mBatchEvents[i].destroy_event();
             }
 
-            ++processedSinceTrim;
+            processedSinceTrim += count;
         }
 
         // Queue drained, this dispatcher is going idle.
@@ -307,6 +342,7 @@ bool EventDispatcherBase::run_dispatcher()
 
     } while (true);
 
+    mBatchEvents.clear();
     ready_for_events(false);
     remove_all_events();
     _clean();
@@ -314,6 +350,46 @@ bool EventDispatcherBase::run_dispatcher()
     return isExit;
 }
 
+bool EventDispatcherBase::dispatch_turn( uint32_t budget, bool & hasMore )
+{
+    hasMore = false;
+    uint32_t dispatched{ 0u };
+    while (dispatched < budget)
+    {
+        const uint32_t count{ _pop_batch(budget - dispatched) };
+        if ((count != 0u) && mBatchEvents[0].is_exit_prio())
+        {
+            mBatchEvents.clear();
+            ready_for_events(false);
+            remove_all_events();
+            _clean();
+            return false;
+        }
+
+        if (count == 0u)
+        {
+            // Out of work, so the next message this strand produces has nothing to be batched with.
+            EventDispatcherBase::grant_inline_send_credit();
+            return true;
+        }
+
+        for (uint32_t i = 0u; i < count; ++ i)
+        {
+            if (mExternalEvents.is_exit_triggered() == false)
+            {
+                _process_event(mBatchEvents[i]);
+            }
+
+            mBatchEvents[i].destroy_event();
+        }
+
+        dispatched += count;
+    }
+
+    hasMore = true;
+    return true;
+}
+
 void EventDispatcherBase::ready_for_events( bool is_ready )
 {
     mExternalEvents.lock_queue( );
@@ -37,6 +37,7 @@
 #include "areg/base/SyncPrimitives.hpp"
 
 #include <atomic>
+#include <vector>
 
 /************************************************************************
  * Dependencies
@@ -233,6 +234,24 @@ public:
     [[nodiscard]]
     inline uint32_t extract_max_producer_wait_ms() noexcept;
 
+    /**
+     * \brief   Sets the number of events the dispatcher takes from its queue at once. A batch
+     *          amortizes the checks of the exit state and of the doorbell over many events of
+     *          a burst. Every batch starts with the events of the priority lane, so a priority
+     *          event waits at most for the rest of the current batch. Call before the dispatcher
+     *          starts.
+     *
+     * \param   batchSize   The batch size, clamped to areg::DISPATCH_MAX_BATCH.
+     *                      0 sets areg::DISPATCH_DEFAULT_BATCH, 1 dispatches event by event.
+     **/
+    void set_dispatch_batch( uint32_t batchSize ) noexcept;
+
+    /**
+     * \brief   Returns the number of events the dispatcher takes from its queue at once.
+     **/
+    [[nodiscard]]
+    inline uint32_t dispatch_batch() const noexcept;
+
     /**
      * \brief   Picks up a single Event from the external queue.
      *          Returns an invalid Event (is_valid() == false) when the queue is empty.
@@ -300,8 +319,9 @@ protected:
     virtual void post_dispatch_event( Event & eventElem );
 
     /**
-     * \brief   Runs the main dispatching loop: drains every queued event, then parks the thread
-     *          until a producer pushes a new event or the exit is triggered.
+     * \brief   Runs the main dispatching loop: drains every queued event in batches, then parks
+     *          the thread until a producer pushes a new event or the exit is triggered. An
+     *          immediate exit stops the batch, its rest is dropped like the queued events.
      *
      *          The loop also returns free heap pages to the operating system, because the C
      *          library keeps the pages of a drained backlog mapped. The pages are released only
@@ -312,6 +332,18 @@ protected:
      **/
     virtual bool run_dispatcher();
 
+    /**
+     * \brief   Runs one turn of the dispatching on the calling thread, for a dispatcher running
+     *          as a strand of the executor instead of its own thread. Dispatches at most
+     *          \a budget queued events and returns, it never waits for an event. The exit event
+     *          ends the dispatching like the loop of run_dispatcher() does.
+     *
+     * \param   budget      The maximum number of events to dispatch in the turn.
+     * \param   hasMore     On output, true if the turn used its budget and events may be left.
+     * \return  False if the turn dispatched the exit event and the dispatching ended.
+     **/
+    bool dispatch_turn( uint32_t budget, bool & hasMore );
+
     /**
      * \brief   Notifies exit event to shutdown dispatcher.
      **/
@@ -357,6 +389,17 @@ protected:
      **/
     EventConsumerMap    mConsumerMap;
 
+    /**
+     * \brief   The number of events taken from the external queue at once.
+     **/
+    uint32_t            mDispatchBatch;
+
+    /**
+     * \brief   The events taken from the external queue and not dispatched yet.
+     *          Allocated when the dispatching starts, only the owner thread uses it.
+     **/
+    std::vector<Event>  mBatchEvents;
+
 #if defined(_MSC_VER)
     #pragma warning(pop)
 #endif  // _MSC_VER
@@ -368,6 +411,18 @@ private:
     inline EventDispatcherBase & self() noexcept;
     void _clean() noexcept;
 
+    /**
+     * \brief   Dispatches the external event and then the internal events it generated.
+     **/
+    inline void _process_event( Event & eventElem );
+
+    /**
+     * \brief   Takes up to \a limit events from the external queue into the batch, the events
+     *          of the priority lane first. Returns the number of events taken. The exit event
+     *          is returned alone.
+     **/
+    inline uint32_t _pop_batch( uint32_t limit );
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden method calls
 //////////////////////////////////////////////////////////////////////////
@@ -395,6 +450,11 @@ inline uint32_t EventDispatcherBase::pop_events(Event* listEvents, uint32_t coun
     return mExternalEvents.pop_events(listEvents, count);
 }
 
+inline uint32_t EventDispatcherBase::dispatch_batch() const noexcept
+{
+    return mDispatchBatch;
+}
+
 inline void EventDispatcherBase::signal_exit_event() noexcept
 {
     mExternalEvents.trigger_exit();
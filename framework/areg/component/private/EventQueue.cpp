@@ -15,11 +15,16 @@
 #include "areg/component/private/EventQueue.hpp"
 
 #include "areg/base/RuntimeClassID.hpp"
+#include "areg/base/Thread.hpp"
 #include "areg/component/Event.hpp"
 #include "areg/component/ExitEvent.hpp"
 #include "areg/base/private/DebugDefs.hpp"
+#include "areg/component/private/StrandExecutor.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <new>
 #include <type_traits>
 
 // pop_event() is noexcept and returns the exit event by copying the cached singleton.
@@ -45,14 +50,19 @@ EventQueue::EventQueue(uint32_t maxQueue, bool dropOnFull /*= false*/, uint32_t
     , mPrioCount        ( 0u )
     , mQueueEvent       ( true, false )     // manual-reset, initially non-signaled
     , mConsumerParked   ( false )
+    , mSpinUs           ( 0u )
     , mExitState        ( EventQueue::EXIT_NONE )
+    , mStrand           ( nullptr )
     , mSlotEvent        ( true, true )      // auto-reset, initially non-signaled
     , mMaxWaitMs        ( 0u )
     , mProducersWaiting ( 0u )
+    , mLatestLock       ( )
+    , mLatest           ( )
+    , mLatestCount      ( 0u )
 {
-    mRing = new Cell[mCapacity];
-    for (uint32_t i = 0u; i < mCapacity; ++i)
-        mRing[i].sequence.store(i, std::memory_order_relaxed);
+    mRing = EventQueue::_allocate_ring(mCapacity, Thread::NUMA_NODE_ANY);
+    if (mRing == nullptr)
+        throw std::bad_alloc();
 }
 
 EventQueue::EventQueue( areg::NullTag ) noexcept
@@ -68,16 +78,21 @@ EventQueue::EventQueue( areg::NullTag ) noexcept
     , mPrioCount        ( 0u )
     , mQueueEvent       ( areg::NullTag{} )     // no OS handle
     , mConsumerParked   ( false )
+    , mSpinUs           ( 0u )
     , mExitState        ( EventQueue::EXIT_NONE )
+    , mStrand           ( nullptr )
     , mSlotEvent        ( areg::NullTag{} )     // no OS handle
     , mMaxWaitMs        ( 0u )
     , mProducersWaiting ( 0u )
+    , mLatestLock       ( )
+    , mLatest           ( )
+    , mLatestCount      ( 0u )
 {
 }
 
 EventQueue::~EventQueue()
 {
-    delete[] mRing;
+    EventQueue::_free_ring(mRing, mCapacity);
     mRing = nullptr;
 }
 
@@ -90,6 +105,10 @@ bool EventQueue::wait_event(uint32_t timeout /*= areg::WAIT_INFINITE*/) noexcept
     if (has_pending())
         return true;
 
+    // The producers see the consumer awake while it spins, so they do not ring the doorbell.
+    if ((mSpinUs != 0u) && (timeout != areg::DO_NOT_WAIT) && _spin_wait(timeout))
+        return true;
+
     // Lost-wakeup-free eventcount: reset the doorbell, then re-check
     mQueueEvent.reset();
     mConsumerParked.store(true, std::memory_order_relaxed);
@@ -105,13 +124,38 @@ bool EventQueue::wait_event(uint32_t timeout /*= areg::WAIT_INFINITE*/) noexcept
     return signaled || has_pending();
 }
 
+bool EventQueue::_spin_wait(uint32_t timeout) const noexcept
+{
+    const uint64_t spinUs{ timeout == areg::WAIT_INFINITE ? mSpinUs : std::min<uint64_t>(mSpinUs, static_cast<uint64_t>(timeout) * 1'000u) };
+    const std::chrono::microseconds spin{ static_cast<std::chrono::microseconds::rep>(spinUs) };
+    const auto deadline{ std::chrono::steady_clock::now() + spin };
+    do
+    {
+        for (uint32_t i = 0u; i < EventQueue::SPIN_CLOCK_CHECK; ++ i)
+        {
+            Thread::cpu_pause();
+            if (has_pending())
+                return true;
+        }
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    return false;
+}
+
 inline void EventQueue::_wake_consumer() noexcept
 {
     std::atomic_thread_fence(std::memory_order_seq_cst);
-    if (mConsumerParked.load(std::memory_order_relaxed))
+    if (mStrand != nullptr)
+        _schedule_strand();
+    else if (mConsumerParked.load(std::memory_order_relaxed))
         mQueueEvent.set_signaled();
 }
 
+void EventQueue::_schedule_strand() noexcept
+{
+    StrandExecutor::instance().schedule(*mStrand);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EventQueue - push
 //////////////////////////////////////////////////////////////////////////
@@ -143,8 +187,19 @@ bool EventQueue::push_event(Event& eventElem, Event* removedEvent /*= nullptr*/)
         return true;
     }
 
-    // Normal-priority: bounded ring (drop or block per policy).
-    if (_ring_enqueue(eventElem))
+    // Normal-priority: bounded ring (drop or block per policy), the droppable updates replace each other.
+    bool enqueued{ false };
+    if (eventElem.is_droppable())
+    {
+        enqueued = _latest_enqueue(eventElem);
+    }
+    else
+    {
+        _latest_seal(eventElem);
+        enqueued = _ring_enqueue(eventElem);
+    }
+
+    if (enqueued)
     {
         _wake_consumer();
         return true;
@@ -210,7 +265,18 @@ uint32_t EventQueue::push_events(Event* eventElems, uint32_t count)
         if (!evt.is_valid())
             continue;
 
-        if (_ring_enqueue(evt))
+        bool enqueued{ false };
+        if (evt.is_droppable())
+        {
+            enqueued = _latest_enqueue(evt);
+        }
+        else
+        {
+            _latest_seal(evt);
+            enqueued = _ring_enqueue(evt);
+        }
+
+        if (enqueued)
         {
             ++signalCount;
         }
@@ -314,6 +380,25 @@ uint32_t EventQueue::pop_events(Event* eventElems, uint32_t count)
     return popped;
 }
 
+bool EventQueue::bind_to_node(int32_t numaNode) noexcept
+{
+    // No producer uses the empty ring yet, the new one starts at the same cursors.
+    const size_t pos{ mEnqueuePos.load(std::memory_order_acquire) };
+    if ((mRing == nullptr) || (pos != mDequeuePos.load(std::memory_order_acquire)) || (mLatestCount.load(std::memory_order_acquire) != 0u))
+        return false;
+
+    Cell* ring{ EventQueue::_allocate_ring(mCapacity, numaNode) };
+    if (ring == nullptr)
+        return false;
+
+    for (size_t i = pos; i < pos + mCapacity; ++i)
+        ring[i & mMask].sequence.store(i, std::memory_order_relaxed);
+
+    EventQueue::_free_ring(mRing, mCapacity);
+    mRing = ring;
+    return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EventQueue - remove
 //////////////////////////////////////////////////////////////////////////
@@ -378,13 +463,20 @@ void EventQueue::remove_all_events() noexcept
         if (!_ring_try_dequeue(evt))
             break;
     }
+
+    if (mLatestCount.load(std::memory_order_relaxed) != 0u)
+    {
+        Lock lock(mLatestLock);
+        mLatest.clear();
+        mLatestCount.store(0u, std::memory_order_relaxed);
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
 // EventQueue - Vyukov bounded ring
 //////////////////////////////////////////////////////////////////////////
 
-bool EventQueue::_ring_try_enqueue(Event& eventElem) noexcept
+bool EventQueue::_ring_try_enqueue(Event& eventElem, size_t * ringPos /*= nullptr*/) noexcept
 {
     ASSERT(mRing != nullptr);
 
@@ -414,6 +506,11 @@ bool EventQueue::_ring_try_enqueue(Event& eventElem) noexcept
 #ifdef AREG_LATENCY_TRACE
     cell->lt_ns = AREG_LT_NOW();    // stamp before publishing; visible to consumer via the release store
 #endif
+    if (ringPos != nullptr)
+    {
+        *ringPos = pos;
+    }
+
     cell->sequence.store(pos + 1u, std::memory_order_release);
     return true;
 }
@@ -425,8 +522,8 @@ bool EventQueue::_ring_enqueue(Event& eventElem) noexcept
     if (_ring_try_enqueue(eventElem))
         return true;
 
-    if (mDropOnFull)
-        return false;   // drop-newest
+    if (mDropOnFull || eventElem.is_droppable())
+        return false;   // drop-newest, the droppable updates never wait
 
     // Lossless: block up to mWaitMs for a free slot; abortable by exit.
     const auto waitBegin{ std::chrono::steady_clock::now() };
@@ -480,9 +577,98 @@ bool EventQueue::_ring_try_dequeue(Event& result) noexcept
 
     if (mProducersWaiting.load(std::memory_order_relaxed) != 0u)
         mSlotEvent.set_signaled();   // a slot freed: wake a blocked producer
+
+    // The count is stored before the update is published, the acquire load above makes it visible.
+    if ((mLatestCount.load(std::memory_order_relaxed) != 0u) && result.is_droppable())
+        _latest_take(result, pos);
+
     return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// EventQueue - latest-value lane
+//////////////////////////////////////////////////////////////////////////
+
+bool EventQueue::_latest_enqueue(Event& eventElem) noexcept
+{
+    const areg::EventHeader* hdr{ eventElem.header() };
+    ASSERT(hdr != nullptr);
+
+    Lock lock(mLatestLock);
+    for (LatestValue& entry : mLatest)
+    {
+        if ((entry.messageId == hdr->messageId) && (std::memcmp(&entry.consumer, &hdr->consumer, sizeof(areg::Endpoint)) == 0))
+        {
+            // The queued update is not dispatched yet, the newer value takes its place.
+            entry.event.destroy_event();
+            entry.event = std::move(eventElem);
+            return true;
+        }
+    }
+
+    // Opened before the update is published, so the consumer dequeuing it finds the entry.
+    mLatest.push_back(LatestValue{ hdr->consumer, hdr->messageId, 0u, Event{} });
+    mLatestCount.store(static_cast<uint32_t>(mLatest.size()), std::memory_order_relaxed);
+    if (_ring_try_enqueue(eventElem, &mLatest.back().ringPos))
+        return true;
+
+    mLatest.pop_back();
+    mLatestCount.store(static_cast<uint32_t>(mLatest.size()), std::memory_order_relaxed);
+    return false;
+}
+
+void EventQueue::_latest_seal(const Event& eventElem) noexcept
+{
+    if ((mLatestCount.load(std::memory_order_relaxed) == 0u) || (areg::is_to_consumer(eventElem.event_type()) == false))
+        return;
+
+    const areg::EventHeader* hdr{ eventElem.header() };
+    Lock lock(mLatestLock);
+    for (uint32_t i = 0u; i < static_cast<uint32_t>(mLatest.size()); ++ i)
+    {
+        LatestValue& entry{ mLatest[i] };
+        if ((entry.messageId == hdr->messageId) && (std::memcmp(&entry.consumer, &hdr->consumer, sizeof(areg::Endpoint)) == 0))
+        {
+            // The queued update is dispatched as it is, a newer value would overtake the lossless event.
+            entry.event.destroy_event();
+            if ((i + 1u) != static_cast<uint32_t>(mLatest.size()))
+            {
+                entry = std::move(mLatest.back());
+            }
+
+            mLatest.pop_back();
+            mLatestCount.store(static_cast<uint32_t>(mLatest.size()), std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
+void EventQueue::_latest_take(Event& result, size_t ringPos) noexcept
+{
+    Lock lock(mLatestLock);
+    for (uint32_t i = 0u; i < static_cast<uint32_t>(mLatest.size()); ++ i)
+    {
+        LatestValue& entry{ mLatest[i] };
+        if (entry.ringPos == ringPos)
+        {
+            if (entry.event.is_valid())
+            {
+                result.destroy_event();
+                result = std::move(entry.event);
+            }
+
+            if ((i + 1u) != static_cast<uint32_t>(mLatest.size()))
+            {
+                entry = std::move(mLatest.back());
+            }
+
+            mLatest.pop_back();
+            mLatestCount.store(static_cast<uint32_t>(mLatest.size()), std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EventQueue - capacity helpers
 //////////////////////////////////////////////////////////////////////////
@@ -512,4 +698,32 @@ uint32_t EventQueue::_calc_capacity(uint32_t requested) noexcept
         return _round_up_pow2(requested);
 }
 
+EventQueue::Cell* EventQueue::_allocate_ring(uint32_t capacity, int32_t numaNode) noexcept
+{
+    // The pages are not touched before the cells are constructed, the node policy places them.
+    void* block{ Thread::allocate_node_memory(sizeof(Cell) * capacity, numaNode) };
+    if (block == nullptr)
+        return nullptr;
+
+    Cell* ring{ static_cast<Cell*>(block) };
+    for (uint32_t i = 0u; i < capacity; ++i)
+    {
+        Cell* cell{ ::new (static_cast<void*>(ring + i)) Cell() };
+        cell->sequence.store(i, std::memory_order_relaxed);
+    }
+
+    return ring;
+}
+
+void EventQueue::_free_ring(Cell* ring, uint32_t capacity) noexcept
+{
+    if (ring == nullptr)
+        return;
+
+    for (uint32_t i = 0u; i < capacity; ++i)
+        ring[i].~Cell();
+
+    Thread::free_node_memory(ring, sizeof(Cell) * capacity);
+}
+
 } // namespace areg
@@ -32,6 +32,10 @@
  ************************************************************************/
 #include "areg/component/Event.hpp"
 
+namespace areg {
+    class Strand;
+}
+
 namespace areg {
 
 //////////////////////////////////////////////////////////////////////////
@@ -61,6 +65,15 @@ namespace areg {
  *              The wait is aborted by trigger_exit().
  *            - dropOnFull == true: the incoming event is rejected (drop-newest),
  *              for best-effort / latest-value streams (e.g. broadcasts).
+ *          A droppable update (Event::is_droppable()) is always rejected by a full
+ *          ring, whatever the policy of the queue: the next update replaces it.
+ *
+ *          The droppable updates also go through a latest-value lane. While an update
+ *          of an attribute to a consumer waits in the ring, a newer update of the same
+ *          attribute to the same consumer replaces it in place and takes no slot. The
+ *          consumer dequeues the newest value at the position of the first one. A
+ *          lossless update of the attribute, like an invalidation, ends the replacing,
+ *          so no value overtakes it.
  *
  *          The queue owns the consumer wake-up (a manual-reset SyncEvent doorbell,
  *          lost-wakeup-free eventcount discipline) and the producer wake-up (an
@@ -92,7 +105,21 @@ private:
 #endif
     };
 
+    /**
+     * \brief   One entry of the latest-value lane: a droppable update of the attribute
+     *          \a messageId to \a consumer, queued in the ring at the ticket \a ringPos.
+     *          \a event is the newer value replacing the queued one, invalid if none.
+     **/
+    struct LatestValue
+    {
+        areg::Endpoint      consumer { };
+        uint32_t            messageId{ 0u };
+        size_t              ringPos  { 0u };
+        Event               event    {    };
+    };
+
     static constexpr uint32_t   RING_WAIT_RECHECK_MS  { 1u };     //!< Producer block re-check interval.
+    static constexpr uint32_t   SPIN_CLOCK_CHECK      { 64u };    //!< Queue checks between two reads of the clock while spinning.
 
     static constexpr uint8_t    EXIT_NONE     { 0u };     //!< The queue keeps running.
     static constexpr uint8_t    EXIT_NOW      { 1u };     //!< Stop at once, queued events are dropped.
@@ -194,9 +221,34 @@ public:
      **/
     inline void reset_exit() noexcept;
 
+    /**
+     * \brief   Sets the strand consuming the queue. The queue schedules a turn of the strand
+     *          instead of waking up a consumer thread. Must be set before the queue is used.
+     *
+     * \param   strand  The strand consuming the queue, nullptr if a thread consumes it.
+     **/
+    inline void set_strand( Strand * strand ) noexcept;
+
+    /**
+     * \brief   Sets how long the consumer spins on the empty queue in wait_event() before it
+     *          parks. A consumer that finds an event while spinning saves its wake-up, and the
+     *          producer does not ring the doorbell. The spinning thread keeps its core busy.
+     *          Must be set before the consumer waits.
+     *
+     * \param   spinUs  The spin time in microseconds. 0 parks at once.
+     **/
+    inline void set_spin_time( uint32_t spinUs ) noexcept;
+
+    /**
+     * \brief   Returns the time in microseconds the consumer spins before it parks.
+     **/
+    [[nodiscard]]
+    inline uint32_t spin_time() const noexcept;
+
     /**
      * \brief   Blocks the single consumer thread until the queue has something to
-     *          pop (a queued event or a pending exit), or the timeout elapses.
+     *          pop (a queued event or a pending exit), or the timeout elapses. If a spin
+     *          time is set, the consumer first spins on the queue, then it parks.
      *
      * \param   timeout     Milliseconds to wait. areg::WAIT_INFINITE blocks until signaled.
      *                      areg::DO_NOT_WAIT polls without blocking.
@@ -267,16 +319,56 @@ public:
      **/
     uint32_t pop_events(Event* eventElems, uint32_t count);
 
+    /**
+     * \brief   Replaces the ring by one allocated on the NUMA node, so that the consumer running
+     *          on that node reads the cells from its local memory. Call before the queue is
+     *          used by any producer, the ring must be empty.
+     *
+     * \param   numaNode    The NUMA node to place the ring on.
+     * \return  Returns true if the ring is placed on the node. Returns false if the queue has
+     *          no ring, is not empty or the platform cannot allocate the memory on the node.
+     **/
+    bool bind_to_node(int32_t numaNode) noexcept;
+
 //////////////////////////////////////////////////////////////////////////
 // Private helpers
 //////////////////////////////////////////////////////////////////////////
 private:
 
+    /**
+     * \brief   Spins on the empty queue up to the spin time, at most \a timeout milliseconds.
+     *          Returns true as soon as the queue has something to pop.
+     **/
+    bool _spin_wait(uint32_t timeout) const noexcept;
+
     /**
      * \brief   One producer attempt to publish \a eventElem into the ring.
      *          Lock-free, safe from any producer. Returns false when the ring is full.
+     *
+     * \param   eventElem   The event to publish, moved in on success.
+     * \param   ringPos     If not nullptr, on output holds the ticket of the claimed slot.
+     **/
+    bool _ring_try_enqueue(Event& eventElem, size_t * ringPos = nullptr) noexcept;
+
+    /**
+     * \brief   Publishes the droppable update \a eventElem through the latest-value lane: it
+     *          replaces the pending update of the same attribute to the same consumer, or it
+     *          takes a ring slot and opens an entry. Never waits for a free slot.
+     *          Returns false if the ring is full.
+     **/
+    bool _latest_enqueue(Event& eventElem) noexcept;
+
+    /**
+     * \brief   Closes the latest-value entry of the attribute and consumer of the lossless
+     *          event \a eventElem, so that no newer value replaces an update queued before it.
+     **/
+    void _latest_seal(const Event& eventElem) noexcept;
+
+    /**
+     * \brief   Consumer side of the latest-value lane: if \a result, dequeued at the ticket
+     *          \a ringPos, has a newer value, replaces it. Closes the entry in any case.
      **/
-    bool _ring_try_enqueue(Event& eventElem) noexcept;
+    void _latest_take(Event& result, size_t ringPos) noexcept;
 
     /**
      * \brief   Publishes \a eventElem honoring the full-ring policy: drop, or block
@@ -297,6 +389,11 @@ private:
      **/
     void _wake_consumer() noexcept;
 
+    /**
+     * \brief   Schedules a turn of the strand consuming the queue.
+     **/
+    void _schedule_strand() noexcept;
+
     /**
      * \brief   Rounds \a value up to the next power of two.
      **/
@@ -309,6 +406,18 @@ private:
     [[nodiscard]]
     static uint32_t _calc_capacity(uint32_t requested) noexcept;
 
+    /**
+     * \brief   Allocates the ring of \a capacity free cells in pages of its own, placed on the
+     *          NUMA node. Returns nullptr on failure.
+     **/
+    [[nodiscard]]
+    static Cell* _allocate_ring(uint32_t capacity, int32_t numaNode) noexcept;
+
+    /**
+     * \brief   Destroys the cells of the ring and frees its pages.
+     **/
+    static void _free_ring(Cell* ring, uint32_t capacity) noexcept;
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -319,7 +428,7 @@ private:
     const size_t            mMask;       //!< mCapacity - 1 (index mask).
     const bool              mDropOnFull; //!< true: drop on full; false: block up to mWaitMs.
     const uint32_t          mWaitMs;     //!< Lossless-mode full-ring block timeout (ms).
-    Cell*                   mRing;       //!< Fixed array of mCapacity cells.
+    Cell*                   mRing;       //!< Fixed array of mCapacity cells, in pages of its own.
 
     //!< Producer-written enqueue cursor - own cache line.
     alignas(AREG_MPSC_CACHE_LINE_SIZE) std::atomic<size_t> mEnqueuePos;
@@ -337,8 +446,12 @@ private:
     //!< Set by the consumer while parked in wait_event(); read by producers so the doorbell
     //!< is rung only when a waiter actually needs it (eventcount discipline, lost-wakeup-free).
     std::atomic<bool>       mConsumerParked;
+    //!< The time in microseconds the consumer spins on the empty queue before it parks.
+    uint32_t                mSpinUs;
     //!< Sticky exit state, a combination of EXIT_NOW and EXIT_DRAINED.
     std::atomic_uint8_t     mExitState;
+    //!< The strand consuming the queue, nullptr if the consumer is a thread waiting in wait_event().
+    Strand *                mStrand;
 
     //!< Producer wake-up (auto-reset): signalled by the consumer when a slot is freed.
     SimpleEvent             mSlotEvent;
@@ -347,6 +460,11 @@ private:
     //!< Number of producers blocked on a full ring (so the consumer signals only when needed).
     std::atomic<uint32_t>   mProducersWaiting;
 
+    //!< Latest-value lane. A few entries at a time: a vector keeps its slots, the hot path allocates nothing.
+    SpinLock                mLatestLock;    //!< Guards mLatest.
+    std::vector<LatestValue> mLatest;       //!< The droppable updates waiting in the ring.
+    std::atomic_uint32_t    mLatestCount;   //!< The number of entries in mLatest, read without the lock.
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden
 //////////////////////////////////////////////////////////////////////////
@@ -404,6 +522,10 @@ inline void EventQueue::trigger_exit() noexcept
     std::atomic_thread_fence(std::memory_order_seq_cst);
     mQueueEvent.set_signaled();     // wake the consumer
     mSlotEvent.set_signaled();      // wake any producer blocked on a full ring
+    if (mStrand != nullptr)
+    {
+        _schedule_strand();
+    }
 }
 
 inline void EventQueue::trigger_exit_drained() noexcept
@@ -412,6 +534,10 @@ inline void EventQueue::trigger_exit_drained() noexcept
     std::atomic_thread_fence(std::memory_order_seq_cst);
     mQueueEvent.set_signaled();     // wake the consumer
     mSlotEvent.set_signaled();      // wake any producer blocked on a full ring
+    if (mStrand != nullptr)
+    {
+        _schedule_strand();
+    }
 }
 
 inline void EventQueue::reset_exit() noexcept
@@ -419,5 +545,20 @@ inline void EventQueue::reset_exit() noexcept
     mExitState.store(EventQueue::EXIT_NONE, std::memory_order_release);
 }
 
+inline void EventQueue::set_strand( Strand * strand ) noexcept
+{
+    mStrand = strand;
+}
+
+inline void EventQueue::set_spin_time( uint32_t spinUs ) noexcept
+{
+    mSpinUs = spinUs;
+}
+
+inline uint32_t EventQueue::spin_time() const noexcept
+{
+    return mSpinUs;
+}
+
 } // namespace areg
 #endif  // AREG_COMPONENT_PRIVATE_EventQueue_HPP
@@ -215,6 +215,7 @@ areg::WorkerThreadEntry::WorkerThreadEntry()
     , mMaxQueue         (areg::IGNORE_VALUE)
     , mDropOnFull       (areg::Bool::Undefined)
     , mQueueTimeout     (areg::WAIT_INFINITE)
+    , mPlacement        ( )
 {
 }
 
@@ -234,6 +235,7 @@ areg::WorkerThreadEntry::WorkerThreadEntry( const String & masterThreadName
     , mMaxQueue         (maxQueue)
     , mDropOnFull       (queueDropEvent)
     , mQueueTimeout     (queueTimeout)
+    , mPlacement        ( )
 {
 }
 
@@ -792,6 +794,9 @@ areg::ComponentThreadEntry::ComponentThreadEntry()
     , mMaxQueue         (areg::IGNORE_VALUE)
     , mDropOnFull       (areg::Bool::Undefined)
     , mQueueTimeout     (areg::WAIT_INFINITE)
+    , mPlacement        ( )
+    , mQueueSpin        (0u)
+    , mDispatchBatch    (0u)
 {
 }
 
@@ -808,6 +813,9 @@ areg::ComponentThreadEntry::ComponentThreadEntry( const String & threadName
     , mMaxQueue         (maxQueue)
     , mDropOnFull       (queueDropEvent)
     , mQueueTimeout     (queueTimeout)
+    , mPlacement        ( )
+    , mQueueSpin        (0u)
+    , mDispatchBatch    (0u)
 {
 }
 
@@ -825,6 +833,9 @@ areg::ComponentThreadEntry::ComponentThreadEntry( const String & threadName
     , mMaxQueue         (maxQueue)
     , mDropOnFull       (queueDropEvent)
     , mQueueTimeout     (queueTimeout)
+    , mPlacement        ( )
+    , mQueueSpin        (0u)
+    , mDispatchBatch    (0u)
 {
 }
 
@@ -963,6 +974,8 @@ areg::Model::Model()
     , mModelThreads ( )
     , mLoadState    ( Model::ModelState::Initialized )
     , mAliveDuration( )
+    , mRunAsStrands ( false )
+    , mStrandWorkers( 0u )
 {
 }
 
@@ -971,6 +984,8 @@ areg::Model::Model( const String & modelName )
     , mModelThreads ( )
     , mLoadState    ( Model::ModelState::Initialized )
     , mAliveDuration( )
+    , mRunAsStrands ( false )
+    , mStrandWorkers( 0u )
 {
 }
 
@@ -979,6 +994,8 @@ areg::Model::Model( const String & modelName, const ComponentThreadList & thread
     , mModelThreads (threadList)
     , mLoadState    ( Model::ModelState::Initialized )
     , mAliveDuration( )
+    , mRunAsStrands ( false )
+    , mStrandWorkers( 0u )
 {
 }
 
@@ -0,0 +1,207 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/component/private/MulticastEnvelope.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, multicast form of the remote response envelope.
+ ************************************************************************/
+#include "areg/component/MulticastEnvelope.hpp"
+
+#include "areg/base/MathDefs.hpp"
+#include "areg/base/MessageEnvelope.hpp"
+#include "areg/component/EventDefs.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace areg {
+
+namespace
+{
+    constexpr uint32_t  ENDPOINT_SIZE   { static_cast<uint32_t>(sizeof(areg::Endpoint)) };
+    constexpr uint32_t  TRAILER_SIZE    { static_cast<uint32_t>(sizeof(MulticastEnvelope::Trailer)) };
+    constexpr uint8_t   CALL_MULTICAST  { static_cast<uint8_t>(areg::EventCallType::CallMulticast) };
+
+    // The target list starts 4-byte aligned, so the entries and the trailer can be read in place.
+    inline constexpr uint32_t _list_offset(uint32_t payloadSize) noexcept
+    {
+        return ((payloadSize + 3u) & ~3u);
+    }
+}
+
+bool MulticastEnvelope::attach_targets( MessageEnvelope & envelope, const areg::Endpoint * targets, uint32_t count )
+{
+    if ((targets == nullptr) || (count == 0u) || !envelope.is_valid() || (envelope.call_type() == CALL_MULTICAST))
+        return false;
+
+    const uint32_t payloadSize{ envelope.size_used() };
+    const uint32_t padding{ _list_offset(payloadSize) - payloadSize };
+    const uint64_t listSize{ static_cast<uint64_t>(count) * ENDPOINT_SIZE + TRAILER_SIZE + padding };
+    if (listSize + payloadSize > static_cast<uint64_t>(areg::MAX_BUF_LENGTH))
+        return false;
+
+    constexpr uint8_t zeros[4]{ 0u, 0u, 0u, 0u };
+    const MulticastEnvelope::Trailer trailer{ payloadSize, count, envelope.call_type() };
+    envelope.move_to_end();
+    if (  (envelope.write_array(zeros, padding) != padding)
+       || (envelope.write_array(targets, count) != count * ENDPOINT_SIZE)
+       || (envelope.write_pod(trailer) != TRAILER_SIZE))
+    {
+        envelope.set_size_used(payloadSize);
+        return false;
+    }
+
+    envelope.set_call_type(CALL_MULTICAST);
+    return true;
+}
+
+bool MulticastEnvelope::is_multicast( const MessageEnvelope & envelope ) noexcept
+{
+    return (MulticastEnvelope::_trailer(envelope) != nullptr);
+}
+
+uint32_t MulticastEnvelope::target_count( const MessageEnvelope & envelope ) noexcept
+{
+    const MulticastEnvelope::Trailer * trailer{ MulticastEnvelope::_trailer(envelope) };
+    return (trailer != nullptr ? trailer->targetCount : 0u);
+}
+
+const areg::Endpoint * MulticastEnvelope::targets( const MessageEnvelope & envelope ) noexcept
+{
+    const MulticastEnvelope::Trailer * trailer{ MulticastEnvelope::_trailer(envelope) };
+    return (trailer != nullptr ? reinterpret_cast<const areg::Endpoint *>(envelope.buffer() + _list_offset(trailer->payloadSize)) : nullptr);
+}
+
+uint32_t MulticastEnvelope::payload_size( const MessageEnvelope & envelope ) noexcept
+{
+    const MulticastEnvelope::Trailer * trailer{ MulticastEnvelope::_trailer(envelope) };
+    return (trailer != nullptr ? trailer->payloadSize : envelope.size_used());
+}
+
+MessageEnvelope MulticastEnvelope::extract_unicast( const MessageEnvelope & envelope, const areg::Endpoint & target )
+{
+    const MulticastEnvelope::Trailer * trailer{ MulticastEnvelope::_trailer(envelope) };
+    if (trailer == nullptr)
+        return MessageEnvelope{};
+
+    const uint8_t callType{ static_cast<uint8_t>(trailer->callType) };
+    MessageEnvelope result{ MulticastEnvelope::_copy_payload(envelope, 0u) };
+    if (result.is_valid())
+    {
+        result.set_consumer(target);
+        result.set_target(target.id);
+        result.set_call_type(callType);
+    }
+
+    return result;
+}
+
+bool MulticastEnvelope::restore_unicast( MessageEnvelope & envelope, const areg::Endpoint & target ) noexcept
+{
+    const MulticastEnvelope::Trailer * trailer{ MulticastEnvelope::_trailer(envelope) };
+    if (trailer == nullptr)
+        return false;
+
+    const uint8_t callType{ static_cast<uint8_t>(trailer->callType) };
+    envelope.set_size_used(trailer->payloadSize);
+    envelope.set_consumer(target);
+    envelope.set_target(target.id);
+    envelope.set_call_type(callType);
+    return true;
+}
+
+uint32_t MulticastEnvelope::split_by_process( const MessageEnvelope & envelope, ArrayList<MessageEnvelope> & result )
+{
+    const uint32_t count{ MulticastEnvelope::target_count(envelope) };
+    if (count == 0u)
+        return 0u;
+
+    // Group the targets by the process cookie, keeping the original order inside a group.
+    const areg::Endpoint * list{ MulticastEnvelope::targets(envelope) };
+    std::vector<areg::Endpoint> sorted(count);
+    std::memcpy(sorted.data(), list, static_cast<size_t>(count) * ENDPOINT_SIZE);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const areg::Endpoint & lhs, const areg::Endpoint & rhs) { return lhs.id < rhs.id; });
+
+    uint32_t added{ 0u };
+    for (uint32_t i{ 0u }; i < count; )
+    {
+        const uint32_t cookie{ sorted[i].id };
+        uint32_t j{ i + 1u };
+        while ((j < count) && (sorted[j].id == cookie))
+            ++j;
+
+        const uint32_t groupSize{ j - i };
+        if (groupSize < MulticastEnvelope::MIN_TARGETS)
+        {
+            MessageEnvelope unicast{ MulticastEnvelope::extract_unicast(envelope, sorted[i]) };
+            if (unicast.is_valid())
+            {
+                result.add(unicast);
+                ++added;
+            }
+        }
+        else
+        {
+            const uint32_t callType{ MulticastEnvelope::_trailer(envelope)->callType };
+            MessageEnvelope multicast{ MulticastEnvelope::_copy_payload(envelope, groupSize * ENDPOINT_SIZE + TRAILER_SIZE + 3u) };
+            if (multicast.is_valid())
+            {
+                multicast.set_call_type(static_cast<uint8_t>(callType));
+                multicast.set_consumer(sorted[i]);
+                if (MulticastEnvelope::attach_targets(multicast, sorted.data() + i, groupSize))
+                {
+                    multicast.set_target(cookie);
+                    result.add(multicast);
+                    ++added;
+                }
+            }
+        }
+
+        i = j;
+    }
+
+    return added;
+}
+
+const MulticastEnvelope::Trailer * MulticastEnvelope::_trailer( const MessageEnvelope & envelope ) noexcept
+{
+    if (envelope.call_type() != CALL_MULTICAST)
+        return nullptr;
+
+    const uint32_t used{ envelope.size_used() };
+    if ((used < TRAILER_SIZE) || ((used & 3u) != 0u))
+        return nullptr;
+
+    const uint8_t * data{ envelope.buffer() };
+    const MulticastEnvelope::Trailer * trailer{ reinterpret_cast<const MulticastEnvelope::Trailer *>(data + used - TRAILER_SIZE) };
+    const uint64_t expected{ static_cast<uint64_t>(_list_offset(trailer->payloadSize)) + static_cast<uint64_t>(trailer->targetCount) * ENDPOINT_SIZE + TRAILER_SIZE };
+    return ((trailer->targetCount != 0u) && (expected == used) ? trailer : nullptr);
+}
+
+MessageEnvelope MulticastEnvelope::_copy_payload( const MessageEnvelope & envelope, uint32_t extra )
+{
+    MessageEnvelope result;
+    const areg::EventHeader * hdr{ envelope.header() };
+    const uint32_t payloadSize{ MulticastEnvelope::payload_size(envelope) };
+    uint8_t * dst{ result.init_envelope(*hdr, payloadSize + extra) };
+    if (dst == nullptr)
+        return result;
+
+    if (payloadSize != 0u)
+    {
+        areg::mem_copy(dst, payloadSize + extra, envelope.buffer(), payloadSize);
+    }
+
+    result.set_size_used(payloadSize);
+    return result;
+}
+
+} // namespace areg
@@ -23,6 +23,7 @@
 #include "areg/component/StubBase.hpp"
 #include "areg/component/StubAddress.hpp"
 #include "areg/component/ComponentThread.hpp"
+#include "areg/component/MulticastEnvelope.hpp"
 
 #include "areg/logging/areg_log.h"
 namespace areg {
@@ -49,7 +50,8 @@ bool RemoteEventFactory::route_outgoing_message( Event & srcWire, const Channel
 
     case areg::EventType::EventRemoteResponse:
         hdr->source = comChannel.cookie();
-        hdr->target = hdr->consumer.id;     // ServiceResponseEvent::target_cookie(); result preserved
+        // A multicast response is split by the router, a unicast goes to the consumer process.
+        hdr->target = MulticastEnvelope::is_multicast(srcWire) ? static_cast<uint32_t>(areg::COOKIE_ROUTER) : hdr->consumer.id;
         result = true;
         break;
 
@@ -126,6 +128,9 @@ bool RemoteEventFactory::route_incoming_message( MessageEnvelope & src, const Ch
 
     case areg::EventType::EventRemoteResponse:
     {
+        if (MulticastEnvelope::is_multicast(src))
+            return RemoteEventFactory::_route_multicast_response(src, comChannel);
+
         UniqueNumber proxyId = hdr->consumer.number;
         const std::shared_ptr<ProxyBase> proxy = ProxyBase::find_proxy(proxyId);
         if ( !proxy )
@@ -156,6 +161,34 @@ bool RemoteEventFactory::route_incoming_message( MessageEnvelope & src, const Ch
     }
 }
 
+bool RemoteEventFactory::_route_multicast_response( MessageEnvelope & src, const Channel & comChannel )
+{
+    const uint32_t count{ MulticastEnvelope::target_count(src) };
+    const areg::Endpoint* targets{ MulticastEnvelope::targets(src) };
+    ASSERT((count != 0u) && (targets != nullptr));
+
+    // Every proxy but the last gets a copy of the payload, the last one takes over the received block.
+    // The copies are needed: each event is dispatched with its own consumer and target dispatcher,
+    // which are in the header of its block, and the proxies may handle their events at the same time.
+    bool result{ false };
+    for (uint32_t i = 0; i + 1u < count; ++i)
+    {
+        MessageEnvelope unicast{ MulticastEnvelope::extract_unicast(src, targets[i]) };
+        if (unicast.is_valid() && RemoteEventFactory::route_incoming_message(unicast, comChannel))
+        {
+            result = true;
+        }
+    }
+
+    const areg::Endpoint last{ targets[count - 1u] };
+    if (MulticastEnvelope::restore_unicast(src, last) && RemoteEventFactory::route_incoming_message(src, comChannel))
+    {
+        result = true;
+    }
+
+    return result;
+}
+
 ServiceResponseEvent RemoteEventFactory::create_request_failed_event( const MessageEnvelope & stream, const Channel & /* comChannel */ )
 {
     DEBUG_LOG_SCOPE( areg_component_RemoteEventFactory, create_request_failed_event);
@@ -89,6 +89,21 @@ void ServiceManager::query_data_received(uint64_t& sizeRecv, uint32_t& msgRecv)
     ServiceManager::instance().mServiceClient.query_data_received(sizeRecv, msgRecv);
 }
 
+void ServiceManager::query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept
+{
+    ServiceManager::instance().mServiceClient.query_data_lost(lostSent, lostRecv);
+}
+
+void ServiceManager::query_send_calls(uint32_t& sendCalls) noexcept
+{
+    ServiceManager::instance().mServiceClient.query_send_calls(sendCalls);
+}
+
+void ServiceManager::query_zerocopy_saved(uint64_t& savedBytes) noexcept
+{
+    ServiceManager::instance().mServiceClient.query_zerocopy_saved(savedBytes);
+}
+
 void ServiceManager::enable_data_rate(bool enable) noexcept
 {
     ServiceManager::instance().mServiceClient.enable_data_rate(enable);
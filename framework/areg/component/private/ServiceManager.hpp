@@ -135,6 +135,34 @@ public:
      **/
     static void query_data_received(uint64_t& sizeRecv, uint32_t& msgRecv) noexcept;
 
+    /**
+     * \brief   Queries the number of droppable messages lost since the last call, and resets counters.
+     *          The sent ones are refused by the full send queue, the received ones are missing in
+     *          the sequence of the datagrams, arrived too late or are refused by the full queue
+     *          of the target.
+     *
+     * \param[out] lostSent     On output, contains the number of droppable messages lost on sending.
+     * \param[out] lostRecv     On output, contains the number of droppable messages lost on receiving.
+     **/
+    static void query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept;
+
+    /**
+     * \brief   Queries the number of system calls that wrote the sent messages since the last call,
+     *          and resets the counter. The messages sent, see query_data_sent(), divided by it give
+     *          the messages per system call, which shows how well the send batches are filled.
+     *
+     * \param[out] sendCalls    On output, contains the number of send system calls.
+     **/
+    static void query_send_calls(uint32_t& sendCalls) noexcept;
+
+    /**
+     * \brief   Queries the number of bytes, which the kernel sent straight from the messages without
+     *          copying them, since the last call, and resets the counter.
+     *
+     * \param[out] savedBytes   On output, contains the number of bytes not copied.
+     **/
+    static void query_zerocopy_saved(uint64_t& savedBytes) noexcept;
+
     /**
      * \brief   Enables or disables data and message rate verbosity.
      **/
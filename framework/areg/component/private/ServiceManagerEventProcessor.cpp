@@ -476,6 +476,21 @@ void ServiceManagerEventProcessor::_start_component_thread( const String & threa
     if ( entry.is_valid( ) && (thread == nullptr) )
     {
         ComponentThread * compThread = new ComponentThread( entry.mThreadName, entry.mWatchdogTimeout );
+        if ( (compThread != nullptr) && (entry.mPlacement.is_empty() == false) )
+        {
+            compThread->set_placement( entry.mPlacement );
+        }
+
+        if ( (compThread != nullptr) && (entry.mQueueSpin != 0u) )
+        {
+            compThread->set_queue_spin( entry.mQueueSpin );
+        }
+
+        if ( (compThread != nullptr) && (entry.mDispatchBatch != 0u) )
+        {
+            compThread->set_dispatch_batch( entry.mDispatchBatch );
+        }
+
         if ( (compThread != nullptr) && compThread->start( areg::WAIT_INFINITE ) )
         {
             LOG_DBG( "Succeeded to create and start component thread [ %s ]", threadName.as_string( ) );
@@ -0,0 +1,338 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/component/private/StrandExecutor.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the work-stealing executor running component threads as strands.
+ ************************************************************************/
+#include "areg/component/private/StrandExecutor.hpp"
+
+#include <thread>
+
+namespace
+{
+    //!< The index of the worker running on the calling thread plus one, 0 if it is not a worker.
+    thread_local uint32_t _workerIndex{ 0u };
+}
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// Strand class implementation
+//////////////////////////////////////////////////////////////////////////
+
+Strand::Strand() noexcept
+    : mStrandState  ( Strand::StrandState::Idle )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+// StrandExecutor::StrandWorker class implementation
+//////////////////////////////////////////////////////////////////////////
+
+StrandExecutor::StrandWorker::StrandWorker( StrandExecutor & executor, uint32_t index )
+    : ThreadConsumer( )
+    , mExecutor     ( executor )
+    , mIndex        ( index )
+    , mThread       ( static_cast<ThreadConsumer &>(self()), String(StrandExecutor::WORKER_NAME_PREFIX) + String::make_string(index) )
+    , mLock         ( )
+    , mStrands      ( )
+    , mCount        ( 0u )
+    , mWakeEvent    ( true, true )
+    , mParked       ( false )
+    , mQuit         ( false )
+{
+}
+
+StrandExecutor::StrandWorker::~StrandWorker()
+{
+    stop();
+}
+
+bool StrandExecutor::StrandWorker::start()
+{
+    mQuit.store(false, std::memory_order_relaxed);
+    return mThread.start(areg::WAIT_INFINITE);
+}
+
+void StrandExecutor::StrandWorker::stop()
+{
+    if (mThread.is_running())
+    {
+        mQuit.store(true, std::memory_order_seq_cst);
+        mWakeEvent.set_signaled();
+        mThread.shutdown(areg::WAIT_INFINITE);
+    }
+}
+
+void StrandExecutor::StrandWorker::push( Strand & strand )
+{
+    Lock lock(mLock);
+    mStrands.push_back(&strand);
+    mCount.fetch_add(1u, std::memory_order_release);
+}
+
+Strand * StrandExecutor::StrandWorker::pop() noexcept
+{
+    if (has_work() == false)
+        return nullptr;
+
+    Lock lock(mLock);
+    if (mStrands.empty())
+        return nullptr;
+
+    Strand * result{ mStrands.front() };
+    mStrands.pop_front();
+    mCount.fetch_sub(1u, std::memory_order_release);
+    return result;
+}
+
+Strand * StrandExecutor::StrandWorker::steal() noexcept
+{
+    if (has_work() == false)
+        return nullptr;
+
+    Lock lock(mLock);
+    if (mStrands.empty())
+        return nullptr;
+
+    // The thief takes the last queued strand, the owner keeps the order of the first ones.
+    Strand * result{ mStrands.back() };
+    mStrands.pop_back();
+    mCount.fetch_sub(1u, std::memory_order_release);
+    return result;
+}
+
+bool StrandExecutor::StrandWorker::wake() noexcept
+{
+    if (mParked.load(std::memory_order_seq_cst) == false)
+        return false;
+
+    mWakeEvent.set_signaled();
+    return true;
+}
+
+void StrandExecutor::StrandWorker::on_run()
+{
+    _workerIndex = mIndex + 1u;
+    while (mQuit.load(std::memory_order_relaxed) == false)
+    {
+        Strand * strand{ mExecutor._next_strand(*this) };
+        if (strand != nullptr)
+        {
+            mExecutor._run_turn(*strand);
+            continue;
+        }
+
+        // Announce the parking before the last check of the queues, so that a strand queued
+        // after the check finds the worker parked and wakes it up.
+        mParked.store(true, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if ((mExecutor._has_work() == false) && (mQuit.load(std::memory_order_seq_cst) == false))
+        {
+            mWakeEvent.lock(areg::WAIT_INFINITE);
+        }
+
+        mParked.store(false, std::memory_order_relaxed);
+    }
+
+    _workerIndex = 0u;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// StrandExecutor class implementation
+//////////////////////////////////////////////////////////////////////////
+
+StrandExecutor & StrandExecutor::instance() noexcept
+{
+    static StrandExecutor _strandExecutor;
+    return _strandExecutor;
+}
+
+StrandExecutor::StrandExecutor()
+    : mWorkers      ( )
+    , mWorkerCount  ( 0u )
+    , mNextWorker   ( 0u )
+    , mAttached     ( 0u )
+    , mLock         ( false )
+{
+}
+
+StrandExecutor::~StrandExecutor()
+{
+    Lock lock(mLock);
+    mWorkerCount.store(0u, std::memory_order_release);
+    for (StrandWorker * worker : mWorkers)
+    {
+        delete worker;
+    }
+
+    mWorkers.clear();
+    mAttached = 0u;
+}
+
+bool StrandExecutor::attach( uint32_t workers )
+{
+    Lock lock(mLock);
+    if (mAttached ++ != 0u)
+        return true;
+
+    if (workers == 0u)
+    {
+        workers = std::thread::hardware_concurrency();
+        workers = workers != 0u ? workers : 1u;
+    }
+
+    mWorkers.reserve(workers);
+    for (uint32_t i = 0u; i < workers; ++ i)
+    {
+        mWorkers.push_back(new StrandWorker(*this, i));
+    }
+
+    // The workers look up the queues of each other, start them when all exist.
+    mWorkerCount.store(workers, std::memory_order_release);
+    bool result{ true };
+    for (StrandWorker * worker : mWorkers)
+    {
+        result = worker->start() && result;
+    }
+
+    return result;
+}
+
+void StrandExecutor::detach()
+{
+    Lock lock(mLock);
+    if ((mAttached == 0u) || (-- mAttached != 0u))
+        return;
+
+    for (StrandWorker * worker : mWorkers)
+    {
+        worker->stop();
+    }
+
+    mWorkerCount.store(0u, std::memory_order_release);
+    for (StrandWorker * worker : mWorkers)
+    {
+        delete worker;
+    }
+
+    mWorkers.clear();
+}
+
+void StrandExecutor::schedule( Strand & strand )
+{
+    Strand::StrandState state{ strand.mStrandState.load(std::memory_order_acquire) };
+    for ( ; ; )
+    {
+        switch (state)
+        {
+        case Strand::StrandState::Idle:
+            if (strand.mStrandState.compare_exchange_weak(state, Strand::StrandState::Queued, std::memory_order_acq_rel))
+            {
+                _enqueue(strand);
+                return;
+            }
+            break;
+
+        case Strand::StrandState::Running:
+            // The running turn queues the strand again when it ends.
+            if (strand.mStrandState.compare_exchange_weak(state, Strand::StrandState::Notified, std::memory_order_acq_rel))
+                return;
+            break;
+
+        case Strand::StrandState::Queued:
+        case Strand::StrandState::Notified:
+        case Strand::StrandState::Finished:
+        default:
+            return;
+        }
+    }
+}
+
+void StrandExecutor::_enqueue( Strand & strand )
+{
+    const uint32_t count{ mWorkerCount.load(std::memory_order_acquire) };
+    if (count == 0u)
+        return;
+
+    const uint32_t index{ (_workerIndex != 0u) && (_workerIndex <= count) ? _workerIndex - 1u : mNextWorker.fetch_add(1u, std::memory_order_relaxed) % count };
+    mWorkers[index]->push(strand);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    _wake_worker(index);
+}
+
+void StrandExecutor::_run_turn( Strand & strand )
+{
+    strand.mStrandState.store(Strand::StrandState::Running, std::memory_order_release);
+    switch (strand.run_strand(StrandExecutor::STRAND_TURN_BUDGET))
+    {
+    case Strand::StrandRun::Finished:
+        // The strand may be already destroyed.
+        break;
+
+    case Strand::StrandRun::Yield:
+        strand.mStrandState.store(Strand::StrandState::Queued, std::memory_order_release);
+        _enqueue(strand);
+        break;
+
+    case Strand::StrandRun::Idle:
+    default:
+        {
+            Strand::StrandState state{ Strand::StrandState::Running };
+            if (strand.mStrandState.compare_exchange_strong(state, Strand::StrandState::Idle, std::memory_order_acq_rel) == false)
+            {
+                // Scheduled while the turn was running.
+                strand.mStrandState.store(Strand::StrandState::Queued, std::memory_order_release);
+                _enqueue(strand);
+            }
+        }
+        break;
+    }
+}
+
+Strand * StrandExecutor::_next_strand( StrandWorker & worker ) noexcept
+{
+    Strand * result{ worker.pop() };
+    const uint32_t count{ static_cast<uint32_t>(mWorkers.size()) };
+    for (uint32_t i = 1u; (result == nullptr) && (i < count); ++ i)
+    {
+        result = mWorkers[(worker.index() + i) % count]->steal();
+    }
+
+    return result;
+}
+
+bool StrandExecutor::_has_work() const noexcept
+{
+    for (const StrandWorker * worker : mWorkers)
+    {
+        if (worker->has_work())
+            return true;
+    }
+
+    return false;
+}
+
+void StrandExecutor::_wake_worker( uint32_t index ) noexcept
+{
+    if (mWorkers[index]->wake())
+        return;
+
+    // The worker is busy, let a parked one steal the strand.
+    const uint32_t count{ static_cast<uint32_t>(mWorkers.size()) };
+    for (uint32_t i = 1u; i < count; ++ i)
+    {
+        if (mWorkers[(index + i) % count]->wake())
+            return;
+    }
+}
+
+} // namespace areg
@@ -0,0 +1,368 @@
+#ifndef AREG_COMPONENT_PRIVATE_STRANDEXECUTOR_HPP
+#define AREG_COMPONENT_PRIVATE_STRANDEXECUTOR_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/component/private/StrandExecutor.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the work-stealing executor running component threads as strands.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/SyncPrimitives.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/base/ThreadConsumer.hpp"
+#include "areg/component/private/SimpleEvent.hpp"
+
+#include <atomic>
+#include <deque>
+#include <string_view>
+#include <vector>
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// Strand class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   A strand is a sequence of work that runs in turns on the threads of the strand
+ *          executor. The executor runs one turn of a strand at a time, so the turns of one
+ *          strand never overlap, even when they run on different threads.
+ **/
+class AREG_API Strand
+{
+    friend class StrandExecutor;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The result of a turn of the strand.
+     **/
+    enum class StrandRun : uint8_t
+    {
+          Idle      //!< The strand has no more work. It runs again when it is scheduled.
+        , Yield     //!< The turn used its budget, the strand has more work.
+        , Finished  //!< The strand stopped. The executor does not touch the object again.
+    };
+
+private:
+    /**
+     * \brief   The scheduling states of the strand.
+     **/
+    enum class StrandState : uint8_t
+    {
+          Idle      //!< Not queued and not running.
+        , Queued    //!< Waits in the queue of a worker.
+        , Running   //!< A worker runs a turn.
+        , Notified  //!< A worker runs a turn and the strand was scheduled again meanwhile.
+        , Finished  //!< Stopped, not scheduled any more.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+protected:
+    Strand() noexcept;
+
+    virtual ~Strand() = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+protected:
+    /**
+     * \brief   Runs one turn of the strand on the calling worker thread.
+     *
+     * \param   budget  The maximum number of units of work, for example events, of the turn.
+     * \return  Returns the result of the turn.
+     **/
+    virtual Strand::StrandRun run_strand( uint32_t budget ) = 0;
+
+    /**
+     * \brief   Makes the strand schedulable again before it is started anew.
+     **/
+    inline void reset_strand() noexcept;
+
+    /**
+     * \brief   Marks the strand finished, so that it is not scheduled again. Called by the last
+     *          turn before it signals the completion of the strand.
+     **/
+    inline void finish_strand() noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< The scheduling state of the strand.
+    std::atomic<StrandState>    mStrandState;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( Strand );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// StrandExecutor class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The process-wide pool of worker threads running the strands. Every worker has its
+ *          own queue of strands: a strand scheduled by a worker is queued on that worker, a
+ *          strand scheduled by another thread is queued round robin. A worker with an empty
+ *          queue steals a strand from the queue of another worker before it parks.
+ *
+ *          A turn runs the events of one strand up to STRAND_TURN_BUDGET, then the strand
+ *          goes to the end of the queue, so that a busy strand does not starve the others.
+ *          A strand blocking in a turn blocks its worker: the other strands queued on it
+ *          are stolen by the other workers.
+ **/
+class AREG_API StrandExecutor
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The maximum number of events one turn of a strand dispatches.
+    static constexpr uint32_t           STRAND_TURN_BUDGET  { 64u };
+
+    //!< The prefix of the names of the worker threads.
+    static constexpr std::string_view   WORKER_NAME_PREFIX  { "_AREG_strand_worker_" };
+
+private:
+    //////////////////////////////////////////////////////////////////////////
+    // StrandExecutor::StrandWorker class declaration
+    //////////////////////////////////////////////////////////////////////////
+    /**
+     * \brief   A worker thread of the executor with its own queue of strands.
+     **/
+    class StrandWorker final : private ThreadConsumer
+    {
+    public:
+        StrandWorker( StrandExecutor & executor, uint32_t index );
+
+        ~StrandWorker() override;
+
+        //!< Starts the worker thread.
+        bool start();
+
+        //!< Stops the worker thread and waits for it.
+        void stop();
+
+        //!< Queues the strand at the end of the queue.
+        void push( Strand & strand );
+
+        //!< Takes the strand from the front of the queue, nullptr if the queue is empty.
+        Strand * pop() noexcept;
+
+        //!< Takes the strand from the end of the queue for another worker, nullptr if the queue is empty.
+        Strand * steal() noexcept;
+
+        //!< Returns true if the queue has strands.
+        [[nodiscard]]
+        inline bool has_work() const noexcept;
+
+        //!< Wakes up the worker if it is parked. Returns true if it was parked.
+        bool wake() noexcept;
+
+        //!< Returns the index of the worker in the executor.
+        [[nodiscard]]
+        inline uint32_t index() const noexcept;
+
+    private:
+        //!< Runs the strands until the worker is stopped.
+        void on_run() override;
+
+        inline StrandWorker & self() noexcept;
+
+    private:
+        //!< The executor of the worker.
+        StrandExecutor &        mExecutor;
+        //!< The index of the worker in the executor.
+        const uint32_t          mIndex;
+        //!< The thread of the worker.
+        Thread                  mThread;
+        //!< Guards the queue.
+        mutable SpinLock        mLock;
+        //!< The queue of the strands.
+        std::deque<Strand *>    mStrands;
+        //!< The number of the queued strands, readable without the lock.
+        std::atomic<uint32_t>   mCount;
+        //!< Signaled to wake up the parked worker.
+        SimpleEvent             mWakeEvent;
+        //!< True while the worker is parked or about to park.
+        std::atomic<bool>       mParked;
+        //!< Set to stop the worker.
+        std::atomic<bool>       mQuit;
+
+    private:
+        AREG_NOCOPY_NOMOVE( StrandWorker );
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the executor of the process.
+     **/
+    [[nodiscard]]
+    static StrandExecutor & instance() noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Starts the worker threads on the first call and counts the users of the
+     *          executor. The later calls keep the running workers, whatever they request.
+     *
+     * \param   workers     The number of worker threads. 0 starts one worker per CPU core.
+     * \return  Returns true if the workers run.
+     **/
+    bool attach( uint32_t workers );
+
+    /**
+     * \brief   Releases one use of the executor. The last one stops the worker threads.
+     *          No strand may run when the workers stop.
+     **/
+    void detach();
+
+    /**
+     * \brief   Schedules a turn of the strand. Has no effect if the strand is queued, or if
+     *          a turn of it runs, in which case it runs one more turn afterwards.
+     **/
+    void schedule( Strand & strand );
+
+    /**
+     * \brief   Returns the number of the running worker threads.
+     **/
+    [[nodiscard]]
+    inline uint32_t worker_count() const noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    StrandExecutor();
+
+    ~StrandExecutor();
+
+    /**
+     * \brief   Queues the strand on the calling worker, or round robin if the calling thread
+     *          is not a worker, and wakes up a worker to run or to steal it.
+     **/
+    void _enqueue( Strand & strand );
+
+    /**
+     * \brief   Runs one turn of the strand on the calling worker and queues it again if it
+     *          has more work.
+     **/
+    void _run_turn( Strand & strand );
+
+    /**
+     * \brief   Returns the strand to run by the worker: the first of its own queue, or one
+     *          stolen from another worker. Returns nullptr if all queues are empty.
+     **/
+    Strand * _next_strand( StrandWorker & worker ) noexcept;
+
+    /**
+     * \brief   Returns true if any worker has queued strands.
+     **/
+    [[nodiscard]]
+    bool _has_work() const noexcept;
+
+    /**
+     * \brief   Wakes up the worker if it is parked, otherwise another parked worker to steal.
+     **/
+    void _wake_worker( uint32_t index ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< The workers. Created by the first attach() and deleted by the last detach().
+    std::vector<StrandWorker *> mWorkers;
+    //!< The number of the running workers, 0 while the executor does not run.
+    std::atomic<uint32_t>       mWorkerCount;
+    //!< The next worker to queue a strand scheduled by a thread that is not a worker.
+    std::atomic<uint32_t>       mNextWorker;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+    //!< The number of attach() calls not released by detach().
+    uint32_t                    mAttached;
+    //!< Guards starting and stopping the workers.
+    mutable Mutex               mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( StrandExecutor );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Strand class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline void Strand::reset_strand() noexcept
+{
+    mStrandState.store(Strand::StrandState::Idle, std::memory_order_release);
+}
+
+inline void Strand::finish_strand() noexcept
+{
+    mStrandState.store(Strand::StrandState::Finished, std::memory_order_release);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// StrandExecutor class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline uint32_t StrandExecutor::worker_count() const noexcept
+{
+    return mWorkerCount.load(std::memory_order_acquire);
+}
+
+inline bool StrandExecutor::StrandWorker::has_work() const noexcept
+{
+    return (mCount.load(std::memory_order_acquire) != 0u);
+}
+
+inline uint32_t StrandExecutor::StrandWorker::index() const noexcept
+{
+    return mIndex;
+}
+
+inline StrandExecutor::StrandWorker & StrandExecutor::StrandWorker::self() noexcept
+{
+    return (*this);
+}
+
+} // namespace areg
+
+#endif  // AREG_COMPONENT_PRIVATE_STRANDEXECUTOR_HPP
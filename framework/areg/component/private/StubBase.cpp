@@ -21,10 +21,20 @@
 #include "areg/base/SharedBuffer.hpp"
 #include "areg/component/ComponentThread.hpp"
 #include "areg/component/Component.hpp"
+#include "areg/component/MulticastEnvelope.hpp"
 #include "areg/component/private/StubConnectEvent.hpp"
 #include "areg/component/private/ServiceManager.hpp"
 
 #include "areg/logging/areg_log.h"
+
+#include <algorithm>
+
+namespace
+{
+    //!< The registration batch open in the calling thread, nullptr if none.
+    thread_local areg::StubBase::RegistrationBatch * _registrationBatch{ nullptr };
+}
+
 namespace areg {
 
 //////////////////////////////////////////////////////////////////////////
@@ -39,6 +49,24 @@ DEF_LOG_SCOPE(areg_component_StubBase, send_busy_response);
 DEF_LOG_SCOPE(areg_component_StubBase, consumer_connected);
 DEF_LOG_SCOPE(areg_component_StubBase, add_notification_listener);
 
+//////////////////////////////////////////////////////////////////////////
+// StubBase::RegistrationBatch implementation
+//////////////////////////////////////////////////////////////////////////
+
+StubBase::RegistrationBatch::RegistrationBatch() noexcept
+    : mEntries  ( )
+    , mPrevious ( _registrationBatch )
+{
+    _registrationBatch = this;
+}
+
+StubBase::RegistrationBatch::~RegistrationBatch()
+{
+    ASSERT(_registrationBatch == this);
+    _registrationBatch = mPrevious;
+    StubBase::map_providers().register_resource_objects(mEntries.data(), static_cast<uint32_t>(mEntries.size()));
+}
+
 //////////////////////////////////////////////////////////////////////////
 // StubBase::Listener implementation
 //////////////////////////////////////////////////////////////////////////
@@ -72,6 +100,29 @@ StubBase::MapProviderResource& StubBase::map_providers() noexcept
     return _mapProviders;
 }
 
+void StubBase::register_provider( uint32_t key, StubBase & stub )
+{
+    if (_registrationBatch != nullptr)
+    {
+        _registrationBatch->mEntries.emplace_back(key, &stub);
+    }
+    else
+    {
+        map_providers().register_resource_object(key, &stub);
+    }
+}
+
+void StubBase::unregister_provider( uint32_t key, const StubBase & stub )
+{
+    for (RegistrationBatch * batch = _registrationBatch; batch != nullptr; batch = batch->mPrevious)
+    {
+        std::vector<std::pair<uint32_t, StubBase *>> & entries{ batch->mEntries };
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [&stub](const std::pair<uint32_t, StubBase *> & entry) { return (entry.second == &stub); }), entries.end());
+    }
+
+    map_providers().unregister_resource_object(key);
+}
+
 StubBase::StubBase( Component & masterComp, const areg::InterfaceData & siData )
     : StubEventConsumer   ( mAddress )
 
@@ -84,21 +135,22 @@ StubBase::StubBase( Component & masterComp, const areg::InterfaceData & siData )
     , mCurrMsgId            ( INVALID_MESSAGE_ID )
     , mCurrIndex            ( 0 )
     , mMapSessions          ( )
+    , mDroppable            ( )
     , mSessionId            (0)
 {
-    map_providers().register_resource_object(static_cast<uint32_t>(mAddress), this);
+    register_provider(static_cast<uint32_t>(mAddress), self());
     masterComp.register_service_provider(self());
 }
 
 StubBase::~StubBase()
 {
-    map_providers().unregister_resource_object(static_cast<uint32_t>(mAddress));
+    unregister_provider(static_cast<uint32_t>(mAddress), self());
 }
 
 void StubBase::detach_from_registry()
 {
     // removing a key that is already gone is a no-op
-    map_providers().unregister_resource_object(static_cast<uint32_t>(mAddress));
+    unregister_provider(static_cast<uint32_t>(mAddress), self());
     ServiceManager::request_unregister_provider(mAddress, areg::DisconnectReason::ProviderDisconnected);
 }
 
@@ -353,9 +405,41 @@ void StubBase::send_update_notification( const StubListenerList & whichListeners
     if (count == 0)
         return;
 
-    for (uint32_t i = 1; i < count; ++i)
+    // Collect the remote listeners, they get one multicast envelope fanned out by the router.
+    ArrayList<areg::Endpoint> remotes;
+    const areg::RawService service{ masterEvent.raw_service() };
+    if (masterEvent.is_remote() && (count >= MulticastEnvelope::MIN_TARGETS))
+    {
+        remotes.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const StubBase::Listener & listener = whichListeners.value_at(i);
+            if (StubBase::is_multicast_listener(listener, service))
+            {
+                remotes.add(listener.mConsumer);
+            }
+        }
+
+        if (remotes.size() < MulticastEnvelope::MIN_TARGETS)
+        {
+            remotes.clear();
+        }
+    }
+
+    // Clone for the other listeners, except the first one, which gets masterEvent.
+    uint32_t masterIndex = count;
+    for (uint32_t i = 0; i < count; ++i)
     {
         const StubBase::Listener & listener = whichListeners.value_at(i);
+        if (!remotes.is_empty() && StubBase::is_multicast_listener(listener, service))
+            continue;
+
+        if (masterIndex == count)
+        {
+            masterIndex = i;
+            continue;
+        }
+
         ServiceResponseEvent eventClone{ masterEvent.clone_for_target(listener.mConsumer, listener.mRawService) };
         if (eventClone.is_valid())
         {
@@ -363,9 +447,65 @@ void StubBase::send_update_notification( const StubListenerList & whichListeners
         }
     }
 
+    if (!remotes.is_empty())
+    {
+        if (masterIndex == count)
+        {
+            // All listeners are remote: masterEvent itself carries the target list, no copy at all.
+            masterEvent.set_consumer(remotes[0]);
+            if (!MulticastEnvelope::attach_targets(masterEvent, remotes.values(), remotes.size()))
+            {
+                for (uint32_t i = 1; i < remotes.size(); ++i)
+                {
+                    ServiceResponseEvent eventClone{ masterEvent.clone_for_target(remotes[i], service) };
+                    if (eventClone.is_valid())
+                    {
+                        send_service_response(eventClone);
+                    }
+                }
+            }
+
+            send_service_response(masterEvent);
+            return;
+        }
+
+        // If the target list does not fit, the remote listeners get a copy each, as the local ones do.
+        ServiceResponseEvent eventMulticast{ masterEvent.clone_for_target(remotes[0], service) };
+        if (!eventMulticast.is_valid() || !MulticastEnvelope::attach_targets(eventMulticast, remotes.values(), remotes.size()))
+        {
+            for (uint32_t i = 1; i < remotes.size(); ++i)
+            {
+                ServiceResponseEvent eventClone{ masterEvent.clone_for_target(remotes[i], service) };
+                if (eventClone.is_valid())
+                {
+                    send_service_response(eventClone);
+                }
+            }
+        }
+
+        if (eventMulticast.is_valid())
+        {
+            send_service_response(eventMulticast);
+        }
+    }
+
+    if (masterIndex != 0)
+    {
+        const StubBase::Listener & listener = whichListeners.value_at(masterIndex);
+        masterEvent.set_consumer(listener.mConsumer);
+        masterEvent.set_raw_service(listener.mRawService);
+    }
+
     send_service_response(masterEvent);
 }
 
+bool StubBase::is_multicast_listener( const StubBase::Listener & listener, const areg::RawService & service ) noexcept
+{
+    return (listener.mConsumer.id >= static_cast<uint32_t>(areg::COOKIE_REMOTE_SERVICE))
+        && (listener.mRawService.service == service.service)
+        && (listener.mRawService.role == service.role);
+}
+
 void StubBase::send_service_response( ServiceResponseEvent & eventElem ) const
 {
     eventElem.deliver_event();
@@ -464,11 +604,26 @@ void StubBase::send_update_event( uint32_t msgId, const SharedBuffer & data, are
         ServiceResponseEvent eventElem = create_response(proxy, msgId, result, data);
         if (eventElem.is_valid())
         {
+            // Only the valid values replace each other, the invalidation must arrive.
+            eventElem.set_droppable((result == areg::ResultType::DataOK) && is_attribute_droppable(msgId));
             send_update_notification(listeners, eventElem);
         }
     }
 }
 
+void StubBase::set_attribute_droppable( uint32_t attrId, bool droppable )
+{
+    ASSERT(areg::is_attribute_id(attrId));
+    if (droppable)
+    {
+        mDroppable.add_if_unique(attrId);
+    }
+    else
+    {
+        mDroppable.remove_elem(attrId);
+    }
+}
+
 void StubBase::send_notify_once( const ProxyAddress & target, uint32_t msgId, const SharedBuffer & data, areg::ResultType result ) const
 {
     ServiceResponseEvent eventElem = create_response( target, msgId, result, data );
@@ -646,13 +801,11 @@ void StubBase::process_registered_event(const StubAddress & stubTarget, areg::Se
     if ( areg::is_service_connected( status) )
     {
         ASSERT( stubTarget.is_valid() );
-        map_providers().lock();
-        map_providers().unregister_resource_object(static_cast<uint32_t>(mAddress));
 
+        // Re-keyed in one change: a request arriving meanwhile finds the stub by either address.
+        const uint32_t oldKey{ static_cast<uint32_t>(mAddress) };
         mAddress = stubTarget;
-        
-        map_providers().register_resource_object(static_cast<uint32_t>(mAddress), this);
-        map_providers().unlock();
+        map_providers().move_resource_object(oldKey, static_cast<uint32_t>(mAddress), this);
     }
 
     mConnectionStatus = status;
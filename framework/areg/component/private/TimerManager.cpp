@@ -118,6 +118,12 @@ TimerManager::TimerManager()
     : TimerManagerBase  ( TimerManager::TIMER_THREAD_NAME, areg::SYSTEM_THREAD_STACK_NORMAL )
 
     , mTimerResource( )
+#ifdef __linux__
+    , mWheel        ( )
+    , mWheelArmed   ( TimerManager::WHEEL_DISARMED )
+    , mWheelExpired ( )
+    , mWheelEntries ( )
+#endif  // __linux__
 {
 }
 
@@ -264,6 +270,18 @@ void TimerManager::ready_for_events( bool is_ready )
         _remove_all_timers( );
     }
 
+#ifdef __linux__
+    // The wheel timerfd lives in the epoll loop, which exists only while the manager runs.
+    if (is_ready)
+    {
+        _wheel_open( );
+    }
+    else
+    {
+        _wheel_close( );
+    }
+#endif  // __linux__
+
     TimerManagerBase::ready_for_events(is_ready);
 }
 
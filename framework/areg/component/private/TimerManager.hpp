@@ -24,6 +24,10 @@
 
 #include "areg/base/SyncPrimitives.hpp"
 #include "areg/base/ResourceMap.hpp"
+#ifdef __linux__
+    #include "areg/component/private/TimingWheel.hpp"
+    #include <vector>
+#endif  // __linux__
    
 /************************************************************************
  * Dependencies
@@ -61,6 +65,14 @@ private:
     using MapTimerResource  = HashMap<TIMERHANDLE, Timer *>;
     using TimerResource     = ConcurrentResourceMap<TIMERHANDLE, Timer *, MapTimerResource>;
 
+#ifdef __linux__
+    /**
+     * \brief   TimerManager::WHEEL_DISARMED
+     *          The value of mWheelArmed when the timing wheel timerfd is not armed.
+     **/
+    static constexpr uint64_t   WHEEL_DISARMED  { 0xFFFFFFFFFFFFFFFFull };
+#endif  // __linux__
+
 //////////////////////////////////////////////////////////////////////////
 // Static members
 //////////////////////////////////////////////////////////////////////////
@@ -238,6 +250,41 @@ private:
      * \param   handle  OS timer handle (TimerPosix*) that fired.
      **/
     void _on_timerfd_expired(TIMERHANDLE handle) final;
+
+    /**
+     * \brief   Called by the epoll loop when the timing wheel timerfd becomes readable.
+     *          Expires the due timers, schedules the periodic ones again and re-arms the timerfd.
+     **/
+    void _on_wheel_expired() final;
+
+    /**
+     * \brief   Creates the timing wheel timerfd and registers it in the epoll loop if the
+     *          timing wheel engine is configured (config::*::timer::wheel).
+     *          Called on the manager thread before the manager is ready for events.
+     **/
+    void _wheel_open();
+
+    /**
+     * \brief   Unregisters and closes the timing wheel timerfd and empties the wheel.
+     **/
+    void _wheel_close();
+
+    /**
+     * \brief   Schedules the timer in the timing wheel and re-arms the timerfd if the timer
+     *          is due earlier than the armed time. Called on the manager thread.
+     *
+     * \param   timer       The timer to schedule.
+     * \return  Returns true if the timer is scheduled.
+     **/
+    bool _wheel_start( Timer & timer );
+
+    /**
+     * \brief   Arms the timing wheel timerfd at the next tick of the wheel. Must be called
+     *          with the timer resource locked.
+     *
+     * \param   force       If true, the timerfd is armed even if it is armed for an earlier tick.
+     **/
+    void _wheel_arm( bool force );
 #elif defined(_POSIX) || defined(POSIX)
     /**
      * \brief   Fires every timer that reached its due time and reports the nearest deadline
@@ -282,6 +329,29 @@ private:
      **/
     TimerResource	mTimerResource;
 
+#ifdef __linux__
+    /**
+     * \brief   The timing wheel of the timers if the wheel engine is used, guarded by the
+     *          lock of mTimerResource. The ticks are milliseconds of CLOCK_MONOTONIC.
+     **/
+    TimingWheel                 mWheel;
+
+    /**
+     * \brief   The tick the wheel timerfd is armed at, TimerManager::WHEEL_DISARMED if not armed.
+     **/
+    uint64_t                    mWheelArmed;
+
+    /**
+     * \brief   The handles of the timers expired in one wheel tick, kept to reuse the memory.
+     **/
+    std::vector<TIMERHANDLE>    mWheelExpired;
+
+    /**
+     * \brief   The wheel entries expired in one wheel tick, kept to reuse the memory.
+     **/
+    std::vector<TimingWheel::Entry *>   mWheelEntries;
+#endif  // __linux__
+
 //////////////////////////////////////////////////////////////////////////
 //  Forbidden calls
 //////////////////////////////////////////////////////////////////////////
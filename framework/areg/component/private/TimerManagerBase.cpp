@@ -32,6 +32,7 @@ TimerManagerBase::TimerManagerBase(const String& threadName, uint32_t stackSizeK
     , mEpollFd  (-1)
     , mCommandFd(-1)
     , mExitFd   (-1)
+    , mWheelFd  (-1)
 #endif  // __linux__
 {
 }
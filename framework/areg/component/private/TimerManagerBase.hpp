@@ -147,6 +147,13 @@ private:
      **/
     virtual void _on_timerfd_expired(TIMERHANDLE handle) = 0;
 
+    /**
+     * \brief   Called from the epoll loop when mWheelFd becomes readable. A subclass that
+     *          keeps its timers in a timing wheel registers mWheelFd with the epoll descriptor
+     *          and expires the due timers here. The default implementation does nothing.
+     **/
+    virtual void _on_wheel_expired();
+
 protected:
     /**
      * \brief   epoll file descriptor that watches all timerfd handles plus the
@@ -167,6 +174,12 @@ protected:
      **/
     int     mExitFd;
 
+    /**
+     * \brief   timerfd that drives the timing wheel of a subclass, registered in the epoll
+     *          loop with the address of this member as data.ptr. Value -1 when not used.
+     **/
+    int     mWheelFd;
+
 #endif  // defined(__linux__)
 
 //////////////////////////////////////////////////////////////////////////
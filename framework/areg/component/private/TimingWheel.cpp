@@ -0,0 +1,260 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/component/private/TimingWheel.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, hierarchical timing wheel.
+ *
+ ************************************************************************/
+#include "areg/component/private/TimingWheel.hpp"
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif  // _MSC_VER
+
+namespace areg {
+
+namespace
+{
+    constexpr uint64_t  SLOT_MASK   { static_cast<uint64_t>(TimingWheel::SLOTS - 1u) };
+
+    //!< Index of the lowest set bit, the value must not be zero.
+    inline uint32_t _lowest_bit(uint64_t value) noexcept
+    {
+#ifdef _MSC_VER
+        unsigned long index{ 0 };
+        _BitScanForward64(&index, value);
+        return static_cast<uint32_t>(index);
+#else   // _MSC_VER
+        return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif  // _MSC_VER
+    }
+
+    //!< Index of the highest set bit, the value must not be zero.
+    inline uint32_t _highest_bit(uint64_t value) noexcept
+    {
+#ifdef _MSC_VER
+        unsigned long index{ 0 };
+        _BitScanReverse64(&index, value);
+        return static_cast<uint32_t>(index);
+#else   // _MSC_VER
+        return static_cast<uint32_t>(63 - __builtin_clzll(value));
+#endif  // _MSC_VER
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// TimingWheel class implementation
+//////////////////////////////////////////////////////////////////////////
+
+TimingWheel::TimingWheel(uint64_t startTick /*= 0u*/)
+    : mSlots    { }
+    , mOccupied { }
+    , mCurrent  ( startTick )
+    , mCount    ( 0u )
+{
+}
+
+void TimingWheel::schedule(TimingWheel::Entry & entry, uint64_t expires) noexcept
+{
+    if (TimingWheel::is_scheduled(entry))
+    {
+        _unlink(entry);
+    }
+    else
+    {
+        ++ mCount;
+    }
+
+    if (expires < mCurrent)
+    {
+        expires = mCurrent;
+    }
+    else if (expires - mCurrent > TimingWheel::MAX_DELAY)
+    {
+        expires = mCurrent + TimingWheel::MAX_DELAY;
+    }
+
+    entry.expires = expires;
+    _link(entry, _position(expires));
+}
+
+void TimingWheel::cancel(TimingWheel::Entry & entry) noexcept
+{
+    if (TimingWheel::is_scheduled(entry))
+    {
+        _unlink(entry);
+        -- mCount;
+    }
+}
+
+void TimingWheel::reset(uint64_t startTick) noexcept
+{
+    for (uint32_t i = 0u; i < LEVELS * SLOTS; ++ i)
+    {
+        while (mSlots[i] != nullptr)
+        {
+            _unlink(*mSlots[i]);
+        }
+    }
+
+    mCurrent = startTick;
+    mCount   = 0u;
+}
+
+bool TimingWheel::next_tick(uint64_t & out_tick) const noexcept
+{
+    if (mCount == 0u)
+        return false;
+
+    // The slots of a level always start later than any slot of the levels below it,
+    // so the first level with work decides.
+    for (uint32_t level = 0u; level < LEVELS; ++ level)
+    {
+        const uint64_t bits{ mOccupied[level] };
+        if (bits == 0u)
+            continue;
+
+        const uint32_t shift{ level * SLOT_BITS };
+        const uint32_t current{ static_cast<uint32_t>((mCurrent >> shift) & SLOT_MASK) };
+        const uint64_t parent{ (mCurrent >> (shift + SLOT_BITS)) << (shift + SLOT_BITS) };
+
+        // Level 0 expires the current slot as well, an upper level has moved its current slot down already.
+        const uint32_t first{ level == 0u ? current : current + 1u };
+        const uint64_t ahead{ first < SLOTS ? (bits & (~static_cast<uint64_t>(0u) << first)) : 0u };
+        if (ahead != 0u)
+        {
+            out_tick = parent | (static_cast<uint64_t>(_lowest_bit(ahead)) << shift);
+            return true;
+        }
+        else if (level == LEVELS - 1u)
+        {
+            // The deadline is in the next round of the top level.
+            const uint64_t round{ static_cast<uint64_t>(1u) << (shift + SLOT_BITS) };
+            out_tick = (parent + round) | (static_cast<uint64_t>(_lowest_bit(bits)) << shift);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t TimingWheel::advance(uint64_t tick, std::vector<TimingWheel::Entry *> & out_expired)
+{
+    uint32_t result{ 0u };
+    uint64_t next{ 0u };
+    while (next_tick(next) && (next <= tick))
+    {
+        // Nothing is due between the current and the next tick, jump there.
+        _move_to(next);
+
+        Entry *& head{ mSlots[static_cast<uint32_t>(mCurrent & SLOT_MASK)] };
+        while (head != nullptr)
+        {
+            Entry * entry{ head };
+            _unlink(*entry);
+            -- mCount;
+            out_expired.push_back(entry);
+            ++ result;
+        }
+    }
+
+    if (mCurrent <= tick)
+    {
+        _move_to(tick + 1u);
+    }
+
+    return result;
+}
+
+void TimingWheel::_move_to(uint64_t tick) noexcept
+{
+    // Every upper level that enters a new slot moves the entries of that slot down,
+    // the highest level first, so that its entries reach the lower level before that one
+    // is moved. The slots passed in between are empty, next_tick() stops before them otherwise.
+    const uint64_t previous{ mCurrent };
+    mCurrent = tick;
+    for (uint32_t level = LEVELS - 1u; level > 0u; -- level)
+    {
+        const uint32_t shift{ level * SLOT_BITS };
+        if ((previous >> shift) != (tick >> shift))
+        {
+            _cascade(level, static_cast<uint32_t>((tick >> shift) & SLOT_MASK));
+        }
+    }
+}
+
+inline uint32_t TimingWheel::_position(uint64_t expires) const noexcept
+{
+    const uint64_t diff{ expires ^ mCurrent };
+    uint32_t level{ diff == 0u ? 0u : _highest_bit(diff) / SLOT_BITS };
+    level = level < LEVELS ? level : LEVELS - 1u;
+    return (level * SLOTS + static_cast<uint32_t>((expires >> (level * SLOT_BITS)) & SLOT_MASK));
+}
+
+inline void TimingWheel::_link(TimingWheel::Entry & entry, uint32_t position) noexcept
+{
+    Entry *& head{ mSlots[position] };
+    entry.prev      = nullptr;
+    entry.next      = head;
+    entry.position  = position;
+    if (head != nullptr)
+    {
+        head->prev = &entry;
+    }
+
+    head = &entry;
+    mOccupied[position / SLOTS] |= (static_cast<uint64_t>(1u) << (position % SLOTS));
+}
+
+inline void TimingWheel::_unlink(TimingWheel::Entry & entry) noexcept
+{
+    const uint32_t position{ entry.position };
+    Entry *& head{ mSlots[position] };
+    if (entry.prev != nullptr)
+    {
+        entry.prev->next = entry.next;
+    }
+    else
+    {
+        head = entry.next;
+    }
+
+    if (entry.next != nullptr)
+    {
+        entry.next->prev = entry.prev;
+    }
+
+    if (head == nullptr)
+    {
+        mOccupied[position / SLOTS] &= ~(static_cast<uint64_t>(1u) << (position % SLOTS));
+    }
+
+    entry.prev      = nullptr;
+    entry.next      = nullptr;
+    entry.position  = Entry::NOT_LINKED;
+}
+
+void TimingWheel::_cascade(uint32_t level, uint32_t slot) noexcept
+{
+    const uint32_t position{ level * SLOTS + slot };
+    Entry * entry{ mSlots[position] };
+    mSlots[position] = nullptr;
+    mOccupied[level] &= ~(static_cast<uint64_t>(1u) << slot);
+
+    while (entry != nullptr)
+    {
+        Entry * next{ entry->next };
+        _link(*entry, _position(entry->expires));
+        entry = next;
+    }
+}
+
+} // namespace areg
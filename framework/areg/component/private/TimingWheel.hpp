@@ -0,0 +1,229 @@
+#ifndef AREG_COMPONENT_PRIVATE_TIMINGWHEEL_HPP
+#define AREG_COMPONENT_PRIVATE_TIMINGWHEEL_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/component/private/TimingWheel.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, hierarchical timing wheel.
+ *              Keeps any number of deadlines with O(1) schedule, cancel and expiry.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+
+#include <vector>
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// TimingWheel class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   A hierarchical timing wheel of LEVELS levels with SLOTS slots each. The time unit
+ *          is an abstract tick (the timer manager uses milliseconds). Level 0 resolves single
+ *          ticks, every next level covers SLOTS times more ticks per slot. A deadline is kept
+ *          in the lowest level that can hold it and moves one level down each time the wheel
+ *          reaches its slot, so every entry is touched at most LEVELS times before it expires.
+ *
+ *          The entries are intrusive: the owner embeds TimingWheel::Entry and the wheel only
+ *          links it, so schedule and cancel never allocate.
+ *
+ * \note    Not thread safe. The owner synchronizes access.
+ **/
+class AREG_API TimingWheel
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The number of bits to index a slot of one level.
+    static constexpr uint32_t   SLOT_BITS   { 6u };
+    //!< The number of slots in one level.
+    static constexpr uint32_t   SLOTS       { 1u << SLOT_BITS };
+    //!< The number of levels, enough to keep 2^36 ticks (more than 2 years in milliseconds).
+    static constexpr uint32_t   LEVELS      { 6u };
+    //!< The farthest deadline in ticks, relative to the current tick.
+    static constexpr uint64_t   MAX_DELAY   { (static_cast<uint64_t>(1u) << (SLOT_BITS * LEVELS)) - 1u };
+
+    /**
+     * \brief   The link of a deadline in the wheel, embedded in the owner object.
+     **/
+    struct Entry
+    {
+        //!< The position of an entry that is not scheduled.
+        static constexpr uint32_t   NOT_LINKED  { 0xFFFFFFFFu };
+
+        Entry *     prev        { nullptr };    //!< Previous entry in the same slot.
+        Entry *     next        { nullptr };    //!< Next entry in the same slot.
+        uint64_t    expires     { 0u };         //!< The tick when the entry expires.
+        uint32_t    position    { NOT_LINKED }; //!< The slot index in the wheel, level * SLOTS + slot.
+        void *      owner       { nullptr };    //!< The object the entry is embedded in.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates an empty wheel positioned at the given tick.
+     **/
+    explicit TimingWheel( uint64_t startTick = 0u );
+
+    ~TimingWheel() = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the tick that the wheel processes next. All earlier ticks are expired.
+     **/
+    [[nodiscard]]
+    inline uint64_t current_tick() const noexcept;
+
+    /**
+     * \brief   Returns the number of scheduled entries.
+     **/
+    [[nodiscard]]
+    inline uint32_t size() const noexcept;
+
+    /**
+     * \brief   Returns true if no entry is scheduled.
+     **/
+    [[nodiscard]]
+    inline bool is_empty() const noexcept;
+
+    /**
+     * \brief   Returns true if the entry is scheduled in a wheel.
+     **/
+    [[nodiscard]]
+    static inline bool is_scheduled( const TimingWheel::Entry & entry ) noexcept;
+
+    /**
+     * \brief   Schedules the entry to expire at the given tick. An already scheduled entry is
+     *          moved. A tick in the past expires with the next call of advance().
+     *
+     * \param   entry       The entry to schedule.
+     * \param   expires     The tick when the entry should expire.
+     **/
+    void schedule( TimingWheel::Entry & entry, uint64_t expires ) noexcept;
+
+    /**
+     * \brief   Removes the entry from the wheel. Does nothing if the entry is not scheduled.
+     **/
+    void cancel( TimingWheel::Entry & entry ) noexcept;
+
+    /**
+     * \brief   Removes all entries from the wheel and positions it at the given tick.
+     **/
+    void reset( uint64_t startTick ) noexcept;
+
+    /**
+     * \brief   Returns the earliest tick when the wheel has work to do: either an entry expires
+     *          or a slot of an upper level is due to move its entries down. Waking up at this
+     *          tick and calling advance() never misses a deadline.
+     *
+     * \param   out_tick    On return, the tick to wake up at. Untouched if the wheel is empty.
+     * \return  Returns true if the wheel is not empty.
+     **/
+    bool next_tick( uint64_t & out_tick ) const noexcept;
+
+    /**
+     * \brief   Moves the wheel up to and including the given tick and unlinks every expired
+     *          entry. The expired entries are appended to the list in the order of expiry.
+     *          The caller may schedule them again.
+     *
+     * \param   tick        The last tick to process.
+     * \param   out_expired On return, contains the expired entries.
+     * \return  Returns the number of entries added to the list.
+     **/
+    uint32_t advance( uint64_t tick, std::vector<TimingWheel::Entry *> & out_expired );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the slot index in the wheel for the deadline at the current tick.
+     **/
+    [[nodiscard]]
+    inline uint32_t _position( uint64_t expires ) const noexcept;
+
+    /**
+     * \brief   Links the entry into the slot, without touching the entry counter.
+     **/
+    inline void _link( TimingWheel::Entry & entry, uint32_t position ) noexcept;
+
+    /**
+     * \brief   Unlinks the entry from its slot, without touching the entry counter.
+     **/
+    inline void _unlink( TimingWheel::Entry & entry ) noexcept;
+
+    /**
+     * \brief   Positions the wheel at the given tick, which must not skip a deadline, and moves
+     *          down the entries of the upper level slots the wheel enters.
+     **/
+    void _move_to( uint64_t tick ) noexcept;
+
+    /**
+     * \brief   Moves the entries of the given upper level slot to the lower levels.
+     **/
+    void _cascade( uint32_t level, uint32_t slot ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The heads of the slot lists, level by level.
+    TimingWheel::Entry *    mSlots[LEVELS * SLOTS];
+    //!< One bit per non-empty slot, one word per level.
+    uint64_t                mOccupied[LEVELS];
+    //!< The tick processed next.
+    uint64_t                mCurrent;
+    //!< The number of scheduled entries.
+    uint32_t                mCount;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( TimingWheel );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// TimingWheel class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline uint64_t TimingWheel::current_tick() const noexcept
+{
+    return mCurrent;
+}
+
+inline uint32_t TimingWheel::size() const noexcept
+{
+    return mCount;
+}
+
+inline bool TimingWheel::is_empty() const noexcept
+{
+    return (mCount == 0u);
+}
+
+inline bool TimingWheel::is_scheduled( const TimingWheel::Entry & entry ) noexcept
+{
+    return (entry.position != TimingWheel::Entry::NOT_LINKED);
+}
+
+} // namespace areg
+
+#endif  // AREG_COMPONENT_PRIVATE_TIMINGWHEEL_HPP
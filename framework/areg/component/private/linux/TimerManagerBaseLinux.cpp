@@ -121,6 +121,14 @@ bool TimerManagerBase::run_dispatcher()
                     ASSERT(mInternalEvents.is_empty());
                 }
             }
+            else if (ptr == static_cast<void *>(&mWheelFd))
+            {
+                // One timerfd for all timers of the timing wheel.
+                uint64_t expirations { 0u };
+                [[maybe_unused]] ssize_t drained = ::read(mWheelFd, &expirations, sizeof(uint64_t));
+
+                _on_wheel_expired();
+            }
             else
             {
                 TIMERHANDLE handle = reinterpret_cast<TIMERHANDLE>(ptr);
@@ -144,6 +152,10 @@ bool TimerManagerBase::run_dispatcher()
     return true;
 }
 
+void TimerManagerBase::_on_wheel_expired()
+{
+}
+
 void TimerManagerBase::stop_manager_thread(bool waitComplete)
 {
     if (mExitFd >= 0)
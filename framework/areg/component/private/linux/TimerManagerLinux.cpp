@@ -12,6 +12,8 @@
  * \author      Artak Avetyan
  * \brief       Areg Platform, Linux-specific TimerManager implementation.
  *              timerfd + epoll timer start, stop, and expiration handling.
+ *              Two engines: one timerfd per timer, or a hierarchical timing
+ *              wheel of all timers driven by a single timerfd.
  *
  ************************************************************************/
 #ifdef __linux__
@@ -19,10 +21,35 @@
 #include "areg/component/private/TimerManager.hpp"
 #include "areg/component/private/posix/TimerPosix.hpp"
 #include "areg/component/Timer.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/persist/ConfigManager.hpp"
+#include "areg/base/UtilityDefs.hpp"
+
 #include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
 
 namespace areg {
 
+namespace
+{
+    constexpr uint64_t  MS_PER_SEC  { static_cast<uint64_t>(areg::SEC_TO_MILLISECS) };
+    constexpr uint64_t  NS_PER_MS   { static_cast<uint64_t>(areg::MILLISEC_TO_NS) };
+
+    /**
+     * \brief   Returns the current CLOCK_MONOTONIC time in milliseconds, the tick of the wheel.
+     *
+     * \param   roundUp     If true, a started millisecond counts as a whole one.
+     **/
+    inline uint64_t _monotonic_ms(bool roundUp) noexcept
+    {
+        struct timespec now{};
+        ::clock_gettime(CLOCK_MONOTONIC, &now);
+        const uint64_t ms{ static_cast<uint64_t>(now.tv_sec) * MS_PER_SEC + static_cast<uint64_t>(now.tv_nsec) / NS_PER_MS };
+        return ((roundUp && ((static_cast<uint64_t>(now.tv_nsec) % NS_PER_MS) != 0u)) ? ms + 1u : ms);
+    }
+}
+
 void TimerManager::_on_timerfd_expired(TIMERHANDLE handle)
 {
     areg::os::TimerPosix * posixTimer = reinterpret_cast<areg::os::TimerPosix *>(handle);
@@ -38,13 +65,168 @@ void TimerManager::_on_timerfd_expired(TIMERHANDLE handle)
     }
 }
 
+void TimerManager::_on_wheel_expired()
+{
+    const uint64_t now{ _monotonic_ms(false) };
+    mWheelExpired.clear();
+    mWheelEntries.clear();
+
+    mTimerResource.lock();
+    mWheel.advance(now, mWheelEntries);
+    for (TimingWheel::Entry * entry : mWheelEntries)
+    {
+        TIMERHANDLE handle = static_cast<TIMERHANDLE>(entry->owner);
+        Timer * timer = mTimerResource.find_resource_object(handle);
+        if (timer == nullptr)
+            continue;   // unregistered, the stop is on its way
+
+        mWheelExpired.push_back(handle);
+        if (timer->event_count() > TimerBase::ONE_TIME)
+        {
+            // The next period counts from the due time, so the timer does not drift.
+            // Periods missed while the process was not scheduled are skipped, like timerfd does.
+            const uint64_t period{ static_cast<uint64_t>(timer->timeout()) };
+            const uint64_t due{ entry->expires + period };
+            mWheel.schedule(*entry, due > now ? due : now + period);
+        }
+    }
+
+    _wheel_arm(true);
+    mTimerResource.unlock();
+
+    struct timespec expiredAt{};
+    ::clock_gettime(CLOCK_REALTIME, &expiredAt);
+    const uint32_t highValue = static_cast<uint32_t>(expiredAt.tv_sec);
+    const uint32_t lowValue  = static_cast<uint32_t>(expiredAt.tv_nsec);
+
+    for (TIMERHANDLE handle : mWheelExpired)
+    {
+        Timer * timer = mTimerResource.find_resource_object(handle);
+        if (timer != nullptr)
+        {
+            _process_expired_timer(timer, handle, highValue, lowValue);
+        }
+    }
+}
+
+void TimerManager::_wheel_open()
+{
+    if ((mWheelFd >= 0) || (mEpollFd < 0) || !Application::config_manager().timer_wheel())
+        return;
+
+    // On failure the manager keeps one timerfd per timer.
+    const int wheelFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (wheelFd < 0)
+        return;
+
+    struct epoll_event ev{};
+    ev.events   = EPOLLIN;
+    ev.data.ptr = static_cast<void *>(&mWheelFd);
+    if (::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, wheelFd, &ev) != 0)
+    {
+        ::close(wheelFd);
+        return;
+    }
+
+    mTimerResource.lock();
+    mWheel.reset(_monotonic_ms(false));
+    mWheelArmed = TimerManager::WHEEL_DISARMED;
+    mWheelFd    = wheelFd;
+    mTimerResource.unlock();
+}
+
+void TimerManager::_wheel_close()
+{
+    mTimerResource.lock();
+    const int wheelFd{ mWheelFd };
+    mWheelFd    = -1;
+    mWheelArmed = TimerManager::WHEEL_DISARMED;
+    mWheel.reset(_monotonic_ms(false));
+    mTimerResource.unlock();
+
+    if (wheelFd >= 0)
+    {
+        if (mEpollFd >= 0)
+        {
+            ::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, wheelFd, nullptr);
+        }
+
+        ::close(wheelFd);
+    }
+}
+
+bool TimerManager::_wheel_start(Timer & timer)
+{
+    areg::os::TimerPosix * posixTimer = reinterpret_cast<areg::os::TimerPosix *>(timer.handle());
+    ASSERT(posixTimer != nullptr);
+
+    const uint32_t timeout{ timer.timeout() };
+    if ((timeout == 0u) || (timer.event_count() == 0u))
+        return false;
+
+    struct timespec startTime;
+    ::clock_gettime(CLOCK_REALTIME, &startTime);
+    timer.timer_starting(startTime.tv_sec, startTime.tv_nsec, reinterpret_cast<ptr_type>(posixTimer));
+
+    // Rounded up, so that the timer never expires before its timeout.
+    const uint64_t expires{ _monotonic_ms(true) + timeout };
+
+    mTimerResource.lock();
+    posixTimer->mWheelEntry.owner = timer.handle();
+    mWheel.schedule(posixTimer->mWheelEntry, expires);
+    _wheel_arm(false);
+    mTimerResource.unlock();
+
+    return true;
+}
+
+void TimerManager::_wheel_arm(bool force)
+{
+    if (mWheelFd < 0)
+        return;
+
+    uint64_t next{ 0u };
+    if (mWheel.next_tick(next) == false)
+    {
+        if (mWheelArmed != TimerManager::WHEEL_DISARMED)
+        {
+            struct itimerspec zero{};
+            ::timerfd_settime(mWheelFd, TFD_TIMER_ABSTIME, &zero, nullptr);
+            mWheelArmed = TimerManager::WHEEL_DISARMED;
+        }
+
+        return;
+    }
+
+    // A later tick than the armed one is picked up when the armed one fires.
+    if (!force && (next >= mWheelArmed))
+        return;
+
+    struct itimerspec due{};
+    due.it_value.tv_sec  = static_cast<time_t>(next / MS_PER_SEC);
+    due.it_value.tv_nsec = static_cast<long>((next % MS_PER_SEC) * NS_PER_MS);
+    if ((due.it_value.tv_sec == 0) && (due.it_value.tv_nsec == 0))
+    {
+        due.it_value.tv_nsec = 1;   // zero would disarm
+    }
+
+    mWheelArmed = (::timerfd_settime(mWheelFd, TFD_TIMER_ABSTIME, &due, nullptr) == 0) ? next : TimerManager::WHEEL_DISARMED;
+}
+
 void TimerManager::_os_timer_stop(TIMERHANDLE timerHandle)
 {
     areg::os::TimerPosix * posixTimer = reinterpret_cast<areg::os::TimerPosix *>(timerHandle);
     if (posixTimer == nullptr)
         return;
 
-    const int epollFd = TimerManager::instance().mEpollFd;
+    // A timer of the timing wheel is only unlinked, it has no timerfd. The timerfd is not
+    // re-armed: an early wake-up finds nothing to expire and arms it for the next tick.
+    TimerManager & timerManager = TimerManager::instance();
+    timerManager.mTimerResource.lock();
+    timerManager.mWheel.cancel(posixTimer->mWheelEntry);
+    timerManager.mTimerResource.unlock();
+
+    const int epollFd = timerManager.mEpollFd;
     const int timerFd = posixTimer->timer_fd();
     if ((epollFd >= 0) && (timerFd >= 0))
     {
@@ -56,6 +238,10 @@ void TimerManager::_os_timer_stop(TIMERHANDLE timerHandle)
 
 bool TimerManager::_os_timer_start(Timer& timer)
 {
+    TimerManager & timerManager = TimerManager::instance();
+    if (timerManager.mWheelFd >= 0)
+        return timerManager._wheel_start(timer);
+
     areg::os::TimerPosix * posixTimer = reinterpret_cast<areg::os::TimerPosix *>(timer.handle());
     ASSERT(posixTimer != nullptr);
 
@@ -68,7 +254,7 @@ bool TimerManager::_os_timer_start(Timer& timer)
 
     // Register the timerfd with the manager's epoll so the run_dispatcher loop
     // fires _on_timerfd_expired(handle) when the timer expires
-    const int epollFd = TimerManager::instance().mEpollFd;
+    const int epollFd = timerManager.mEpollFd;
     if (epollFd >= 0)
     {
         struct epoll_event ev{};
@@ -137,6 +137,9 @@ TimerPosix::TimerPosix()
     , mContextId    ( 0u      )
     , mDueTime      (         )
     , mLock         (         )
+#ifdef __linux__
+    , mWheelEntry   (         )
+#endif  // __linux__
 {
 }
 
@@ -23,6 +23,9 @@
 #if defined(_POSIX) || defined(POSIX)
 
 #include "areg/base/private/posix/SpinLockPosix.hpp"
+#ifdef __linux__
+    #include "areg/component/private/TimingWheel.hpp"
+#endif  // __linux__
 #include <sys/types.h>
 #include <time.h>
 
@@ -297,6 +300,14 @@ private:
      */
     mutable SpinLockPosix  mLock;
 
+#ifdef __linux__
+    /**
+     * \brief   The link of the timer in the timing wheel of the timer manager. Used instead of
+     *          the timerfd when the manager runs the timing wheel engine, guarded by the manager.
+     */
+    TimingWheel::Entry      mWheelEntry;
+#endif  // __linux__
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,10 @@
 
 #include "areg/base/MessageEnvelope.hpp"
 #include "areg/base/SocketClient.hpp"
+#include "areg/ipc/CompactFraming.hpp"
+#include "areg/ipc/DatagramLink.hpp"
+#include "areg/ipc/SharedMemoryLink.hpp"
+#include "areg/ipc/ZeroCopySender.hpp"
 namespace areg {
 
 //////////////////////////////////////////////////////////////////////////
@@ -56,7 +60,7 @@ public:
      **/
     ClientConnection( const areg::SocketAddress & remoteAddress );
 
-    virtual ~ClientConnection() = default;
+    virtual ~ClientConnection();
 
 //////////////////////////////////////////////////////////////////////////
 // Attributes
@@ -158,21 +162,129 @@ public:
      *
      * \param   messages    Array of pointers to messages to send. Entries may be nullptr (skipped).
      * \param   count       Number of entries in the array.
+     * \param   totalSize   The total size of the buffers, 0 to calculate.
+     * \param   owners      The messages the buffers point into. If the zero-copy send is enabled,
+     *                      the large buffers are sent without copying and their messages are
+     *                      kept until the kernel releases them. nullptr always copies.
+     * \param   ownerCount  The number of entries of \a owners.
      * \return  Returns total bytes sent on success, or 0 / negative on failure.
      *
      * \note    Threading: call only from the send thread that owns this connection.
      **/
-    inline int32_t send_messages_batch(const areg::IoBuffer* ioBuffer, uint32_t count, uint32_t totalSize = 0) const;
+    inline int32_t send_messages_batch(const areg::IoBuffer* ioBuffer, uint32_t count, uint32_t totalSize = 0, const areg::RawBufferPtr* owners = nullptr, uint32_t ownerCount = 0u) const;
 
     /**
-     * \brief   Receives message data via socket connection. Validates checksum after receiving.
+     * \brief   Returns true if the large messages are sent without copying, see ZeroCopySender.
+     **/
+    [[nodiscard]]
+    inline bool is_zerocopy() const noexcept;
+
+    /**
+     * \brief   Returns the bytes the kernel sent without copying since the last call.
+     **/
+    inline uint64_t extract_zerocopy_saved() const noexcept;
+
+    /**
+     * \brief   Sends a batch of messages only if it is possible without waiting. Never sends a
+     *          part of the data.
+     *
+     * \return  Returns total bytes sent on success, zero if nothing is sent, negative on failure.
+     *
+     * \note    Hold the writer lock of the socket, see areg::SocketWriter.
+     **/
+    inline int32_t try_send_messages_batch(const areg::IoBuffer* ioBuffer, uint32_t count, uint32_t totalSize = 0) const;
+
+    /**
+     * \brief   Receives message data via socket connection, or via the shared memory channel
+     *          if the router confirmed it. Validates checksum after receiving.
      *          Returns bytes received, zero if invalid checksum, or negative on failure.
      *
      * \param[in,out] out_message     MessageEnvelope to receive into; checksum validated after receiving.
      * \return  Returns length in bytes of data received; zero if checksum invalid or buffer empty;
      *          negative if socket invalid or receive failed.
      **/
-    inline int32_t receive_message( MessageEnvelope & out_message ) const;
+    int32_t receive_message( MessageEnvelope & out_message ) const;
+
+    /**
+     * \brief   Creates the shared memory channel to the router and attaches it to the socket.
+     *          Call after the socket is created and before the connect request is sent, which
+     *          passes the name of the channel to the router.
+     *
+     * \param   sendSize    The size of the ring to send messages in bytes.
+     * \param   recvSize    The size of the ring to receive messages in bytes.
+     * \return  Returns true if the channel is created.
+     **/
+    bool open_shared_memory( uint32_t sendSize, uint32_t recvSize );
+
+    /**
+     * \brief   Returns the name of the shared memory channel, empty if there is none.
+     **/
+    [[nodiscard]]
+    inline const String & shared_memory_name() const noexcept;
+
+    /**
+     * \brief   Applies the answer of the router to the shared memory channel. If the router
+     *          opened the channel, the messages are sent through the channel from now on.
+     *          Otherwise the channel is closed and the connection stays on TCP.
+     *
+     * \param   accepted    True if the router opened the channel.
+     **/
+    inline void confirm_shared_memory( bool accepted );
+
+    /**
+     * \brief   Creates the UDP socket to receive the droppable messages of the router as
+     *          datagrams, see DatagramLink. Call before the connect request is sent, which
+     *          passes the port of the socket to the router.
+     *
+     * \return  Returns the port of the UDP socket, zero on failure.
+     **/
+    uint16_t open_datagram();
+
+    /**
+     * \brief   Applies the answer of the router to the datagrams. If the router passed the port
+     *          of its UDP socket, the droppable messages are sent as datagrams from now on.
+     *          Otherwise the UDP socket is closed and all messages stay on the socket connection.
+     *
+     * \param   routerPort  The port of the UDP socket of the router, zero if it declined.
+     * \return  Returns true if the droppable messages are sent as datagrams.
+     **/
+    bool confirm_datagram( uint16_t routerPort );
+
+    /**
+     * \brief   Detaches the datagram link and closes the UDP socket. Call when no thread receives
+     *          the datagrams anymore.
+     **/
+    void close_datagram();
+
+    /**
+     * \brief   Attaches the compact framing to the socket, so that the compact frames of the
+     *          router are decoded, see CompactFraming. Call after the socket is created and
+     *          before the connect request is sent, which offers the framing to the router.
+     *
+     * \return  Returns true if the framing is attached and can be offered.
+     **/
+    inline bool open_compact();
+
+    /**
+     * \brief   Applies the answer of the router to the compact framing. If the router agreed,
+     *          the messages are sent in the compact frames from now on. Otherwise the framing
+     *          is detached and the messages keep the full header.
+     *
+     * \param   accepted    True if the router agreed to the compact framing.
+     **/
+    inline void confirm_compact( bool accepted );
+
+    /**
+     * \brief   Returns the UDP socket, invalid if there is none.
+     **/
+    [[nodiscard]]
+    inline SOCKETHANDLE datagram_socket() const noexcept;
+
+    /**
+     * \brief   Returns the datagram link of the connection.
+     **/
+    [[nodiscard]]
+    inline DatagramLink & datagram_link() noexcept;
 
     /**
      * \brief   Sends an MessageEnvelope over the socket connection via scatter/gather I/O.
@@ -201,6 +313,21 @@ public:
      **/
     inline void set_send_timeout(uint32_t timeoutMs) noexcept;
 
+    /**
+     * \brief   Sets the path of the local stream socket of the router, which create_socket_fd()
+     *          prefers over TCP. An empty path connects via TCP only.
+     *          Call before create_socket_fd().
+     *
+     * \param   path    The path of the local socket, see areg::local_socket_path().
+     **/
+    inline void set_local_path(const String & path);
+
+    /**
+     * \brief   Returns true if the connection uses the local stream socket instead of TCP.
+     **/
+    [[nodiscard]]
+    inline bool is_local_connection() const noexcept;
+
     /**
      * \brief   Sets socket to read-only mode, disabling message sending.
      *
@@ -244,6 +371,31 @@ private:
      **/
     uint32_t        mSockSendTimeoutMs;
 
+    /**
+     * \brief   The shared memory channel to the router, if it is used.
+     **/
+    mutable SharedMemoryLink    mSharedLink;
+
+    /**
+     * \brief   The UDP socket of the datagrams, closed by close_datagram() only.
+     **/
+    SOCKETHANDLE                mDatagramSocket;
+
+    /**
+     * \brief   The link sending the droppable messages as datagrams, if it is used.
+     **/
+    mutable DatagramLink        mDatagramLink;
+
+    /**
+     * \brief   The compact framing of the socket, if it is used.
+     **/
+    mutable CompactFraming      mCompact;
+
+    /**
+     * \brief   The zero-copy send of the large messages, if it is enabled.
+     **/
+    mutable ZeroCopySender      mZeroCopy;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -300,14 +452,61 @@ inline Socket & ClientConnection::socket()
     return mClientSocket;
 }
 
-inline int32_t ClientConnection::send_messages_batch(const areg::IoBuffer* ioBuffer, uint32_t count, uint32_t totalSize) const
+inline int32_t ClientConnection::send_messages_batch(const areg::IoBuffer* ioBuffer, uint32_t count, uint32_t totalSize, const areg::RawBufferPtr* owners, uint32_t ownerCount) const
+{
+    return SocketConnectionBase::send_messages_batch(ioBuffer, count, mClientSocket.handle(), totalSize, owners, ownerCount);
+}
+
+inline bool ClientConnection::is_zerocopy() const noexcept
+{
+    return mZeroCopy.is_sending();
+}
+
+inline uint64_t ClientConnection::extract_zerocopy_saved() const noexcept
+{
+    return mZeroCopy.extract_saved();
+}
+
+inline int32_t ClientConnection::try_send_messages_batch(const areg::IoBuffer* ioBuffer, uint32_t count, uint32_t totalSize) const
+{
+    return SocketConnectionBase::try_send_messages_batch(ioBuffer, count, mClientSocket.handle(), totalSize);
+}
+
+inline const String & ClientConnection::shared_memory_name() const noexcept
+{
+    return mSharedLink.name();
+}
+
+inline void ClientConnection::confirm_shared_memory( bool accepted )
 {
-    return SocketConnectionBase::send_messages_batch(ioBuffer, count, mClientSocket, totalSize);
+    mSharedLink.confirm(accepted);
 }
 
-inline int32_t ClientConnection::receive_message(MessageEnvelope & out_message) const
+inline bool ClientConnection::open_compact()
 {
-    return SocketConnectionBase::receive_message(out_message, mClientSocket);
+    return mCompact.attach(mClientSocket.handle(), links());
+}
+
+inline void ClientConnection::confirm_compact( bool accepted )
+{
+    if (accepted)
+    {
+        mCompact.activate_send();
+    }
+    else
+    {
+        mCompact.detach();
+    }
+}
+
+inline SOCKETHANDLE ClientConnection::datagram_socket() const noexcept
+{
+    return mDatagramSocket;
+}
+
+inline DatagramLink & ClientConnection::datagram_link() noexcept
+{
+    return mDatagramLink;
 }
 
 inline bool ClientConnection::connect_socket()
@@ -344,5 +543,15 @@ inline void ClientConnection::set_send_timeout(uint32_t timeoutMs) noexcept
     mSockSendTimeoutMs = (timeoutMs > 0) ? timeoutMs : mSockSendTimeoutMs;
 }
 
+inline void ClientConnection::set_local_path(const String & path)
+{
+    mClientSocket.set_local_path(path);
+}
+
+inline bool ClientConnection::is_local_connection() const noexcept
+{
+    return mClientSocket.is_local();
+}
+
 } // namespace areg
 #endif  // AREG_IPC_CLIENTCONNECTION_HPP
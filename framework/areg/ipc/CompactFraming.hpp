@@ -0,0 +1,271 @@
+#ifndef AREG_IPC_COMPACTFRAMING_HPP
+#define AREG_IPC_COMPACTFRAMING_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/CompactFraming.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the compact message framing of a stream connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/MemoryDefs.hpp"
+#include "areg/base/SocketDefs.hpp"
+
+#include <atomic>
+#include <memory>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+namespace areg {
+    class SocketLinkMap;
+    struct SocketLinks;
+} // namespace areg
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// CompactFraming class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Replaces the 128 bytes of the EventHeader of the messages sent through a stream
+ *          socket by the 40 bytes of the areg::CompactHeader. The routing fields, which are the
+ *          same for all messages of a proxy and a stub, are kept in a session dictionary on both
+ *          sides of the connection: the first frame of a session defines it in a slot, the next
+ *          frames refer to the slot only. The local-only fields of the header are never sent.
+ *          The receiver rebuilds the complete EventHeader, so the checksum and the rest of the
+ *          framework see the same message as before.
+ *
+ *          The client offers the framing with the connect request and the router confirms it
+ *          in the response. Each side decodes the compact frames as soon as it offered or
+ *          confirmed the framing and sends them once the peer agreed. The frames carry their
+ *          kind in the first word, so a full frame is valid at any time: the messages, which
+ *          are not a single complete envelope, and the messages of a send, which must not wait,
+ *          with a session not yet defined, are sent with the full header.
+ *
+ *          A framing is attached to a socket in the SocketLinkMap of the connection object, the
+ *          code sending to or receiving from the socket of the connection takes it from there.
+ *
+ * \note    The dictionary of the sent sessions is changed by the senders, which hold the writer
+ *          lock of the socket, see SocketWriter. The dictionary of the received sessions is used
+ *          by the thread receiving from the socket only.
+ **/
+class AREG_API CompactFraming
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The number of slots of the session dictionary in each direction.
+    static constexpr uint32_t   SESSION_SLOTS   { 256u };
+
+    //!< The largest payload copied into the frame, the larger ones are sent from the message.
+    static constexpr uint32_t   INLINE_PAYLOAD  { 64u };
+
+    /**
+     * \brief   The bytes of one encoded frame: the header, the definition of the session if
+     *          any, and the small payload, which is sent together with the header.
+     **/
+    struct Frame
+    {
+        alignas(8) uint8_t  bytes[sizeof(areg::CompactHeader) + sizeof(areg::CompactSession) + INLINE_PAYLOAD];
+    };
+
+private:
+    /**
+     * \brief   A slot of the session dictionary.
+     **/
+    struct Session
+    {
+        areg::CompactSession    session;    //!< The routing fields of the session.
+        uint32_t                defined;    //!< Nonzero if the slot holds a session.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Static operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Sends the messages through the stream socket, in the compact frames if the
+     *          framing of the socket is sending. Each buffer must contain one complete message.
+     *
+     * \param   hSocket     The stream socket, the caller holds its writer lock.
+     * \param   links       The framing and the sender attached to the socket.
+     * \param   ioBuffer    The buffers of the messages.
+     * \param   count       The number of buffers.
+     * \param   totalSize   The total size of the buffers, 0 to calculate.
+     * \param   tryOnly     If true, does not wait for the socket and never sends a part of the data.
+     * \param   owners      The messages of the buffers. If not nullptr and not in the try mode,
+     *                      the frames are sent by ZeroCopySender::send_stream() with the
+     *                      sender of \a links, the large
+     *                      payloads may then leave without a copy.
+     * \param   ownerCount  The number of entries of \a owners.
+     * \return  Returns the number of bytes written to the socket on success, zero if the socket
+     *          had no space in the try mode, negative value on failure.
+     **/
+    static int32_t send_stream( SOCKETHANDLE hSocket, const SocketLinks & links, const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, bool tryOnly, const areg::RawBufferPtr * owners = nullptr, uint32_t ownerCount = 0u ) noexcept;
+
+    /**
+     * \brief   Encodes in place the groups of the sockets with a sending framing: the buffers of
+     *          such a group are replaced by the buffers of the frames, which stay valid until the
+     *          next call of the same thread. The groups, which do not fit into the frames of the
+     *          thread, are left as they are. Call while holding the writer locks of the sockets.
+     *
+     * \param   groups      The groups of the messages to send.
+     * \param   framings    The framings attached to the sockets of the groups, nullptr if none.
+     * \param   count       The number of groups.
+     **/
+    static void encode_groups( areg::IoGroup * groups, CompactFraming * const * framings, uint32_t count ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    CompactFraming() noexcept;
+
+    ~CompactFraming();
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the messages are sent in the compact frames.
+     **/
+    [[nodiscard]]
+    inline bool is_sending() const noexcept;
+
+    /**
+     * \brief   Returns the socket the framing is attached to.
+     **/
+    [[nodiscard]]
+    inline SOCKETHANDLE socket() const noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Attaches the framing to the socket with both dictionaries empty, so that the
+     *          compact frames received from the socket are decoded. The sending starts with
+     *          activate_send(). Call before the peer may send a compact frame.
+     *
+     * \param   hSocket     The stream socket of the connection.
+     * \param   links       The links of the connection object, which owns the socket.
+     * \return  Returns true if attached. Returns false if another framing is attached to the
+     *          socket; the connection then uses the full headers.
+     **/
+    bool attach( SOCKETHANDLE hSocket, SocketLinkMap & links );
+
+    /**
+     * \brief   Starts sending the messages in the compact frames.
+     **/
+    inline void activate_send() noexcept;
+
+    /**
+     * \brief   Detaches the framing from the socket. On return no sender uses the framing anymore.
+     *          The dictionaries are kept until the next attach(), a thread, which still receives
+     *          from the closing socket, may read them.
+     **/
+    void detach() noexcept;
+
+    /**
+     * \brief   Encodes the messages into the compact frames. The buffers, which are not a single
+     *          complete message, and in the try mode the messages of the sessions not yet
+     *          defined, are passed with the full header. Call while holding the writer lock.
+     *
+     * \param   ioBuffer        The buffers of the messages.
+     * \param   count           The number of buffers.
+     * \param   tryOnly         If true, defines no new sessions: a send, which writes nothing,
+     *                          must not change the dictionary.
+     * \param[out]  frames      The frames to encode into, at least count entries.
+     * \param[out]  encoded     The buffers to send, at least 2 * count entries.
+     * \param[out]  wireSize    On output, the total size of the buffers to send.
+     * \return  Returns the number of the buffers to send.
+     **/
+    uint32_t encode( const areg::IoBuffer * ioBuffer, uint32_t count, bool tryOnly, Frame * frames, areg::IoBuffer * encoded, uint32_t & wireSize ) noexcept;
+
+    /**
+     * \brief   Rebuilds the EventHeader of a received compact frame. Called by the thread
+     *          receiving from the socket.
+     *
+     * \param   header      The received compact header.
+     * \param   define      The received definition of the session, nullptr if the frame
+     *                      refers to a session defined before.
+     * \param[out]  evtHeader   The complete header of the message.
+     * \return  Returns false if the frame refers to a session, which was never defined.
+     **/
+    bool restore( const areg::CompactHeader & header, const areg::CompactSession * define, areg::EventHeader & evtHeader ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the slot of the session dictionary for the routing fields.
+     **/
+    [[nodiscard]]
+    static uint32_t _session_slot( const areg::CompactSession & session ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The socket the framing is attached to.
+    SOCKETHANDLE                mSocket;
+    //!< The links of the connection object, which the framing is attached in.
+    SocketLinkMap *             mLinks;
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< The dictionary of the sent sessions, guarded by the writer lock.
+    std::unique_ptr<Session[]>  mSent;
+    //!< The dictionary of the received sessions, used by the receiving thread only.
+    std::unique_ptr<Session[]>  mReceived;
+    //!< True if the messages are sent in the compact frames.
+    std::atomic_bool            mSending;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( CompactFraming );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// CompactFraming class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool CompactFraming::is_sending() const noexcept
+{
+    return mSending.load(std::memory_order_acquire);
+}
+
+inline SOCKETHANDLE CompactFraming::socket() const noexcept
+{
+    return mSocket;
+}
+
+inline void CompactFraming::activate_send() noexcept
+{
+    mSending.store(true, std::memory_order_release);
+}
+
+} // namespace areg
+
+#endif  // AREG_IPC_COMPACTFRAMING_HPP
@@ -83,6 +83,13 @@ public:
     [[nodiscard]]
     bool connection_enable_flag() const;
 
+    /**
+     * \brief   Returns true if the connection type is in the list of supported connections of
+     *          the remote service (the 'connect' property of the service).
+     **/
+    [[nodiscard]]
+    bool is_connection_listed() const;
+
     /**
      * \brief   Sets the connection enabled/disabled flag.
      *
@@ -154,6 +161,13 @@ public:
     [[nodiscard]]
     uint32_t pool_pairs() const noexcept;
 
+    /**
+     * \brief   Returns true if the connection offers or accepts the compact message header,
+     *          see CompactFraming. Falls back to true when the key is absent from areg.init.
+     **/
+    [[nodiscard]]
+    bool compact_header() const noexcept;
+
     /**
      * \brief   Returns the configured SO_SNDTIMEO value in milliseconds for this service connection.
      *          Falls back to the compile-time default (SOCKET_SEND_TIMEOUT_MS) when the
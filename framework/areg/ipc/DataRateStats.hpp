@@ -19,18 +19,28 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/areg_global.h"
+#include "areg/base/RawBufferPool.hpp"
 
 #include <atomic>
 #include <cstdint>
 
 namespace areg {
 
+/**
+ * \brief   Hit / miss / retained-bytes counters of the raw buffer pool, which backs
+ *          the message buffers counted by DataRateStats. See RawBufferPool::stats().
+ **/
+using BufferPoolStats = RawBufferPool::Stats;
+
 //////////////////////////////////////////////////////////////////////////
 // DataRateStats class declaration.
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   Lightweight atomic send/receive statistics counter.
- *          Embed one instance per direction (send or receive) in a thread
+ *          Embed one instance per direction (send or receive) in a thread.
+ *          Besides the delivered data, it counts the lost droppable messages:
+ *          dropped by a full queue or a full datagram socket, or missing in
+ *          the sequence of the received datagrams.
  **/
 class AREG_API DataRateStats
 {
@@ -47,8 +57,8 @@ public:
 //////////////////////////////////////////////////////////////////////////
 public:
     /**
-     * \brief   Adds bytes and message count to the running totals.
-     *          No-op when tracking is disabled.
+     * \brief   Adds bytes and message count to the running totals, which one system call
+     *          carried, and counts the call. No-op when tracking is disabled.
      *
      * \param   bytes   Number of bytes to add.
      * \param   msgs    Number of messages to add.
@@ -69,9 +79,47 @@ public:
     [[nodiscard]]
     inline uint32_t extract_msgs() const noexcept;
 
+    /**
+     * \brief   Returns and atomically resets the number of system calls that carried the data.
+     *          Dividing the extracted message count by it gives the messages per system call.
+     *          Returns 0 when tracking is disabled (counters are already 0).
+     **/
+    [[nodiscard]]
+    inline uint32_t extract_calls() const noexcept;
+
+    /**
+     * \brief   Adds the number of lost droppable messages.
+     *          No-op when tracking is disabled.
+     *
+     * \param   msgs    Number of lost messages to add.
+     **/
+    inline void accumulate_lost(uint32_t msgs) noexcept;
+
+    /**
+     * \brief   Returns and atomically resets the number of lost droppable messages.
+     *          Returns 0 when tracking is disabled (counters are already 0).
+     **/
+    [[nodiscard]]
+    inline uint32_t extract_lost() const noexcept;
+
+    /**
+     * \brief   Adds the bytes, which the kernel sent without copying them from the message.
+     *          No-op when tracking is disabled.
+     *
+     * \param   bytes   Number of bytes to add.
+     **/
+    inline void accumulate_zerocopy(uint64_t bytes) noexcept;
+
+    /**
+     * \brief   Returns and atomically resets the number of bytes sent without copying.
+     *          Returns 0 when tracking is disabled (counters are already 0).
+     **/
+    [[nodiscard]]
+    inline uint64_t extract_zerocopy() const noexcept;
+
     /**
      * \brief   Enables or disables tracking.
-     *          Resets both counters whenever the enabled state changes so
+     *          Resets all counters whenever the enabled state changes so
      *          stale data from the previous interval is not reported.
      *
      * \param   enable  True to start accumulating; false to stop.
@@ -94,6 +142,9 @@ private:
 #endif  // _MSC_VER
     mutable std::atomic_uint64_t    mBytes;     //!< Running byte total.
     mutable std::atomic_uint32_t    mMsgs;      //!< Running message total.
+    mutable std::atomic_uint32_t    mLost;      //!< Running total of lost droppable messages.
+    mutable std::atomic_uint32_t    mCalls;     //!< Running total of system calls.
+    mutable std::atomic_uint64_t    mZeroCopy;  //!< Running total of bytes sent without copying.
 #if defined(_MSC_VER)
     #pragma warning(pop)
 #endif  // _MSC_VER
@@ -113,6 +164,9 @@ private:
 inline DataRateStats::DataRateStats() noexcept
     : mBytes    (0u)
     , mMsgs     (0u)
+    , mLost     (0u)
+    , mCalls    (0u)
+    , mZeroCopy (0u)
     , mEnabled  (false)
 {
 }
@@ -123,6 +177,7 @@ inline void DataRateStats::accumulate(uint64_t bytes, uint32_t msgs) noexcept
     {
         mBytes.fetch_add(bytes, std::memory_order_relaxed);
         mMsgs.fetch_add(msgs, std::memory_order_relaxed);
+        mCalls.fetch_add(1u, std::memory_order_relaxed);
     }
 }
 
@@ -136,12 +191,46 @@ inline uint32_t DataRateStats::extract_msgs() const noexcept
     return mMsgs.exchange(0u, std::memory_order_relaxed);
 }
 
+inline uint32_t DataRateStats::extract_calls() const noexcept
+{
+    return mCalls.exchange(0u, std::memory_order_relaxed);
+}
+
+inline void DataRateStats::accumulate_lost(uint32_t msgs) noexcept
+{
+    if (mEnabled)
+    {
+        mLost.fetch_add(msgs, std::memory_order_relaxed);
+    }
+}
+
+inline uint32_t DataRateStats::extract_lost() const noexcept
+{
+    return mLost.exchange(0u, std::memory_order_relaxed);
+}
+
+inline void DataRateStats::accumulate_zerocopy(uint64_t bytes) noexcept
+{
+    if (mEnabled && (bytes != 0u))
+    {
+        mZeroCopy.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+inline uint64_t DataRateStats::extract_zerocopy() const noexcept
+{
+    return mZeroCopy.exchange(0u, std::memory_order_relaxed);
+}
+
 inline void DataRateStats::set_enabled(bool enable) noexcept
 {
     if (mEnabled != enable)
     {
         mBytes.store(0u, std::memory_order_relaxed);
         mMsgs.store(0u, std::memory_order_relaxed);
+        mLost.store(0u, std::memory_order_relaxed);
+        mCalls.store(0u, std::memory_order_relaxed);
+        mZeroCopy.store(0u, std::memory_order_relaxed);
         mEnabled = enable;
     }
 }
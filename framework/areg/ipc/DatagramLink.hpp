@@ -0,0 +1,278 @@
+#ifndef AREG_IPC_DATAGRAMLINK_HPP
+#define AREG_IPC_DATAGRAMLINK_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/DatagramLink.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the best-effort datagram path of a TCP connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/SocketDefs.hpp"
+
+#include <atomic>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+namespace areg {
+    class SocketLinkMap;
+    struct SocketLinks;
+    class MessageEnvelope;
+} // namespace areg
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// DatagramLink class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Carries the droppable messages of one TCP connection as UDP datagrams, see
+ *          areg::is_droppable(). These are the updates of the latest-value attributes: the next
+ *          update replaces a lost one, so they need neither the retransmission nor the order of
+ *          the stream. All other messages stay on TCP, which also carries the handshake, and
+ *          the end of the TCP connection is the end of the link.
+ *
+ *          The client offers the port of its UDP socket with the connect request, the router
+ *          answers with the port of its own. Every datagram starts with a prefix carrying the
+ *          sequence number of the link, so that the receiver counts the missing datagrams as
+ *          lost and discards the late ones. A datagram may overtake the messages sent through
+ *          the stream before it.
+ *
+ *          A link is attached to a socket in the SocketLinkMap of the connection object, so that
+ *          the code sending to the socket finds the datagrams there.
+ *
+ * \note    The senders hold the writer lock of the socket, see SocketWriter. This is what makes
+ *          the sequence numbers of the link safe for many sending threads.
+ **/
+class AREG_API DatagramLink
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The prefix of every datagram of the link.
+     **/
+    struct Prefix
+    {
+        uint32_t    magic;      //!< Always DATAGRAM_MAGIC, filters the foreign datagrams.
+        uint32_t    sequence;   //!< The sequence number of the datagram in the link.
+    };
+
+    //!< The largest datagram, it fits into the Ethernet MTU and is never fragmented.
+    static constexpr uint32_t   MAX_DATAGRAM_SIZE   { 1472u };
+
+    //!< The largest message sent as a datagram, the larger ones go through the stream.
+    static constexpr uint32_t   MAX_MESSAGE_SIZE    { MAX_DATAGRAM_SIZE - static_cast<uint32_t>(sizeof(Prefix)) };
+
+    //!< The number of datagrams sent or received in one system call.
+    static constexpr uint32_t   BATCH_SIZE          { 32u };
+
+    //!< The value of the prefix, which marks the datagrams of a link.
+    static constexpr uint32_t   DATAGRAM_MAGIC      { 0x41524744u };
+
+//////////////////////////////////////////////////////////////////////////
+// Static operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the complete message in the buffer is droppable and small enough
+     *          to be sent as a datagram.
+     **/
+    [[nodiscard]]
+    static bool is_datagram( const areg::IoBuffer & message ) noexcept;
+
+    /**
+     * \brief   Decodes the received datagram into the message.
+     *
+     * \param   datagram        The received datagram.
+     * \param[out]  message     The message to receive, the checksum is validated.
+     * \param[out]  sequence    On output, the sequence number of the datagram.
+     * \return  Returns the size of the message on success, zero if the datagram is not a valid
+     *          droppable message of a link.
+     **/
+    static int32_t decode( const areg::DatagramIn & datagram, MessageEnvelope & message, uint32_t & sequence );
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    DatagramLink() noexcept;
+
+    ~DatagramLink();
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the droppable messages are sent as datagrams.
+     **/
+    [[nodiscard]]
+    inline bool is_sending() const noexcept;
+
+    /**
+     * \brief   Returns the socket of the connection the link is attached to.
+     **/
+    [[nodiscard]]
+    inline SOCKETHANDLE socket() const noexcept;
+
+    /**
+     * \brief   Returns true if the datagram is sent by the peer of the link.
+     **/
+    [[nodiscard]]
+    inline bool is_peer( const areg::DatagramEndpoint & sender ) const noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Attaches the link to the socket of the connection, so that the senders find it.
+     *          The sending starts with activate_send().
+     *
+     * \param   hSocket     The socket of the connection.
+     * \param   links       The links of the connection object, the link is attached in them.
+     * \param   hDatagram   The UDP socket to send the datagrams, it is not owned by the link.
+     * \param   peer        The UDP endpoint of the peer.
+     * \return  Returns true if the link is attached. Returns false if another link is attached
+     *          to the socket; the droppable messages then stay on TCP.
+     **/
+    bool attach( SOCKETHANDLE hSocket, SocketLinkMap & links, SOCKETHANDLE hDatagram, const areg::DatagramEndpoint & peer );
+
+    /**
+     * \brief   Switches the sending of the droppable messages to the datagrams.
+     **/
+    inline void activate_send() noexcept;
+
+    /**
+     * \brief   Detaches the link from the socket. On return no sender uses the link anymore.
+     **/
+    void detach() noexcept;
+
+    /**
+     * \brief   Sends the droppable messages of the buffers as datagrams and the others through
+     *          the socket of the connection. Each buffer must contain one complete message.
+     *          Sends the datagrams without waiting: the ones, which do not fit into the send
+     *          buffer, are lost and the receiver counts them.
+     *
+     * \param   links       The framing and the sender attached to the socket of the connection.
+     * \return  Returns the number of bytes sent or passed as datagrams on success, negative
+     *          value if the socket of the connection failed.
+     **/
+    inline int32_t send_messages_batch( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, const SocketLinks & links ) noexcept;
+
+    /**
+     * \brief   Same as send_messages_batch(), but does not wait for the socket of the connection
+     *          and never sends a part of the buffers.
+     *
+     * \return  Returns the number of bytes sent on success, zero if the socket of the
+     *          connection has no space for them, negative value on failure.
+     **/
+    inline int32_t try_send_messages_batch( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, const SocketLinks & links ) noexcept;
+
+    /**
+     * \brief   Called by the receiving thread for every valid datagram of the peer.
+     *
+     * \param   sequence    The sequence number of the received datagram.
+     * \return  Returns the number of the datagrams lost since the previous one. Returns
+     *          negative value if the datagram is older than one already received, it must be
+     *          discarded.
+     **/
+    int32_t accept_sequence( uint32_t sequence ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Splits the buffers into the datagrams and the stream and sends them.
+     *
+     * \param   tryOnly     If true, does not wait for the socket of the connection.
+     **/
+    int32_t _send( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, const SocketLinks & links, bool tryOnly ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The socket of the connection the link is attached to.
+    SOCKETHANDLE                mSocket;
+    //!< The links of the connection object, which the link is attached in.
+    SocketLinkMap *             mLinks;
+    //!< The UDP socket to send the datagrams.
+    SOCKETHANDLE                mDatagram;
+    //!< The UDP endpoint of the peer.
+    areg::DatagramEndpoint      mPeer;
+    //!< The sequence number of the next sent datagram, guarded by the writer lock.
+    uint32_t                    mSendSequence;
+    //!< The sequence number of the next expected datagram, used by the receiving thread only.
+    uint32_t                    mRecvSequence;
+    //!< True if a datagram of the peer was received, used by the receiving thread only.
+    bool                        mRecvStarted;
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< True if the droppable messages are sent as datagrams.
+    std::atomic_bool            mSending;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( DatagramLink );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// DatagramLink class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool DatagramLink::is_sending() const noexcept
+{
+    return mSending.load(std::memory_order_acquire);
+}
+
+inline SOCKETHANDLE DatagramLink::socket() const noexcept
+{
+    return mSocket;
+}
+
+inline bool DatagramLink::is_peer( const areg::DatagramEndpoint & sender ) const noexcept
+{
+    return (sender.address == mPeer.address) && (sender.port == mPeer.port);
+}
+
+inline void DatagramLink::activate_send() noexcept
+{
+    mSending.store(true, std::memory_order_release);
+}
+
+inline int32_t DatagramLink::send_messages_batch( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, const SocketLinks & links ) noexcept
+{
+    return _send(ioBuffer, count, totalSize, links, false);
+}
+
+inline int32_t DatagramLink::try_send_messages_batch( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, const SocketLinks & links ) noexcept
+{
+    return _send(ioBuffer, count, totalSize, links, true);
+}
+
+} // namespace areg
+
+#endif  // AREG_IPC_DATAGRAMLINK_HPP
@@ -52,9 +52,10 @@ enum class ConnectionType   : uint32_t
 {
       Undefined     = 0 //!< Undefined connection
     , Tcpip         = 1 //!< Service connection via TCP/IP
-    , Udp           = 2 //!< Service connection via UDP, not implemented at the moment
+    , Udp           = 2 //!< Service connection via UDP, the best-effort path of the droppable messages of a TCP/IP connection
     , Web           = 4 //!< Service connection via Web socket
-    , SharedMemory  = 8 //!< Service connection via Shared Memory
+    , SharedMemory  = 8 //!< Service connection via Shared Memory, the data path of a local TCP/IP connection
+    , UnixSocket    =16 //!< Service connection via local stream socket (AF_UNIX), preferred over TCP/IP on loopback
 };
 
 /**
@@ -425,6 +426,8 @@ inline constexpr const char* areg::as_string(areg::ConnectionType type) noexcept
         return "Web Socket";
     case ConnectionType::SharedMemory:
         return "Shared Memory";
+    case ConnectionType::UnixSocket:
+        return "Unix Socket";
     default:
         return "Unknown";
     }
@@ -355,6 +355,24 @@ public:
      **/
     inline void set_socket_buffers(uint32_t sendBuf, uint32_t recvBuf) noexcept;
 
+    /**
+     * \brief   Enables or disables the local stream socket (AF_UNIX), which the server opens in
+     *          parallel with the TCP socket, so that the processes of the same host bypass the TCP
+     *          stack. The path of the socket is derived from the TCP port, see areg::local_socket_path().
+     *          Call before create_socket() to take effect. If the local socket cannot be opened,
+     *          the server continues with TCP only.
+     *
+     * \param   enable  Flag, indicating whether the local socket should be opened.
+     **/
+    inline void set_local_socket_enabled(bool enable) noexcept;
+
+    /**
+     * \brief   Returns the path of the opened local stream socket, or an empty string if the server
+     *          listens on TCP only.
+     **/
+    [[nodiscard]]
+    inline const String & local_socket_path() const noexcept;
+
     /**
      * \brief   Configures the SO_SNDTIMEO value applied to every accepted client socket.
      *          Call before the first accept_connection() to take effect.
@@ -431,6 +449,26 @@ protected:
      **/
     uint32_t            mSockSendTimeoutMs;
 
+    /**
+     * \brief   The listening local stream socket, opened in parallel with the server socket.
+     **/
+    SOCKETHANDLE        mLocalSocket;
+
+    /**
+     * \brief   The path of the local stream socket, empty if it is not opened.
+     **/
+    String              mLocalPath;
+
+    /**
+     * \brief   The address reported for the connections accepted on the local stream socket.
+     **/
+    areg::SocketAddress mLocalAddress;
+
+    /**
+     * \brief   Flag, indicating whether create_socket() opens the local stream socket.
+     **/
+    bool                mLocalEnabled;
+
 #if defined(_MSC_VER)
     #pragma warning(push)
     #pragma warning(disable: 4251)
@@ -447,6 +485,30 @@ protected:
 #if defined(_MSC_VER)
     #pragma warning(pop)
 #endif  // _MSC_VER
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Opens the local stream socket if it is enabled and registers it in the multiplexer.
+     *          Called with the lock held, after the server socket is created.
+     **/
+    void _create_local_socket();
+
+    /**
+     * \brief   Closes the local stream socket and removes its path. Called with the lock held.
+     **/
+    void _close_local_socket() noexcept;
+
+    /**
+     * \brief   Accepts the connection pending on the local stream socket.
+     *
+     * \param[out] out_addrNewAccepted  On output contains the loopback address and the port of
+     *                                  the server, if a new connection is accepted.
+     * \return  Returns the accepted socket, or InvalidSocketHandle on failure.
+     **/
+    SOCKETHANDLE _accept_local_connection(areg::SocketAddress & out_addrNewAccepted);
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -476,6 +538,16 @@ inline const areg::SocketAddress & ServerConnectionBase::address() const noexcep
     return mServerSocket.address();
 }
 
+inline void ServerConnectionBase::set_local_socket_enabled(bool enable) noexcept
+{
+    mLocalEnabled = enable;
+}
+
+inline const String & ServerConnectionBase::local_socket_path() const noexcept
+{
+    return mLocalPath;
+}
+
 inline bool ServerConnectionBase::is_valid() const noexcept
 {
     std::shared_lock<std::shared_mutex> lock(mLock);
@@ -26,6 +26,7 @@
 #include "areg/component/EventConsumer.hpp"
 #include "areg/component/ExitEvent.hpp"
 #include "areg/ipc/ClientConnection.hpp"
+#include "areg/ipc/private/ClientDatagramThread.hpp"
 #include "areg/ipc/private/ClientReceiveThread.hpp"
 #include "areg/ipc/private/ClientSendThread.hpp"
 #include "areg/component/Channel.hpp"
@@ -140,6 +141,32 @@ public:
      **/
     inline void query_data_received(uint64_t& sizeRecv, uint32_t& msgRecv) noexcept;
 
+    /**
+     * \brief   Queries the number of droppable messages lost since the last call, and resets counters.
+     *          The sent ones are lost if the send queue is full, the received ones are missing in
+     *          the sequence of the datagrams or arrived too late.
+     *
+     * \param[out] lostSent     On output, contains the number of droppable messages lost on sending.
+     * \param[out] lostRecv     On output, contains the number of droppable messages lost on receiving.
+     **/
+    inline void query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept;
+
+    /**
+     * \brief   Queries the number of system calls that wrote the sent messages since the last call,
+     *          and resets the counter. Gives the messages per system call with query_data_sent().
+     *
+     * \param[out] sendCalls    On output, contains the number of send system calls.
+     **/
+    inline void query_send_calls(uint32_t& sendCalls) noexcept;
+
+    /**
+     * \brief   Queries the number of bytes the kernel sent without copying since the last call,
+     *          and resets the counter. Stays 0 unless the zero-copy send is enabled.
+     *
+     * \param[out] savedBytes   On output, contains the number of bytes not copied.
+     **/
+    inline void query_zerocopy_saved(uint64_t& savedBytes) noexcept;
+
     /**
      * \brief   Enable or disable the data rate calculation.
      *
@@ -353,6 +380,14 @@ protected:
     [[nodiscard]]
     inline bool is_connection_started() const noexcept;
 
+    /**
+     * \brief   Counts the droppable messages, which are received, but refused by the full event
+     *          queue of the target, see query_data_lost().
+     *
+     * \param   msgs    Number of lost messages.
+     **/
+    inline void accumulate_lost_received(uint32_t msgs) noexcept;
+
     /**
      * \brief   Queues a service command event with optional priority.
      *
@@ -477,6 +512,35 @@ private:
     [[nodiscard]]
     inline ServiceClientConnectionBase & self() noexcept;
 
+    /**
+     * \brief   Creates the shared memory channel to offer with the connect request, if the
+     *          configuration enables it and the remote service runs on the same host.
+     * \return  Returns true if the channel is created.
+     **/
+    bool _open_shared_memory();
+
+    /**
+     * \brief   Creates the UDP socket to offer with the connect request, if the configuration
+     *          enables the datagrams for the droppable messages.
+     * \return  Returns the port of the UDP socket, zero if there is none.
+     **/
+    uint16_t _open_datagram();
+
+    /**
+     * \brief   Attaches the compact framing to the socket to offer it with the connect request,
+     *          if the configuration enables the compact message header.
+     * \return  Returns true if the compact header is offered.
+     **/
+    bool _open_compact();
+
+    /**
+     * \brief   Returns the path of the local stream socket of the remote service, if the
+     *          configuration enables it and the address of the remote service is loopback.
+     *          Otherwise returns an empty string and the connection uses TCP.
+     **/
+    [[nodiscard]]
+    String _local_socket_path() const;
+
 //////////////////////////////////////////////////////////////////////////
 // Protected member variables
 //////////////////////////////////////////////////////////////////////////
@@ -561,6 +625,10 @@ private:
      * \brief   Message sender thread
      **/
     areg::ClientSendThread          mThreadSend;
+    /**
+     * \brief   The thread receiving the droppable messages sent as datagrams.
+     **/
+    areg::ClientDatagramThread      mThreadDatagram;
     //!< Guards the lazy start of the send thread, see ensure_send_thread().
     areg::Mutex                     mSendStartLock;
 
@@ -602,6 +670,22 @@ inline void ServiceClientConnectionBase::query_data_received(uint64_t& sizeRecv,
     msgRecv  = mThreadReceive.extract_msgs_received();
 }
 
+inline void ServiceClientConnectionBase::query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept
+{
+    lostSent = mThreadSend.extract_msgs_lost();
+    lostRecv = mThreadReceive.extract_msgs_lost();
+}
+
+inline void ServiceClientConnectionBase::query_send_calls(uint32_t& sendCalls) noexcept
+{
+    sendCalls = mThreadSend.extract_send_calls();
+}
+
+inline void ServiceClientConnectionBase::query_zerocopy_saved(uint64_t& savedBytes) noexcept
+{
+    savedBytes = mThreadSend.extract_zerocopy_saved();
+}
+
 inline void ServiceClientConnectionBase::enable_data_rate(bool enable)
 {
     mThreadReceive.set_data_rate_enabled(enable);
@@ -670,6 +754,11 @@ inline bool ServiceClientConnectionBase::is_connection_started() const noexcept
     return (mClientConnection.is_valid() && (cookie != areg::COOKIE_LOCAL) && (cookie != areg::COOKIE_UNKNOWN));
 }
 
+inline void ServiceClientConnectionBase::accumulate_lost_received(uint32_t msgs) noexcept
+{
+    mThreadReceive.accumulate_lost(msgs);
+}
+
 inline void ServiceClientConnectionBase::set_connection_state(const ServiceClientConnectionBase::ConnectionPhase newState)
 {
     mConnectionState = newState;
@@ -733,6 +822,10 @@ inline bool ServiceClientConnectionBase::send_message(MessageEnvelope && data, a
     if ( queued == false )
     {
         mThreadSend.send_gate().leave(1u);   // balance the enter() above, or the gate never clears
+        if ( evt.is_droppable() )
+        {
+            mThreadSend.accumulate_lost(1u);
+        }
     }
 
     return queued;
@@ -0,0 +1,301 @@
+#ifndef AREG_IPC_SHAREDMEMORYLINK_HPP
+#define AREG_IPC_SHAREDMEMORYLINK_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/SharedMemoryLink.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the shared memory data path of a TCP connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/SharedMemoryChannel.hpp"
+#include "areg/base/SocketDefs.hpp"
+
+#include <atomic>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+namespace areg {
+    class MessageEnvelope;
+    class SocketLinkMap;
+} // namespace areg
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryLink class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Carries the messages of one TCP connection through a shared memory channel when
+ *          both processes run on the same host. The TCP connection stays open: it carries the
+ *          handshake, and its end is the end of the link.
+ *
+ *          The client creates the channel and sends its name with the connect request. The
+ *          router opens the channel and confirms it in the connect response. From then on the
+ *          client sends through the channel, and the router switches its sending to the
+ *          channel when the first message of the client arrives from it. The messages sent
+ *          before the switch are read from the socket first, so the order is kept.
+ *
+ *          A link is attached to a socket in the SocketLinkMap of the connection object, so that
+ *          the code sending to the socket finds the channel there.
+ *
+ * \note    The senders hold the writer lock of the socket, see SocketWriter. This is what makes
+ *          the single producer channel safe for many sending threads.
+ **/
+class AREG_API SharedMemoryLink
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The source of the next message to read.
+     **/
+    enum class Input : uint8_t
+    {
+          Channel   //!< The next message is in the shared memory channel.
+        , Socket    //!< The next message is in the socket, or the socket must report its error.
+    };
+
+private:
+    //!< The longest wait in milliseconds before the socket is checked again.
+    static constexpr uint32_t   SOCKET_CHECK_MS     { 100u };
+
+    //!< The longest wait in milliseconds on the socket while the channel is not used yet.
+    static constexpr uint32_t   SWITCH_CHECK_MS     { 8u };
+
+    /**
+     * \brief   The state of the receiving side of the link.
+     **/
+    enum class ReceiveState : uint8_t
+    {
+          Socket    //!< The messages are read from the socket only.
+        , Switching //!< The channel is confirmed, the peer may switch to it at any time.
+        , Channel   //!< The peer sends through the channel.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    SharedMemoryLink() noexcept;
+
+    ~SharedMemoryLink();
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the name of the channel to pass to the peer.
+     **/
+    [[nodiscard]]
+    inline const String & name() const noexcept;
+
+    /**
+     * \brief   Returns true if the channel is open and not shut down.
+     **/
+    [[nodiscard]]
+    inline bool is_active() const noexcept;
+
+    /**
+     * \brief   Returns true if the messages are sent through the channel.
+     **/
+    [[nodiscard]]
+    inline bool is_sending() const noexcept;
+
+    /**
+     * \brief   Returns true if the messages may arrive through the channel and the receiving
+     *          thread should call wait_input().
+     **/
+    [[nodiscard]]
+    inline bool is_receiving() const noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the channel, the client side of the link.
+     *
+     * \param   sendSize    The size of the ring to send messages in bytes.
+     * \param   recvSize    The size of the ring to receive messages in bytes.
+     * \param   timeoutMs   The time in milliseconds the sender waits for free space in the ring.
+     * \return  Returns true if the channel is created.
+     **/
+    bool create( uint32_t sendSize, uint32_t recvSize, uint32_t timeoutMs );
+
+    /**
+     * \brief   Opens the channel created by the peer, the router side of the link.
+     *
+     * \param   name        The name of the channel received from the peer.
+     * \param   timeoutMs   The time in milliseconds the sender waits for free space in the ring.
+     * \return  Returns true if the channel is opened.
+     **/
+    bool open( const String & name, uint32_t timeoutMs );
+
+    /**
+     * \brief   Attaches the link to the socket of the connection, so that the senders find it.
+     *
+     * \param   hSocket     The socket of the connection.
+     * \param   links       The links of the connection object, the link is attached in them.
+     * \return  Returns true if the link is attached. Returns false if another link is attached
+     *          to the socket; the connection then stays on TCP.
+     **/
+    bool attach( SOCKETHANDLE hSocket, SocketLinkMap & links );
+
+    /**
+     * \brief   Called by the client when the router answered the connect request. Removes the
+     *          name of the channel and, if the router opened the channel, switches the sending
+     *          to the channel and starts watching the channel for the messages of the router.
+     *
+     * \param   accepted    True if the router opened the channel.
+     **/
+    void confirm( bool accepted );
+
+    /**
+     * \brief   Switches the sending to the channel.
+     **/
+    inline void activate_send() noexcept;
+
+    /**
+     * \brief   Detaches the link from the socket and shuts the channel down for both sides.
+     *          On return no sender uses the link anymore. The memory stays mapped until
+     *          release(), because a receiving thread may still read it.
+     **/
+    void detach() noexcept;
+
+    /**
+     * \brief   Unmaps the channel. Call it after detach() and after the receiving thread stopped.
+     **/
+    void release() noexcept;
+
+    /**
+     * \brief   Sends the buffers through the channel. Waits for free space if the ring is full.
+     *
+     * \return  Returns the number of sent bytes on success, negative value on failure.
+     **/
+    inline int32_t send_messages_batch( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize ) noexcept;
+
+    /**
+     * \brief   Sends the buffers through the channel only if they fit, never waits.
+     *
+     * \return  Returns the number of sent bytes on success, zero if the ring has no space for
+     *          them, negative value if the channel is shut down.
+     **/
+    inline int32_t try_send_messages_batch( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize ) noexcept;
+
+    /**
+     * \brief   Receives the next message from the channel.
+     *
+     * \param[out]  message     The message to receive, the checksum is validated.
+     * \param       waitMs      The time in milliseconds to wait for the message to start.
+     * \return  Returns the size of the message on success, zero if the message is corrupted,
+     *          negative value on timeout or if the channel is shut down.
+     **/
+    int32_t receive_message( MessageEnvelope & message, uint32_t waitMs );
+
+    /**
+     * \brief   Waits for the next message of the peer and returns where to read it from.
+     *          The socket is checked regularly, so that a closed connection is detected.
+     *          Called by the receiving thread of the client.
+     *
+     * \param   hSocket     The socket of the connection.
+     **/
+    Input wait_input( SOCKETHANDLE hSocket );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns true if the socket has data to read or a pending error.
+     **/
+    [[nodiscard]]
+    static bool _socket_ready( SOCKETHANDLE hSocket, uint32_t timeoutMs ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The channel of the link.
+    SharedMemoryChannel         mChannel;
+    //!< The socket the link is attached to.
+    SOCKETHANDLE                mSocket;
+    //!< The links of the connection object, which the link is attached in.
+    SocketLinkMap *             mLinks;
+    //!< The time in milliseconds the sender waits for free space in the ring.
+    uint32_t                    mTimeout;
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< True if the messages are sent through the channel.
+    std::atomic_bool            mSending;
+    //!< The state of the receiving side, changed by the receiving thread only.
+    std::atomic<ReceiveState>   mReceive;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( SharedMemoryLink );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryLink class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline const String & SharedMemoryLink::name() const noexcept
+{
+    return mChannel.name();
+}
+
+inline bool SharedMemoryLink::is_active() const noexcept
+{
+    return (mChannel.is_shutdown() == false);
+}
+
+inline bool SharedMemoryLink::is_sending() const noexcept
+{
+    return mSending.load(std::memory_order_acquire);
+}
+
+inline bool SharedMemoryLink::is_receiving() const noexcept
+{
+    return (mReceive.load(std::memory_order_acquire) != ReceiveState::Socket);
+}
+
+inline void SharedMemoryLink::activate_send() noexcept
+{
+    mSending.store(true, std::memory_order_release);
+}
+
+inline int32_t SharedMemoryLink::send_messages_batch( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize ) noexcept
+{
+    return mChannel.send(ioBuffer, count, totalSize, mTimeout);
+}
+
+inline int32_t SharedMemoryLink::try_send_messages_batch( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize ) noexcept
+{
+    return mChannel.try_send(ioBuffer, count, totalSize);
+}
+
+} // namespace areg
+
+#endif  // AREG_IPC_SHAREDMEMORYLINK_HPP
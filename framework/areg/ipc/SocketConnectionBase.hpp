@@ -21,6 +21,10 @@
 #include "areg/base/areg_global.h"
 #include "areg/base/SocketDefs.hpp"
 #include "areg/base/Socket.hpp"
+#include "areg/ipc/CompactFraming.hpp"
+#include "areg/ipc/DatagramLink.hpp"
+#include "areg/ipc/SharedMemoryLink.hpp"
+#include "areg/ipc/SocketLinkMap.hpp"
 
 /************************************************************************
  * Dependencies
@@ -43,9 +47,19 @@ class AREG_API SocketConnectionBase
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
 protected:
-    SocketConnectionBase() noexcept;
+    SocketConnectionBase();
     virtual ~SocketConnectionBase() = default;
 
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the framings and links attached to the sockets of the connection.
+     **/
+    [[nodiscard]]
+    inline SocketLinkMap & links() const noexcept;
+
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
@@ -69,12 +83,47 @@ protected:
      * \param   count       Number of entries in the array.
      * \param   hSocket     Raw OS socket handle; must be valid.
      * \param   totalSize   The total size of data in the `ioBuffer` to send. If 0, it is calculated.
+     * \param   owners      The messages the buffers point into, passed to the ZeroCopySender of
+     *                      the socket, if any. nullptr sends all buffers by copying.
+     * \param   ownerCount  The number of entries of \a owners.
      * \return  Total bytes sent on success; negative if the syscall fails.
      **/
-    inline int32_t send_messages_batch(const areg::IoBuffer* const ioBuffer, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize = 0) const;
+    inline int32_t send_messages_batch(const areg::IoBuffer* const ioBuffer, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize = 0, const areg::RawBufferPtr* owners = nullptr, uint32_t ownerCount = 0u) const;
 
     /**
-     * \brief   Receives a message by reading EventHeader first, then payload.
+     * \brief   Sends multiple messages to the same socket handle only if it is possible without
+     *          waiting. Never sends a part of the data.
+     *
+     * \param   ioBuffer    Array of pointers to the buffers to send.
+     * \param   count       Number of entries in the array.
+     * \param   hSocket     Raw OS socket handle; must be valid.
+     * \param   totalSize   The total size of data in the `ioBuffer` to send. If 0, it is calculated.
+     * \return  Total bytes sent on success; zero if nothing could be sent without waiting;
+     *          negative if the syscall fails.
+     **/
+    inline int32_t try_send_messages_batch(const areg::IoBuffer* const ioBuffer, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize = 0) const;
+
+    /**
+     * \brief   Sends the groups of messages of many sockets, and sets the result of each group.
+     *          The groups of one socket are sent in the order of the array. The groups of the
+     *          free sockets are passed to areg::send_data_groups() in one call, which on Linux
+     *          built with AREG_IO_URING is a single system call. The groups of the sockets written
+     *          by other threads, or carried by the shared memory or datagram links, are sent one
+     *          by one as send_messages_batch() does.
+     *
+     * \param   groups      The groups to send. On output, each group has the result of the send.
+     * \param   count       The number of groups in the array.
+     * \param   timeoutMs   The send timeout of the sockets in milliseconds, 0 waits infinitely.
+     **/
+    void send_messages_groups(areg::IoGroup* groups, uint32_t count, uint32_t timeoutMs) const;
+
+    /**
+     * \brief   Receives a message by reading the header first, then payload. The header is
+     *          either the full EventHeader or, if a CompactFraming is attached to the socket in
+     *          links(), the compact one, from which the EventHeader is rebuilt.
+     *          If the thread caches the received data, the frame is decoded straight out of the
+     *          read-ahead buffer (see areg::receive_frame()): one recv() serves all the small
+     *          frames it brought, and the payload is copied once, into the message.
      *
      * \param[out]  message     MessageEnvelope to populate; checksum validated after receiving.
      * \param       socket      A socket for communication (client or server-side accepted socket). Must be valid.
@@ -82,6 +131,13 @@ protected:
      **/
     int32_t receive_message( MessageEnvelope & message, const Socket & socket ) const;
 
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The framings and links attached to the sockets of the connection.
+    mutable SocketLinkMap   mLinks;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -89,14 +145,36 @@ private:
     AREG_NOCOPY_NOMOVE( SocketConnectionBase );
 };
 
-inline int32_t SocketConnectionBase::send_messages_batch(const areg::IoBuffer* const ioBuffer, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize) const
+inline SocketLinkMap & SocketConnectionBase::links() const noexcept
+{
+    return mLinks;
+}
+
+inline int32_t SocketConnectionBase::send_messages_batch(const areg::IoBuffer* const ioBuffer, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize, const areg::RawBufferPtr* owners, uint32_t ownerCount) const
 {
-    return areg::send_data_v(hSocket, ioBuffer, count, totalSize);
+    const SocketLinks links{ mLinks.links_of(hSocket) };
+    SharedMemoryLink * link{ links.slShared };
+    if ((link != nullptr) && link->is_sending())
+        return link->send_messages_batch(ioBuffer, count, totalSize);
+
+    DatagramLink * datagram{ links.slDatagram };
+    return ((datagram != nullptr) && datagram->is_sending() ? datagram->send_messages_batch(ioBuffer, count, totalSize, links) : CompactFraming::send_stream(hSocket, links, ioBuffer, count, totalSize, false, owners, ownerCount));
 }
 
 inline int32_t SocketConnectionBase::send_messages_batch(const areg::IoBuffer* const ioBuffer, uint32_t count, const Socket& socket, uint32_t totalSize /*= 0*/) const
 {
-    return areg::send_data_v(socket.handle(), ioBuffer, count, totalSize);
+    return send_messages_batch(ioBuffer, count, socket.handle(), totalSize);
+}
+
+inline int32_t SocketConnectionBase::try_send_messages_batch(const areg::IoBuffer* const ioBuffer, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize) const
+{
+    const SocketLinks links{ mLinks.links_of(hSocket) };
+    SharedMemoryLink * link{ links.slShared };
+    if ((link != nullptr) && link->is_sending())
+        return link->try_send_messages_batch(ioBuffer, count, totalSize);
+
+    DatagramLink * datagram{ links.slDatagram };
+    return ((datagram != nullptr) && datagram->is_sending() ? datagram->try_send_messages_batch(ioBuffer, count, totalSize, links) : CompactFraming::send_stream(hSocket, links, ioBuffer, count, totalSize, true));
 }
 
 } // namespace areg
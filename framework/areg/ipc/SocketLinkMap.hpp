@@ -0,0 +1,180 @@
+#ifndef AREG_IPC_SOCKETLINKMAP_HPP
+#define AREG_IPC_SOCKETLINKMAP_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/SocketLinkMap.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the framings and links attached to the sockets of a connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/ResourceMap.hpp"
+#include "areg/base/SocketDefs.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+namespace areg {
+    class CompactFraming;
+    class DatagramLink;
+    class SharedMemoryLink;
+    class ZeroCopySender;
+} // namespace areg
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// SocketLinks structure declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The framing and the links attached to one socket, nullptr if none is attached.
+ **/
+struct SocketLinks
+{
+    CompactFraming *    slFraming   { nullptr };    //!< The compact framing of the socket.
+    ZeroCopySender *    slZeroCopy  { nullptr };    //!< The zero-copy sender of the socket.
+    SharedMemoryLink *  slShared    { nullptr };    //!< The shared memory link of the socket.
+    DatagramLink *      slDatagram  { nullptr };    //!< The datagram link of the socket.
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SocketLinkMap class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The framings and links attached to the sockets of one connection object, found by
+ *          the exact socket handle. The code sending to or receiving from a socket of the
+ *          connection takes them from here, so each socket has its own entry and the sockets
+ *          never compete for one.
+ *
+ *          The lookups take no lock. The attach and detach are rare, they are serialized and
+ *          publish the changed entry at once. The object attached to a socket stays valid for
+ *          the senders until its own detach() waits for them.
+ **/
+class AREG_API SocketLinkMap
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    SocketLinkMap();
+
+    ~SocketLinkMap() = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the framing and the links attached to the socket. Takes no lock.
+     **/
+    [[nodiscard]]
+    inline SocketLinks links_of( SOCKETHANDLE hSocket ) const;
+
+    /**
+     * \brief   Attaches the compact framing to the socket.
+     * \return  Returns false if another framing is attached to the socket.
+     **/
+    bool attach( SOCKETHANDLE hSocket, CompactFraming & framing );
+
+    /**
+     * \brief   Detaches the compact framing from the socket, if it is the attached one.
+     **/
+    void detach( SOCKETHANDLE hSocket, const CompactFraming & framing );
+
+    /**
+     * \brief   Attaches the zero-copy sender to the socket.
+     * \return  Returns false if another sender is attached to the socket.
+     **/
+    bool attach( SOCKETHANDLE hSocket, ZeroCopySender & sender );
+
+    /**
+     * \brief   Detaches the zero-copy sender from the socket, if it is the attached one.
+     **/
+    void detach( SOCKETHANDLE hSocket, const ZeroCopySender & sender );
+
+    /**
+     * \brief   Attaches the shared memory link to the socket.
+     * \return  Returns false if another link is attached to the socket.
+     **/
+    bool attach( SOCKETHANDLE hSocket, SharedMemoryLink & link );
+
+    /**
+     * \brief   Detaches the shared memory link from the socket, if it is the attached one.
+     **/
+    void detach( SOCKETHANDLE hSocket, const SharedMemoryLink & link );
+
+    /**
+     * \brief   Attaches the datagram link to the socket.
+     * \return  Returns false if another link is attached to the socket.
+     **/
+    bool attach( SOCKETHANDLE hSocket, DatagramLink & link );
+
+    /**
+     * \brief   Detaches the datagram link from the socket, if it is the attached one.
+     **/
+    void detach( SOCKETHANDLE hSocket, const DatagramLink & link );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Sets the field of the entry of the socket to \a link, if the field is empty.
+     * \return  Returns true if the field is set to \a link.
+     **/
+    template <typename LINK>
+    bool _attach( SOCKETHANDLE hSocket, LINK * SocketLinks::* field, LINK * link );
+
+    /**
+     * \brief   Clears the field of the entry of the socket, if the field is \a link. The entry
+     *          is removed, once nothing is attached to the socket.
+     **/
+    template <typename LINK>
+    void _detach( SOCKETHANDLE hSocket, LINK * SocketLinks::* field, const LINK * link );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< The entries of the sockets, searched by the senders and the receivers.
+    ReadMostlyResourceMap<SOCKETHANDLE, SocketLinks>    mLinks;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+    //!< Serializes the changes, each reads and republishes an entry.
+    mutable ResourceLock                                mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( SocketLinkMap );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SocketLinkMap class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline SocketLinks SocketLinkMap::links_of( SOCKETHANDLE hSocket ) const
+{
+    return mLinks.find_resource_object(hSocket);
+}
+
+} // namespace areg
+
+#endif  // AREG_IPC_SOCKETLINKMAP_HPP
@@ -0,0 +1,319 @@
+#ifndef AREG_IPC_ZEROCOPYSENDER_HPP
+#define AREG_IPC_ZEROCOPYSENDER_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/ZeroCopySender.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the zero-copy send of the large messages of a stream connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/MemoryDefs.hpp"
+#include "areg/base/SocketDefs.hpp"
+
+#include <atomic>
+#include <memory>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+namespace areg {
+    class SocketLinkMap;
+} // namespace areg
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// ZeroCopySender class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Sends the buffers of a stream socket, which are at least as large as the threshold,
+ *          without copying them into the kernel. The kernel reads such a buffer while it
+ *          transmits it, so the sender keeps a reference to the message of the buffer until
+ *          the error queue of the socket reports that the kernel released it. The smaller
+ *          buffers, and the buffers without a known message, are sent as usual.
+ *
+ *          The completions are read by the next sends and when the sender is detached. If the
+ *          kernel reports that it copied the data anyway, as it does on the loopback interface,
+ *          the sender stops sending without copying: it would only add the cost of the
+ *          completions. The bytes the kernel did not copy are counted for the statistics.
+ *
+ *          The messages, which the kernel did not release when the sender is detached, are
+ *          moved to a retired sender with another handle of the socket, see zerocopy_retain().
+ *          The retired senders read the completions on the later calls of reap(), attach() and
+ *          detach() of any sender, and free the message when the kernel releases it. The kernel
+ *          releases all of them at the latest when it tears the closed socket down.
+ *
+ *          A sender is attached to a socket in the SocketLinkMap of the connection object, the
+ *          same way as the CompactFraming, so the code sending to the socket finds it there.
+ *
+ * \note    The sender is used by the threads holding the writer lock of the socket, see
+ *          SocketWriter. The zero-copy send exists on Linux only; elsewhere attach() fails.
+ **/
+class AREG_API ZeroCopySender
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The largest number of the messages the kernel may hold at once. A large buffer is
+    //!< copied if that many are still not released.
+    static constexpr uint32_t   MAX_PENDING     { 256u };
+
+private:
+    //!< The number of the completions read at once.
+    static constexpr uint32_t   COMPLETIONS     { 16u };
+
+    /**
+     * \brief   A message, which the kernel did not release yet. The ids of the sends are 32-bit
+     *          and wrap around, the range of the buffer is its first id and the number of sends.
+     **/
+    struct Pending
+    {
+        areg::RawBufferPtr  owner;      //!< The message of the sent buffer.
+        uint32_t            first;      //!< The id of the first send of the buffer.
+        uint32_t            sends;      //!< The number of the sends of the buffer.
+        uint32_t            done;       //!< The number of the completed sends of the buffer.
+        uint32_t            size;       //!< The bytes of the buffer sent without copying.
+        bool                copied;     //!< True if the kernel copied a part of the buffer.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Static operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Sends the buffers through the stream socket, the large ones without copying if
+     *          the sender of the socket is sending. Otherwise sends them as send_data_v() does.
+     *
+     * \param   hSocket     The stream socket, the caller holds its writer lock.
+     * \param   sender      The sender attached to the socket, nullptr if none.
+     * \param   ioBuffer    The buffers to send.
+     * \param   count       The number of buffers.
+     * \param   totalSize   The total size of the buffers, 0 to calculate.
+     * \param   owners      The messages the buffers point into, in any order. A buffer outside
+     *                      of them is always copied.
+     * \param   ownerCount  The number of entries of \a owners, the empty ones are skipped.
+     * \return  Returns the number of bytes written to the socket on success, negative on failure.
+     **/
+    static int32_t send_stream( SOCKETHANDLE hSocket, ZeroCopySender * sender, const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, const areg::RawBufferPtr * owners, uint32_t ownerCount ) noexcept;
+
+    /**
+     * \brief   Returns the number of the retired senders, which still keep messages.
+     **/
+    [[nodiscard]]
+    static uint32_t count_retired() noexcept;
+
+    /**
+     * \brief   Returns how many of the sends of a buffer are within the completed range. The ids
+     *          are compared by their distance from the first send of the buffer, so the ranges
+     *          crossing the wrap of the 32-bit ids are counted right.
+     *
+     * \param   first       The id of the first send of the buffer.
+     * \param   sends       The number of the sends of the buffer.
+     * \param   done        The range of the completed sends reported by the kernel.
+     **/
+    [[nodiscard]]
+    static uint32_t completed_sends( uint32_t first, uint32_t sends, const areg::ZeroCopyDone & done ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    ZeroCopySender() noexcept;
+
+    ~ZeroCopySender();
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the large buffers are sent without copying.
+     **/
+    [[nodiscard]]
+    inline bool is_sending() const noexcept;
+
+    /**
+     * \brief   Returns the socket the sender is attached to.
+     **/
+    [[nodiscard]]
+    inline SOCKETHANDLE socket() const noexcept;
+
+    /**
+     * \brief   Returns the size in bytes from which a buffer is sent without copying.
+     **/
+    [[nodiscard]]
+    inline uint32_t threshold() const noexcept;
+
+    /**
+     * \brief   Returns the bytes sent without copying, which the kernel released since the
+     *          last call, and resets the counter.
+     **/
+    inline uint64_t extract_saved() noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Attaches the sender to the connected socket and enables the zero-copy send of it.
+     *
+     * \param   hSocket     The stream socket of the connection.
+     * \param   links       The links of the connection object, the sender is attached in them.
+     * \param   threshold   The size in bytes from which a buffer is sent without copying.
+     * \return  Returns true if attached. Returns false if the threshold is 0, the socket has no
+     *          zero-copy send or another sender is attached to the socket.
+     **/
+    bool attach( SOCKETHANDLE hSocket, SocketLinkMap & links, uint32_t threshold );
+
+    /**
+     * \brief   Detaches the sender from the socket. The messages, which the kernel did not
+     *          release yet, are kept by a retired sender until it does. Call before closing the socket.
+     **/
+    void detach() noexcept;
+
+    /**
+     * \brief   Sends the buffers, the large ones without copying. Call while holding the writer lock.
+     *
+     * \param   ioBuffer    The buffers to send.
+     * \param   count       The number of buffers.
+     * \param   owners      The messages the buffers point into.
+     * \param   ownerCount  The number of entries of \a owners.
+     * \return  Returns the number of bytes written to the socket on success, negative on failure.
+     **/
+    int32_t send( const areg::IoBuffer * ioBuffer, uint32_t count, const areg::RawBufferPtr * owners, uint32_t ownerCount ) noexcept;
+
+    /**
+     * \brief   Reads the completions of the socket and releases the messages the kernel does not
+     *          use anymore, then the ones of the retired senders. Call while holding the writer lock.
+     *
+     * \param   timeoutMs   The time to wait for the first completion, 0 does not wait.
+     **/
+    void reap( uint32_t timeoutMs ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the message the buffer points into, nullptr if none of the owners has it.
+     **/
+    [[nodiscard]]
+    static const areg::RawBufferPtr * _owner_of( const areg::IoBuffer & buffer, const areg::RawBufferPtr * owners, uint32_t ownerCount ) noexcept;
+
+    /**
+     * \brief   Returns the first entry of the list of the retired senders.
+     **/
+    [[nodiscard]]
+    static std::atomic<ZeroCopySender *> & _retired() noexcept;
+
+    /**
+     * \brief   Reads the completions of the retired senders, the senders without pending
+     *          messages close their handle of the socket and are deleted.
+     **/
+    static void _drain_retired() noexcept;
+
+    /**
+     * \brief   Moves the pending messages to a new retired sender, which reads their completions
+     *          with another handle of the socket.
+     **/
+    void _retire() noexcept;
+
+    /**
+     * \brief   Reads the completions of the socket and releases the messages the kernel does not
+     *          use anymore.
+     **/
+    void _reap_completions( uint32_t timeoutMs ) noexcept;
+
+    /**
+     * \brief   Sends a large buffer without copying and keeps its message until the kernel
+     *          releases it. The part, which the kernel could not take without copying, is copied.
+     * \return  Returns the number of bytes written, negative on failure.
+     **/
+    int32_t _send_buffer( const areg::IoBuffer & buffer, const areg::RawBufferPtr & owner ) noexcept;
+
+    /**
+     * \brief   Marks the completed sends in the pending messages and releases the completed
+     *          messages from the front of the list.
+     **/
+    void _complete( const areg::ZeroCopyDone & done ) noexcept;
+
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The socket the sender is attached to.
+    SOCKETHANDLE                mSocket;
+    //!< The links of the connection object, which the sender is attached in.
+    SocketLinkMap *             mLinks;
+    //!< The size in bytes from which a buffer is sent without copying.
+    uint32_t                    mThreshold;
+    //!< The index of the oldest pending message.
+    uint32_t                    mHead;
+    //!< The number of the pending messages.
+    uint32_t                    mCount;
+    //!< The id of the next zero-copy send of the socket.
+    uint32_t                    mNextId;
+    //!< The next retired sender in the list, guarded by the lock of the list.
+    ZeroCopySender *            mNextRetired;
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< The ring of the pending messages, guarded by the writer lock.
+    std::unique_ptr<Pending[]>  mPending;
+    //!< True if the large buffers are sent without copying.
+    std::atomic_bool            mSending;
+    //!< The released bytes the kernel did not copy, not yet extracted.
+    std::atomic<uint64_t>       mSaved;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( ZeroCopySender );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// ZeroCopySender class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool ZeroCopySender::is_sending() const noexcept
+{
+    return mSending.load(std::memory_order_acquire);
+}
+
+inline SOCKETHANDLE ZeroCopySender::socket() const noexcept
+{
+    return mSocket;
+}
+
+inline uint32_t ZeroCopySender::threshold() const noexcept
+{
+    return mThreshold;
+}
+
+inline uint64_t ZeroCopySender::extract_saved() noexcept
+{
+    return mSaved.exchange(0u, std::memory_order_relaxed);
+}
+
+} // namespace areg
+
+#endif  // AREG_IPC_ZEROCOPYSENDER_HPP
@@ -26,6 +26,11 @@ ClientConnection::ClientConnection()
     , mSockSendBuf          ( areg::SOCKET_SEND_BUFFER_SIZE )
     , mSockRecvBuf          ( areg::SOCKET_RECV_BUFFER_SIZE )
     , mSockSendTimeoutMs    ( areg::SOCKET_SEND_TIMEOUT_MS )
+    , mSharedLink           ( )
+    , mDatagramSocket       ( areg::InvalidSocketHandle )
+    , mDatagramLink         ( )
+    , mCompact              ( )
+    , mZeroCopy             ( )
 {
 }
 
@@ -36,6 +41,11 @@ ClientConnection::ClientConnection(const String & hostName, uint16_t portNr)
     , mSockSendBuf          ( areg::SOCKET_SEND_BUFFER_SIZE )
     , mSockRecvBuf          ( areg::SOCKET_RECV_BUFFER_SIZE )
     , mSockSendTimeoutMs    ( areg::SOCKET_SEND_TIMEOUT_MS )
+    , mSharedLink           ( )
+    , mDatagramSocket       ( areg::InvalidSocketHandle )
+    , mDatagramLink         ( )
+    , mCompact              ( )
+    , mZeroCopy             ( )
 {
 }
 
@@ -46,9 +56,19 @@ ClientConnection::ClientConnection(const areg::SocketAddress & remoteAddress)
     , mSockSendBuf          ( areg::SOCKET_SEND_BUFFER_SIZE )
     , mSockRecvBuf          ( areg::SOCKET_RECV_BUFFER_SIZE )
     , mSockSendTimeoutMs    ( areg::SOCKET_SEND_TIMEOUT_MS )
+    , mSharedLink           ( )
+    , mDatagramSocket       ( areg::InvalidSocketHandle )
+    , mDatagramLink         ( )
+    , mCompact              ( )
+    , mZeroCopy             ( )
 {
 }
 
+ClientConnection::~ClientConnection()
+{
+    close_datagram();
+}
+
 
 bool ClientConnection::create_socket(const String & hostName, uint16_t portNr)
 {
@@ -59,6 +79,7 @@ bool ClientConnection::create_socket(const String & hostName, uint16_t portNr)
         areg::set_recv_size(mClientSocket.handle(), mSockRecvBuf);
         areg::set_send_timeout(mClientSocket.handle(), mSockSendTimeoutMs);
         areg::socket_set_no_delay(mClientSocket.handle());
+        mZeroCopy.attach(mClientSocket.handle(), links(), areg::zerocopy_threshold());
     }
 
     return mClientSocket.is_valid();
@@ -73,6 +94,7 @@ bool ClientConnection::create_socket()
         areg::set_recv_size(mClientSocket.handle(), mSockRecvBuf);
         areg::set_send_timeout(mClientSocket.handle(), mSockSendTimeoutMs);
         areg::socket_set_no_delay(mClientSocket.handle());
+        mZeroCopy.attach(mClientSocket.handle(), links(), areg::zerocopy_threshold());
     }
 
     return mClientSocket.is_valid();
@@ -94,7 +116,69 @@ bool ClientConnection::create_socket_fd()
 void ClientConnection::close_socket()
 {
     set_cookie(areg::COOKIE_UNKNOWN);
+    mSharedLink.detach();
+    mDatagramLink.detach();
+    mCompact.detach();
+    mZeroCopy.detach();
     mClientSocket.close();
 }
 
+bool ClientConnection::open_shared_memory( uint32_t sendSize, uint32_t recvSize )
+{
+    // The previous receive thread is stopped, the old channel can be unmapped.
+    mSharedLink.detach();
+    if (mSharedLink.create(sendSize, recvSize, mSockSendTimeoutMs) && mSharedLink.attach(mClientSocket.handle(), links()))
+        return true;
+
+    mSharedLink.release();
+    return false;
+}
+
+uint16_t ClientConnection::open_datagram()
+{
+    // The previous datagram thread is stopped, the old socket can be closed.
+    close_datagram();
+    mDatagramSocket = areg::datagram_socket_create(String(), 0u);
+    const uint16_t port{ areg::datagram_socket_port(mDatagramSocket) };
+    if (port == 0u)
+    {
+        close_datagram();
+    }
+
+    return port;
+}
+
+bool ClientConnection::confirm_datagram( uint16_t routerPort )
+{
+    areg::DatagramEndpoint peer{ };
+    if ( (routerPort != 0u) && areg::is_valid_socket(mDatagramSocket) &&
+         areg::datagram_endpoint(mClientSocket.address().host_address(), routerPort, peer) &&
+         mDatagramLink.attach(mClientSocket.handle(), links(), mDatagramSocket, peer) )
+    {
+        mDatagramLink.activate_send();
+        return true;
+    }
+
+    close_datagram();
+    return false;
+}
+
+void ClientConnection::close_datagram()
+{
+    mDatagramLink.detach();
+    if (areg::is_valid_socket(mDatagramSocket))
+    {
+        areg::socket_close(mDatagramSocket);
+        mDatagramSocket = areg::InvalidSocketHandle;
+    }
+}
+
+int32_t ClientConnection::receive_message( MessageEnvelope & out_message ) const
+{
+    if (mSharedLink.is_receiving() && (mSharedLink.wait_input(mClientSocket.handle()) == SharedMemoryLink::Input::Channel))
+        return mSharedLink.receive_message(out_message, mSockSendTimeoutMs);
+
+    return SocketConnectionBase::receive_message(out_message, mClientSocket);
+}
+
 } // namespace areg
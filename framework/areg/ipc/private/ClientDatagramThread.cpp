@@ -0,0 +1,124 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/private/ClientDatagramThread.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the thread receiving the datagrams of the router.
+ ************************************************************************/
+#include "areg/ipc/private/ClientDatagramThread.hpp"
+
+#include "areg/base/MessageEnvelope.hpp"
+#include "areg/base/SocketDefs.hpp"
+#include "areg/ipc/ClientConnection.hpp"
+#include "areg/ipc/DatagramLink.hpp"
+#include "areg/ipc/RemoteMessageHandler.hpp"
+#include "areg/ipc/private/ClientReceiveThread.hpp"
+#include "areg/ipc/private/ConnectionDefs.hpp"
+
+#include "areg/logging/areg_log.h"
+
+#include <vector>
+
+namespace areg {
+
+DEF_LOG_SCOPE(areg_ipc_private_ClientDatagramThread, on_run);
+
+ClientDatagramThread::ClientDatagramThread( RemoteMessageHandler & remoteService
+                                          , ClientConnection & connection
+                                          , ClientReceiveThread & recvStats
+                                          , const String & namePrefix )
+    : ThreadConsumer    ( )
+    , mRemoteService    ( remoteService )
+    , mConnection       ( connection )
+    , mRecvStats        ( recvStats )
+    , mStopped          ( false )
+    , mDatagramThread   ( static_cast<ThreadConsumer &>(self()), namePrefix + areg::CLIENT_DATAGRAM_THREAD )
+{
+}
+
+ClientDatagramThread::~ClientDatagramThread()
+{
+    stop();
+}
+
+bool ClientDatagramThread::start( uint16_t routerPort )
+{
+    ASSERT(mDatagramThread.is_running() == false);
+
+    if ( !mConnection.confirm_datagram(routerPort) )
+        return false;
+
+    mStopped.store(false, std::memory_order_release);
+    if ( !mDatagramThread.start(areg::WAIT_INFINITE) )
+    {
+        mConnection.close_datagram();
+        return false;
+    }
+
+    return true;
+}
+
+void ClientDatagramThread::stop()
+{
+    mStopped.store(true, std::memory_order_release);
+    mDatagramThread.shutdown(areg::WAIT_INFINITE);
+    mConnection.close_datagram();
+}
+
+void ClientDatagramThread::on_run()
+{
+    LOG_SCOPE(areg_ipc_private_ClientDatagramThread, on_run);
+
+    const SOCKETHANDLE hSocket{ mConnection.datagram_socket() };
+    DatagramLink & link{ mConnection.datagram_link() };
+    LOG_DBG("Receiving the datagrams of the router through the UDP socket [ %u ]", static_cast<uint32_t>(hSocket));
+
+    std::vector<uint8_t> buffer(static_cast<size_t>(DatagramLink::BATCH_SIZE) * DatagramLink::MAX_DATAGRAM_SIZE);
+    areg::DatagramIn datagrams[DatagramLink::BATCH_SIZE];
+    for (uint32_t i = 0u; i < DatagramLink::BATCH_SIZE; ++ i)
+    {
+        datagrams[i] = areg::DatagramIn{ buffer.data() + i * DatagramLink::MAX_DATAGRAM_SIZE, DatagramLink::MAX_DATAGRAM_SIZE, 0u, { 0u, 0u } };
+    }
+
+    MessageEnvelope msgReceived;
+    while (mStopped.load(std::memory_order_acquire) == false)
+    {
+        const int32_t count{ areg::datagram_receive(hSocket, datagrams, DatagramLink::BATCH_SIZE, RECEIVE_TIMEOUT) };
+        if (count < 0)
+            break;
+
+        for (int32_t i = 0; i < count; ++ i)
+        {
+            uint32_t sequence{ 0u };
+            const int32_t sizeReceived{ link.is_peer(datagrams[i].peer) ? DatagramLink::decode(datagrams[i], msgReceived, sequence) : 0 };
+            if (sizeReceived <= 0)
+                continue;
+
+            const int32_t lost{ link.accept_sequence(sequence) };
+            if (lost < 0)
+            {
+                // Late datagram, a newer value is already delivered.
+                mRecvStats.accumulate_lost(1u);
+            }
+            else
+            {
+                mRecvStats.accumulate_lost(static_cast<uint32_t>(lost));
+                mRecvStats.accumulate_received(static_cast<uint64_t>(sizeReceived), 1u);
+                mRemoteService.process_received_message(msgReceived, mConnection.socket());
+            }
+
+            msgReceived.invalidate();
+        }
+    }
+
+    LOG_DBG("Stopped receiving the datagrams of the router");
+}
+
+} // namespace areg
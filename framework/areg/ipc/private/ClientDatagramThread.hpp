@@ -0,0 +1,164 @@
+#ifndef AREG_IPC_PRIVATE_CLIENTDATAGRAMTHREAD_HPP
+#define AREG_IPC_PRIVATE_CLIENTDATAGRAMTHREAD_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/private/ClientDatagramThread.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the thread receiving the datagrams of the router.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/Thread.hpp"
+#include "areg/base/ThreadConsumer.hpp"
+
+#include <atomic>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+namespace areg {
+    class ClientConnection;
+    class ClientReceiveThread;
+    class RemoteMessageHandler;
+} // namespace areg
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// ClientDatagramThread class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Receives the droppable messages, which the router sends as UDP datagrams, see
+ *          DatagramLink, and passes them to the remote message handler as if they arrived
+ *          through the socket of the connection. The datagrams missing in the sequence of the
+ *          link and the late ones are counted as lost by the receive thread of the connection.
+ **/
+class ClientDatagramThread final    : private   ThreadConsumer
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The time in milliseconds to wait for the datagrams before checking the exit request.
+    static constexpr uint32_t   RECEIVE_TIMEOUT { 100u };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the thread of the client connection.
+     *
+     * \param   remoteService   The remote message handler to pass the received messages.
+     * \param   connection      The client connection, which owns the UDP socket and the link.
+     * \param   recvStats       The receive thread of the connection, which accumulates the data.
+     * \param   namePrefix      Prefix for thread name to ensure uniqueness.
+     **/
+    ClientDatagramThread( RemoteMessageHandler & remoteService
+                        , ClientConnection & connection
+                        , ClientReceiveThread & recvStats
+                        , const String & namePrefix );
+
+    ~ClientDatagramThread() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the thread runs.
+     **/
+    [[nodiscard]]
+    inline bool is_running() const noexcept;
+
+    /**
+     * \brief   Applies the answer of the router to the datagrams and, if the router accepted
+     *          them, starts receiving.
+     *
+     * \param   routerPort  The port of the UDP socket of the router, zero if it declined.
+     * \return  Returns true if the thread runs.
+     **/
+    bool start( uint16_t routerPort );
+
+    /**
+     * \brief   Stops the thread, waits for it to leave and closes the UDP socket.
+     **/
+    void stop();
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+private:
+/************************************************************************/
+// ThreadConsumer interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Receives the datagrams of the router until the thread is stopped.
+     **/
+    void on_run() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    inline ClientDatagramThread & self();
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The instance of remote service message handler.
+    RemoteMessageHandler &  mRemoteService;
+    //!< The client connection, which owns the UDP socket and the link.
+    ClientConnection &      mConnection;
+    //!< The receive thread of the connection, which accumulates the received data.
+    ClientReceiveThread &   mRecvStats;
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< Set when the thread should leave.
+    std::atomic_bool        mStopped;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+    //!< The receiving thread.
+    Thread                  mDatagramThread;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    ClientDatagramThread() = delete;
+    AREG_NOCOPY_NOMOVE( ClientDatagramThread );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// ClientDatagramThread class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool ClientDatagramThread::is_running() const noexcept
+{
+    return mDatagramThread.is_running();
+}
+
+inline ClientDatagramThread & ClientDatagramThread::self()
+{
+    return (*this);
+}
+
+} // namespace areg
+
+#endif  // AREG_IPC_PRIVATE_CLIENTDATAGRAMTHREAD_HPP
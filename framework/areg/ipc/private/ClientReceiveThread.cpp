@@ -55,6 +55,8 @@ bool ClientReceiveThread::run_dispatcher()
         return false;
     }
 
+    LOG_DBG("Client receive thread connected via [ %s ]", mConnection.is_local_connection() ? "local socket" : "TCP/IP");
+
     // Send connect handshake
     if ( mHandshakeMsg.is_valid() )
     {
@@ -75,6 +75,13 @@ public:
     [[nodiscard]]
     inline uint32_t extract_msgs_received() const noexcept;
 
+    /**
+     * \brief   Returns accumulative count of droppable messages lost on receiving and resets the existing
+     *          value to zero. The operations are atomic.
+     **/
+    [[nodiscard]]
+    inline uint32_t extract_msgs_lost() const noexcept;
+
     /**
      * \brief   Call to enable or disable the received data calculation. It also resets the existing
      *          calculated data.
@@ -99,6 +106,13 @@ public:
      **/
     inline void accumulate_received(uint64_t bytes, uint32_t msgs) noexcept;
 
+    /**
+     * \brief   Accumulates the count of droppable messages lost on receiving. Thread-safe: uses atomic add.
+     *
+     * \param   msgs    Number of lost messages.
+     **/
+    inline void accumulate_lost(uint32_t msgs) noexcept;
+
     /**
      * \brief   Sets the connection handshake message to send after the TCP
      *          connection is established. Must be called before start() returns.
@@ -165,6 +179,11 @@ inline uint32_t ClientReceiveThread::extract_msgs_received() const noexcept
     return mRecvStats.extract_msgs();
 }
 
+inline uint32_t ClientReceiveThread::extract_msgs_lost() const noexcept
+{
+    return mRecvStats.extract_lost();
+}
+
 inline void ClientReceiveThread::set_data_rate_enabled(bool enable) noexcept
 {
     mRecvStats.set_enabled(enable);
@@ -180,6 +199,11 @@ inline void ClientReceiveThread::accumulate_received(uint64_t bytes, uint32_t ms
     mRecvStats.accumulate(bytes, msgs);
 }
 
+inline void ClientReceiveThread::accumulate_lost(uint32_t msgs) noexcept
+{
+    mRecvStats.accumulate_lost(msgs);
+}
+
 inline void ClientReceiveThread::set_handshake(areg::MessageEnvelope msg)
 {
     mHandshakeMsg = std::move(msg);
@@ -25,6 +25,12 @@
 
 namespace areg {
 
+namespace
+{
+    //!< Queue checks between two reads of the clock while a batch waits.
+    constexpr uint32_t  FILL_CLOCK_CHECK    { 32u };
+}
+
 DEF_LOG_SCOPE(areg_ipc_private_ClientSendThread, report_producer_wait);
 
 ClientSendThread::ClientSendThread(RemoteMessageHandler& remoteService, ClientConnection & connection, const String& namePrefix )
@@ -39,7 +45,10 @@ ClientSendThread::ClientSendThread(RemoteMessageHandler& remoteService, ClientCo
     , mIsClosing        ( false )
     , mSendGate         ( )
     , mDrainLimit       ( areg::DEFAULT_DRAIN_LIMIT )
+    , mBatchWindow      ( )
 {
+    // start_event_processing() drains the queue behind the event, so the loop takes one event at a time.
+    set_dispatch_batch(1u);
 }
 
 void ClientSendThread::ready_for_events( bool is_ready )
@@ -49,7 +58,8 @@ void ClientSendThread::ready_for_events( bool is_ready )
         // The flag belongs to the connection this thread is about to serve, not to the
         // one it served before.
         mIsClosing.store(false, std::memory_order_relaxed);
-        mDrainLimit = areg::send_batch_limit();
+        mDrainLimit  = areg::send_batch_limit();
+        mBatchWindow.reset(areg::send_batch_wait(), std::chrono::steady_clock::now());
         areg::set_receive_mode(areg::ReceiveMode::MonoCache);
         DispatcherThread::ready_for_events( true );
     }
@@ -89,44 +99,31 @@ void ClientSendThread::start_event_processing( Event & eventElem )
 
     // Drain further queued events into the same batch (one OS send) via a single dequeue window.
     // The single-message ping-pong case drains nothing and touches no mDrain slot.
-    const uint32_t drained{ pop_events(mEvents, mDrainLimit - bufCount) };
-    for ( uint32_t k{ 0u }; k < drained; ++k, ++bufCount )
-    {
-        Event& evt{ mEvents[k] };
-        if ( evt.is_exit_prio() )
-        {
-            for ( uint32_t i{ 1u }; i < bufCount; ++i )
-                mDrain[i].reset();
-
-            mSendGate.leave(bufCount);
-            mConnection.close_socket();
-            trigger_exit();
-            return;
-        }
-
-        areg::EventHeader * hdr{ evt.header() };
-        ASSERT( hdr != nullptr );
-        hdr->internal1 = 0u;
-        hdr->internal2 = 0u;
-        hdr->custom    = 0u;
-        evt.envelope().buffer_completion_fix(); // compute checksum now; zeroed fields are not covered by checksum
+    const std::chrono::steady_clock::time_point batchBegin{ mBatchWindow.is_enabled() ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{ } };
+    if ( !_append_events(pop_events(mEvents, mDrainLimit - bufCount), bufCount, totalSize) )
+        return;
 
-        const uint32_t wireSize{ static_cast<uint32_t>(sizeof(areg::EventHeader)) + hdr->bufHeader.biUsed };
-        mIoBuffer[bufCount] = { reinterpret_cast<const uint8_t*>(hdr), wireSize };
-        totalSize += wireSize;
-        mDrain[bufCount] = evt.envelope().share_buffer();  // retain buffer; raw pointer hdr stays valid through writev
-        evt.destroy_event();                               // release the mEvents slot; mDrain keeps the buffer alive
-    }
+    if ( mBatchWindow.is_enabled() && !_fill_batch(batchBegin, bufCount, totalSize) )
+        return;
 
     // Single writer per socket: the whole batch below must reach the wire uninterrupted.
     areg::SocketWriteGuard writeGuard{ mConnection.socket().handle() };
 
+    // The zero-copy send keeps the large messages until the kernel releases them: it needs the
+    // owners of all buffers, slot 0 included, which otherwise stays empty.
+    const areg::RawBufferPtr * owners{ nullptr };
+    if ( mConnection.is_zerocopy() )
+    {
+        mDrain[0] = eventElem.envelope().share_buffer();
+        owners    = mDrain;
+    }
+
     if ( totalSize <= areg::MAX_SEND_BATCH_BYTES )
     {
         int32_t sentBytes{ 0 };
         {
             AREG_LT_SCOPE(areg::LtStage::SendSyscall);  // isolates the raw send()/writev syscall cost
-            sentBytes = mConnection.send_messages_batch(mIoBuffer, bufCount, static_cast<uint32_t>(totalSize) );
+            sentBytes = mConnection.send_messages_batch(mIoBuffer, bufCount, static_cast<uint32_t>(totalSize), owners, bufCount );
         }
 
         if ( sentBytes > 0 )
@@ -149,7 +146,7 @@ void ClientSendThread::start_event_processing( Event & eventElem )
             int32_t sentBytes{ 0 };
             {
                 AREG_LT_SCOPE(areg::LtStage::SendSyscall);
-                sentBytes = mConnection.send_messages_batch(mIoBuffer + start, end - start, batchBytes );
+                sentBytes = mConnection.send_messages_batch(mIoBuffer + start, end - start, batchBytes, owners, bufCount );
             }
 
             if ( sentBytes > 0 )
@@ -165,6 +162,12 @@ void ClientSendThread::start_event_processing( Event & eventElem )
     for ( uint32_t i{ 1u }; i < bufCount; ++i )
         mDrain[i].reset();
 
+    if ( owners != nullptr )
+    {
+        mDrain[0].reset();
+        mSendStats.accumulate_zerocopy( mConnection.extract_zerocopy_saved() );
+    }
+
     // The gate opens only after the write, never before it.
     mSendGate.leave(bufCount);
 
@@ -176,6 +179,66 @@ void ClientSendThread::start_event_processing( Event & eventElem )
     }
 }
 
+bool ClientSendThread::_append_events( uint32_t count, uint32_t & bufCount, uint64_t & totalSize )
+{
+    for ( uint32_t k{ 0u }; k < count; ++k, ++bufCount )
+    {
+        Event& evt{ mEvents[k] };
+        if ( evt.is_exit_prio() )
+        {
+            for ( uint32_t i{ 1u }; i < bufCount; ++i )
+                mDrain[i].reset();
+
+            mSendGate.leave(bufCount);
+            mConnection.close_socket();
+            trigger_exit();
+            return false;
+        }
+
+        areg::EventHeader * hdr{ evt.header() };
+        ASSERT( hdr != nullptr );
+        hdr->internal1 = 0u;
+        hdr->internal2 = 0u;
+        hdr->custom    = 0u;
+        evt.envelope().buffer_completion_fix(); // compute checksum now; zeroed fields are not covered by checksum
+
+        const uint32_t wireSize{ static_cast<uint32_t>(sizeof(areg::EventHeader)) + hdr->bufHeader.biUsed };
+        mIoBuffer[bufCount] = { reinterpret_cast<const uint8_t*>(hdr), wireSize };
+        totalSize += wireSize;
+        mDrain[bufCount] = evt.envelope().share_buffer();  // retain buffer; raw pointer hdr stays valid through writev
+        evt.destroy_event();                               // release the mEvents slot; mDrain keeps the buffer alive
+    }
+
+    return true;
+}
+
+bool ClientSendThread::_fill_batch( const std::chrono::steady_clock::time_point & batchBegin, uint32_t & bufCount, uint64_t & totalSize )
+{
+    if ( !mBatchWindow.begin(batchBegin, bufCount) )
+        return true;
+
+    while ( (bufCount < mDrainLimit) && (totalSize < areg::MAX_SEND_BATCH_BYTES) )
+    {
+        uint32_t taken{ 0u };
+        for ( uint32_t i{ 0u }; (i < FILL_CLOCK_CHECK) && (taken == 0u); ++i )
+        {
+            Thread::cpu_pause();
+            if ( has_more_events() )
+            {
+                taken = pop_events(mEvents, mDrainLimit - bufCount);
+            }
+        }
+
+        if ( !_append_events(taken, bufCount, totalSize) )
+            return false;
+
+        if ( mBatchWindow.is_over(std::chrono::steady_clock::now(), taken != 0u) )
+            break;
+    }
+
+    return true;
+}
+
 void ClientSendThread::report_failed_send(const areg::MessageEnvelope & msgFailed, areg::Socket & whichTarget)
 {
     if ( mIsClosing.load(std::memory_order_relaxed) == false )
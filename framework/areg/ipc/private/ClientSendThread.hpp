@@ -24,8 +24,10 @@
 #include "areg/component/EventConsumer.hpp"
 #include "areg/ipc/DataRateStats.hpp"
 #include "areg/ipc/private/ConnectionDefs.hpp"
+#include "areg/ipc/private/SendBatchWindow.hpp"
 
 #include <atomic>
+#include <chrono>
 
 /************************************************************************
  * Dependencies
@@ -78,6 +80,28 @@ public:
     [[nodiscard]]
     inline uint32_t extract_msgs_sent() const noexcept;
 
+    /**
+     * \brief   Returns accumulative count of droppable messages lost on sending and resets the existing
+     *          value to zero. The operations are atomic.
+     **/
+    [[nodiscard]]
+    inline uint32_t extract_msgs_lost() const noexcept;
+
+    /**
+     * \brief   Returns accumulative count of the system calls that wrote the sent messages and
+     *          resets the existing value to zero. Together with extract_msgs_sent() it gives
+     *          the messages per system call. The operations are atomic.
+     **/
+    [[nodiscard]]
+    inline uint32_t extract_send_calls() const noexcept;
+
+    /**
+     * \brief   Returns accumulative count of the bytes the kernel sent without copying them from
+     *          the messages, see ZeroCopySender, and resets the existing value to zero.
+     **/
+    [[nodiscard]]
+    inline uint64_t extract_zerocopy_saved() const noexcept;
+
     /**
      * \brief   Call to enable or disable the received data calculation. It also resets the existing
      *          calculated data.
@@ -99,6 +123,13 @@ public:
      **/
     inline void accumulate_sent(uint64_t bytes, uint32_t msgs) noexcept;
 
+    /**
+     * \brief   Accumulates the count of droppable messages lost on sending. Thread-safe: uses atomic add.
+     *
+     * \param   msgs    Number of lost messages.
+     **/
+    inline void accumulate_lost(uint32_t msgs) noexcept;
+
     /**
      * \brief   Tells the thread that the connection is being closed on purpose, so a
      *          send that fails from here on is expected and must not be reported.
@@ -178,6 +209,33 @@ private:
      **/
     void start_event_processing( Event & eventElem ) final;
 
+/************************************************************************/
+// Hidden methods
+/************************************************************************/
+
+    /**
+     * \brief   Appends the first \a count events of mEvents to the batch. Stops at an exit
+     *          event, releases the batch, closes the socket and triggers the exit.
+     *
+     * \param       count       The number of events taken into mEvents.
+     * \param[in,out] bufCount  The number of messages in the batch.
+     * \param[in,out] totalSize The size of the batch in bytes.
+     * \return  Returns false if the thread is exiting and the batch must not be sent.
+     **/
+    bool _append_events( uint32_t count, uint32_t & bufCount, uint64_t & totalSize );
+
+    /**
+     * \brief   Waits up to the latency budget for more messages to fill the batch, if the
+     *          messages arrive often enough to fill it. Gives up once the batch is full, or
+     *          when no message arrives for a few arrival intervals, see SendBatchWindow.
+     *
+     * \param   batchBegin      The time the batch started.
+     * \param[in,out] bufCount  The number of messages in the batch.
+     * \param[in,out] totalSize The size of the batch in bytes.
+     * \return  Returns false if the thread is exiting and the batch must not be sent.
+     **/
+    bool _fill_batch( const std::chrono::steady_clock::time_point & batchBegin, uint32_t & bufCount, uint64_t & totalSize );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -222,6 +280,11 @@ private:
      *          1 .. areg::DEFAULT_DRAIN_LIMIT. Resolved when the thread becomes ready.
      **/
     uint32_t                        mDrainLimit;
+    /**
+     * \brief   Decides how long a batch waits for more messages. Without the latency budget a
+     *          batch is written at once. The budget is resolved when the thread becomes ready.
+     **/
+    SendBatchWindow                 mBatchWindow;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -245,6 +308,21 @@ inline uint32_t ClientSendThread::extract_msgs_sent() const noexcept
     return mSendStats.extract_msgs();
 }
 
+inline uint32_t ClientSendThread::extract_msgs_lost() const noexcept
+{
+    return mSendStats.extract_lost();
+}
+
+inline uint32_t ClientSendThread::extract_send_calls() const noexcept
+{
+    return mSendStats.extract_calls();
+}
+
+inline uint64_t ClientSendThread::extract_zerocopy_saved() const noexcept
+{
+    return mSendStats.extract_zerocopy();
+}
+
 inline void ClientSendThread::set_data_rate_enabled(bool enable) noexcept
 {
     mSendStats.set_enabled(enable);
@@ -265,6 +343,11 @@ inline void ClientSendThread::accumulate_sent(uint64_t bytes, uint32_t msgs) noe
     mSendStats.accumulate(bytes, msgs);
 }
 
+inline void ClientSendThread::accumulate_lost(uint32_t msgs) noexcept
+{
+    mSendStats.accumulate_lost(msgs);
+}
+
 inline areg::SendQueueGate & ClientSendThread::send_gate() noexcept
 {
     return mSendGate;
@@ -0,0 +1,286 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/private/CompactFraming.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the compact message framing of a stream connection.
+ ************************************************************************/
+#include "areg/ipc/CompactFraming.hpp"
+#include "areg/ipc/SocketLinkMap.hpp"
+#include "areg/ipc/ZeroCopySender.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace
+{
+    /**
+     * \brief   The frames a thread encodes for one send.
+     **/
+    struct FrameScratch
+    {
+        areg::CompactFraming::Frame frames[areg::DEFAULT_DRAIN_LIMIT];
+        areg::IoBuffer              buffers[2u * areg::DEFAULT_DRAIN_LIMIT];
+    };
+
+    /**
+     * \brief   Returns the frames of the calling thread, allocated by the first send of the
+     *          thread, which uses the compact framing. Returns nullptr if out of memory.
+     **/
+    FrameScratch * _frame_scratch() noexcept
+    {
+        static thread_local std::unique_ptr<FrameScratch> _scratch;
+        if (_scratch == nullptr)
+        {
+            _scratch.reset(new(std::nothrow) FrameScratch);
+        }
+
+        return _scratch.get();
+    }
+}
+
+namespace areg {
+
+int32_t CompactFraming::send_stream( SOCKETHANDLE hSocket, const SocketLinks & links, const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, bool tryOnly, const areg::RawBufferPtr * owners /*= nullptr*/, uint32_t ownerCount /*= 0u*/ ) noexcept
+{
+    CompactFraming * framing{ links.slFraming };
+    FrameScratch * scratch{ (framing != nullptr) && framing->is_sending() && (count <= areg::DEFAULT_DRAIN_LIMIT) ? _frame_scratch() : nullptr };
+    if (scratch != nullptr)
+    {
+        uint32_t wireSize{ 0u };
+        const uint32_t encoded{ framing->encode(ioBuffer, count, tryOnly, scratch->frames, scratch->buffers, wireSize) };
+        ioBuffer  = scratch->buffers;
+        count     = encoded;
+        totalSize = wireSize;
+    }
+
+    // The frames are in the scratch of the thread, which is reused: they are always copied,
+    // the large payloads they refer to are in the messages and may be sent without a copy.
+    if (tryOnly)
+        return areg::try_send_data_v(hSocket, ioBuffer, count, totalSize);
+    else if (owners != nullptr)
+        return ZeroCopySender::send_stream(hSocket, links.slZeroCopy, ioBuffer, count, totalSize, owners, ownerCount);
+    else
+        return areg::send_data_v(hSocket, ioBuffer, count, totalSize);
+}
+
+void CompactFraming::encode_groups( areg::IoGroup * groups, CompactFraming * const * framings, uint32_t count ) noexcept
+{
+    FrameScratch * scratch{ nullptr };
+    uint32_t frames{ 0u };
+    uint32_t buffers{ 0u };
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        areg::IoGroup & group{ groups[i] };
+        CompactFraming * framing{ framings[i] };
+        if ((framing == nullptr) || (framing->is_sending() == false) || (group.count > (areg::DEFAULT_DRAIN_LIMIT - frames)))
+            continue;
+
+        scratch = (scratch != nullptr ? scratch : _frame_scratch());
+        if (scratch == nullptr)
+            return;
+
+        // A frame per message and at most two buffers per frame, both stay within the scratch.
+        uint32_t wireSize{ 0u };
+        const uint32_t encoded{ framing->encode(group.buffers, group.count, false, scratch->frames + frames, scratch->buffers + buffers, wireSize) };
+        frames         += group.count;
+        group.buffers   = scratch->buffers + buffers;
+        group.count     = encoded;
+        group.totalSize = wireSize;
+        buffers        += encoded;
+    }
+}
+
+uint32_t CompactFraming::_session_slot( const areg::CompactSession & session ) noexcept
+{
+    constexpr uint32_t WORDS{ static_cast<uint32_t>(sizeof(areg::CompactSession) / sizeof(uint32_t)) };
+    uint32_t words[WORDS];
+    std::memcpy(words, &session, sizeof(areg::CompactSession));
+
+    // FNV-1a over the words, the top bits of the golden-ratio product pick the slot.
+    uint32_t hash{ 2166136261u };
+    for (uint32_t word : words)
+    {
+        hash = (hash ^ word) * 16777619u;
+    }
+
+    static_assert(SESSION_SLOTS == 256u, "The slot is the top 8 bits of the hash");
+    return ((hash * 0x9E37'79B1u) >> 24);
+}
+
+CompactFraming::CompactFraming() noexcept
+    : mSocket   ( areg::InvalidSocketHandle )
+    , mLinks    ( nullptr )
+    , mSent     ( )
+    , mReceived ( )
+    , mSending  ( false )
+{
+}
+
+CompactFraming::~CompactFraming()
+{
+    detach();
+}
+
+bool CompactFraming::attach( SOCKETHANDLE hSocket, SocketLinkMap & links )
+{
+    detach();
+    if (areg::is_valid_socket(hSocket) == false)
+        return false;
+
+    if (mSent == nullptr)
+    {
+        mSent       = std::make_unique<Session[]>(SESSION_SLOTS);
+        mReceived   = std::make_unique<Session[]>(SESSION_SLOTS);
+    }
+    else
+    {
+        areg::mem_zero(mSent.get(), static_cast<uint32_t>(SESSION_SLOTS * sizeof(Session)));
+        areg::mem_zero(mReceived.get(), static_cast<uint32_t>(SESSION_SLOTS * sizeof(Session)));
+    }
+
+    if (links.attach(hSocket, *this) == false)
+        return false;
+
+    mSocket = hSocket;
+    mLinks  = &links;
+    return true;
+}
+
+void CompactFraming::detach() noexcept
+{
+    mSending.store(false, std::memory_order_release);
+
+    if (mSocket != areg::InvalidSocketHandle)
+    {
+        mLinks->detach(mSocket, *this);
+        mLinks = nullptr;
+
+        // The senders encode while holding the writer lock: once it is taken here, no sender
+        // uses the dictionary of the sent sessions anymore.
+        SocketWriter & writer{ SocketWriter::writer_of(mSocket) };
+        if (writer.is_owner() == false)
+        {
+            writer.acquire();
+            writer.release();
+        }
+
+        mSocket = areg::InvalidSocketHandle;
+    }
+}
+
+uint32_t CompactFraming::encode( const areg::IoBuffer * ioBuffer, uint32_t count, bool tryOnly, Frame * frames, areg::IoBuffer * encoded, uint32_t & wireSize ) noexcept
+{
+    constexpr uint32_t FULL_HEADER{ static_cast<uint32_t>(sizeof(areg::EventHeader)) };
+    constexpr uint32_t SESSION_OFFSET{ static_cast<uint32_t>(offsetof(areg::EventHeader, target)) };
+
+    uint32_t result{ 0u };
+    wireSize = 0u;
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        const areg::IoBuffer & message{ ioBuffer[i] };
+        const areg::EventHeader * hdr{ (message.size >= FULL_HEADER) && (mSent != nullptr) ? reinterpret_cast<const areg::EventHeader *>(message.data) : nullptr };
+        if ((hdr == nullptr) || (hdr->bufHeader.biOffset != FULL_HEADER) || (message.size != (FULL_HEADER + hdr->bufHeader.biUsed)))
+        {
+            encoded[result ++] = message;
+            wireSize += static_cast<uint32_t>(message.size);
+            continue;
+        }
+
+        areg::CompactSession session{ };
+        std::memcpy(&session, message.data + SESSION_OFFSET, sizeof(areg::CompactSession));
+        const uint32_t slot{ CompactFraming::_session_slot(session) };
+        Session & entry{ mSent[slot] };
+        const bool known{ (entry.defined != 0u) && areg::mem_equal(&entry.session, &session, sizeof(areg::CompactSession)) };
+        if ((known == false) && tryOnly)
+        {
+            encoded[result ++] = message;
+            wireSize += static_cast<uint32_t>(message.size);
+            continue;
+        }
+
+        areg::CompactHeader header{ };
+        header.frame        = areg::COMPACT_FRAME_TAG | (known ? 0u : areg::COMPACT_FLAG_DEFINE) | slot;
+        header.used         = hdr->bufHeader.biUsed;
+        header.sequenceNr   = hdr->sequenceNr;
+        header.messageId    = hdr->messageId;
+        header.result       = hdr->result;
+        header.checksum     = hdr->checksum;
+        header.eventId      = hdr->eventId;
+        header.eventType    = hdr->eventType;
+        header.callType     = hdr->callType;
+        header.priority     = hdr->priority;
+        header.bufType      = hdr->bufHeader.biBufType;
+
+        uint8_t * bytes{ frames[i].bytes };
+        uint32_t length{ static_cast<uint32_t>(sizeof(areg::CompactHeader)) };
+        std::memcpy(bytes, &header, sizeof(areg::CompactHeader));
+        if (known == false)
+        {
+            entry.session = session;
+            entry.defined = 1u;
+            std::memcpy(bytes + length, &session, sizeof(areg::CompactSession));
+            length += static_cast<uint32_t>(sizeof(areg::CompactSession));
+        }
+
+        const uint8_t * payload{ message.data + FULL_HEADER };
+        if (header.used <= INLINE_PAYLOAD)
+        {
+            std::memcpy(bytes + length, payload, header.used);
+            length += header.used;
+            encoded[result ++] = areg::IoBuffer{ bytes, length };
+            wireSize += length;
+        }
+        else
+        {
+            encoded[result ++] = areg::IoBuffer{ bytes, length };
+            encoded[result ++] = areg::IoBuffer{ payload, header.used };
+            wireSize += length + header.used;
+        }
+    }
+
+    return result;
+}
+
+bool CompactFraming::restore( const areg::CompactHeader & header, const areg::CompactSession * define, areg::EventHeader & evtHeader ) noexcept
+{
+    const uint32_t slot{ header.frame & areg::COMPACT_SLOT_MASK };
+    if ((slot >= SESSION_SLOTS) || (mReceived == nullptr))
+        return false;
+
+    Session & entry{ mReceived[slot] };
+    if (define != nullptr)
+    {
+        entry.session = *define;
+        entry.defined = 1u;
+    }
+    else if (entry.defined == 0u)
+    {
+        return false;
+    }
+
+    evtHeader = areg::EventHeader{ };
+    evtHeader.bufHeader.biLength    = static_cast<uint32_t>(sizeof(areg::EventHeader)) + header.used;
+    evtHeader.bufHeader.biOffset    = static_cast<uint32_t>(sizeof(areg::EventHeader));
+    evtHeader.bufHeader.biBufType   = header.bufType;
+    evtHeader.bufHeader.biUsed      = header.used;
+    std::memcpy(reinterpret_cast<uint8_t *>(&evtHeader) + offsetof(areg::EventHeader, target), &entry.session, sizeof(areg::CompactSession));
+    evtHeader.messageId             = header.messageId;
+    evtHeader.sequenceNr            = header.sequenceNr;
+    evtHeader.result                = header.result;
+    evtHeader.eventType             = header.eventType;
+    evtHeader.callType              = header.callType;
+    evtHeader.priority              = header.priority;
+    evtHeader.checksum              = header.checksum;
+    evtHeader.eventId               = header.eventId;
+    return true;
+}
+
+} // namespace areg
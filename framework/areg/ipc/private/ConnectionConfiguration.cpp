@@ -62,6 +62,18 @@ bool ConnectionConfiguration::connection_enable_flag() const
     return Application::config_manager().remote_service_enable(mServiceName, mConnectType);
 }
 
+bool ConnectionConfiguration::is_connection_listed() const
+{
+    const std::vector<Identifier> list{ Application::config_manager().remote_service_connections(mServiceName) };
+    for (const Identifier & entry : list)
+    {
+        if (entry.name() == mConnectType)
+            return true;
+    }
+
+    return false;
+}
+
 void ConnectionConfiguration::set_connection_enable(bool is_enabled)
 {
     Application::config_manager().set_service_enable(mServiceName, mConnectType, is_enabled);
@@ -97,6 +109,11 @@ uint32_t ConnectionConfiguration::pool_pairs() const noexcept
     return Application::config_manager().network_pool_pairs(areg::EmptyStringA, mConnectType);
 }
 
+bool ConnectionConfiguration::compact_header() const noexcept
+{
+    return Application::config_manager().network_compact(areg::EmptyStringA, mConnectType);
+}
+
 uint32_t ConnectionConfiguration::socket_send_timeout() const noexcept
 {
     return Application::config_manager().network_timeout(areg::EmptyStringA, mConnectType);
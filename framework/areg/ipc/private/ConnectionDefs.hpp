@@ -48,6 +48,11 @@ namespace areg {
      *          Fixed name of client message dispatcher thread
      **/
     constexpr std::string_view  CLIENT_DISPATCH_MESSAGE_THREAD  { "CLIENT_DISPATCH_MESSAGE_THREAD" };
+    /**
+     * \brief   areg::CLIENT_DATAGRAM_THREAD
+     *          Fixed name of client thread receiving the datagrams
+     **/
+    constexpr std::string_view  CLIENT_DATAGRAM_THREAD          { "CLIENT_DATAGRAM_THREAD" };
     /**
      * \brief   areg::SERVER_SEND_MESSAGE_THREAD
      *          Fixed name of server message sender thread
@@ -63,6 +68,11 @@ namespace areg {
      *          Fixed name of server message dispatcher thread
      **/
     constexpr std::string_view  SERVER_DISPATCH_MESSAGE_THREAD  { "SERVER_DISPATCH_MESSAGE_THREAD" };
+    /**
+     * \brief   areg::SERVER_DATAGRAM_THREAD
+     *          Fixed name of server thread receiving the datagrams
+     **/
+    constexpr std::string_view  SERVER_DATAGRAM_THREAD          { "SERVER_DATAGRAM_THREAD" };
     /**
      * \brief   areg::CLIENT_CONNECT_TIMER_NAME
      *          Fixed name of client connection retry timer name
@@ -0,0 +1,210 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/private/DatagramLink.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the best-effort datagram path of a TCP connection.
+ ************************************************************************/
+#include "areg/ipc/DatagramLink.hpp"
+
+#include "areg/base/MemoryDefs.hpp"
+#include "areg/base/MessageEnvelope.hpp"
+#include "areg/ipc/CompactFraming.hpp"
+#include "areg/ipc/SocketLinkMap.hpp"
+#include "areg/component/EventDefs.hpp"
+
+#include <cstring>
+
+namespace areg {
+
+bool DatagramLink::is_datagram( const areg::IoBuffer & message ) noexcept
+{
+    if ((message.size < sizeof(areg::EventHeader)) || (message.size > MAX_MESSAGE_SIZE))
+        return false;
+
+    const areg::EventHeader * hdr{ reinterpret_cast<const areg::EventHeader *>(message.data) };
+    return areg::is_droppable(hdr->eventType, hdr->callType) && ((sizeof(areg::EventHeader) + hdr->bufHeader.biUsed) == message.size);
+}
+
+int32_t DatagramLink::decode( const areg::DatagramIn & datagram, MessageEnvelope & message, uint32_t & sequence )
+{
+    constexpr uint32_t minSize{ static_cast<uint32_t>(sizeof(Prefix) + sizeof(areg::EventHeader)) };
+    if ((datagram.size < minSize) || (datagram.size > MAX_DATAGRAM_SIZE))
+        return 0;
+
+    Prefix prefix{ };
+    areg::EventHeader evtHeader{ };
+    std::memcpy(&prefix, datagram.data, sizeof(Prefix));
+    std::memcpy(&evtHeader, datagram.data + sizeof(Prefix), sizeof(areg::EventHeader));
+    if ((prefix.magic != DATAGRAM_MAGIC) || (evtHeader.bufHeader.biUsed != (datagram.size - minSize)))
+        return 0;
+
+    // Only the droppable messages may skip the stream.
+    if (areg::is_droppable(evtHeader.eventType, evtHeader.callType) == false)
+        return 0;
+
+    uint8_t * buffer = message.init_envelope(evtHeader, evtHeader.bufHeader.biUsed);
+    if (buffer == nullptr)
+        return 0;
+
+    if (evtHeader.bufHeader.biUsed != 0u)
+    {
+        std::memcpy(buffer, datagram.data + minSize, evtHeader.bufHeader.biUsed);
+        message.set_size_used(evtHeader.bufHeader.biUsed);
+    }
+
+    message.move_to_begin();
+    sequence = prefix.sequence;
+    return (message.is_checksum_valid() ? static_cast<int32_t>(datagram.size - sizeof(Prefix)) : 0);
+}
+
+DatagramLink::DatagramLink() noexcept
+    : mSocket       ( areg::InvalidSocketHandle )
+    , mLinks        ( nullptr )
+    , mDatagram     ( areg::InvalidSocketHandle )
+    , mPeer         { 0u, 0u }
+    , mSendSequence ( 0u )
+    , mRecvSequence ( 0u )
+    , mRecvStarted  ( false )
+    , mSending      ( false )
+{
+}
+
+DatagramLink::~DatagramLink()
+{
+    detach();
+}
+
+bool DatagramLink::attach( SOCKETHANDLE hSocket, SocketLinkMap & links, SOCKETHANDLE hDatagram, const areg::DatagramEndpoint & peer )
+{
+    detach();
+    if ((areg::is_valid_socket(hSocket) == false) || (areg::is_valid_socket(hDatagram) == false) || (peer.port == 0u))
+        return false;
+
+    if (links.attach(hSocket, *this) == false)
+        return false;
+
+    mDatagram       = hDatagram;
+    mPeer           = peer;
+    mSendSequence   = 0u;
+    mRecvSequence   = 0u;
+    mRecvStarted    = false;
+    mSocket         = hSocket;
+    mLinks          = &links;
+    return true;
+}
+
+void DatagramLink::detach() noexcept
+{
+    mSending.store(false, std::memory_order_release);
+
+    if (mSocket != areg::InvalidSocketHandle)
+    {
+        mLinks->detach(mSocket, *this);
+        mLinks = nullptr;
+
+        // A sender holds the writer lock while it uses the link: once the lock is taken here,
+        // every sender either left the link or finds no link anymore.
+        SocketWriter & writer{ SocketWriter::writer_of(mSocket) };
+        if (writer.is_owner() == false)
+        {
+            writer.acquire();
+            writer.release();
+        }
+
+        mSocket = areg::InvalidSocketHandle;
+    }
+
+    mDatagram = areg::InvalidSocketHandle;
+}
+
+int32_t DatagramLink::accept_sequence( uint32_t sequence ) noexcept
+{
+    if (mRecvStarted == false)
+    {
+        // The first datagram received, whatever was sent before is not known as lost.
+        mRecvStarted    = true;
+        mRecvSequence   = sequence + 1u;
+        return 0;
+    }
+
+    const int32_t distance{ static_cast<int32_t>(sequence - mRecvSequence) };
+    if (distance < 0)
+        return -1;
+
+    mRecvSequence = sequence + 1u;
+    return distance;
+}
+
+int32_t DatagramLink::_send( const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, const SocketLinks & links, bool tryOnly ) noexcept
+{
+    uint32_t datagrams{ 0u };
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        datagrams += DatagramLink::is_datagram(ioBuffer[i]) ? 1u : 0u;
+    }
+
+    // No datagrams, or a partial send is not allowed: keep all on the stream.
+    if ((datagrams == 0u) || (tryOnly && (datagrams != count)) || (count > areg::DEFAULT_DRAIN_LIMIT))
+    {
+        return CompactFraming::send_stream(mSocket, links, ioBuffer, count, totalSize, tryOnly);
+    }
+
+    areg::IoBuffer stream[areg::DEFAULT_DRAIN_LIMIT];
+    uint32_t streamCount{ 0u };
+    uint32_t streamSize{ 0u };
+
+    Prefix prefix[BATCH_SIZE];
+    areg::DatagramOut batch[BATCH_SIZE];
+    uint32_t batchCount{ 0u };
+    uint32_t datagramSize{ 0u };
+
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        const areg::IoBuffer & message{ ioBuffer[i] };
+        if (DatagramLink::is_datagram(message) == false)
+        {
+            stream[streamCount ++] = message;
+            streamSize += static_cast<uint32_t>(message.size);
+            continue;
+        }
+
+        prefix[batchCount] = Prefix{ DATAGRAM_MAGIC, mSendSequence ++ };
+        areg::DatagramOut & datagram{ batch[batchCount ++] };
+        datagram.parts[0]   = areg::IoBuffer{ reinterpret_cast<const uint8_t *>(&prefix[batchCount - 1u]), sizeof(Prefix) };
+        datagram.parts[1]   = message;
+        datagram.peer       = mPeer;
+        datagramSize       += static_cast<uint32_t>(message.size);
+
+        if (batchCount == BATCH_SIZE)
+        {
+            // Best effort: the datagrams refused by the full send buffer are lost.
+            static_cast<void>(areg::datagram_send(mDatagram, batch, batchCount));
+            batchCount = 0u;
+        }
+    }
+
+    int32_t result{ 0 };
+    if (streamCount != 0u)
+    {
+        result = CompactFraming::send_stream(mSocket, links, stream, streamCount, streamSize, false);
+        if (result < 0)
+            return result;
+    }
+
+    if (batchCount != 0u)
+    {
+        static_cast<void>(areg::datagram_send(mDatagram, batch, batchCount));
+    }
+
+    return (result + static_cast<int32_t>(datagramSize));
+}
+
+} // namespace areg
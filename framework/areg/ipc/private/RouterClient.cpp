@@ -361,6 +361,8 @@ void RouterClient::process_received_message( MessageEnvelope & msgReceived, Sock
     case areg::FuncIdRange::ServiceSaveLogConfiguration:      // fall through
     case areg::FuncIdRange::ServiceLogConfigurationSaved:     // fall through
     case areg::FuncIdRange::ServiceLogMessage:                // fall through
+    case areg::FuncIdRange::ServiceLogRecordFormat:           // fall through
+    case areg::FuncIdRange::ServiceLogCompactMessage:         // fall through
         break;
 
     case areg::FuncIdRange::AttributeLastId:          // fall through
@@ -374,10 +376,20 @@ void RouterClient::process_received_message( MessageEnvelope & msgReceived, Sock
     {
         if ( areg::is_executable_id(static_cast<uint32_t>(msgId)) )
         {
-            // Route directly on the receive thread
+            // Route directly on the receive thread. The routing takes the message over.
+            const areg::EventHeader * hdr{ msgReceived.header() };
+            const bool droppable{ (hdr != nullptr) && areg::is_droppable(hdr->eventType, hdr->callType) };
             if ( !RemoteEventFactory::route_incoming_message(msgReceived, mChannel) )
             {
-                failed_process_message(msgReceived);
+                if ( droppable )
+                {
+                    // The full queue of the target refuses the droppable updates, the next one replaces it.
+                    accumulate_lost_received(1u);
+                }
+                else
+                {
+                    failed_process_message(msgReceived);
+                }
             }
         }
         else
@@ -0,0 +1,204 @@
+#ifndef AREG_IPC_PRIVATE_SENDBATCHWINDOW_HPP
+#define AREG_IPC_PRIVATE_SENDBATCHWINDOW_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/private/SendBatchWindow.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the time window a send batch waits for more messages.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// SendBatchWindow class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Decides how long a send batch waits for more messages. The batch waits only if the
+ *          messages arrive often enough to come within the latency budget, and at most the
+ *          budget. It stops waiting earlier, when no message arrives for a few arrival intervals.
+ *          The arrival interval is measured per batch and smoothed.
+ *
+ *          The send thread starts a batch with begin() and, while the batch waits, asks
+ *          is_over() after every check of the queue. The times are passed by the caller.
+ **/
+class SendBatchWindow
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    using Clock     = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+
+    //!< An arrival interval is smoothed with this share of the new sample, as 1 / 2^N.
+    static constexpr uint32_t   ARRIVAL_SMOOTH_SHIFT{ 2u };
+
+    //!< The batch stops waiting after this many arrival intervals without a message.
+    static constexpr uint64_t   ARRIVAL_IDLE_FACTOR { 4u };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    inline SendBatchWindow() noexcept;
+
+    ~SendBatchWindow() = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Sets the latency budget and starts as if the messages were rare: the batches
+     *          wait only after the rate is seen.
+     *
+     * \param   budgetUs    The latency budget of a batch in microseconds, 0 never waits.
+     * \param   now         The current time, the base of the first arrival interval.
+     **/
+    inline void reset( uint32_t budgetUs, const TimePoint & now ) noexcept;
+
+    /**
+     * \brief   Returns true if the batches may wait, i.e. the latency budget is set.
+     **/
+    [[nodiscard]]
+    inline bool is_enabled() const noexcept;
+
+    /**
+     * \brief   Returns the latency budget in nanoseconds.
+     **/
+    [[nodiscard]]
+    inline uint64_t budget_ns() const noexcept;
+
+    /**
+     * \brief   Returns the smoothed interval between two messages in nanoseconds.
+     **/
+    [[nodiscard]]
+    inline uint64_t arrival_ns() const noexcept;
+
+    /**
+     * \brief   Starts a batch: measures the arrival interval of the messages taken since the
+     *          previous batch started, and decides whether the batch waits for more.
+     *
+     * \param   batchBegin  The time the batch started.
+     * \param   count       The number of messages taken into the batch, at least 1.
+     * \return  Returns true if the batch waits. Returns false if a message is not expected
+     *          within the budget, then waiting would only delay the batch.
+     **/
+    inline bool begin( const TimePoint & batchBegin, uint32_t count ) noexcept;
+
+    /**
+     * \brief   Returns true if the batch started with begin() stops waiting: the budget is over,
+     *          or no message arrived for ARRIVAL_IDLE_FACTOR arrival intervals.
+     *
+     * \param   now         The current time.
+     * \param   arrived     True if messages were taken into the batch since the last call.
+     **/
+    inline bool is_over( const TimePoint & now, bool arrived ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The latency budget of a batch in nanoseconds, 0 never waits.
+    uint64_t    mBudgetNs;
+    //!< The smoothed interval between two messages in nanoseconds.
+    uint64_t    mArrivalNs;
+    //!< The time the previous batch started, the base of the next arrival interval.
+    TimePoint   mLastBatch;
+    //!< The time the waiting batch must be sent.
+    TimePoint   mDeadline;
+    //!< The time the waiting batch took the last messages.
+    TimePoint   mLastArrival;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( SendBatchWindow );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SendBatchWindow class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline SendBatchWindow::SendBatchWindow() noexcept
+    : mBudgetNs     ( 0u )
+    , mArrivalNs    ( 0u )
+    , mLastBatch    ( )
+    , mDeadline     ( )
+    , mLastArrival  ( )
+{
+}
+
+inline void SendBatchWindow::reset( uint32_t budgetUs, const TimePoint & now ) noexcept
+{
+    mBudgetNs    = static_cast<uint64_t>(budgetUs) * 1'000u;
+    mArrivalNs   = mBudgetNs * ARRIVAL_IDLE_FACTOR;
+    mLastBatch   = now;
+    mDeadline    = now;
+    mLastArrival = now;
+}
+
+inline bool SendBatchWindow::is_enabled() const noexcept
+{
+    return (mBudgetNs != 0u);
+}
+
+inline uint64_t SendBatchWindow::budget_ns() const noexcept
+{
+    return mBudgetNs;
+}
+
+inline uint64_t SendBatchWindow::arrival_ns() const noexcept
+{
+    return mArrivalNs;
+}
+
+inline bool SendBatchWindow::begin( const TimePoint & batchBegin, uint32_t count ) noexcept
+{
+    using namespace std::chrono;
+
+    // The messages taken so far arrived since the previous batch started.
+    const uint64_t sinceLast{ static_cast<uint64_t>(duration_cast<nanoseconds>(batchBegin - mLastBatch).count()) };
+    const uint64_t sample   { std::min(sinceLast / std::max(count, 1u), mBudgetNs * ARRIVAL_IDLE_FACTOR) };
+    mArrivalNs   = mArrivalNs - (mArrivalNs >> ARRIVAL_SMOOTH_SHIFT) + (sample >> ARRIVAL_SMOOTH_SHIFT);
+    mLastBatch   = batchBegin;
+    mDeadline    = batchBegin + nanoseconds(static_cast<nanoseconds::rep>(mBudgetNs));
+    mLastArrival = batchBegin;
+
+    return (mArrivalNs < mBudgetNs);
+}
+
+inline bool SendBatchWindow::is_over( const TimePoint & now, bool arrived ) noexcept
+{
+    if (now >= mDeadline)
+        return true;
+
+    if (arrived)
+    {
+        mLastArrival = now;
+        return false;
+    }
+
+    return ((now - mLastArrival) >= std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(mArrivalNs * ARRIVAL_IDLE_FACTOR)));
+}
+
+} // namespace areg
+
+#endif  // AREG_IPC_PRIVATE_SENDBATCHWINDOW_HPP
@@ -22,6 +22,7 @@ namespace areg {
 
 DEF_LOG_SCOPE(areg_ipc_ServerConnectionBase, accept_connection);
 DEF_LOG_SCOPE(areg_ipc_ServerConnectionBase, close_connection_cookie);
+DEF_LOG_SCOPE(areg_ipc_ServerConnectionBase, _create_local_socket);
 
 ServerConnectionBase::ServerConnectionBase()
     : mServerSocket         ( )
@@ -33,6 +34,10 @@ ServerConnectionBase::ServerConnectionBase()
     , mSockSendBuf          ( areg::SOCKET_SEND_BUFFER_SIZE )
     , mSockRecvBuf          ( areg::SOCKET_RECV_BUFFER_SIZE )
     , mSockSendTimeoutMs    ( areg::SOCKET_SEND_TIMEOUT_MS )
+    , mLocalSocket          ( areg::InvalidSocketHandle )
+    , mLocalPath            ( )
+    , mLocalAddress         ( )
+    , mLocalEnabled         ( false )
     , mLock                 ( )
 {
 }
@@ -47,6 +52,10 @@ ServerConnectionBase::ServerConnectionBase(const String & hostName, uint16_t por
     , mSockSendBuf          ( areg::SOCKET_SEND_BUFFER_SIZE )
     , mSockRecvBuf          ( areg::SOCKET_RECV_BUFFER_SIZE )
     , mSockSendTimeoutMs    ( areg::SOCKET_SEND_TIMEOUT_MS )
+    , mLocalSocket          ( areg::InvalidSocketHandle )
+    , mLocalPath            ( )
+    , mLocalAddress         ( )
+    , mLocalEnabled         ( false )
     , mLock                 ( )
 {
 }
@@ -61,6 +70,10 @@ ServerConnectionBase::ServerConnectionBase(const areg::SocketAddress & serverAdd
     , mSockSendBuf          ( areg::SOCKET_SEND_BUFFER_SIZE )
     , mSockRecvBuf          ( areg::SOCKET_RECV_BUFFER_SIZE )
     , mSockSendTimeoutMs    ( areg::SOCKET_SEND_TIMEOUT_MS )
+    , mLocalSocket          ( areg::InvalidSocketHandle )
+    , mLocalPath            ( )
+    , mLocalAddress         ( )
+    , mLocalEnabled         ( false )
     , mLock                 ( )
 {
 }
@@ -71,6 +84,7 @@ bool ServerConnectionBase::create_socket(const String & hostName, uint16_t portN
     if (mServerSocket.create(hostName, portNr))
     {
         mMultiplexer.register_socket(mServerSocket.handle(), true);
+        _create_local_socket();
         mIsInterrupted.store(false, std::memory_order_release);
         return true;
     }
@@ -84,6 +98,7 @@ bool ServerConnectionBase::create_socket()
     if (mServerSocket.create())
     {
         mMultiplexer.register_socket(mServerSocket.handle(), true);
+        _create_local_socket();
         mIsInterrupted.store(false, std::memory_order_release);
         return true;
     }
@@ -109,6 +124,7 @@ void ServerConnectionBase::close_socket()
     mCookieGenerator = areg::COOKIE_REMOTE_SERVICE;
 
     mServerSocket.close();
+    _close_local_socket();
 }
 
 void ServerConnectionBase::interrupt_connections() noexcept
@@ -131,17 +147,28 @@ void ServerConnectionBase::interrupt_connections() noexcept
 
 bool ServerConnectionBase::server_listen(int32_t maxQueueSize /*= areg::MAXIMUM_LISTEN_QUEUE_SIZE */)
 {
-    return mServerSocket.listen(maxQueueSize);
+    if (!mServerSocket.listen(maxQueueSize))
+        return false;
+
+    if ((mLocalSocket != areg::InvalidSocketHandle) && !areg::server_listen(mLocalSocket, maxQueueSize))
+    {
+        std::unique_lock<std::shared_mutex> lock(mLock);
+        _close_local_socket();
+    }
+
+    return true;
 }
 
 SOCKETHANDLE ServerConnectionBase::wait_connection(areg::SocketAddress & out_addrNewAccepted)
 {
-    return mServerSocket.wait_connection_event(mMultiplexer, out_addrNewAccepted);
+    const SOCKETHANDLE result{ mServerSocket.wait_connection_event(mMultiplexer, out_addrNewAccepted) };
+    return ((mLocalSocket == areg::InvalidSocketHandle) || (result != mLocalSocket) ? result : _accept_local_connection(out_addrNewAccepted));
 }
 
 SOCKETHANDLE ServerConnectionBase::wait_connection_nowait(areg::SocketAddress & out_addrNewAccepted)
 {
-    return mServerSocket.wait_connection_nowait(mMultiplexer, out_addrNewAccepted);
+    const SOCKETHANDLE result{ mServerSocket.wait_connection_nowait(mMultiplexer, out_addrNewAccepted) };
+    return ((mLocalSocket == areg::InvalidSocketHandle) || (result != mLocalSocket) ? result : _accept_local_connection(out_addrNewAccepted));
 }
 
 bool ServerConnectionBase::accept_connection(SocketAccepted & clientConnection)
@@ -254,4 +281,58 @@ void ServerConnectionBase::close_connection( const ITEM_ID & cookie )
     }
 }
 
+void ServerConnectionBase::_create_local_socket()
+{
+    LOG_SCOPE(areg_ipc_ServerConnectionBase, _create_local_socket);
+    _close_local_socket();
+    if (!mLocalEnabled)
+        return;
+
+    const uint16_t portNr{ mServerSocket.address().host_port() };
+    const String path{ areg::local_socket_path(portNr) };
+    const SOCKETHANDLE hSocket{ areg::local_server_connect(path) };
+    if ((hSocket != areg::InvalidSocketHandle) && mMultiplexer.register_socket(hSocket, true))
+    {
+        mLocalSocket    = hSocket;
+        mLocalPath      = path;
+        mLocalAddress   = areg::SocketAddress(String(areg::LocalAddress), portNr);
+
+        LOG_INFO("Opened the local socket [ %s ] in parallel with the TCP port [ %u ]", path.as_string(), static_cast<uint32_t>(portNr));
+    }
+    else
+    {
+        LOG_WARN("Failed to open the local socket [ %s ], the server accepts TCP connections only", path.as_string());
+        if (hSocket != areg::InvalidSocketHandle)
+        {
+            areg::socket_close(hSocket);
+            areg::local_socket_remove(path);
+        }
+    }
+}
+
+void ServerConnectionBase::_close_local_socket() noexcept
+{
+    if (mLocalSocket != areg::InvalidSocketHandle)
+    {
+        mMultiplexer.unregister_socket(mLocalSocket);
+        areg::socket_close(mLocalSocket);
+        areg::local_socket_remove(mLocalPath);
+        mLocalSocket = areg::InvalidSocketHandle;
+        mLocalPath.clear();
+    }
+}
+
+SOCKETHANDLE ServerConnectionBase::_accept_local_connection(areg::SocketAddress & out_addrNewAccepted)
+{
+    const SOCKETHANDLE result{ areg::local_server_accept(mLocalSocket) };
+    out_addrNewAccepted.reset();
+    if (result != areg::InvalidSocketHandle)
+    {
+        // The local peer has no network address, it is reported as loopback.
+        out_addrNewAccepted = mLocalAddress;
+    }
+
+    return result;
+}
+
 } // namespace areg
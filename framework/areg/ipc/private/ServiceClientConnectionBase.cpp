@@ -24,6 +24,20 @@
 
 #include "areg/base/private/DebugDefs.hpp"
 
+namespace {
+
+    /**
+     * \brief   Returns the number of bytes of the message left to read.
+     **/
+    inline uint32_t _size_left( const areg::MessageEnvelope & msg ) noexcept
+    {
+        const uint32_t pos{ msg.position() };
+        const uint32_t used{ msg.size_used() };
+        return (pos < used ? used - pos : 0u);
+    }
+
+} // namespace
+
 namespace areg {
 
 DEF_LOG_SCOPE(areg_ipc_private_ServiceClientConnectionBase, on_reconnect_timer);
@@ -91,6 +105,7 @@ ServiceClientConnectionBase::ServiceClientConnectionBase( const ITEM_ID & target
     , mTimerConnect         ( static_cast<TimerConsumer &>(self()), prefixName + areg::CLIENT_CONNECT_TIMER_NAME, areg::INVALID_TIMEOUT, Timer::IGNORE_TIMER_QUEUE, areg::EventPriority::HighPrio )
     , mThreadReceive        (messageHandler, mClientConnection, prefixName)
     , mThreadSend           (messageHandler, mClientConnection, prefixName)
+    , mThreadDatagram       (messageHandler, mClientConnection, mThreadReceive, prefixName)
     , mSendStartLock        ( false )
 {
     ASSERT((target > areg::TARGET_LOCAL) && (target < areg::COOKIE_REMOTE_SERVICE));
@@ -154,7 +169,7 @@ bool ServiceClientConnectionBase::try_send_inline( MessageEnvelope & data )
     {
         AREG_LT_SCOPE(areg::LtStage::SendSyscall);
         const areg::IoBuffer ioBuffer{ reinterpret_cast<const uint8_t *>(hdr), wireSize };
-        sent = areg::try_send_data_v(hSocket, &ioBuffer, 1u, wireSize);
+        sent = mClientConnection.try_send_messages_batch(&ioBuffer, 1u, wireSize);
     }
 
     writer.release();
@@ -193,9 +208,51 @@ void ServiceClientConnectionBase::service_connection_event(const MessageEnvelope
     {
         if (msgReceived.result() == areg::MESSAGE_SUCCESS)
         {
+            // The response of the router may carry the message source, the confirmation
+            // of the shared memory channel and the UDP port offered with the connect request.
+            areg::MessageSource msgSource{ areg::MessageSource::SourceUndefined };
+            bool sharedMemory{ false };
+            uint16_t datagramPort{ 0u };
+            bool compact{ false };
+            if (_size_left(msgReceived) >= sizeof(areg::MessageSource))
+            {
+                msgReceived >> msgSource;
+            }
+
+            if (_size_left(msgReceived) >= sizeof(bool))
+            {
+                msgReceived >> sharedMemory;
+            }
+
+            if (_size_left(msgReceived) >= sizeof(uint16_t))
+            {
+                msgReceived >> datagramPort;
+            }
+
+            if (_size_left(msgReceived) >= sizeof(bool))
+            {
+                msgReceived >> compact;
+            }
+
             Lock lock(mLock);
             ASSERT(cookie == static_cast<ITEM_ID>(msgReceived.target()));
             mClientConnection.set_cookie(cookie);
+            if (mClientConnection.shared_memory_name().is_empty() == false)
+            {
+                LOG_DBG("The router [ %s ] the shared memory channel", sharedMemory ? "accepted" : "declined");
+                mClientConnection.confirm_shared_memory(sharedMemory);
+            }
+
+            // A router, which does not know the compact header, answers without it.
+            LOG_DBG("The messages are sent with the [ %s ] header", compact ? "compact" : "full");
+            mClientConnection.confirm_compact(compact);
+
+            if (areg::is_valid_socket(mClientConnection.datagram_socket()))
+            {
+                const bool datagrams{ mThreadDatagram.start(datagramPort) };
+                LOG_DBG("The droppable messages are sent [ %s ]", datagrams ? "as datagrams" : "through the stream");
+            }
+
             on_channel_connected(cookie);
             send_command(ServiceEventData::ServiceCommand::CMD_ServiceStarted);
         }
@@ -306,6 +363,49 @@ bool ServiceClientConnectionBase::is_host_setup() const
     return mClientConnection.address().is_valid();
 }
 
+bool ServiceClientConnectionBase::_open_shared_memory()
+{
+    // Shared memory connects the processes of one host only.
+    ConnectionConfiguration config(mService, areg::ConnectionType::SharedMemory);
+    if ( !config.is_connection_listed() || !config.connection_enable_flag() ||
+         !areg::is_local_address(mClientConnection.address().host_address()) )
+    {
+        return false;
+    }
+
+    return mClientConnection.open_shared_memory(config.socket_send_buffer(), config.socket_recv_buffer());
+}
+
+uint16_t ServiceClientConnectionBase::_open_datagram()
+{
+    ConnectionConfiguration config(mService, areg::ConnectionType::Udp);
+    if ( !config.is_connection_listed() || !config.connection_enable_flag() )
+    {
+        return 0u;
+    }
+
+    return mClientConnection.open_datagram();
+}
+
+bool ServiceClientConnectionBase::_open_compact()
+{
+    ConnectionConfiguration config(mService, areg::ConnectionType::Tcpip);
+    return config.compact_header() && mClientConnection.open_compact();
+}
+
+String ServiceClientConnectionBase::_local_socket_path() const
+{
+    // The local socket reaches the processes of one host only, when the router address is loopback.
+    ConnectionConfiguration config(mService, areg::ConnectionType::UnixSocket);
+    if ( !config.is_connection_listed() || !config.connection_enable_flag() ||
+         !areg::is_local_address(mClientConnection.address().host_address()) )
+    {
+        return String();
+    }
+
+    return areg::local_socket_path(mClientConnection.address().host_port());
+}
+
 MessageEnvelope ServiceClientConnectionBase::connect_message(const ITEM_ID & source, const ITEM_ID & target, areg::MessageSource msgSource) const
 {
     return areg::create_connect_request(source, target, msgSource);
@@ -390,6 +490,7 @@ void ServiceClientConnectionBase::on_service_stop()
     mClientConnection.close_socket( );
     mThreadSend.shutdown( areg::DO_NOT_WAIT );
     mThreadReceive.shutdown( areg::WAIT_INFINITE );
+    mThreadDatagram.stop( );
 
     mMessageDispatcher.remove_event_type( ServiceClientEvent::CLASS_ID );
 
@@ -448,6 +549,7 @@ void ServiceClientConnectionBase::on_connection_stopped()
 
     mThreadReceive.shutdown( areg::WAIT_INFINITE );
     mThreadSend.shutdown( areg::WAIT_INFINITE );
+    mThreadDatagram.stop( );
     mConnectionConsumer.on_service_channel_disconnected( channel );
 
     if ( Application::is_servicing_available( ) && (prevState != ConnectionPhase::ConnectionStopping) )
@@ -487,6 +589,7 @@ void ServiceClientConnectionBase::on_connection_lost()
     LOG_DBG( "Restarting lost connection with remote service" );
     mThreadReceive.shutdown( areg::WAIT_INFINITE );
     mThreadSend.shutdown( areg::WAIT_INFINITE );
+    mThreadDatagram.stop( );
     mConnectionConsumer.on_service_channel_lost( channel );
     if (!mTimerConnect.start_timer(areg::DEFAULT_RETRY_CONNECT_TIMEOUT, mMessageDispatcher, 1))
     {
@@ -545,6 +648,7 @@ bool ServiceClientConnectionBase::start_connection()
 
     mTimerConnect.stop_timer();
 
+    mClientConnection.set_local_path(_local_socket_path());
     if ( !mClientConnection.create_socket_fd() )
     {
         LOG_WARN("Client service failed to create socket FD, going to repeat in [ %u ] ms on thread [ %u : %s ]"
@@ -562,8 +666,34 @@ bool ServiceClientConnectionBase::start_connection()
         return false;
     }
 
-    // Store handshake in the receive thread before starting it.
-    mThreadReceive.set_handshake(connect_message(areg::COOKIE_UNKNOWN, mTarget, mMessageSource));
+    // Store handshake in the receive thread before starting it. The name of the shared memory
+    // channel, if any, follows the connect request, then the port of the UDP socket, if any,
+    // then the offer of the compact header; the router confirms them in the response.
+    MessageEnvelope msgHello{ connect_message(areg::COOKIE_UNKNOWN, mTarget, mMessageSource) };
+    const bool sharedMemory{ _open_shared_memory() };
+    mThreadDatagram.stop();
+    const uint16_t datagramPort{ _open_datagram() };
+    const bool compact{ _open_compact() };
+    if ( sharedMemory || (datagramPort != 0u) || compact )
+    {
+        LOG_DBG("Offering the shared memory channel [ %s ], the UDP port [ %u ] and the compact header [ %s ] with the connect request"
+                    , mClientConnection.shared_memory_name().as_string()
+                    , static_cast<uint32_t>(datagramPort)
+                    , compact ? "yes" : "no");
+        msgHello.move_to_end();
+        msgHello << mClientConnection.shared_memory_name();
+        if ( (datagramPort != 0u) || compact )
+        {
+            msgHello << datagramPort;
+        }
+
+        if ( compact )
+        {
+            msgHello << compact;
+        }
+    }
+
+    mThreadReceive.set_handshake(std::move(msgHello));
 
     // The send thread is not started here: it is a fallback, and the first message that has to
     // be queued starts it, see ensure_send_thread().
@@ -586,6 +716,7 @@ bool ServiceClientConnectionBase::start_connection()
         mClientConnection.close_socket();
         mThreadReceive.shutdown( areg::WAIT_INFINITE );
         mThreadSend.shutdown( areg::WAIT_INFINITE );
+        mThreadDatagram.stop( );
         if (!mTimerConnect.start_timer(areg::DEFAULT_RETRY_CONNECT_TIMEOUT, mMessageDispatcher, 1))
         {
             LOG_WARN("Failed to start reconnect timer, retrying connection immediately.");
@@ -0,0 +1,188 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/private/SharedMemoryLink.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the shared memory data path of a TCP connection.
+ ************************************************************************/
+
+#include "areg/ipc/SharedMemoryLink.hpp"
+
+#include "areg/base/MemoryDefs.hpp"
+#include "areg/base/MessageEnvelope.hpp"
+#include "areg/ipc/SocketLinkMap.hpp"
+#include "areg/ipc/private/ConnectionDefs.hpp"
+
+#include <algorithm>
+
+namespace areg {
+
+bool SharedMemoryLink::_socket_ready( SOCKETHANDLE hSocket, uint32_t timeoutMs ) noexcept
+{
+    return (areg::recv_data_available(hSocket) != 0u) || areg::is_socket_readable(hSocket, timeoutMs);
+}
+
+SharedMemoryLink::SharedMemoryLink() noexcept
+    : mChannel  ( )
+    , mSocket   ( areg::InvalidSocketHandle )
+    , mLinks    ( nullptr )
+    , mTimeout  ( areg::SOCKET_SEND_TIMEOUT_MS )
+    , mSending  ( false )
+    , mReceive  ( ReceiveState::Socket )
+{
+}
+
+SharedMemoryLink::~SharedMemoryLink()
+{
+    detach();
+    release();
+}
+
+bool SharedMemoryLink::create( uint32_t sendSize, uint32_t recvSize, uint32_t timeoutMs )
+{
+    release();
+    mTimeout = timeoutMs != 0u ? timeoutMs : areg::SOCKET_SEND_TIMEOUT_MS;
+    return mChannel.create(sendSize, recvSize);
+}
+
+bool SharedMemoryLink::open( const String & name, uint32_t timeoutMs )
+{
+    release();
+    mTimeout = timeoutMs != 0u ? timeoutMs : areg::SOCKET_SEND_TIMEOUT_MS;
+    return mChannel.open(name);
+}
+
+bool SharedMemoryLink::attach( SOCKETHANDLE hSocket, SocketLinkMap & links )
+{
+    if ((mChannel.is_open() == false) || (areg::is_valid_socket(hSocket) == false))
+        return false;
+
+    if (links.attach(hSocket, *this) == false)
+        return false;
+
+    mSocket = hSocket;
+    mLinks  = &links;
+    return true;
+}
+
+void SharedMemoryLink::confirm( bool accepted )
+{
+    mChannel.remove_name();
+    if (accepted && (mSocket != areg::InvalidSocketHandle))
+    {
+        mReceive.store(ReceiveState::Switching, std::memory_order_release);
+        activate_send();
+    }
+    else
+    {
+        detach();
+    }
+}
+
+void SharedMemoryLink::detach() noexcept
+{
+    mSending.store(false, std::memory_order_release);
+    mChannel.shutdown();
+
+    if (mSocket != areg::InvalidSocketHandle)
+    {
+        mLinks->detach(mSocket, *this);
+        mLinks = nullptr;
+
+        // A sender holds the writer lock while it uses the link: once the lock is taken here,
+        // every sender either left the link or finds no link anymore. If the calling thread
+        // owns the lock, for example, because its send failed, no other sender can be inside.
+        SocketWriter & writer{ SocketWriter::writer_of(mSocket) };
+        if (writer.is_owner() == false)
+        {
+            writer.acquire();
+            writer.release();
+        }
+        mSocket = areg::InvalidSocketHandle;
+    }
+}
+
+void SharedMemoryLink::release() noexcept
+{
+    ASSERT(mSocket == areg::InvalidSocketHandle);
+    mChannel.close();
+    mSending.store(false, std::memory_order_release);
+    mReceive.store(ReceiveState::Socket, std::memory_order_release);
+}
+
+int32_t SharedMemoryLink::receive_message( MessageEnvelope & message, uint32_t waitMs )
+{
+    areg::EventHeader evtHeader{};
+    if (mChannel.receive(reinterpret_cast<uint8_t *>(&evtHeader), sizeof(areg::EventHeader), waitMs) != static_cast<int32_t>(sizeof(areg::EventHeader)))
+        return -1;
+
+    if (evtHeader.bufHeader.biUsed > areg::MAX_BUF_LENGTH)
+        return 0;
+
+    uint8_t * buffer = message.init_envelope(evtHeader, evtHeader.bufHeader.biUsed);
+    if (buffer == nullptr)
+        return 0;
+
+    int32_t result{ static_cast<int32_t>(sizeof(areg::EventHeader)) };
+    if (evtHeader.bufHeader.biUsed != 0u)
+    {
+        // The peer writes the rest of the message right after the header.
+        if (mChannel.receive(buffer, evtHeader.bufHeader.biUsed, mTimeout) != static_cast<int32_t>(evtHeader.bufHeader.biUsed))
+            return -1;
+
+        message.set_size_used(evtHeader.bufHeader.biUsed);
+        result += static_cast<int32_t>(evtHeader.bufHeader.biUsed);
+    }
+
+    message.move_to_begin();
+    return (message.is_checksum_valid() ? result : 0);
+}
+
+SharedMemoryLink::Input SharedMemoryLink::wait_input( SOCKETHANDLE hSocket )
+{
+    const ReceiveState state{ mReceive.load(std::memory_order_acquire) };
+    if ((state == ReceiveState::Socket) || mChannel.is_shutdown() || (areg::recv_data_available(hSocket) != 0u))
+        return Input::Socket;
+
+    if (state == ReceiveState::Switching)
+    {
+        // The peer still may send through the socket: watch both, the socket first, since its
+        // messages were sent before the first message in the channel.
+        uint32_t waitMs{ 1u };
+        for ( ; ; )
+        {
+            if (mChannel.size_readable() != 0u)
+            {
+                if (SharedMemoryLink::_socket_ready(hSocket, 0u))
+                    return Input::Socket;
+
+                mReceive.store(ReceiveState::Channel, std::memory_order_release);
+                return Input::Channel;
+            }
+
+            if (SharedMemoryLink::_socket_ready(hSocket, waitMs) || mChannel.is_shutdown())
+                return Input::Socket;
+
+            waitMs = std::min<uint32_t>(waitMs * 2u, SWITCH_CHECK_MS);
+        }
+    }
+
+    for ( ; ; )
+    {
+        if (mChannel.wait_readable(SOCKET_CHECK_MS))
+            return Input::Channel;
+
+        // Idle: the socket reports the end of the connection.
+        if (mChannel.is_shutdown() || SharedMemoryLink::_socket_ready(hSocket, 0u))
+            return Input::Socket;
+    }
+}
+
+} // namespace areg
@@ -22,28 +22,218 @@
 
 #include "areg/logging/areg_log.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace areg {
 
-SocketConnectionBase::SocketConnectionBase() noexcept
+SocketConnectionBase::SocketConnectionBase()
+    : mLinks    ( )
+{
+}
+
+void SocketConnectionBase::send_messages_groups(areg::IoGroup* groups, uint32_t count, uint32_t timeoutMs) const
 {
+    areg::IoGroup direct[areg::DEFAULT_DRAIN_LIMIT];
+    CompactFraming * framings[areg::DEFAULT_DRAIN_LIMIT];
+    uint32_t directIndex[areg::DEFAULT_DRAIN_LIMIT];
+    uint32_t deferred[areg::DEFAULT_DRAIN_LIMIT];
+    bool taken[areg::DEFAULT_DRAIN_LIMIT];
+
+    for (uint32_t first = 0u; first < count; first += areg::DEFAULT_DRAIN_LIMIT)
+    {
+        const uint32_t window{ std::min<uint32_t>(count - first, areg::DEFAULT_DRAIN_LIMIT) };
+        areg::IoGroup * batch{ groups + first };
+        uint32_t directCount{ 0u };
+        uint32_t deferredCount{ 0u };
+
+        for (uint32_t i = 0u; i < window; ++i)
+        {
+            areg::IoGroup & group{ batch[i] };
+            taken[i] = false;
+
+            // Once a group of the socket waits for another writer, the next groups of the
+            // same socket wait as well, so that the order of the messages is kept.
+            bool wait{ false };
+            for (uint32_t k = 0u; (k < deferredCount) && (wait == false); ++k)
+            {
+                wait = (batch[deferred[k]].socket == group.socket);
+            }
+
+            // Never wait for a writer lock while holding the others: the busy ones are sent last.
+            areg::SocketWriter & writer{ areg::SocketWriter::writer_of(group.socket) };
+            if (wait || ((writer.is_owner() == false) && ((taken[i] = writer.try_acquire()) == false)))
+            {
+                deferred[deferredCount ++] = i;
+                continue;
+            }
+
+            const SocketLinks links{ mLinks.links_of(group.socket) };
+            SharedMemoryLink * link{ links.slShared };
+            DatagramLink * datagram{ links.slDatagram };
+            if (((link != nullptr) && link->is_sending()) || ((datagram != nullptr) && datagram->is_sending()))
+            {
+                group.result = send_messages_batch(group.buffers, group.count, group.socket, group.totalSize);
+            }
+            else
+            {
+                framings[directCount] = links.slFraming;
+                directIndex[directCount] = i;
+                direct[directCount ++] = group;
+            }
+        }
+
+        // The copies of the groups take the compact frames, the groups of the caller stay as they are.
+        CompactFraming::encode_groups(direct, framings, directCount);
+        areg::send_data_groups(direct, directCount, timeoutMs);
+        for (uint32_t i = 0u; i < directCount; ++i)
+        {
+            batch[directIndex[i]].result = direct[i].result;
+        }
+
+        for (uint32_t i = 0u; i < window; ++i)
+        {
+            if (taken[i])
+            {
+                areg::SocketWriter::writer_of(batch[i].socket).release();
+            }
+        }
+
+        for (uint32_t i = 0u; i < deferredCount; ++i)
+        {
+            areg::IoGroup & group{ batch[deferred[i]] };
+            areg::SocketWriteGuard writeGuard{ group.socket };
+            group.result = send_messages_batch(group.buffers, group.count, group.socket, group.totalSize);
+        }
+    }
+}
+
+namespace
+{
+    /**
+     * \brief   Builds the message of the complete frame in the read-ahead buffer of the thread.
+     *          The header is decoded and the payload copied into the message straight out of
+     *          the buffer, the socket is not read.
+     * \return  Returns the size of the frame; zero if the frame is malformed or out of memory.
+     **/
+    int32_t _decode_frame(MessageEnvelope & message, const uint8_t * frame, uint32_t frameSize, CompactFraming * framing)
+    {
+        areg::EventHeader evtHeader{};
+        const uint8_t * payload{ nullptr };
+
+        uint32_t word{ 0u };
+        std::memcpy(&word, frame, sizeof(word));
+        if (areg::is_compact_frame(word))
+        {
+            areg::CompactHeader header{};
+            areg::CompactSession session{};
+            std::memcpy(&header, frame, sizeof(areg::CompactHeader));
+            payload = frame + sizeof(areg::CompactHeader);
+            const bool define{ (header.frame & areg::COMPACT_FLAG_DEFINE) != 0u };
+            if (define)
+            {
+                std::memcpy(&session, payload, sizeof(areg::CompactSession));
+                payload += sizeof(areg::CompactSession);
+            }
+
+            if ((framing == nullptr) || (framing->restore(header, define ? &session : nullptr, evtHeader) == false))
+                return 0;
+        }
+        else
+        {
+            if (frameSize < static_cast<uint32_t>(sizeof(areg::EventHeader)))
+                return 0;
+
+            std::memcpy(&evtHeader, frame, sizeof(areg::EventHeader));
+            payload = frame + sizeof(areg::EventHeader);
+        }
+
+        const uint32_t used{ evtHeader.bufHeader.biUsed };
+        if ((used > areg::MAX_BUF_LENGTH) || (static_cast<uint32_t>(payload - frame) + used != frameSize))
+            return 0;
+
+        uint8_t * buffer{ message.init_envelope(evtHeader, used) };
+        if (buffer == nullptr)
+            return 0;
+
+        if (used != 0u)
+        {
+            std::memcpy(buffer, payload, used);
+            message.set_size_used(used);
+        }
+
+        message.move_to_begin();
+        return (message.is_checksum_valid() ? static_cast<int32_t>(frameSize) : 0);
+    }
 }
 
 int32_t SocketConnectionBase::receive_message(MessageEnvelope & message, const Socket & socket) const
 {
-    areg::EventHeader evtHeader{};
-    if (socket.receive(reinterpret_cast<uint8_t*>(&evtHeader), sizeof(areg::EventHeader)) != static_cast<int32_t>(sizeof(areg::EventHeader)))
+    const uint8_t * frame{ nullptr };
+    const int32_t frameSize{ areg::receive_frame(socket.handle(), frame) };
+    if (frameSize < 0)
         return 0;
 
+    if (frame != nullptr)
+    {
+        const int32_t result{ _decode_frame(message, frame, static_cast<uint32_t>(frameSize), mLinks.links_of(socket.handle()).slFraming) };
+        areg::receive_frame_done(socket.handle(), static_cast<uint32_t>(frameSize));
+        return result;
+    }
+
+    areg::EventHeader evtHeader{};
+    uint8_t * raw{ reinterpret_cast<uint8_t *>(&evtHeader) };
+    int32_t result{ 0 };
+
+    CompactFraming * framing{ mLinks.links_of(socket.handle()).slFraming };
+    if (framing == nullptr)
+    {
+        if (socket.receive(raw, sizeof(areg::EventHeader)) != static_cast<int32_t>(sizeof(areg::EventHeader)))
+            return 0;
+
+        result = static_cast<int32_t>(sizeof(areg::EventHeader));
+    }
+    else
+    {
+        // Both kinds of frames are at least as long as the compact header, its first word tells them apart.
+        constexpr int32_t compactSize{ static_cast<int32_t>(sizeof(areg::CompactHeader)) };
+        if (socket.receive(raw, compactSize) != compactSize)
+            return 0;
+
+        if (areg::is_compact_frame(evtHeader.bufHeader.biLength))
+        {
+            areg::CompactHeader header{};
+            areg::CompactSession session{};
+            std::memcpy(&header, raw, sizeof(areg::CompactHeader));
+            const bool define{ (header.frame & areg::COMPACT_FLAG_DEFINE) != 0u };
+            if (define && (socket.receive(reinterpret_cast<uint8_t *>(&session), sizeof(areg::CompactSession)) != static_cast<int32_t>(sizeof(areg::CompactSession))))
+                return 0;
+
+            if (framing->restore(header, define ? &session : nullptr, evtHeader) == false)
+                return 0;
+
+            result = compactSize + (define ? static_cast<int32_t>(sizeof(areg::CompactSession)) : 0);
+        }
+        else
+        {
+            constexpr int32_t restSize{ static_cast<int32_t>(sizeof(areg::EventHeader)) - compactSize };
+            if (socket.receive(raw + compactSize, restSize) != restSize)
+                return 0;
+
+            result = static_cast<int32_t>(sizeof(areg::EventHeader));
+        }
+    }
+
     if (evtHeader.bufHeader.biUsed > areg::MAX_BUF_LENGTH)
         return 0;
 
     uint8_t * buffer = message.init_envelope(evtHeader, evtHeader.bufHeader.biUsed);
-    int32_t result{ buffer != nullptr ? static_cast<int32_t>(sizeof(areg::EventHeader)) : 0 };
+    result = (buffer != nullptr ? result : 0);
     if ((evtHeader.bufHeader.biUsed != 0u) && (result != 0))
     {
         const int32_t rest = socket.receive(buffer, static_cast<int32_t>(evtHeader.bufHeader.biUsed));
         message.set_size_used(evtHeader.bufHeader.biUsed);
-        result = rest > 0 ? (static_cast<int32_t>(sizeof(areg::EventHeader)) + rest) : 0;
+        result = rest > 0 ? (result + rest) : 0;
     }
 
     message.move_to_begin();
@@ -0,0 +1,108 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/private/SocketLinkMap.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the framings and links attached to the sockets of a connection.
+ ************************************************************************/
+#include "areg/ipc/SocketLinkMap.hpp"
+
+namespace
+{
+    /**
+     * \brief   Returns true if nothing is attached in the entry.
+     **/
+    inline bool _is_unused( const areg::SocketLinks & links ) noexcept
+    {
+        return (links.slFraming == nullptr) && (links.slZeroCopy == nullptr) && (links.slShared == nullptr) && (links.slDatagram == nullptr);
+    }
+}
+
+namespace areg {
+
+SocketLinkMap::SocketLinkMap()
+    : mLinks( )
+    , mLock ( )
+{
+}
+
+template <typename LINK>
+bool SocketLinkMap::_attach( SOCKETHANDLE hSocket, LINK * SocketLinks::* field, LINK * link )
+{
+    Lock lock(mLock);
+    SocketLinks links{ mLinks.find_resource_object(hSocket) };
+    if (links.*field != nullptr)
+        return (links.*field == link);
+
+    links.*field = link;
+    mLinks.register_resource_object(hSocket, links);
+    return true;
+}
+
+template <typename LINK>
+void SocketLinkMap::_detach( SOCKETHANDLE hSocket, LINK * SocketLinks::* field, const LINK * link )
+{
+    Lock lock(mLock);
+    SocketLinks links{ mLinks.find_resource_object(hSocket) };
+    if (links.*field != link)
+        return;
+
+    links.*field = nullptr;
+    if (_is_unused(links))
+    {
+        mLinks.unregister_resource_object(hSocket);
+    }
+    else
+    {
+        mLinks.register_resource_object(hSocket, links);
+    }
+}
+
+bool SocketLinkMap::attach( SOCKETHANDLE hSocket, CompactFraming & framing )
+{
+    return _attach(hSocket, &SocketLinks::slFraming, &framing);
+}
+
+void SocketLinkMap::detach( SOCKETHANDLE hSocket, const CompactFraming & framing )
+{
+    _detach(hSocket, &SocketLinks::slFraming, &framing);
+}
+
+bool SocketLinkMap::attach( SOCKETHANDLE hSocket, ZeroCopySender & sender )
+{
+    return _attach(hSocket, &SocketLinks::slZeroCopy, &sender);
+}
+
+void SocketLinkMap::detach( SOCKETHANDLE hSocket, const ZeroCopySender & sender )
+{
+    _detach(hSocket, &SocketLinks::slZeroCopy, &sender);
+}
+
+bool SocketLinkMap::attach( SOCKETHANDLE hSocket, SharedMemoryLink & link )
+{
+    return _attach(hSocket, &SocketLinks::slShared, &link);
+}
+
+void SocketLinkMap::detach( SOCKETHANDLE hSocket, const SharedMemoryLink & link )
+{
+    _detach(hSocket, &SocketLinks::slShared, &link);
+}
+
+bool SocketLinkMap::attach( SOCKETHANDLE hSocket, DatagramLink & link )
+{
+    return _attach(hSocket, &SocketLinks::slDatagram, &link);
+}
+
+void SocketLinkMap::detach( SOCKETHANDLE hSocket, const DatagramLink & link )
+{
+    _detach(hSocket, &SocketLinks::slDatagram, &link);
+}
+
+} // namespace areg
@@ -0,0 +1,389 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/ipc/private/ZeroCopySender.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the zero-copy send of the large messages of a stream connection.
+ ************************************************************************/
+#include "areg/ipc/ZeroCopySender.hpp"
+#include "areg/ipc/SocketLinkMap.hpp"
+#include "areg/base/SyncPrimitives.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace
+{
+    //!< Guards the list of the retired senders.
+    areg::ResourceLock & _retired_lock() noexcept
+    {
+        static areg::ResourceLock _lock;
+        return _lock;
+    }
+}
+
+namespace areg {
+
+int32_t ZeroCopySender::send_stream( SOCKETHANDLE hSocket, ZeroCopySender * sender, const areg::IoBuffer * ioBuffer, uint32_t count, uint32_t totalSize, const areg::RawBufferPtr * owners, uint32_t ownerCount ) noexcept
+{
+    if ((sender == nullptr) || (owners == nullptr) || (ownerCount == 0u) || (sender->is_sending() == false))
+    {
+        return areg::send_data_v(hSocket, ioBuffer, count, totalSize);
+    }
+
+    return sender->send(ioBuffer, count, owners, ownerCount);
+}
+
+uint32_t ZeroCopySender::count_retired() noexcept
+{
+    Lock lock(_retired_lock());
+    uint32_t result{ 0u };
+    for (const ZeroCopySender * retired = ZeroCopySender::_retired().load(std::memory_order_acquire); retired != nullptr; retired = retired->mNextRetired)
+    {
+        ++ result;
+    }
+
+    return result;
+}
+
+uint32_t ZeroCopySender::completed_sends( uint32_t first, uint32_t sends, const areg::ZeroCopyDone & done ) noexcept
+{
+    // The distances from the first send of the buffer: the pending sends are far fewer than
+    // 2^31, so a signed distance tells whether an id is before or after it across the wrap.
+    const int64_t from{ static_cast<int32_t>(done.first - first) };
+    const int64_t to  { from + static_cast<int64_t>(done.last - done.first) };
+    const int64_t lo  { std::max<int64_t>(from, 0) };
+    const int64_t hi  { std::min<int64_t>(to, static_cast<int64_t>(sends) - 1) };
+    return (lo <= hi ? static_cast<uint32_t>(hi - lo + 1) : 0u);
+}
+
+std::atomic<ZeroCopySender *> & ZeroCopySender::_retired() noexcept
+{
+    static std::atomic<ZeroCopySender *> _first{ nullptr };
+    return _first;
+}
+
+void ZeroCopySender::_drain_retired() noexcept
+{
+    std::atomic<ZeroCopySender *> & first{ ZeroCopySender::_retired() };
+    if (first.load(std::memory_order_acquire) == nullptr)
+        return;
+
+    Lock lock(_retired_lock());
+    ZeroCopySender * prev{ nullptr };
+    ZeroCopySender * retired{ first.load(std::memory_order_acquire) };
+    while (retired != nullptr)
+    {
+        ZeroCopySender * next{ retired->mNextRetired };
+        retired->_reap_completions(0u);
+        if (retired->mCount != 0u)
+        {
+            prev = retired;
+        }
+        else
+        {
+            if (prev == nullptr)
+            {
+                first.store(next, std::memory_order_release);
+            }
+            else
+            {
+                prev->mNextRetired = next;
+            }
+
+            areg::socket_close(retired->mSocket);
+            retired->mSocket = areg::InvalidSocketHandle;
+            delete retired;
+        }
+
+        retired = next;
+    }
+}
+
+const areg::RawBufferPtr * ZeroCopySender::_owner_of( const areg::IoBuffer & buffer, const areg::RawBufferPtr * owners, uint32_t ownerCount ) noexcept
+{
+    const uintptr_t begin{ reinterpret_cast<uintptr_t>(buffer.data) };
+    const uintptr_t end{ begin + buffer.size };
+    for (uint32_t i = 0u; i < ownerCount; ++ i)
+    {
+        const areg::RawBuffer * block{ owners[i].get() };
+        if (block == nullptr)
+            continue;
+
+        // The message is the header and the used data after it, the buffer must be within it.
+        const uintptr_t first{ reinterpret_cast<uintptr_t>(block) };
+        const uintptr_t last{ first + block->bufHeader.biOffset + block->bufHeader.biUsed };
+        if ((begin >= first) && (end <= last))
+            return &owners[i];
+    }
+
+    return nullptr;
+}
+
+ZeroCopySender::ZeroCopySender() noexcept
+    : mSocket   ( areg::InvalidSocketHandle )
+    , mLinks    ( nullptr )
+    , mThreshold( 0u )
+    , mHead     ( 0u )
+    , mCount    ( 0u )
+    , mNextId   ( 0u )
+    , mNextRetired( nullptr )
+    , mPending  ( )
+    , mSending  ( false )
+    , mSaved    ( 0u )
+{
+}
+
+ZeroCopySender::~ZeroCopySender()
+{
+    detach();
+}
+
+bool ZeroCopySender::attach( SOCKETHANDLE hSocket, SocketLinkMap & links, uint32_t threshold )
+{
+    detach();
+    ZeroCopySender::_drain_retired();
+    if ((threshold == 0u) || (areg::zerocopy_enable(hSocket) == false))
+        return false;
+
+    if (mPending == nullptr)
+    {
+        mPending = std::make_unique<Pending[]>(MAX_PENDING);
+    }
+
+    // The ids of the completions count the zero-copy sends of the socket from 0.
+    mHead       = 0u;
+    mCount      = 0u;
+    mNextId     = 0u;
+    mThreshold  = std::max(threshold, areg::MIN_ZEROCOPY_BLOCK);
+    if (links.attach(hSocket, *this) == false)
+        return false;
+
+    mSocket     = hSocket;
+    mLinks      = &links;
+    mSending.store(true, std::memory_order_release);
+    return true;
+}
+
+void ZeroCopySender::detach() noexcept
+{
+    mSending.store(false, std::memory_order_release);
+    if (mSocket == areg::InvalidSocketHandle)
+        return;
+
+    if (mLinks != nullptr)
+    {
+        mLinks->detach(mSocket, *this);
+        mLinks = nullptr;
+    }
+
+    // The senders send while holding the writer lock: once it is taken here, none of them
+    // uses the list of the pending messages anymore.
+    SocketWriter & writer{ SocketWriter::writer_of(mSocket) };
+    if (writer.is_owner() == false)
+    {
+        writer.acquire();
+        writer.release();
+    }
+
+    // The kernel may read the messages of the last sends until it releases them, they are not
+    // returned to the pool before: the ones still pending are kept by a retired sender.
+    _reap_completions(0u);
+    if (mCount != 0u)
+    {
+        _retire();
+    }
+
+    mHead   = 0u;
+    mCount  = 0u;
+    mSocket = areg::InvalidSocketHandle;
+    ZeroCopySender::_drain_retired();
+}
+
+int32_t ZeroCopySender::send( const areg::IoBuffer * ioBuffer, uint32_t count, const areg::RawBufferPtr * owners, uint32_t ownerCount ) noexcept
+{
+    int32_t written{ 0 };
+    uint32_t start{ 0u };
+    uint32_t runSize{ 0u };
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        const areg::IoBuffer & buffer{ ioBuffer[i] };
+        const areg::RawBufferPtr * owner{ (buffer.size >= mThreshold) && is_sending() ? ZeroCopySender::_owner_of(buffer, owners, ownerCount) : nullptr };
+        if ((owner != nullptr) && (mCount == MAX_PENDING))
+        {
+            reap(0u);
+            owner = (mCount < MAX_PENDING ? owner : nullptr);
+        }
+
+        if (owner == nullptr)
+        {
+            runSize += static_cast<uint32_t>(buffer.size);
+            continue;
+        }
+
+        // The ordinary buffers before the large one keep their order on the stream.
+        if (i > start)
+        {
+            const int32_t sent{ areg::send_data_v(mSocket, ioBuffer + start, i - start, runSize) };
+            if (sent < 0)
+                return sent;
+
+            written += sent;
+        }
+
+        const int32_t sent{ _send_buffer(buffer, *owner) };
+        if (sent < 0)
+            return sent;
+
+        written += sent;
+        start    = i + 1u;
+        runSize  = 0u;
+    }
+
+    if (start < count)
+    {
+        const int32_t sent{ areg::send_data_v(mSocket, ioBuffer + start, count - start, runSize) };
+        if (sent < 0)
+            return sent;
+
+        written += sent;
+    }
+
+    if (mCount != 0u)
+    {
+        reap(0u);
+    }
+
+    return written;
+}
+
+void ZeroCopySender::reap( uint32_t timeoutMs ) noexcept
+{
+    _reap_completions(timeoutMs);
+    ZeroCopySender::_drain_retired();
+}
+
+void ZeroCopySender::_retire() noexcept
+{
+    // The connection closes its handle next, the retained one keeps the socket and its error queue.
+    const SOCKETHANDLE hRetained{ areg::zerocopy_retain(mSocket) };
+    ZeroCopySender * retired{ areg::is_valid_socket(hRetained) ? new (std::nothrow) ZeroCopySender() : nullptr };
+    if (retired == nullptr)
+    {
+        // Nothing can read the completions: the messages are never returned to the pool.
+        if (areg::is_valid_socket(hRetained))
+        {
+            areg::socket_close(hRetained);
+        }
+
+        static_cast<void>(mPending.release());
+        return;
+    }
+
+    retired->mSocket    = hRetained;
+    retired->mThreshold = mThreshold;
+    retired->mHead      = mHead;
+    retired->mCount     = mCount;
+    retired->mNextId    = mNextId;
+    retired->mPending   = std::move(mPending);
+
+    Lock lock(_retired_lock());
+    std::atomic<ZeroCopySender *> & first{ ZeroCopySender::_retired() };
+    retired->mNextRetired = first.load(std::memory_order_acquire);
+    first.store(retired, std::memory_order_release);
+}
+
+void ZeroCopySender::_reap_completions( uint32_t timeoutMs ) noexcept
+{
+    areg::ZeroCopyDone done[COMPLETIONS];
+    for ( ; ; )
+    {
+        const int32_t count{ areg::zerocopy_completions(mSocket, done, COMPLETIONS, timeoutMs) };
+        for (int32_t i = 0; i < count; ++ i)
+        {
+            _complete(done[i]);
+        }
+
+        if (count < static_cast<int32_t>(COMPLETIONS))
+            break;
+
+        timeoutMs = 0u;
+    }
+}
+
+int32_t ZeroCopySender::_send_buffer( const areg::IoBuffer & buffer, const areg::RawBufferPtr & owner ) noexcept
+{
+    const uint32_t size{ static_cast<uint32_t>(buffer.size) };
+    uint32_t sends{ 0u };
+    const int32_t taken{ areg::send_data_zerocopy(mSocket, buffer.data, size, sends) };
+    if (taken < 0)
+        return taken;
+
+    if (sends != 0u)
+    {
+        Pending & entry{ mPending[(mHead + mCount) % MAX_PENDING] };
+        entry.owner     = owner;
+        entry.first     = mNextId;
+        entry.sends     = sends;
+        entry.done      = 0u;
+        entry.size      = static_cast<uint32_t>(taken);
+        entry.copied    = false;
+        mNextId        += sends;
+        ++ mCount;
+    }
+
+    // The kernel could not pin more pages, the rest is copied.
+    if (static_cast<uint32_t>(taken) < size)
+    {
+        const int32_t sent{ areg::send_data(mSocket, buffer.data + taken, size - static_cast<uint32_t>(taken)) };
+        return (sent < 0 ? sent : taken + sent);
+    }
+
+    return taken;
+}
+
+void ZeroCopySender::_complete( const areg::ZeroCopyDone & done ) noexcept
+{
+    if (done.copied)
+    {
+        // The kernel copies on this route anyway, sending without copying only adds the completions.
+        mSending.store(false, std::memory_order_release);
+    }
+
+    for (uint32_t i = 0u; i < mCount; ++ i)
+    {
+        Pending & entry{ mPending[(mHead + i) % MAX_PENDING] };
+        const uint32_t completed{ ZeroCopySender::completed_sends(entry.first, entry.sends, done) };
+        if (completed != 0u)
+        {
+            entry.done  += completed;
+            entry.copied = entry.copied || done.copied;
+        }
+    }
+
+    // The completions of the sends of a stream arrive in order, the front is released first.
+    while (mCount != 0u)
+    {
+        Pending & entry{ mPending[mHead] };
+        if (entry.done < entry.sends)
+            break;
+
+        if (entry.copied == false)
+        {
+            mSaved.fetch_add(entry.size, std::memory_order_relaxed);
+        }
+
+        entry.owner.reset();
+        mHead = (mHead + 1u) % MAX_PENDING;
+        -- mCount;
+    }
+}
+
+} // namespace areg
@@ -163,6 +163,51 @@ public:
      **/
     void set_append_data( bool prop );
 
+    /**
+     * \brief   Returns the size in bytes of the buffer to stage logs before writing to the file.
+     *          Returns 0 if every message is written directly.
+     **/
+    [[nodiscard]]
+    uint32_t file_buffer_size() const noexcept;
+    /**
+     * \brief   Sets the size in bytes of the buffer to stage logs, rounded up to kilobytes.
+     **/
+    void set_file_buffer_size( uint32_t prop );
+
+    /**
+     * \brief   Returns the maximum time in milliseconds the logs stay in the file staging buffer.
+     **/
+    [[nodiscard]]
+    uint32_t file_latency() const noexcept;
+    /**
+     * \brief   Sets the maximum time in milliseconds the logs stay in the file staging buffer.
+     **/
+    void set_file_latency( uint32_t prop );
+
+    /**
+     * \brief   Returns the size in bytes the log file is rotated at, 0 if not rotated by size.
+     **/
+    [[nodiscard]]
+    uint64_t file_rotate_size() const noexcept;
+
+    /**
+     * \brief   Returns the interval in minutes the log file is rotated, 0 if not rotated by time.
+     **/
+    [[nodiscard]]
+    uint32_t file_rotate_interval() const noexcept;
+
+    /**
+     * \brief   Returns the number of rotated log files to keep, 0 to keep all.
+     **/
+    [[nodiscard]]
+    uint32_t file_retain() const noexcept;
+
+    /**
+     * \brief   Returns true if the log messages are formatted on the logging thread.
+     **/
+    [[nodiscard]]
+    bool is_format_deferred() const noexcept;
+
     /**
      * \brief   Returns the configured log file path.
      **/
@@ -25,6 +25,7 @@
 #include "areg/base/MathDefs.hpp"
 #include "areg/base/StringDefs.hpp"
 
+#include <functional>
 #include <string_view>
 
 /************************************************************************
@@ -88,6 +89,33 @@ namespace areg {
      **/
     constexpr uint32_t          DEFAULT_LOG_QUEUE_SIZE{ 100 };
 
+    /**
+     * \brief  areg::DEFAULT_LOG_FILE_BUFFER
+     *         The default size in kilobytes of the log file staging buffer.
+     **/
+    constexpr uint32_t          DEFAULT_LOG_FILE_BUFFER{ 64 };
+
+    /**
+     * \brief  areg::DEFAULT_LOG_FILE_LATENCY
+     *         The default maximum time in milliseconds the logs stay in the file staging buffer.
+     **/
+    constexpr uint32_t          DEFAULT_LOG_FILE_LATENCY{ 100 };
+
+    /**
+     * \brief  areg::DEFAULT_LOG_FILE_RETAIN
+     *         The default number of rotated log files to keep.
+     **/
+    constexpr uint32_t          DEFAULT_LOG_FILE_RETAIN { 10 };
+
+    /**
+     * \brief  areg::FuncLogSegment
+     *         The handler of a finished log file segment after rotation, called on a background
+     *         thread. Receives the path of the segment and returns the path of the file to keep
+     *         instead (for example, the compressed copy), or an empty string if nothing should
+     *         be kept and counted for the retention.
+     **/
+    using FuncLogSegment = std::function<areg::String (const areg::String & /*segmentPath*/)>;
+
     /**
      * \brief  areg::DEFAULT_LOG_FILE
      *         The default layout to display enter scope on console in the plain text file
@@ -345,6 +373,16 @@ namespace areg {
         , Remote    = 1 //!< The message data is prepared for remote logging.
     };
 
+    /**
+     * \brief   areg::LogRecordFormat
+     *          The format of the log records sent to the log collector.
+     **/
+    enum class LogRecordFormat : uint8_t
+    {
+          Plain     = 1 //!< The log record is the `LogEntry` structure.
+        , Compact   = 2 //!< The log record is variable-length, the names are sent once per connection.
+    };
+
     /**
      * \brief   The structure of logging message object to output on target (log collector or observer).
      **/
@@ -669,16 +707,35 @@ namespace areg {
      **/
     AREG_API MessageEnvelope message_configuration_saved();
 
+    /**
+     * \brief   Creates a message to notify the log source about the format of the log records
+     *          the log collector accepts on the connection.
+     *
+     * \param   source      The ID of the source, i.e. the log collector.
+     * \param   target      The ID of the log source.
+     * \param   format      The format of the log records to send.
+     * \return  The message ready to send to the log source.
+     **/
+    AREG_API MessageEnvelope message_record_format(const ITEM_ID & source, const ITEM_ID & target, areg::LogRecordFormat format);
+
     /**
      * \brief   Sets the external logging database engine.
      **/
     AREG_API void set_db_engine(LogDatabaseEngine* dbEngine);
 
+    /**
+     * \brief   Sets the handler of the log file segments finished by rotation, for example, to
+     *          compress them. The handler runs on a background thread. Pass an empty handler
+     *          to keep the segments as they are.
+     **/
+    AREG_API void set_log_segment_handler(const areg::FuncLogSegment & handler);
+
 //////////////////////////////////////////////////////////////////////////////
 // areg namespace streamable types
 //////////////////////////////////////////////////////////////////////////////
 AREG_IMPLEMENT_STREAMABLE(areg::LogPriority)
 AREG_IMPLEMENT_STREAMABLE(areg::LogMessageType)
+AREG_IMPLEMENT_STREAMABLE(areg::LogRecordFormat)
 
 //////////////////////////////////////////////////////////////////////////////
 // areg namespace objects
@@ -24,7 +24,11 @@ namespace areg {
 
 FileLogger::FileLogger( LogConfiguration & logConfig)
     : LoggerBase(logConfig)
-    , mLogFile  ( )
+    , mLogFiles ( )
+    , mLogFile  ( &mLogFiles[0] )
+    , mLogBuffer( mLogFiles[0] )
+    , mRotator  ( )
+    , mFileOffset       ( 0u )
 {
 }
 
@@ -32,7 +36,7 @@ bool FileLogger::open_logger()
 {
     if (!mLogConfiguration.is_file_logging_enabled())
         return false;
-    if (mLogFile.is_opened())
+    if (mLogFile->is_opened())
         return true;
 
     
@@ -41,42 +45,29 @@ bool FileLogger::open_logger()
         return false;
     
     bool newFile  = static_cast<bool>(mLogConfiguration.append_data()) == false;
-    uint32_t mode = static_cast<uint32_t>(File::OpenMode::Write)      | 
-                    static_cast<uint32_t>(File::OpenMode::Read)       |
-                    static_cast<uint32_t>(File::OpenMode::ShareRead)  |
-                    static_cast<uint32_t>(File::OpenMode::ShareWrite) |
-                    static_cast<uint32_t>(File::OpenMode::Text);
-
-    if (File::has_file(fileName))
+    if ( _open_file(fileName, newFile) && create_layouts() )
     {
-        mode |= newFile ? static_cast<uint32_t>(File::OpenMode::Truncate) : static_cast<uint32_t>(File::OpenMode::Exist);
-    }
-    else
-    {
-        mode |= static_cast<uint32_t>(File::OpenMode::Create);
-    }
-
-    if ( mLogFile.open( fileName, mode) && create_layouts() )
-    {
-            
-        Process & curProcess = Process::instance();
-        areg::LogEntry logMsgHello(areg::LogMessageType::MessageText, 0u, 0u, 0u, areg::LogPriority::PrioIgnoreLayout, nullptr, 0);
-        logMsgHello.logMessageLen = static_cast<uint32_t>(String::format_string( logMsgHello.logMessage
-                                                                               , areg::LOG_MSG_SIZE
-                                                                               , LoggerBase::FORMAT_MESSAGE_HELLO.data()
-                                                                               , DateTime(logMsgHello.logTimestamp).format_time().as_string()
-                                                                               , Process::as_string(curProcess.environment())
-                                                                               , curProcess.full_path().as_string()
-                                                                               , logMsgHello.logModuleId));
-        log_message(logMsgHello);
+        mLogBuffer.initialize(mLogConfiguration.file_buffer_size(), mLogConfiguration.file_latency());
+        mFileOffset     = mLogFile->length();
+        mLogBuffer.reset_written();
+
+        const uint64_t rotateSize{ mLogConfiguration.file_rotate_size() };
+        const std::chrono::minutes interval{ mLogConfiguration.file_rotate_interval() };
+        if ((rotateSize != 0u) || (interval.count() != 0))
+        {
+            File & next{ mLogFile == &mLogFiles[0] ? mLogFiles[1] : mLogFiles[0] };
+            mRotator.start(mLogFile->name(), next, rotateSize, interval, mLogConfiguration.file_retain());
+        }
+
+        _log_hello();
     }
     
-    return mLogFile.is_opened();
+    return mLogFile->is_opened();
 }
 
 void FileLogger::close_logger()
 {
-    if ( mLogFile.is_opened() )
+    if ( mLogFile->is_opened() )
     {
         Process & curProcess = Process::instance();
         areg::LogEntry logMsgGoodbye(areg::LogMessageType::MessageText, 0u, 0u, 0u, areg::LogPriority::PrioIgnoreLayout, nullptr, 0);
@@ -91,26 +82,28 @@ void FileLogger::close_logger()
     }
 
     release_layouts();
-    mLogFile.close();
+    mLogBuffer.release();
+    mRotator.stop();
+    mLogFile->close();
 }
 
 void FileLogger::log_message( const areg::LogEntry & logMessage)
 {
-    if (!mLogFile.is_opened())
+    if (!mLogFile->is_opened())
         return;
     
     switch (logMessage.logMsgType)
     {
     case areg::LogMessageType::MessageText:
-        layout_message().log_message(logMessage, static_cast<OutStream&>(mLogFile));
+        layout_message().log_message(logMessage, static_cast<OutStream&>(mLogBuffer));
         break;
 
     case areg::LogMessageType::ScopeEnter:
-        layout_enter_scope().log_message(logMessage, static_cast<OutStream &>(mLogFile) );
+        layout_enter_scope().log_message(logMessage, static_cast<OutStream &>(mLogBuffer) );
         break;
 
     case areg::LogMessageType::ScopeExit:
-        layout_exit_scope().log_message(logMessage, static_cast<OutStream &>(mLogFile) );
+        layout_exit_scope().log_message(logMessage, static_cast<OutStream &>(mLogBuffer) );
         break;
 
     case areg::LogMessageType::Undefined: // fall through
@@ -118,11 +111,74 @@ void FileLogger::log_message( const areg::LogEntry & logMessage)
         ASSERT(false);  // unexpected message to log
         break;
     }
+
+    mLogBuffer.end_message(logMessage.logMessagePrio == areg::LogPriority::PrioFatal);
+
+    if (_is_rotation_due())
+    {
+        _rotate();
+    }
 }
 
 bool FileLogger::is_logger_opened() const noexcept
 {
-    return mLogFile.is_opened();
+    return mLogFile->is_opened();
+}
+
+void FileLogger::set_segment_handler(const areg::FuncLogSegment & handler)
+{
+    mRotator.set_segment_handler(handler);
+}
+
+bool FileLogger::_open_file(const String & fileName, bool newFile)
+{
+    uint32_t mode = static_cast<uint32_t>(File::OpenMode::Write)      | 
+                    static_cast<uint32_t>(File::OpenMode::Read)       |
+                    static_cast<uint32_t>(File::OpenMode::ShareRead)  |
+                    static_cast<uint32_t>(File::OpenMode::ShareWrite) |
+                    static_cast<uint32_t>(File::OpenMode::Text);
+
+    if (File::has_file(fileName))
+    {
+        mode |= newFile ? static_cast<uint32_t>(File::OpenMode::Truncate) : static_cast<uint32_t>(File::OpenMode::Exist);
+    }
+    else
+    {
+        mode |= static_cast<uint32_t>(File::OpenMode::Create);
+    }
+
+    return mLogFile->open( fileName, mode);
+}
+
+void FileLogger::_log_hello()
+{
+    Process & curProcess = Process::instance();
+    areg::LogEntry logMsgHello(areg::LogMessageType::MessageText, 0u, 0u, 0u, areg::LogPriority::PrioIgnoreLayout, nullptr, 0);
+    logMsgHello.logMessageLen = static_cast<uint32_t>(String::format_string( logMsgHello.logMessage
+                                                                           , areg::LOG_MSG_SIZE
+                                                                           , LoggerBase::FORMAT_MESSAGE_HELLO.data()
+                                                                           , DateTime(logMsgHello.logTimestamp).format_time().as_string()
+                                                                           , Process::as_string(curProcess.environment())
+                                                                           , curProcess.full_path().as_string()
+                                                                           , logMsgHello.logModuleId));
+    log_message(logMsgHello);
+}
+
+inline bool FileLogger::_is_rotation_due() const
+{
+    return mRotator.is_rotation_due(mFileOffset + mLogBuffer.size_written());
+}
+
+void FileLogger::_rotate()
+{
+    // The rotator has the next file open already: switch to it, the rotator thread closes and
+    // renames the finished one.
+    mLogBuffer.flush();
+    mLogFile = &mRotator.exchange(*mLogFile);
+    mLogBuffer.set_file(*mLogFile);
+    mFileOffset = 0u;
+    mLogBuffer.reset_written();
+    _log_hello();
 }
 
 } // namespace areg
@@ -20,6 +20,8 @@
  ************************************************************************/
 #include "areg/base/areg_global.h"
 #include "areg/logging/private/LoggerBase.hpp"
+#include "areg/logging/private/LogFileBuffer.hpp"
+#include "areg/logging/private/LogFileRotator.hpp"
 
 #include "areg/base/File.hpp"
 
@@ -33,6 +35,15 @@ namespace areg {
 /**
  * \brief   Message logger to output messages in the file. At the moment the output logger supports
  *          only ASCII messages and any Unicode character might output wrong.
+ *          The formatted messages are staged in memory and written to the file in batches,
+ *          see LogFileBuffer. The size of the buffer and the maximum latency are set by the
+ *          'log::*::file::buffer' and 'log::*::file::latency' properties. Fatal messages and
+ *          the end of logging flush the buffer immediately.
+ *
+ *          The log file is rotated when it reaches 'log::*::file::maxsize' megabytes or every
+ *          'log::*::file::interval' minutes: the logger continues in the empty file, which
+ *          LogFileRotator has opened in advance, and the rotator thread renames the finished
+ *          file to '<name>.<N><ext>' and keeps 'log::*::file::retain' of the segments.
  **/
 class FileLogger final  : public    LoggerBase
 {
@@ -91,18 +102,72 @@ public:
 
 public:
     /**
-     * \brief   Flushes queued logs. Some loggers might ignore this.
+     * \brief   Writes the staged logs to the file and flushes the file.
      **/
     inline void flush_logs() noexcept;
 
+    /**
+     * \brief   Sets the handler of the log file segments finished by rotation.
+     **/
+    void set_segment_handler( const areg::FuncLogSegment & handler );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Opens the log file for writing.
+     *
+     * \param   fileName    The path of the log file.
+     * \param   newFile     If true, the existing file is truncated, otherwise appended.
+     * \return  Returns true if the file is opened.
+     **/
+    bool _open_file( const String & fileName, bool newFile );
+
+    /**
+     * \brief   Writes the message about the start of logging.
+     **/
+    void _log_hello();
+
+    /**
+     * \brief   Returns true if the log file reached the size or the time to rotate.
+     **/
+    [[nodiscard]]
+    inline bool _is_rotation_due() const;
+
+    /**
+     * \brief   Continues logging in the next file of the rotator, which renames the finished one.
+     **/
+    void _rotate();
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   The log file object
+     * \brief   The log file objects, the rotator opens the next log file with the unused one.
+     **/
+    File              mLogFiles[2];
+
+    /**
+     * \brief   The log file object of the current log file.
+     **/
+    File *            mLogFile;
+
+    /**
+     * \brief   The staging buffer of the log file.
+     **/
+    LogFileBuffer     mLogBuffer;
+
+    /**
+     * \brief   Rotates the log file and handles the finished segments.
+     **/
+    LogFileRotator    mRotator;
+
+    /**
+     * \brief   The size of the log file when it was opened.
      **/
-    File              mLogFile;
+    uint64_t          mFileOffset;
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden / Forbidden calls.
@@ -114,7 +179,8 @@ private:
 
 inline void FileLogger::flush_logs() noexcept
 {
-    mLogFile.flush();
+    mLogBuffer.flush();
+    mLogFile->flush();
 }
 
 } // namespace areg
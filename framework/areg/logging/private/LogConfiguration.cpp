@@ -138,6 +138,46 @@ void LogConfiguration::set_append_data(bool prop)
     mConfigMan.set_file_append(prop);
 }
 
+uint32_t LogConfiguration::file_buffer_size() const noexcept
+{
+    return mConfigMan.log_file_buffer() * areg::ONE_KILOBYTE;
+}
+
+void LogConfiguration::set_file_buffer_size(uint32_t prop)
+{
+    mConfigMan.set_file_buffer((prop + areg::ONE_KILOBYTE - 1u) / areg::ONE_KILOBYTE);
+}
+
+uint32_t LogConfiguration::file_latency() const noexcept
+{
+    return mConfigMan.log_file_latency();
+}
+
+void LogConfiguration::set_file_latency(uint32_t prop)
+{
+    mConfigMan.set_file_latency(prop);
+}
+
+uint64_t LogConfiguration::file_rotate_size() const noexcept
+{
+    return static_cast<uint64_t>(mConfigMan.log_file_maxsize()) * areg::ONE_MEGABYTE;
+}
+
+uint32_t LogConfiguration::file_rotate_interval() const noexcept
+{
+    return mConfigMan.log_file_interval();
+}
+
+uint32_t LogConfiguration::file_retain() const noexcept
+{
+    return mConfigMan.log_file_retain();
+}
+
+bool LogConfiguration::is_format_deferred() const noexcept
+{
+    return mConfigMan.log_format_deferred();
+}
+
 areg::String LogConfiguration::log_file() const
 {
     return mConfigMan.log_file_location();
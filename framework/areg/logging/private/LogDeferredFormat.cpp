@@ -0,0 +1,554 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/logging/private/LogDeferredFormat.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the binary record of a log message formatted on the logging thread.
+ ************************************************************************/
+
+#include "areg/logging/private/LogDeferredFormat.hpp"
+
+#if AREG_LOGGING
+
+#include "areg/logging/LoggingDefs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    /**
+     * \brief   The type of the argument a conversion takes. The integers smaller than int and
+     *          float are promoted, so they are read as int and double.
+     **/
+    enum class ArgType : uint8_t
+    {
+          NoArg         //!< The conversion takes no argument, i.e. "%%".
+        , Int           //!< int, also char and short.
+        , UInt          //!< unsigned int.
+        , Long          //!< long.
+        , ULong         //!< unsigned long.
+        , LongLong      //!< long long.
+        , ULongLong     //!< unsigned long long.
+        , IntMax        //!< intmax_t.
+        , UIntMax       //!< uintmax_t.
+        , Size          //!< size_t.
+        , PtrDiff       //!< ptrdiff_t.
+        , Double        //!< double, also float.
+        , LongDouble    //!< long double.
+        , Pointer       //!< void pointer.
+        , String        //!< null-terminated string of char.
+        , Unsupported   //!< The conversion cannot be captured.
+    };
+
+    /**
+     * \brief   The length modifier of a conversion.
+     **/
+    enum class ArgLength : uint8_t
+    {
+          Default, Char, Short, Long, LongLong, IntMax, Size, PtrDiff, LongDouble
+    };
+
+    //!< The longest conversion specification, including the null-character.
+    constexpr uint32_t  SPEC_SIZE       { 32u };
+    //!< The size of the length in front of a copied string.
+    constexpr uint32_t  LENGTH_SIZE     { static_cast<uint32_t>(sizeof(uint32_t)) };
+    //!< The length that marks a null pointer passed as string.
+    constexpr uint32_t  NULL_STRING     { 0xFFFFFFFFu };
+
+    /**
+     * \brief   One conversion specification of a format string.
+     **/
+    struct FormatSpec
+    {
+        const char *    begin   { nullptr };            //!< The '%' character.
+        const char *    end     { nullptr };            //!< The character after the conversion.
+        ArgType         type    { ArgType::NoArg };     //!< The type of the argument.
+        uint32_t        stars   { 0u };                 //!< The int arguments of the width and precision given as '*'.
+    };
+
+    inline bool _is_digit(char ch) noexcept
+    {
+        return ((ch >= '0') && (ch <= '9'));
+    }
+
+    inline ArgType _signed_type(ArgLength length) noexcept
+    {
+        switch (length)
+        {
+        case ArgLength::Default:    // fall through
+        case ArgLength::Char:       // fall through
+        case ArgLength::Short:
+            return ArgType::Int;
+        case ArgLength::Long:
+            return ArgType::Long;
+        case ArgLength::LongLong:
+            return ArgType::LongLong;
+        case ArgLength::IntMax:
+            return ArgType::IntMax;
+        case ArgLength::Size:
+            return ArgType::Size;
+        case ArgLength::PtrDiff:
+            return ArgType::PtrDiff;
+        case ArgLength::LongDouble: // fall through
+        default:
+            return ArgType::Unsupported;
+        }
+    }
+
+    inline ArgType _unsigned_type(ArgLength length) noexcept
+    {
+        switch (length)
+        {
+        case ArgLength::Default:    // fall through
+        case ArgLength::Char:       // fall through
+        case ArgLength::Short:
+            return ArgType::UInt;
+        case ArgLength::Long:
+            return ArgType::ULong;
+        case ArgLength::LongLong:
+            return ArgType::ULongLong;
+        case ArgLength::IntMax:
+            return ArgType::UIntMax;
+        case ArgLength::Size:
+            return ArgType::Size;
+        case ArgLength::PtrDiff:
+            return ArgType::PtrDiff;
+        case ArgLength::LongDouble: // fall through
+        default:
+            return ArgType::Unsupported;
+        }
+    }
+
+    /**
+     * \brief   Finds the next conversion specification in the format string.
+     *
+     * \param   format  The position in the format string to search from.
+     * \param   spec    On output, contains the found specification. The text before spec.begin
+     *                  is literal.
+     * \return  Returns false if there are no more specifications.
+     **/
+    bool _next_spec(const char * format, FormatSpec & spec) noexcept
+    {
+        const char * pos = std::strchr(format, '%');
+        if (pos == nullptr)
+            return false;
+
+        spec.begin  = pos ++;
+        spec.stars  = 0u;
+        spec.type   = ArgType::Unsupported;
+
+        if (*pos == '%')
+        {
+            spec.end    = pos + 1;
+            spec.type   = ArgType::NoArg;
+            return true;
+        }
+
+        while ((*pos == '-') || (*pos == '+') || (*pos == ' ') || (*pos == '#') || (*pos == '0'))
+            ++ pos;
+
+        if (*pos == '*')
+        {
+            ++ spec.stars;
+            ++ pos;
+        }
+        else
+        {
+            while (_is_digit(*pos))
+                ++ pos;
+        }
+
+        if (*pos == '.')
+        {
+            ++ pos;
+            if (*pos == '*')
+            {
+                ++ spec.stars;
+                ++ pos;
+            }
+            else
+            {
+                while (_is_digit(*pos))
+                    ++ pos;
+            }
+        }
+
+        ArgLength length{ ArgLength::Default };
+        switch (*pos)
+        {
+        case 'h':
+            ++ pos;
+            length = (*pos == 'h') ? ArgLength::Char : ArgLength::Short;
+            pos += (*pos == 'h') ? 1 : 0;
+            break;
+        case 'l':
+            ++ pos;
+            length = (*pos == 'l') ? ArgLength::LongLong : ArgLength::Long;
+            pos += (*pos == 'l') ? 1 : 0;
+            break;
+        case 'j':
+            ++ pos;
+            length = ArgLength::IntMax;
+            break;
+        case 'z':
+            ++ pos;
+            length = ArgLength::Size;
+            break;
+        case 't':
+            ++ pos;
+            length = ArgLength::PtrDiff;
+            break;
+        case 'L':
+            ++ pos;
+            length = ArgLength::LongDouble;
+            break;
+        default:
+            break;
+        }
+
+        if (*pos == '\0')
+        {
+            spec.end = pos;
+            return true;
+        }
+
+        spec.end = pos + 1;
+        if ((spec.end - spec.begin) >= static_cast<std::ptrdiff_t>(SPEC_SIZE))
+            return true;
+
+        switch (*pos)
+        {
+        case 'd':   // fall through
+        case 'i':
+            spec.type = _signed_type(length);
+            break;
+
+        case 'u':   // fall through
+        case 'o':   // fall through
+        case 'x':   // fall through
+        case 'X':
+            spec.type = _unsigned_type(length);
+            break;
+
+        case 'c':
+            spec.type = (length == ArgLength::Default) ? ArgType::Int : ArgType::Unsupported;
+            break;
+
+        case 'f':   // fall through
+        case 'F':   // fall through
+        case 'e':   // fall through
+        case 'E':   // fall through
+        case 'g':   // fall through
+        case 'G':   // fall through
+        case 'a':   // fall through
+        case 'A':
+            if (length == ArgLength::LongDouble)
+                spec.type = ArgType::LongDouble;
+            else if ((length == ArgLength::Default) || (length == ArgLength::Long))
+                spec.type = ArgType::Double;
+            break;
+
+        case 'p':
+            spec.type = (length == ArgLength::Default) ? ArgType::Pointer : ArgType::Unsupported;
+            break;
+
+        case 's':
+            spec.type = (length == ArgLength::Default) ? ArgType::String : ArgType::Unsupported;
+            break;
+
+        default:    // %n and the compiler-specific conversions
+            break;
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief   Writes the value to the record.
+     **/
+    template<typename Type>
+    inline bool _put(char * record, uint32_t space, uint32_t & used, Type value) noexcept
+    {
+        if (space - used < static_cast<uint32_t>(sizeof(Type)))
+            return false;
+
+        std::memcpy(record + used, &value, sizeof(Type));
+        used += static_cast<uint32_t>(sizeof(Type));
+        return true;
+    }
+
+    /**
+     * \brief   Reads the value from the record.
+     **/
+    template<typename Type>
+    inline bool _get(const char * record, uint32_t length, uint32_t & used, Type & value) noexcept
+    {
+        if (length - used < static_cast<uint32_t>(sizeof(Type)))
+            return false;
+
+        std::memcpy(&value, record + used, sizeof(Type));
+        used += static_cast<uint32_t>(sizeof(Type));
+        return true;
+    }
+
+    /**
+     * \brief   Copies a string argument with its length to the record.
+     **/
+    inline bool _put_string(char * record, uint32_t space, uint32_t & used, const char * value) noexcept
+    {
+        if (value == nullptr)
+            return _put<uint32_t>(record, space, used, NULL_STRING);
+
+        const uint32_t len{ static_cast<uint32_t>(std::strlen(value)) };
+        if ((space - used < LENGTH_SIZE) || (space - used - LENGTH_SIZE < len))
+            return false;
+
+        _put<uint32_t>(record, space, used, len);
+        std::memcpy(record + used, value, len);
+        used += len;
+        return true;
+    }
+
+    /**
+     * \brief   Captures the argument of the specification from the list.
+     **/
+    bool _capture_arg(char * record, uint32_t space, uint32_t & used, ArgType type, va_list & args) noexcept
+    {
+        switch (type)
+        {
+        case ArgType::NoArg:
+            return true;
+        case ArgType::Int:
+            return _put(record, space, used, va_arg(args, int));
+        case ArgType::UInt:
+            return _put(record, space, used, va_arg(args, unsigned int));
+        case ArgType::Long:
+            return _put(record, space, used, va_arg(args, long));
+        case ArgType::ULong:
+            return _put(record, space, used, va_arg(args, unsigned long));
+        case ArgType::LongLong:
+            return _put(record, space, used, va_arg(args, long long));
+        case ArgType::ULongLong:
+            return _put(record, space, used, va_arg(args, unsigned long long));
+        case ArgType::IntMax:
+            return _put(record, space, used, va_arg(args, intmax_t));
+        case ArgType::UIntMax:
+            return _put(record, space, used, va_arg(args, uintmax_t));
+        case ArgType::Size:
+            return _put(record, space, used, va_arg(args, size_t));
+        case ArgType::PtrDiff:
+            return _put(record, space, used, va_arg(args, ptrdiff_t));
+        case ArgType::Double:
+            return _put(record, space, used, va_arg(args, double));
+        case ArgType::LongDouble:
+            return _put(record, space, used, va_arg(args, long double));
+        case ArgType::Pointer:
+            return _put(record, space, used, va_arg(args, void *));
+        case ArgType::String:
+            return _put_string(record, space, used, va_arg(args, const char *));
+        case ArgType::Unsupported:  // fall through
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * \brief   Formats one value with the specification and the values of its '*'.
+     **/
+    template<typename Type>
+    inline int _print(char * text, uint32_t space, const char * spec, const int * stars, uint32_t count, Type value) noexcept
+    {
+        switch (count)
+        {
+        case 0u:
+            return std::snprintf(text, space, spec, value);
+        case 1u:
+            return std::snprintf(text, space, spec, stars[0], value);
+        default:
+            return std::snprintf(text, space, spec, stars[0], stars[1], value);
+        }
+    }
+
+    /**
+     * \brief   Reads the value of the specification from the record and formats it.
+     * \return  The number of characters the value needs, or a negative value on error.
+     **/
+    template<typename Type>
+    inline int _print_arg(const char * record, uint32_t length, uint32_t & used, char * text, uint32_t space, const char * spec, const int * stars, uint32_t count) noexcept
+    {
+        Type value{ };
+        return (_get(record, length, used, value) ? _print(text, space, spec, stars, count, value) : -1);
+    }
+
+    int _format_arg(const char * record, uint32_t length, uint32_t & used, ArgType type, char * text, uint32_t space, const char * spec, const int * stars, uint32_t count) noexcept
+    {
+        switch (type)
+        {
+        case ArgType::Int:
+            return _print_arg<int>(record, length, used, text, space, spec, stars, count);
+        case ArgType::UInt:
+            return _print_arg<unsigned int>(record, length, used, text, space, spec, stars, count);
+        case ArgType::Long:
+            return _print_arg<long>(record, length, used, text, space, spec, stars, count);
+        case ArgType::ULong:
+            return _print_arg<unsigned long>(record, length, used, text, space, spec, stars, count);
+        case ArgType::LongLong:
+            return _print_arg<long long>(record, length, used, text, space, spec, stars, count);
+        case ArgType::ULongLong:
+            return _print_arg<unsigned long long>(record, length, used, text, space, spec, stars, count);
+        case ArgType::IntMax:
+            return _print_arg<intmax_t>(record, length, used, text, space, spec, stars, count);
+        case ArgType::UIntMax:
+            return _print_arg<uintmax_t>(record, length, used, text, space, spec, stars, count);
+        case ArgType::Size:
+            return _print_arg<size_t>(record, length, used, text, space, spec, stars, count);
+        case ArgType::PtrDiff:
+            return _print_arg<ptrdiff_t>(record, length, used, text, space, spec, stars, count);
+        case ArgType::Double:
+            return _print_arg<double>(record, length, used, text, space, spec, stars, count);
+        case ArgType::LongDouble:
+            return _print_arg<long double>(record, length, used, text, space, spec, stars, count);
+        case ArgType::Pointer:
+            return _print_arg<void *>(record, length, used, text, space, spec, stars, count);
+
+        case ArgType::String:
+            {
+                uint32_t len{ 0u };
+                if (_get(record, length, used, len) == false)
+                    return -1;
+
+                if (len == NULL_STRING)
+                    return _print<const char *>(text, space, spec, stars, count, nullptr);
+
+                if (length - used < len)
+                    return -1;
+
+                char value[areg::LOG_MSG_SIZE];
+                len = len < areg::LOG_MSG_SIZE ? len : areg::LOG_MSG_SIZE - 1u;
+                std::memcpy(value, record + used, len);
+                value[len] = '\0';
+                used += len;
+                return _print<const char *>(text, space, spec, stars, count, value);
+            }
+
+        case ArgType::NoArg:        // fall through
+        case ArgType::Unsupported:  // fall through
+        default:
+            return -1;
+        }
+    }
+}
+
+namespace areg {
+
+uint32_t LogDeferredFormat::capture(char * record, uint32_t space, const char * format, va_list args) noexcept
+{
+    if ((record == nullptr) || (format == nullptr))
+        return 0u;
+
+    const uint32_t lenFormat{ static_cast<uint32_t>(std::strlen(format)) };
+    uint32_t used{ 0u };
+    if ((space < LENGTH_SIZE + 1u) || (space - LENGTH_SIZE - 1u < lenFormat))
+        return 0u;
+
+    // The format is copied with its null-character, so that the logging thread parses it in place.
+    _put<uint32_t>(record, space, used, lenFormat);
+    std::memcpy(record + used, format, lenFormat + 1u);
+    used += lenFormat + 1u;
+
+    va_list values;
+    va_copy(values, args);
+
+    bool result{ true };
+    FormatSpec spec;
+    const char * pos{ format };
+    while (result && _next_spec(pos, spec))
+    {
+        pos = spec.end;
+        result = (spec.type != ArgType::Unsupported);
+        for (uint32_t i = 0u; result && (i < spec.stars); ++ i)
+        {
+            result = _put(record, space, used, va_arg(values, int));
+        }
+
+        result = result && _capture_arg(record, space, used, spec.type, values);
+    }
+
+    va_end(values);
+    return (result ? used : 0u);
+}
+
+uint32_t LogDeferredFormat::format(const char * record, uint32_t length, char * text, uint32_t space) noexcept
+{
+    if ((text == nullptr) || (space == 0u))
+        return 0u;
+
+    text[0] = '\0';
+    uint32_t lenFormat{ 0u };
+    uint32_t used{ 0u };
+    if ((record == nullptr) || (_get(record, length, used, lenFormat) == false) || (length - used <= lenFormat))
+        return 0u;
+
+    const char * format{ record + used };
+    used += lenFormat + 1u;
+
+    uint32_t written{ 0u };
+    const uint32_t last{ space - 1u };
+    FormatSpec spec;
+    const char * pos{ format };
+    char specText[SPEC_SIZE];
+    bool next{ true };
+
+    while (next && (written < last))
+    {
+        next = _next_spec(pos, spec);
+        const char * literal{ next ? spec.begin : format + lenFormat };
+        uint32_t lenLiteral{ static_cast<uint32_t>(literal - pos) };
+        lenLiteral = lenLiteral < last - written ? lenLiteral : last - written;
+        std::memcpy(text + written, pos, lenLiteral);
+        written += lenLiteral;
+
+        if ((next == false) || (written >= last))
+            break;
+
+        pos = spec.end;
+        if (spec.type == ArgType::NoArg)
+        {
+            text[written ++] = '%';
+            continue;
+        }
+
+        int stars[2]{ 0, 0 };
+        for (uint32_t i = 0u; (i < spec.stars) && next; ++ i)
+        {
+            next = _get(record, length, used, stars[i]);
+        }
+
+        const uint32_t lenSpec{ static_cast<uint32_t>(spec.end - spec.begin) };
+        std::memcpy(specText, spec.begin, lenSpec);
+        specText[lenSpec] = '\0';
+
+        const int count{ next ? _format_arg(record, length, used, spec.type, text + written, space - written, specText, stars, spec.stars) : -1 };
+        if (count < 0)
+            break;
+
+        written += static_cast<uint32_t>(count) < last - written ? static_cast<uint32_t>(count) : last - written;
+    }
+
+    text[written] = '\0';
+    return written;
+}
+
+} // namespace areg
+
+#endif  // AREG_LOGGING
@@ -0,0 +1,88 @@
+#ifndef AREG_LOGGING_PRIVATE_LOGDEFERREDFORMAT_HPP
+#define AREG_LOGGING_PRIVATE_LOGDEFERREDFORMAT_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/logging/private/LogDeferredFormat.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the binary record of a log message formatted on the logging thread.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+
+#include <stdarg.h>
+
+#if AREG_LOGGING
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// LogDeferredFormat class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Moves the formatting of a log message from the calling thread to the logging thread.
+ *          The calling thread captures the format string and the raw values of the arguments
+ *          in a compact binary record, without converting any value to text. The logging thread
+ *          formats the record to the same text as `vsnprintf()` would have produced.
+ *
+ *          The record is self-contained: it holds a copy of the format string and of every
+ *          string argument, so nothing the caller passed must outlive the call.
+ *
+ *          Only the standard conversions are captured. The capture fails and the caller formats
+ *          the message itself when the format has a conversion the record does not support,
+ *          for example `%n`, `%ls` or a compiler-specific length, or when the record does not
+ *          fit in the given space.
+ **/
+class AREG_API LogDeferredFormat
+{
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Captures the format and the arguments in a binary record.
+     *
+     * \param   record      The buffer to write the record.
+     * \param   space       The size of the buffer in bytes.
+     * \param   format      The printf-like format string.
+     * \param   args        The arguments of the format. The list is not consumed.
+     * \return  The size of the record in bytes, or 0 if the message cannot be deferred.
+     **/
+    static uint32_t capture( char * record, uint32_t space, const char * format, va_list args ) noexcept;
+
+    /**
+     * \brief   Formats a binary record to text.
+     *
+     * \param   record      The record written by `capture()`.
+     * \param   length      The size of the record in bytes.
+     * \param   text        The buffer to write the text, always null-terminated.
+     * \param   space       The size of the text buffer in characters, including the null-character.
+     * \return  The length of the text, not including the null-character. The text is truncated
+     *          to fit in the buffer.
+     **/
+    static uint32_t format( const char * record, uint32_t length, char * text, uint32_t space ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    LogDeferredFormat() = delete;
+    ~LogDeferredFormat() = delete;
+    AREG_NOCOPY_NOMOVE( LogDeferredFormat );
+};
+
+} // namespace areg
+
+#endif  // AREG_LOGGING
+
+#endif  // AREG_LOGGING_PRIVATE_LOGDEFERREDFORMAT_HPP
@@ -61,6 +61,10 @@ void LogEventProcessor::process_log_event( const LoggingEventData & data )
         _logging_log_message( data );
         break;
 
+    case LoggingEventData::LogAction::LogDeferred:
+        _logging_log_deferred( data );
+        break;
+
     case LoggingEventData::LogAction::UpdateScopes:   // fall through
     case LoggingEventData::LogAction::QueryScopes:    // fall through
     case LoggingEventData::LogAction::Undefined:      // fall through
@@ -94,6 +98,11 @@ inline void LogEventProcessor::_logging_log_message( const LoggingEventData & da
     mLogManager.write_log_message( data );
 }
 
+inline void LogEventProcessor::_logging_log_deferred( const LoggingEventData & data )
+{
+    mLogManager.write_deferred_message( data );
+}
+
 inline void LogEventProcessor::_change_scope_priority( const SharedBuffer & stream, uint32_t scopeCount )
 {
     String scopeName{ };
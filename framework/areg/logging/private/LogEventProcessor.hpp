@@ -105,6 +105,14 @@ private:
      **/
     void _logging_log_message( const LoggingEventData & data );
 
+    /**
+     * \brief   Formats the log message captured by LogDeferredFormat and writes it to all
+     *          registered loggers.
+     *
+     * \param   data    The logging event data containing the log entry with the captured record.
+     **/
+    void _logging_log_deferred( const LoggingEventData & data );
+
     /**
      * \brief   Changes the priority of the scopes. The streaming object contains the list of scopes
      *          with priority to change. Each scope entry can be either a single scope or scope
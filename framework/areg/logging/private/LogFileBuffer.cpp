@@ -0,0 +1,164 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/logging/private/LogFileBuffer.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the staging buffer of the file logger.
+ ************************************************************************/
+#include "areg/logging/private/LogFileBuffer.hpp"
+
+#include "areg/base/File.hpp"
+#include "areg/base/SharedBuffer.hpp"
+#include "areg/base/SocketDefs.hpp"
+#include "areg/base/String.hpp"
+#include "areg/base/WideString.hpp"
+
+#include <cstring>
+
+#if AREG_LOGGING
+
+namespace areg {
+
+LogFileBuffer::LogFileBuffer( File & logFile )
+    : OutStream ( )
+    , mLogFile  ( &logFile )
+    , mBuffer   ( nullptr )
+    , mCapacity ( 0u )
+    , mUsed     ( 0u )
+    , mWritten  ( 0u )
+    , mLatency  ( 0 )
+    , mStagedAt ( )
+{
+}
+
+LogFileBuffer::~LogFileBuffer()
+{
+    delete [] mBuffer;
+}
+
+void LogFileBuffer::initialize( uint32_t capacity, uint32_t latencyMs )
+{
+    release();
+    mBuffer     = capacity != 0u ? new uint8_t[capacity] : nullptr;
+    mCapacity   = capacity;
+    mLatency    = std::chrono::milliseconds(latencyMs);
+}
+
+void LogFileBuffer::release() noexcept
+{
+    flush();
+    delete [] mBuffer;
+    mBuffer     = nullptr;
+    mCapacity   = 0u;
+}
+
+void LogFileBuffer::set_file( File & logFile ) noexcept
+{
+    flush();
+    mLogFile = &logFile;
+}
+
+bool LogFileBuffer::is_flush_due() const noexcept
+{
+    return ((mUsed != 0u) && ((std::chrono::steady_clock::now() - mStagedAt) >= mLatency));
+}
+
+void LogFileBuffer::end_message( bool isFatal ) noexcept
+{
+    if (isFatal)
+    {
+        flush();
+        mLogFile->flush();
+    }
+    else if (is_flush_due())
+    {
+        flush();
+    }
+}
+
+uint32_t LogFileBuffer::write( const uint8_t * buffer, uint32_t size ) noexcept
+{
+    if ((buffer == nullptr) || (size == 0u))
+        return 0u;
+
+    mWritten += size;
+    if (mCapacity == 0u)
+        return mLogFile->write(buffer, size);
+
+    if (size > mCapacity - mUsed)
+    {
+        if (size < mCapacity / 2u)
+        {
+            flush();
+        }
+        else
+        {
+            // Too big to stage: one gather write of the staged data and the piece.
+            const IoBuffer list[]{ {mBuffer, mUsed}, {buffer, size} };
+            const uint32_t staged{ mUsed };
+            const uint32_t first{ staged != 0u ? 0u : 1u };
+            mUsed = 0u;
+            const uint32_t written{ mLogFile->write_gather(list + first, 2u - first) };
+            return (written > staged ? written - staged : 0u);
+        }
+    }
+
+    if (mUsed == 0u)
+    {
+        mStagedAt = std::chrono::steady_clock::now();
+    }
+
+    std::memcpy(mBuffer + mUsed, buffer, size);
+    mUsed += size;
+    return size;
+}
+
+uint32_t LogFileBuffer::write( const SharedBuffer & buffer )
+{
+    const uint32_t sizeUsed{ buffer.size_used() };
+    const int32_t  length{ static_cast<int32_t>(sizeUsed) };
+    if (write(reinterpret_cast<const uint8_t *>(&length), sizeof(int32_t)) != sizeof(int32_t))
+        return 0u;
+
+    return (write(buffer.buffer(), sizeUsed) == sizeUsed ? sizeUsed + sizeof(int32_t) : 0u);
+}
+
+uint32_t LogFileBuffer::write( const String & ascii )
+{
+    return write(reinterpret_cast<const uint8_t *>(ascii.as_string()), static_cast<uint32_t>(ascii.length()) * sizeof(char));
+}
+
+uint32_t LogFileBuffer::write( const WideString & wide )
+{
+    return write(reinterpret_cast<const uint8_t *>(wide.as_string()), static_cast<uint32_t>(wide.length()) * sizeof(wchar_t));
+}
+
+void LogFileBuffer::flush() noexcept
+{
+    if (mUsed != 0u)
+    {
+        mLogFile->write(mBuffer, mUsed);
+        mUsed = 0u;
+    }
+}
+
+bool LogFileBuffer::ensure_size( uint32_t /*addSize*/ )
+{
+    return true;
+}
+
+uint32_t LogFileBuffer::size_writable() const noexcept
+{
+    return (mCapacity - mUsed);
+}
+
+} // namespace areg
+
+#endif  // AREG_LOGGING
@@ -0,0 +1,234 @@
+#ifndef AREG_LOGGING_PRIVATE_LOGFILEBUFFER_HPP
+#define AREG_LOGGING_PRIVATE_LOGFILEBUFFER_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/logging/private/LogFileBuffer.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the staging buffer of the file logger.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/IOStream.hpp"
+
+#include <chrono>
+
+#if AREG_LOGGING
+
+namespace areg {
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class File;
+
+//////////////////////////////////////////////////////////////////////////
+// LogFileBuffer class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The output stream the file logger passes to the layouts. The layouts write every
+ *          piece of a log line separately, the buffer collects the pieces of many lines in
+ *          memory and writes them to the file with one call when the buffer is full, when
+ *          the oldest staged byte is older than the latency or when it is flushed.
+ *          A piece that does not fit in the buffer is written together with the staged data
+ *          in one gather write, without copying.
+ *
+ *          With zero capacity the buffer is disabled and every piece is written to the file
+ *          directly.
+ *
+ * \note    Not thread safe. Used by the logging thread only.
+ **/
+class AREG_API LogFileBuffer final  : public    OutStream
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates a disabled buffer to write to the given file.
+     **/
+    explicit LogFileBuffer( File & logFile );
+
+    ~LogFileBuffer() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates the buffer. Staged data is written to the file first.
+     *
+     * \param   capacity    The size of the buffer in bytes, 0 disables buffering.
+     * \param   latencyMs   The maximum time in milliseconds the data stays in the buffer.
+     **/
+    void initialize( uint32_t capacity, uint32_t latencyMs );
+
+    /**
+     * \brief   Writes staged data to the file and frees the buffer.
+     **/
+    void release() noexcept;
+
+    /**
+     * \brief   Writes staged data to the current file and continues with the given one.
+     **/
+    void set_file( File & logFile ) noexcept;
+
+    /**
+     * \brief   Returns true if the data is staged in memory before it is written.
+     **/
+    [[nodiscard]]
+    inline bool is_buffered() const noexcept;
+
+    /**
+     * \brief   Returns the number of staged bytes not written to the file yet.
+     **/
+    [[nodiscard]]
+    inline uint32_t size_staged() const noexcept;
+
+    /**
+     * \brief   Returns the number of bytes written through the buffer since the last reset,
+     *          staged or not.
+     **/
+    [[nodiscard]]
+    inline uint64_t size_written() const noexcept;
+
+    /**
+     * \brief   Resets the counter of the written bytes.
+     **/
+    inline void reset_written() noexcept;
+
+    /**
+     * \brief   Returns true if the staged data is older than the latency and should be written.
+     **/
+    [[nodiscard]]
+    bool is_flush_due() const noexcept;
+
+    /**
+     * \brief   Called when a log message is written to the buffer. The message of a fatal error is
+     *          written to the file and flushed to the disk at once, the process may not survive it.
+     *          Otherwise the staged data is written if it is older than the latency.
+     *
+     * \param   isFatal     True if the written message is a fatal error.
+     **/
+    void end_message( bool isFatal ) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+public:
+/************************************************************************/
+// OutStream interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Stages the bytes or writes them to the file. Returns the number of bytes accepted.
+     *
+     * \param   buffer      The byte buffer containing data to write.
+     * \param   size        The number of bytes to write.
+     **/
+    uint32_t write( const uint8_t * buffer, uint32_t size ) noexcept override;
+
+    /**
+     * \brief   Writes the size of the used data and then the data of the buffer.
+     **/
+    uint32_t write( const SharedBuffer & buffer ) override;
+
+    /**
+     * \brief   Writes the characters of the ASCII string without the end of string.
+     **/
+    uint32_t write( const String & ascii ) override;
+
+    /**
+     * \brief   Writes the characters of the wide string without the end of string.
+     **/
+    uint32_t write( const WideString & wide ) override;
+
+    /**
+     * \brief   Writes the staged data to the file. Does not flush the file to the disk.
+     **/
+    void flush() noexcept override;
+
+    /**
+     * \brief   The buffer never grows, always returns true.
+     **/
+    bool ensure_size( uint32_t addSize ) override;
+
+protected:
+    /**
+     * \brief   Returns the free space in the buffer.
+     **/
+    [[nodiscard]]
+    uint32_t size_writable() const noexcept override;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The log file to write.
+    File *                                  mLogFile;
+    //!< The staging buffer.
+    uint8_t *                               mBuffer;
+    //!< The size of the staging buffer in bytes.
+    uint32_t                                mCapacity;
+    //!< The number of staged bytes.
+    uint32_t                                mUsed;
+    //!< The number of bytes written through the buffer since the last reset.
+    uint64_t                                mWritten;
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< The maximum time the data stays in the buffer.
+    std::chrono::milliseconds               mLatency;
+    //!< The time when the first byte of the staged data was written.
+    std::chrono::steady_clock::time_point   mStagedAt;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden / Forbidden calls.
+//////////////////////////////////////////////////////////////////////////
+private:
+    LogFileBuffer() = delete;
+    AREG_NOCOPY_NOMOVE( LogFileBuffer );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// LogFileBuffer class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool LogFileBuffer::is_buffered() const noexcept
+{
+    return (mCapacity != 0u);
+}
+
+inline uint32_t LogFileBuffer::size_staged() const noexcept
+{
+    return mUsed;
+}
+
+inline uint64_t LogFileBuffer::size_written() const noexcept
+{
+    return mWritten;
+}
+
+inline void LogFileBuffer::reset_written() noexcept
+{
+    mWritten = 0u;
+}
+
+} // namespace areg
+
+#endif  // AREG_LOGGING
+#endif  // AREG_LOGGING_PRIVATE_LOGFILEBUFFER_HPP
@@ -0,0 +1,263 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/logging/private/LogFileRotator.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, background processing of the rotated log files.
+ ************************************************************************/
+#include "areg/logging/private/LogFileRotator.hpp"
+
+#include "areg/base/File.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+#if AREG_LOGGING
+
+namespace areg {
+
+namespace
+{
+    //!< The mode to open the log file and the next file, the file is truncated or created.
+    uint32_t _next_file_mode( const String & filePath )
+    {
+        const uint32_t mode { static_cast<uint32_t>(File::OpenMode::Write)      |
+                              static_cast<uint32_t>(File::OpenMode::Read)       |
+                              static_cast<uint32_t>(File::OpenMode::ShareRead)  |
+                              static_cast<uint32_t>(File::OpenMode::ShareWrite) |
+                              static_cast<uint32_t>(File::OpenMode::Text) };
+
+        return mode | (File::has_file(filePath) ? static_cast<uint32_t>(File::OpenMode::Truncate) : static_cast<uint32_t>(File::OpenMode::Create));
+    }
+}
+
+LogFileRotator::LogFileRotator()
+    : ThreadConsumer    ( )
+    , mRotatorThread    ( static_cast<ThreadConsumer &>(self()), String(LogFileRotator::ROTATOR_THREAD_NAME) )
+    , mWakeEvent        ( true, true )
+    , mHandlerLock      ( )
+    , mLogPath          ( )
+    , mNextPath         ( )
+    , mRotateSize       ( 0u )
+    , mSegment          ( 0u )
+    , mRetain           ( 0u )
+    , mNext             ( nullptr )
+    , mHandler          ( )
+    , mSegments         ( )
+    , mInterval         ( 0 )
+    , mRotateAt         ( )
+    , mExchanged        ( nullptr )
+    , mNextReady        ( false )
+    , mQuit             ( false )
+{
+}
+
+LogFileRotator::~LogFileRotator()
+{
+    stop();
+}
+
+bool LogFileRotator::start( const String & logFile, File & next, uint64_t rotateSize, std::chrono::milliseconds interval, uint32_t retain )
+{
+    if (mRotatorThread.is_running())
+        return true;
+
+    const String ext{ File::file_extension(logFile) };
+    String stem{ logFile };
+    stem.substring(0, static_cast<areg::CharCount>(logFile.length() - ext.length()));
+
+    mLogPath    = logFile;
+    mNextPath   = stem + '.' + String(LogFileRotator::NEXT_FILE_MARK) + ext;
+    mRotateSize = rotateSize;
+    mInterval   = interval;
+    mRotateAt   = std::chrono::steady_clock::now() + interval;
+    mRetain     = retain;
+    mNext       = &next;
+    mSegments.clear();
+    mSegment    = _find_segments();
+    mExchanged.store(nullptr, std::memory_order_relaxed);
+    mNextReady.store(false, std::memory_order_relaxed);
+    mQuit.store(false, std::memory_order_relaxed);
+    return mRotatorThread.start(areg::WAIT_INFINITE);
+}
+
+void LogFileRotator::stop()
+{
+    if (mRotatorThread.is_running())
+    {
+        mQuit.store(true, std::memory_order_relaxed);
+        mWakeEvent.set_signaled();
+        mRotatorThread.shutdown(areg::WAIT_INFINITE);
+    }
+
+    mNextReady.store(false, std::memory_order_relaxed);
+    if ((mNext != nullptr) && mNext->is_opened())
+    {
+        mNext->close();
+        File::delete_file(mNextPath);
+    }
+
+    mNext = nullptr;
+}
+
+bool LogFileRotator::is_rotation_due( uint64_t fileSize ) const noexcept
+{
+    if (is_next_ready() == false)
+        return false;
+
+    if ((mRotateSize != 0u) && (fileSize >= mRotateSize))
+        return true;
+
+    return ((mInterval.count() != 0) && (std::chrono::steady_clock::now() >= mRotateAt));
+}
+
+File & LogFileRotator::exchange( File & logFile ) noexcept
+{
+    ASSERT(is_next_ready() && (mNext != nullptr));
+
+    File & next{ *mNext };
+    mNextReady.store(false, std::memory_order_relaxed);
+    mRotateAt = std::chrono::steady_clock::now() + mInterval;
+    mExchanged.store(&logFile, std::memory_order_release);
+    mWakeEvent.set_signaled();
+    return next;
+}
+
+void LogFileRotator::set_segment_handler( const areg::FuncLogSegment & handler )
+{
+    Lock lock(mHandlerLock);
+    mHandler = handler;
+}
+
+void LogFileRotator::on_run()
+{
+    // The segments of the earlier runs may be above the retention count already.
+    _keep_segment(String::EmptyString);
+    _open_next(*mNext);
+
+    while (mQuit.load(std::memory_order_relaxed) == false)
+    {
+        mWakeEvent.lock(areg::WAIT_INFINITE);
+        _rotate();
+    }
+
+    // The log file exchanged right before the stop.
+    _rotate();
+}
+
+uint32_t LogFileRotator::_find_segments()
+{
+    const std::filesystem::path logPath{ mLogPath.as_string() };
+    const std::string stem{ logPath.stem().string() + '.' };
+    const std::string ext{ logPath.extension().string() };
+    std::filesystem::path dirPath{ logPath.parent_path() };
+    if (dirPath.empty())
+    {
+        dirPath = std::filesystem::path(".");
+    }
+
+    std::vector<std::pair<uint32_t, String>> found;
+    std::error_code err;
+    for (std::filesystem::directory_iterator it{ dirPath, err }, last; (err.value() == 0) && (it != last); it.increment(err))
+    {
+        // Only '<stem>.<N><ext>' is a segment, neither the next file nor the handled segments.
+        const std::string name{ it->path().filename().string() };
+        if ((name.size() <= stem.size() + ext.size()) || (name.compare(0, stem.size(), stem) != 0) || (name.compare(name.size() - ext.size(), ext.size(), ext) != 0))
+            continue;
+
+        const std::string number{ name.substr(stem.size(), name.size() - stem.size() - ext.size()) };
+        if ((number.size() > 9u) || (std::all_of(number.begin(), number.end(), [](char ch) { return (ch >= '0') && (ch <= '9'); }) == false))
+            continue;
+
+        found.emplace_back(static_cast<uint32_t>(std::stoul(number)), String(it->path().string()));
+    }
+
+    std::sort(found.begin(), found.end(), [](const auto & lhs, const auto & rhs) { return lhs.first < rhs.first; });
+    for (const auto & segment : found)
+    {
+        mSegments.push_back(segment.second);
+    }
+
+    return (found.empty() ? 0u : found.back().first);
+}
+
+void LogFileRotator::_open_next( File & next )
+{
+    mNext = &next;
+    if (next.open(mNextPath, _next_file_mode(mNextPath)))
+    {
+        mNextReady.store(true, std::memory_order_release);
+    }
+}
+
+bool LogFileRotator::_rotate()
+{
+    File * finished{ mExchanged.exchange(nullptr, std::memory_order_acquire) };
+    if (finished == nullptr)
+        return false;
+
+    finished->close();
+
+    const String ext{ File::file_extension(mLogPath) };
+    String stem{ mLogPath };
+    stem.substring(0, static_cast<areg::CharCount>(mLogPath.length() - ext.length()));
+    String segment;
+    do
+    {
+        segment = stem + '.' + String::make_string(++ mSegment) + ext;
+    } while (File::has_file(segment));
+
+    // The logging thread writes the next file already, it takes the name of the log file.
+    // If a rename fails, the logging continues in the next file and the rotation stops.
+    const bool moved{ File::move_file(mLogPath, segment) };
+    if (moved && File::move_file(mNextPath, mLogPath))
+    {
+        _open_next(*finished);
+    }
+    else
+    {
+        mNext = finished;
+    }
+
+    _keep_segment(moved ? segment : String::EmptyString);
+    return true;
+}
+
+void LogFileRotator::_keep_segment( const String & segment )
+{
+    if (segment.is_empty() == false)
+    {
+        areg::FuncLogSegment handler;
+        do
+        {
+            Lock lock(mHandlerLock);
+            handler = mHandler;
+        } while (false);
+
+        // The handler may replace the segment, for example, by its compressed copy.
+        String kept{ handler ? handler(segment) : segment };
+        if (kept.is_empty() == false)
+        {
+            mSegments.push_back(kept);
+        }
+    }
+
+    while ((mRetain != 0u) && (mSegments.size() > mRetain))
+    {
+        File::delete_file(mSegments.front());
+        mSegments.pop_front();
+    }
+}
+
+} // namespace areg
+
+#endif  // AREG_LOGGING
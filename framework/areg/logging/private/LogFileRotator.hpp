@@ -0,0 +1,273 @@
+#ifndef AREG_LOGGING_PRIVATE_LOGFILEROTATOR_HPP
+#define AREG_LOGGING_PRIVATE_LOGFILEROTATOR_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/logging/private/LogFileRotator.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, background processing of the rotated log files.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/String.hpp"
+#include "areg/base/SyncPrimitives.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/base/ThreadConsumer.hpp"
+#include "areg/logging/LoggingDefs.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+
+#if AREG_LOGGING
+
+namespace areg {
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class File;
+
+//////////////////////////////////////////////////////////////////////////
+// LogFileRotator class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Rotates the log file on a background thread, so that the logging thread only
+ *          switches to the next file. The rotator keeps the next file open in advance, named
+ *          '<name>.next<ext>'. When the rotation is due, the logging thread exchanges its
+ *          file for the next one and continues to write. The rotator thread then closes the
+ *          finished file, renames it to the segment '<name>.<N><ext>', renames the next file
+ *          to the log file name and opens the new next file.
+ *
+ *          Every finished segment is passed to the segment handler, if one is set (for example,
+ *          to compress it), and the oldest segments above the retention count are deleted.
+ *          The segments '<name>.<N><ext>' of the earlier runs are found at the start and are
+ *          counted as the oldest ones.
+ *
+ * \note    The open next file is renamed while the logging thread writes it, the log file is
+ *          opened with the shared write and the rename works on every platform.
+ **/
+class AREG_API LogFileRotator final : private   ThreadConsumer
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The name of the thread rotating the log file.
+    static constexpr std::string_view   ROTATOR_THREAD_NAME { "LogFileRotatorThread" };
+
+    //!< The name between the name and the extension of the log file, which the next file has.
+    static constexpr std::string_view   NEXT_FILE_MARK      { "next" };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    LogFileRotator();
+
+    ~LogFileRotator() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the background thread runs.
+     **/
+    [[nodiscard]]
+    inline bool is_running() const noexcept;
+
+    /**
+     * \brief   Returns true if the next file is open and the log file can be rotated.
+     **/
+    [[nodiscard]]
+    inline bool is_next_ready() const noexcept;
+
+    /**
+     * \brief   Finds the segments of the earlier runs and starts the background thread, which
+     *          opens the next file. Has no effect if the thread runs already.
+     *
+     * \param   logFile     The path of the log file.
+     * \param   next        The closed file object to open the next file with.
+     * \param   rotateSize  The size in bytes to rotate the log file at, 0 if not rotated by size.
+     * \param   interval    The interval to rotate the log file, 0 if not rotated by time.
+     * \param   retain      The number of finished segments to keep, 0 keeps all of them.
+     * \return  Returns true if the thread runs.
+     **/
+    bool start( const String & logFile, File & next, uint64_t rotateSize, std::chrono::milliseconds interval, uint32_t retain );
+
+    /**
+     * \brief   Finishes the started rotation, stops the background thread, closes and deletes
+     *          the next file.
+     **/
+    void stop();
+
+    /**
+     * \brief   Returns true if the log file of the given size should be rotated: it reached the
+     *          size or the interval is over, and the next file is open.
+     *
+     * \param   fileSize    The current size of the log file in bytes.
+     **/
+    [[nodiscard]]
+    bool is_rotation_due( uint64_t fileSize ) const noexcept;
+
+    /**
+     * \brief   Exchanges the log file for the open next file. The given file is closed and
+     *          renamed to a segment by the background thread, it becomes the next file after.
+     *          Call when is_next_ready() returns true.
+     *
+     * \param   logFile     The current log file, the caller does not use it anymore.
+     * \return  Returns the file to continue logging.
+     **/
+    File & exchange( File & logFile ) noexcept;
+
+    /**
+     * \brief   Sets the handler of the finished segments, called on the background thread.
+     *          The empty handler keeps the segments as they are.
+     **/
+    void set_segment_handler( const areg::FuncLogSegment & handler );
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+private:
+/************************************************************************/
+// ThreadConsumer interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Opens the next file and rotates the log file until the thread is stopped.
+     **/
+    void on_run() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Adds the segments '<name>.<N><ext>' of the log file, which exist already, to the
+     *          kept segments, the lowest number first. Returns the highest number found.
+     **/
+    uint32_t _find_segments();
+
+    /**
+     * \brief   Opens the file object of the next file, truncating the file, and marks it ready.
+     **/
+    void _open_next( File & next );
+
+    /**
+     * \brief   Closes the exchanged log file, renames it to the next segment, gives the log
+     *          file name to the next file and opens the new next file. Returns true if the log
+     *          file was exchanged.
+     **/
+    bool _rotate();
+
+    /**
+     * \brief   Passes the finished segment to the handler and deletes the segments above the
+     *          retention count.
+     *
+     * \param   segment     The path of the finished segment, empty to apply the retention only.
+     **/
+    void _keep_segment( const String & segment );
+
+    inline LogFileRotator & self();
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The thread rotating the log file.
+    Thread                  mRotatorThread;
+
+    //!< Signaled when the log file is exchanged or when the thread should stop.
+    SyncEvent               mWakeEvent;
+
+    //!< Guards the handler.
+    mutable SpinLock        mHandlerLock;
+
+    //!< The path of the log file.
+    String                  mLogPath;
+
+    //!< The path of the next file.
+    String                  mNextPath;
+
+    //!< The size in bytes to rotate the log file at, 0 if not rotated by size.
+    uint64_t                mRotateSize;
+
+    //!< The number of the last segment.
+    uint32_t                mSegment;
+
+    //!< The number of segments to keep, 0 keeps all.
+    uint32_t                mRetain;
+
+    //!< The next file, owned by the background thread until it is ready.
+    File *                  mNext;
+
+#if defined(_MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< The handler of the finished segments, guarded by mHandlerLock.
+    areg::FuncLogSegment    mHandler;
+
+    //!< The kept segments, the oldest first. Accessed by the background thread only.
+    std::deque<String>      mSegments;
+
+    //!< The interval to rotate the log file, 0 if not rotated by time.
+    std::chrono::milliseconds               mInterval;
+
+    //!< The time to rotate the log file next, changed by the logging thread only.
+    std::chrono::steady_clock::time_point   mRotateAt;
+
+    //!< The exchanged log file to rotate, nullptr if there is none.
+    std::atomic<File *>     mExchanged;
+
+    //!< True if the next file is open and can be exchanged.
+    std::atomic_bool        mNextReady;
+
+    //!< Set to true to stop the background thread.
+    std::atomic_bool        mQuit;
+#if defined(_MSC_VER)
+    #pragma warning(pop)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( LogFileRotator );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// LogFileRotator class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool LogFileRotator::is_running() const noexcept
+{
+    return mRotatorThread.is_running();
+}
+
+inline bool LogFileRotator::is_next_ready() const noexcept
+{
+    return mNextReady.load(std::memory_order_acquire);
+}
+
+inline LogFileRotator & LogFileRotator::self()
+{
+    return (*this);
+}
+
+} // namespace areg
+
+#endif  // AREG_LOGGING
+#endif  // AREG_LOGGING_PRIVATE_LOGFILEROTATOR_HPP
@@ -23,6 +23,7 @@
 
 #include "areg/logging/LogDatabaseEngine.hpp"
 #include "areg/logging/LogScope.hpp"
+#include "areg/logging/private/LogDeferredFormat.hpp"
 #include "areg/logging/private/LogMessage.hpp"
 
 #if AREG_LOGGING
@@ -71,6 +72,16 @@ void LogManager::log_message(areg::MessageEnvelope&& msg)
     LoggingEvent::send_event(ev, static_cast<LoggingEventConsumer&>(mgr), static_cast<DispatcherThread&>(mgr));
 }
 
+void LogManager::log_deferred(areg::MessageEnvelope&& msg)
+{
+    LogManager& mgr = LogManager::instance();
+    LoggingEvent ev;
+    ev.data().set_action(LoggingEventData::LogAction::LogDeferred);
+    ev.data().message() = std::move(msg);
+
+    LoggingEvent::send_event(ev, static_cast<LoggingEventConsumer&>(mgr), static_cast<DispatcherThread&>(mgr));
+}
+
 void LogManager::log_message(const areg::MessageEnvelope& logData)
 {
     LogManager& mgr = LogManager::instance();
@@ -187,6 +198,11 @@ void LogManager::set_db_engine(LogDatabaseEngine * dbEngine)
     LogManager::instance().mLoggerDatabase.set_database_engine(dbEngine);
 }
 
+void LogManager::set_segment_handler(const areg::FuncLogSegment & handler)
+{
+    LogManager::instance().mLoggerFile.set_segment_handler(handler);
+}
+
 bool LogManager::is_db_initialized() noexcept
 {
     return LogManager::instance().mLoggerDatabase.is_valid();
@@ -213,6 +229,7 @@ LogManager::LogManager()
 
     , mScopeController  ( )
 	, mIsStarted		( false )
+    , mFormatDeferred   ( false )
     , mLogConfig        ( )
 
     , mLoggerFile       ( mLogConfig )
@@ -340,6 +357,7 @@ void LogManager::process_event( const LoggingEventData & data )
 
 void LogManager::start_logs()
 {
+    mFormatDeferred = mLogConfig.is_format_deferred();
     if ( mLogConfig.is_logging_enabled() )
     {
         mScopeController.configure_scopes();
@@ -377,6 +395,7 @@ void LogManager::stop_logs()
     mLogStarted.reset( );
 
     mIsStarted = false;
+    mFormatDeferred = false;
 
     mLoggerDebug.close_logger( );
     mLoggerFile.close_logger( );
@@ -412,6 +431,19 @@ void LogManager::write_log_message( const LoggingEventData & data )
     }
 }
 
+void LogManager::write_deferred_message( const LoggingEventData & data )
+{
+    areg::LogEntry* logEntry = const_cast<areg::LogEntry *>(data.log_entry());
+    ASSERT(logEntry != nullptr);
+
+    char text[areg::LOG_MSG_SIZE];
+    const uint32_t len = LogDeferredFormat::format(logEntry->logMessage, logEntry->logMessageLen, text, areg::LOG_MSG_SIZE);
+    areg::mem_copy(logEntry->logMessage, areg::LOG_MSG_SIZE, text, len + 1u);
+    logEntry->logMessageLen = len;
+
+    write_log_message( data );
+}
+
 bool LogManager::post_event(Event & eventElem)
 {
     return EventDispatcher::post_event(eventElem);
@@ -101,6 +101,20 @@ public:
      **/
     static void log_message( const areg::MessageEnvelope& logData );
 
+    /**
+     * \brief   Triggers a log event from a pre-built message, which text is a record captured
+     *          by LogDeferredFormat. The text is formatted on the logging thread.
+     *
+     * \param   msg     A pre-built message from make_log_message(); moved into the event.
+     **/
+    static void log_deferred( areg::MessageEnvelope && msg );
+
+    /**
+     * \brief   Returns true if the log messages are formatted on the logging thread.
+     **/
+    [[nodiscard]]
+    inline static bool is_format_deferred() noexcept;
+
     /**
      * \brief   Reads logging configuration from a file.
      *
@@ -245,6 +259,13 @@ public:
      **/
     static void set_db_engine(LogDatabaseEngine * dbEngine);
 
+    /**
+     * \brief   Sets the handler of the log file segments finished by rotation.
+     *
+     * \param   handler     The handler called on the background thread, can be empty.
+     **/
+    static void set_segment_handler(const areg::FuncLogSegment & handler);
+
     /**
      * \brief   Returns true if the logging database and tables are initialized and ready.
      **/
@@ -403,6 +424,14 @@ private:
      **/
     void write_log_message( const LoggingEventData & data );
 
+    /**
+     * \brief   Formats the record captured by LogDeferredFormat to the text of the log message
+     *          and dispatches the message to all registered loggers.
+     *
+     * \param   data    The logging event data containing the log entry with the captured record.
+     **/
+    void write_deferred_message( const LoggingEventData & data );
+
     /**
      * \brief   Sends a logging event with the specified priority.
      *
@@ -444,6 +473,10 @@ private:
      * \brief   Flag, indicating whether the logging is started or not
      **/
     bool                mIsStarted;
+    /**
+     * \brief   Flag, indicating whether the log messages are formatted on the logging thread.
+     **/
+    bool                mFormatDeferred;
     /**
      * \brief   Logging configuration
      **/
@@ -534,6 +567,11 @@ inline bool LogManager::is_logging_started() noexcept
     return instance().mIsStarted;
 }
 
+inline bool LogManager::is_format_deferred() noexcept
+{
+    return instance().mFormatDeferred;
+}
+
 } // namespace areg
 
 #endif  // AREG_LOGGING
@@ -0,0 +1,285 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/logging/private/LogRecordCodec.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the compact format of the log records sent to the log collector.
+ ************************************************************************/
+
+#include "areg/logging/private/LogRecordCodec.hpp"
+
+#include "areg/component/EventDefs.hpp"
+#include "areg/component/ServiceDefs.hpp"
+
+#include <cstring>
+
+namespace
+{
+    //!< The maximum number of bytes of a varint of 64 bits.
+    constexpr uint32_t  VARINT_MAX_SIZE { 10u };
+
+    inline areg::EventHeader _compact_message_header() noexcept
+    {
+        areg::EventHeader hdr{};
+        hdr.checksum   = areg::CHECKSUM_INVALID;
+        hdr.target     = static_cast<uint32_t>(areg::COOKIE_LOGGER);
+        hdr.messageId  = static_cast<uint32_t>(areg::FuncIdRange::ServiceLogCompactMessage);
+        hdr.eventType  = static_cast<uint16_t>(areg::EventType::EventRemoteConnection);
+        hdr.result     = areg::MESSAGE_SUCCESS;
+        hdr.sequenceNr = areg::SEQUENCE_NUMBER_NOTIFY;
+        return hdr;
+    }
+
+    inline areg::EventHeader _plain_message_header() noexcept
+    {
+        areg::EventHeader hdr{ _compact_message_header() };
+        hdr.messageId  = static_cast<uint32_t>(areg::FuncIdRange::ServiceLogMessage);
+        return hdr;
+    }
+
+    inline uint8_t * _write_varint(uint8_t * dst, uint64_t value) noexcept
+    {
+        while (value >= 0x80u)
+        {
+            *dst ++ = static_cast<uint8_t>(value | 0x80u);
+            value >>= 7;
+        }
+
+        *dst ++ = static_cast<uint8_t>(value);
+        return dst;
+    }
+
+    inline const uint8_t * _read_varint(const uint8_t * src, const uint8_t * end, uint64_t & value) noexcept
+    {
+        value = 0u;
+        for (uint32_t shift = 0u; (src < end) && (shift < VARINT_MAX_SIZE * 7u); shift += 7u)
+        {
+            const uint8_t byte{ *src ++ };
+            value |= static_cast<uint64_t>(byte & 0x7Fu) << shift;
+            if ((byte & 0x80u) == 0u)
+                return src;
+        }
+
+        return nullptr;
+    }
+
+    template<typename Type>
+    inline const uint8_t * _read_field(const uint8_t * src, const uint8_t * end, Type & field) noexcept
+    {
+        uint64_t value{ 0u };
+        src = (src != nullptr ? _read_varint(src, end, value) : nullptr);
+        field = static_cast<Type>(value);
+        return src;
+    }
+
+    inline uint64_t _zigzag(int64_t value) noexcept
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    inline int64_t _unzigzag(uint64_t value) noexcept
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1u);
+    }
+}
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// LogRecordEncoder class implementation
+//////////////////////////////////////////////////////////////////////////
+
+void LogRecordEncoder::reset()
+{
+    mThreads.clear();
+    mModules.clear();
+    mNameCount = 0u;
+    mLastStamp = 0;
+}
+
+MessageEnvelope LogRecordEncoder::encode(const areg::LogEntry & entry, const ITEM_ID & cookie)
+{
+    // Reserve the largest record, so that the names and the timestamp change only if it is sent.
+    MessageEnvelope msgCompact;
+    uint8_t * const record{ msgCompact.init_envelope(_compact_message_header(), LogRecordEncoder::MAX_RECORD_SIZE) };
+    if (record == nullptr)
+        return msgCompact;
+
+    uint8_t * dst{ record };
+    *dst ++ = static_cast<uint8_t>(entry.logMsgType);
+    dst = _write_varint(dst, static_cast<uint64_t>(entry.logMessagePrio));
+    dst = _write_varint(dst, entry.logScopeId);
+    dst = _write_varint(dst, entry.logSessionId);
+    dst = _write_varint(dst, entry.logDuration);
+    dst = _write_varint(dst, _zigzag(static_cast<int64_t>(entry.logTimestamp - mLastStamp)));
+    dst = _write_varint(dst, static_cast<uint64_t>(entry.logReceived));
+    dst = _write_varint(dst, static_cast<uint64_t>(entry.logSource));
+    dst = _write_varint(dst, static_cast<uint64_t>(entry.logTarget));
+    dst = _write_name(dst, mThreads, entry.logThreadId, entry.logThread, entry.logThreadLen);
+    dst = _write_name(dst, mModules, entry.logModuleId, entry.logModule, entry.logModuleLen);
+
+    const uint32_t textLen{ entry.logMessageLen < areg::LOG_MSG_SIZE ? entry.logMessageLen : areg::LOG_MSG_SIZE - 1u };
+    dst = _write_varint(dst, textLen);
+    std::memcpy(dst, entry.logMessage, textLen);
+    dst += textLen;
+
+    mLastStamp = entry.logTimestamp;
+
+    msgCompact.set_size_used(static_cast<uint32_t>(dst - record));
+    msgCompact.move_to_end();
+    msgCompact.set_source(static_cast<uint32_t>(cookie));
+    return msgCompact;
+}
+
+void LogRecordEncoder::offer_format(MessageEnvelope & msgRegisterScopes)
+{
+    msgRegisterScopes.move_to_end();
+    msgRegisterScopes << areg::LogRecordFormat::Compact;
+}
+
+uint8_t * LogRecordEncoder::_write_name(uint8_t * dst, NameIndex & names, ITEM_ID id, const char * name, uint32_t length)
+{
+    length = length < areg::LOG_NAME_SIZE ? length : areg::LOG_NAME_SIZE - 1u;
+
+    auto pos = names.find(id);
+    if ((pos != names.end()) && (pos->second.neName.size() == length) && (std::memcmp(pos->second.neName.data(), name, length) == 0))
+    {
+        return _write_varint(dst, pos->second.neRef);
+    }
+
+    // A new thread or module, or a thread ID reused with another name.
+    if (mNameCount < LogRecordEncoder::MAX_NAMES)
+    {
+        NameEntry & entry{ names[id] };
+        entry.neRef = ++ mNameCount;
+        entry.neName.assign(name, length);
+    }
+
+    dst = _write_varint(dst, 0u);
+    dst = _write_varint(dst, static_cast<uint64_t>(id));
+    dst = _write_varint(dst, length);
+    std::memcpy(dst, name, length);
+    return (dst + length);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// LogRecordDecoder class implementation
+//////////////////////////////////////////////////////////////////////////
+
+void LogRecordDecoder::reset()
+{
+    mNames.clear();
+    mLastStamp = 0;
+}
+
+MessageEnvelope LogRecordDecoder::decode(const MessageEnvelope & msgCompact)
+{
+    MessageEnvelope msgPlain;
+    const uint8_t * src{ msgCompact.buffer() };
+    const uint8_t * end{ src + msgCompact.size_used() };
+    if ((src == nullptr) || (src == end))
+        return msgPlain;
+
+    areg::LogEntry * log{ reinterpret_cast<areg::LogEntry *>(msgPlain.init_envelope(_plain_message_header(), sizeof(areg::LogEntry))) };
+    if (log == nullptr)
+        return msgPlain;
+
+    uint64_t delta{ 0u };
+    uint32_t textLen{ 0u };
+    log->logMsgType = static_cast<areg::LogMessageType>(*src ++);
+    src = _read_field(src, end, log->logMessagePrio);
+    src = _read_field(src, end, log->logScopeId);
+    src = _read_field(src, end, log->logSessionId);
+    src = _read_field(src, end, log->logDuration);
+    src = _read_field(src, end, delta);
+    src = _read_field(src, end, log->logReceived);
+    src = _read_field(src, end, log->logSource);
+    src = _read_field(src, end, log->logTarget);
+    src = (src != nullptr ? _read_name(src, end, log->logThreadId, log->logThread, log->logThreadLen) : nullptr);
+    src = (src != nullptr ? _read_name(src, end, log->logModuleId, log->logModule, log->logModuleLen) : nullptr);
+    src = _read_field(src, end, textLen);
+    if ((src == nullptr) || (textLen >= areg::LOG_MSG_SIZE) || (static_cast<uint32_t>(end - src) < textLen))
+        return MessageEnvelope{};
+
+    std::memcpy(log->logMessage, src, textLen);
+    log->logMessage[textLen] = '\0';
+    log->logMessageLen  = textLen;
+
+    mLastStamp         += _unzigzag(delta);
+    log->logTimestamp   = mLastStamp;
+    log->logDataType    = areg::LogDataType::Remote;
+    log->logCookie      = static_cast<ITEM_ID>(msgCompact.source());
+
+    msgPlain.set_size_used(sizeof(areg::LogEntry));
+    msgPlain.move_to_end();
+    msgPlain.set_source(msgCompact.source());
+    msgPlain.set_target(msgCompact.target());
+    return msgPlain;
+}
+
+bool LogRecordDecoder::is_format_offered(const MessageEnvelope & msgRegisterScopes)
+{
+    // The offer follows the list of scopes.
+    msgRegisterScopes.move_to_begin();
+    uint32_t scopeCount{ 0u };
+    msgRegisterScopes >> scopeCount;
+
+    areg::ScopeEntry scope{};
+    for (uint32_t i = 0u; (i < scopeCount) && (msgRegisterScopes.position() < msgRegisterScopes.size_used()); ++ i)
+    {
+        msgRegisterScopes >> scope;
+    }
+
+    areg::LogRecordFormat format{ areg::LogRecordFormat::Plain };
+    if (msgRegisterScopes.position() + sizeof(areg::LogRecordFormat) <= msgRegisterScopes.size_used())
+    {
+        msgRegisterScopes >> format;
+    }
+
+    msgRegisterScopes.move_to_begin();
+    return (format == areg::LogRecordFormat::Compact);
+}
+
+const uint8_t * LogRecordDecoder::_read_name(const uint8_t * src, const uint8_t * end, ITEM_ID & id, char * name, uint32_t & length)
+{
+    uint64_t ref{ 0u };
+    src = _read_varint(src, end, ref);
+    if (src == nullptr)
+        return nullptr;
+
+    if (ref != 0u)
+    {
+        if (ref > mNames.size())
+            return nullptr;
+
+        const NameEntry & entry{ mNames[static_cast<size_t>(ref - 1u)] };
+        id      = entry.neId;
+        length  = static_cast<uint32_t>(entry.neName.size());
+        std::memcpy(name, entry.neName.data(), length);
+        name[length] = '\0';
+        return src;
+    }
+
+    src = _read_field(src, end, id);
+    src = _read_field(src, end, length);
+    if ((src == nullptr) || (length >= areg::LOG_NAME_SIZE) || (static_cast<uint32_t>(end - src) < length))
+        return nullptr;
+
+    std::memcpy(name, src, length);
+    name[length] = '\0';
+    if (mNames.size() < LogRecordEncoder::MAX_NAMES)
+    {
+        mNames.push_back(NameEntry{ id, std::string(name, length) });
+    }
+
+    return (src + length);
+}
+
+} // namespace areg
@@ -0,0 +1,258 @@
+#ifndef AREG_LOGGING_PRIVATE_LOGRECORDCODEC_HPP
+#define AREG_LOGGING_PRIVATE_LOGRECORDCODEC_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        areg/logging/private/LogRecordCodec.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the compact format of the log records sent to the log collector.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/MessageEnvelope.hpp"
+#include "areg/logging/LoggingDefs.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/************************************************************************
+ * The compact log record.
+ *
+ * A plain log record is the whole `LogEntry` structure, about 700 bytes,
+ * most of them the unused rest of the message text and of the thread and
+ * module names. The compact record is the payload of the message
+ * `ServiceLogCompactMessage` and has the same fields, written in this order:
+ *
+ *      uint8_t     the message type.
+ *      varint      the priority, the scope ID, the session ID and the duration.
+ *      varint      the timestamp, the zigzag-encoded difference to the
+ *                  timestamp of the previous record of the connection.
+ *      varint      the received timestamp, the source and the target.
+ *      name        the thread ID and name.
+ *      name        the module ID and name.
+ *      varint      the length of the message text, then the text without
+ *                  the null-character.
+ *
+ * The varint is the unsigned LEB128 encoding: 7 bits per byte, the lowest
+ * first, the highest bit set when more bytes follow. A name is a varint
+ * reference: the number of a name sent before on the connection, or 0
+ * followed by the varint ID, the varint length and the characters of a new
+ * name. Both sides number the new names in the order they are sent, up to
+ * LogRecordEncoder::MAX_NAMES.
+ *
+ * The log source offers the compact format by appending the format to the
+ * scope registration sent on connect; an old log collector does not read
+ * past the scopes. The log collector accepts it with the message
+ * `ServiceLogRecordFormat`, then decodes the compact records to plain
+ * records, so that the observers and the database receive what they did
+ * before. An old log source does not offer it and keeps sending plain records.
+ ************************************************************************/
+
+namespace areg {
+
+//////////////////////////////////////////////////////////////////////////
+// LogRecordEncoder class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Encodes the log records of one connection to the log collector in the compact
+ *          format. The encoder keeps the names sent on the connection and the timestamp of
+ *          the last record, so it is reset when the connection changes. Not thread-safe.
+ **/
+class AREG_API LogRecordEncoder
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The maximum number of names numbered on one connection. Other names are sent each time.
+    static constexpr uint32_t   MAX_NAMES       { 4'096u };
+
+    //!< The maximum size of a compact record.
+    static constexpr uint32_t   MAX_RECORD_SIZE { 1'024u };
+
+private:
+    /**
+     * \brief   A name sent on the connection.
+     **/
+    struct NameEntry
+    {
+        uint32_t    neRef   { 0u }; //!< The reference of the name, the number of the name plus 1.
+        std::string neName  { };    //!< The name.
+    };
+
+    //!< The names of the threads or of the modules sent on the connection, the key is the ID.
+    using NameIndex = std::unordered_map<ITEM_ID, NameEntry>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    LogRecordEncoder() = default;
+    ~LogRecordEncoder() = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Forgets the names and the timestamp, to start a new connection.
+     **/
+    void reset();
+
+    /**
+     * \brief   Encodes the log record in the compact format.
+     *
+     * \param   entry   The log record prepared for remote logging.
+     * \param   cookie  The cookie of the connection, the source of the message.
+     * \return  The message `ServiceLogCompactMessage` to send to the log collector,
+     *          or an invalid message on allocation failure.
+     **/
+    [[nodiscard]]
+    MessageEnvelope encode(const areg::LogEntry & entry, const ITEM_ID & cookie);
+
+    /**
+     * \brief   Offers the compact format with the scope registration sent on connect.
+     *
+     * \param   msgRegisterScopes   The message `ServiceLogRegisterScopes` to append the offer.
+     **/
+    static void offer_format(MessageEnvelope & msgRegisterScopes);
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Writes the reference of the name, or the new name, and numbers the new name.
+     *
+     * \param   dst     The position in the record to write.
+     * \param   names   The names of the threads or of the modules.
+     * \param   id      The ID of the thread or of the module.
+     * \param   name    The name of the thread or of the module.
+     * \param   length  The length of the name.
+     * \return  The position in the record after the name.
+     **/
+    uint8_t * _write_name(uint8_t * dst, NameIndex & names, ITEM_ID id, const char * name, uint32_t length);
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The thread names sent on the connection.
+    NameIndex   mThreads    { };
+    //!< The module names sent on the connection.
+    NameIndex   mModules    { };
+    //!< The number of the names numbered on the connection.
+    uint32_t    mNameCount  { 0u };
+    //!< The timestamp of the last record.
+    TIME64      mLastStamp  { 0 };
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( LogRecordEncoder );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// LogRecordDecoder class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Decodes the compact log records of one log source back to plain records.
+ *          The decoder mirrors the names and the timestamp of the encoder, so every
+ *          connection has its own decoder. Not thread-safe.
+ **/
+class AREG_API LogRecordDecoder
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   A name received on the connection.
+     **/
+    struct NameEntry
+    {
+        ITEM_ID     neId    { 0u }; //!< The ID of the thread or of the module.
+        std::string neName  { };    //!< The name.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    LogRecordDecoder() = default;
+    ~LogRecordDecoder() = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Forgets the names and the timestamp, to start a new connection.
+     **/
+    void reset();
+
+    /**
+     * \brief   Decodes the compact log record.
+     *
+     * \param   msgCompact  The message `ServiceLogCompactMessage` received from the log source.
+     * \return  The message `ServiceLogMessage` with the plain record, or an invalid message
+     *          if the record is malformed.
+     **/
+    [[nodiscard]]
+    MessageEnvelope decode(const MessageEnvelope & msgCompact);
+
+    /**
+     * \brief   Returns true if the log source offered the compact format with the scope registration.
+     *
+     * \param   msgRegisterScopes   The message `ServiceLogRegisterScopes` received from the log source.
+     **/
+    [[nodiscard]]
+    static bool is_format_offered(const MessageEnvelope & msgRegisterScopes);
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Reads the reference of the name or the new name, and numbers the new name.
+     *
+     * \param   src     The position in the record to read.
+     * \param   end     The end of the record.
+     * \param   id      On output, the ID of the thread or of the module.
+     * \param   name    The buffer of LOG_NAME_SIZE characters to copy the name.
+     * \param   length  On output, the length of the name.
+     * \return  The position in the record after the name, or nullptr if the name is malformed.
+     **/
+    const uint8_t * _read_name(const uint8_t * src, const uint8_t * end, ITEM_ID & id, char * name, uint32_t & length);
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The names received on the connection, in the order they are numbered.
+    std::vector<NameEntry>  mNames      { };
+    //!< The timestamp of the last record.
+    TIME64                  mLastStamp  { 0 };
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    AREG_NOCOPY_NOMOVE( LogRecordDecoder );
+};
+
+} // namespace areg
+
+#endif  // AREG_LOGGING_PRIVATE_LOGRECORDCODEC_HPP
@@ -104,7 +104,7 @@ areg::LogEntry::LogEntry(areg::LogMessageType msgType, uint32_t scopeId, uint32_
     , logDuration   { scopeStamp != 0u ? static_cast<uint32_t>(logTimestamp - scopeStamp) : 0u }
     , logSessionId  { sessionId }
     , logModuleId   { static_cast<ITEM_ID>(Process::instance().id()) }
-    , logThreadId   { static_cast<ITEM_ID>(Thread::current_thread_id()) }
+    , logThreadId   { static_cast<ITEM_ID>(Thread::current_logical_id()) }
     , logSource     { areg::COOKIE_LOCAL }
     , logThreadLen  { 0 }
     , logModuleLen  { 0 }
@@ -255,7 +255,7 @@ AREG_API_IMPL areg::MessageEnvelope areg::make_log_message( areg::LogMessageType
         log->logSource      = areg::COOKIE_LOCAL;
         log->logTarget      = areg::COOKIE_LOGGER;
         log->logCookie      = areg::COOKIE_LOCAL;
-        log->logThreadId    = static_cast<ITEM_ID>(Thread::current_thread_id());
+        log->logThreadId    = static_cast<ITEM_ID>(Thread::current_logical_id());
         log->logTimestamp   = now;
         log->logReceived    = DateTime::INVALID_TIME;
         log->logDuration    = scopeStamp != 0u ? static_cast<uint32_t>(now - scopeStamp) : 0u;
@@ -493,11 +493,30 @@ AREG_API_IMPL areg::MessageEnvelope areg::message_configuration_saved()
     return msgScope;
 }
 
+AREG_API_IMPL areg::MessageEnvelope areg::message_record_format(const ITEM_ID& source, const ITEM_ID& target, areg::LogRecordFormat format)
+{
+    MessageEnvelope msgFormat;
+    if ((target != areg::COOKIE_UNKNOWN) && (msgFormat.init_envelope(_log_empty_header()) != nullptr))
+    {
+        msgFormat.set_message_id(static_cast<uint32_t>(areg::FuncIdRange::ServiceLogRecordFormat));
+        msgFormat.set_target(static_cast<uint32_t>(target));
+        msgFormat.set_source(static_cast<uint32_t>(source));
+        msgFormat << format;
+    }
+
+    return msgFormat;
+}
+
 AREG_API_IMPL void areg::set_db_engine(LogDatabaseEngine * dbEngine)
 {
     LogManager::set_db_engine(dbEngine);
 }
 
+AREG_API_IMPL void areg::set_log_segment_handler(const areg::FuncLogSegment & handler)
+{
+    LogManager::set_segment_handler(handler);
+}
+
 AREG_API_IMPL bool areg::force_start_logging()
 {
     LogManager::set_default_configuration(false);
@@ -659,10 +678,19 @@ AREG_API_IMPL areg::MessageEnvelope areg::message_configuration_saved()
     return areg::MessageEnvelope{};
 }
 
+AREG_API_IMPL areg::MessageEnvelope areg::message_record_format(const ITEM_ID & /*source*/, const ITEM_ID & /*target*/, areg::LogRecordFormat /*format*/)
+{
+    return areg::MessageEnvelope{};
+}
+
 AREG_API_IMPL void areg::set_db_engine(areg::LogDatabaseEngine * /*dbEngine*/)
 {
 }
 
+AREG_API_IMPL void areg::set_log_segment_handler(const areg::FuncLogSegment & /*handler*/)
+{
+}
+
 AREG_API_IMPL bool areg::force_start_logging()
 {
     return true;
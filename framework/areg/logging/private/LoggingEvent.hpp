@@ -56,6 +56,7 @@ public:
         , LogMessage    //!< Action to output logging message
         , UpdateScopes  //!< Action to update scope priorities
         , QueryScopes   //!< Action to send the list of scopes.
+        , LogDeferred   //!< Action to format and output logging message captured by LogDeferredFormat
     };
 
     /**
@@ -198,6 +199,8 @@ inline constexpr const char * LoggingEventData::as_string( LoggingEventData::Log
         return "LoggingEventData::LogAction::UpdateScopes";
     case LoggingEventData::LogAction::QueryScopes:
         return "LoggingEventData::LogAction::QueryScopes";
+    case LoggingEventData::LogAction::LogDeferred:
+        return "LoggingEventData::LogAction::LogDeferred";
     default:
         ASSERT(false);
         return "ERR: Undefined LoggingEventData::LogAction value!";
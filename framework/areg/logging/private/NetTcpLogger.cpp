@@ -46,6 +46,10 @@ NetTcpLogger::NetTcpLogger(LogConfiguration & logConfig, ScopeController & scope
     , mScopeController  ( scopeController )
     , mIsEnabled        ( false )
     , mRingStack        ( 0, areg::OverlapPolicy::Shift )
+    , mEncoder          ( )
+    , mCompactSession   ( 0u )
+    , mEncoderSession   ( 0u )
+    , mSessionCounter   ( 0u )
 {
 }
 
@@ -91,7 +95,7 @@ void NetTcpLogger::log_message(const areg::LogEntry& logMessage)
 
     if (mChannel.is_valid() && is_connected_state())
     {
-        send_message(areg::create_log_message(logMessage, areg::LogDataType::Remote, mChannel.cookie()), areg::EventPriority::NormalPrio);
+        send_message(_encode_record(areg::create_log_message(logMessage, areg::LogDataType::Remote, mChannel.cookie())), areg::EventPriority::NormalPrio);
     }
     else if (mRingStack.capacity() != 0)
     {
@@ -106,7 +110,7 @@ void NetTcpLogger::forward_message(const areg::MessageEnvelope& msg)
 
     if (mChannel.is_valid() && is_connected_state())
     {
-        send_message(msg, areg::EventPriority::NormalPrio);
+        send_message(_encode_record(areg::MessageEnvelope(msg)), areg::EventPriority::NormalPrio);
     }
     else if (mRingStack.capacity() != 0)
     {
@@ -121,7 +125,7 @@ void NetTcpLogger::forward_message(areg::MessageEnvelope&& msg)
 
     if (mChannel.is_valid() && is_connected_state())
     {
-        send_message(std::move(msg), areg::EventPriority::NormalPrio);
+        send_message(_encode_record(std::move(msg)), areg::EventPriority::NormalPrio);
     }
     else if (mRingStack.capacity() != 0)
     {
@@ -144,8 +148,13 @@ void NetTcpLogger::on_service_channel_connected(const Channel & channel)
     mIsEnabled = true;
     const ITEM_ID& cookie = channel.cookie();
 
+    // The records stay plain until the log collector accepts the compact format offered
+    // with the scopes, an old log collector does not answer the offer.
+    mCompactSession.store(0u, std::memory_order_release);
     const areg::ScopeList& scopes{ static_cast<const areg::ScopeList&>(mScopeController.scope_list()) };
-    send_message(areg::message_register_scopes(cookie, areg::COOKIE_LOGGER, scopes));
+    areg::MessageEnvelope msgScopes{ areg::message_register_scopes(cookie, areg::COOKIE_LOGGER, scopes) };
+    LogRecordEncoder::offer_format(msgScopes);
+    send_message(msgScopes);
 
     while (mRingStack.is_empty() == false)
     {
@@ -160,12 +169,14 @@ void NetTcpLogger::on_service_channel_disconnected(const Channel & /* channel */
 {
     ASSERT(mChannel.is_valid() == false);
     mIsEnabled = false;
+    mCompactSession.store(0u, std::memory_order_release);
     mClientConnection.set_cookie(areg::COOKIE_UNKNOWN);
 }
 
 void NetTcpLogger::on_service_channel_lost(const Channel & /* channel */)
 {
     ASSERT(mChannel.is_valid() == false);
+    mCompactSession.store(0u, std::memory_order_release);
     mClientConnection.set_cookie(areg::COOKIE_UNKNOWN);
 }
 
@@ -175,7 +186,9 @@ void NetTcpLogger::failed_send_message(const MessageEnvelope & msgFailed, Socket
         return;
 
     ASSERT(mIsEnabled);
-    if (mLogConfiguration.stack_size() > 0)
+    // A compact record refers to the names and the timestamp of the lost connection, so it
+    // cannot be sent again on the next one.
+    if ((mLogConfiguration.stack_size() > 0) && (msgFailed.message_id() != static_cast<uint32_t>(areg::FuncIdRange::ServiceLogCompactMessage)))
     {
         mRingStack.push(msgFailed);
     }
@@ -241,6 +254,19 @@ void NetTcpLogger::process_received_message(MessageEnvelope & msgReceived, Socke
         }
         break;
 
+    case areg::FuncIdRange::ServiceLogRecordFormat:
+        {
+            areg::LogRecordFormat format{ areg::LogRecordFormat::Plain };
+            msgReceived >> format;
+            if (format == areg::LogRecordFormat::Compact)
+            {
+                // Every accept starts a new session, the logging thread resets the encoder.
+                mSessionCounter = (mSessionCounter + 1u != 0u ? mSessionCounter + 1u : 1u);
+                mCompactSession.store(mSessionCounter, std::memory_order_release);
+            }
+        }
+        break;
+
     case areg::FuncIdRange::SystemServiceNotifyRegister:      // fall through
     case areg::FuncIdRange::ServiceLastId:                    // fall through
     case areg::FuncIdRange::SystemServiceQueryInstances:      // fall through
@@ -258,6 +284,7 @@ void NetTcpLogger::process_received_message(MessageEnvelope & msgReceived, Socke
     case areg::FuncIdRange::ServiceLogScopesUpdated:          // fall through
     case areg::FuncIdRange::ServiceLogConfigurationSaved:     // fall through
     case areg::FuncIdRange::ServiceLogMessage:                // fall through
+    case areg::FuncIdRange::ServiceLogCompactMessage:         // fall through
     case areg::FuncIdRange::AttributeLastId:                  // fall through
     case areg::FuncIdRange::AttributeFirstId:                 // fall through
     case areg::FuncIdRange::ResponseLastId:                   // fall through
@@ -270,6 +297,22 @@ void NetTcpLogger::process_received_message(MessageEnvelope & msgReceived, Socke
     }
 }
 
+MessageEnvelope NetTcpLogger::_encode_record(MessageEnvelope && msg)
+{
+    const uint32_t session{ mCompactSession.load(std::memory_order_acquire) };
+    if ((session == 0u) || (msg.message_id() != static_cast<uint32_t>(areg::FuncIdRange::ServiceLogMessage)))
+        return std::move(msg);
+
+    if (session != mEncoderSession)
+    {
+        mEncoder.reset();
+        mEncoderSession = session;
+    }
+
+    MessageEnvelope msgCompact{ mEncoder.encode(*reinterpret_cast<const areg::LogEntry *>(msg.buffer()), static_cast<ITEM_ID>(msg.source())) };
+    return (msgCompact.is_valid() ? msgCompact : std::move(msg));
+}
+
 } // namespace areg
 
 #endif  // AREG_LOGGING
@@ -21,6 +21,7 @@
  ************************************************************************/
 #include "areg/base/areg_global.h"
 #include "areg/logging/private/LoggerBase.hpp"
+#include "areg/logging/private/LogRecordCodec.hpp"
 #include "areg/ipc/ServiceClientConnectionBase.hpp"
 #include "areg/ipc/ConnectionConsumer.hpp"
 #include "areg/ipc/RemoteMessageHandler.hpp"
@@ -216,6 +217,15 @@ private:
     //!< Wrapper of 'this' pointer.
     inline NetTcpLogger& self();
 
+    /**
+     * \brief   Encodes the log record in the compact format if the log collector accepted it
+     *          on the connection. Called on the logging thread.
+     *
+     * \param   msg     The plain log record to send.
+     * \return  The compact log record, or the plain log record if the format is not accepted.
+     **/
+    MessageEnvelope _encode_record( MessageEnvelope && msg );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -226,6 +236,14 @@ private:
     std::atomic<bool>   mIsEnabled;
     //!< The ring stack to queue log messages if the connection setup did not complete yet.
     PendingQueue        mRingStack;
+    //!< The encoder of the compact log records, used on the logging thread.
+    LogRecordEncoder    mEncoder;
+    //!< The session of the compact log records accepted by the log collector, 0 if the records are plain.
+    std::atomic<uint32_t> mCompactSession;
+    //!< The session the encoder is prepared for, used on the logging thread.
+    uint32_t            mEncoderSession;
+    //!< The last session, counted on the thread receiving the messages.
+    uint32_t            mSessionCounter;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
@@ -17,6 +17,7 @@
 
 #include "areg/base/DateTime.hpp"
 #include "areg/logging/LogScope.hpp"
+#include "areg/logging/private/LogDeferredFormat.hpp"
 #include "areg/logging/private/LoggingEvent.hpp"
 #include "areg/logging/private/LogManager.hpp"
 
@@ -141,6 +142,17 @@ inline void ScopeMessage::_send_log( uint32_t scopeId, uint32_t sessionId, TIME6
         return;
 
     areg::LogEntry* log = reinterpret_cast<areg::LogEntry*>(msg.buffer());
+    if (LogManager::is_format_deferred())
+    {
+        // Only the raw arguments are copied here, the logging thread formats the text.
+        log->logMessageLen = LogDeferredFormat::capture(log->logMessage, areg::LOG_MSG_SIZE, format, args);
+        if (log->logMessageLen != 0u)
+        {
+            LogManager::log_deferred(std::move(msg));
+            return;
+        }
+    }
+
     log->logMessageLen = static_cast<uint32_t>(String::format_string_list(log->logMessage, areg::LOG_MSG_SIZE, format, args));
     LogManager::log_message(std::move(msg));
 }
@@ -22,6 +22,7 @@
 
 #include "areg/base/String.hpp"
 #include "areg/base/Identifier.hpp"
+#include "areg/base/Thread.hpp"
 #include "areg/base/Version.hpp"
 #include "areg/logging/LoggingDefs.hpp"
 #include "areg/ipc/RemoteServiceDefs.hpp"
@@ -555,6 +556,98 @@ public:
      **/
     void set_file_append(bool newValue, bool isTemporary  = false);
 
+    /**
+     * \brief   Returns the size in kilobytes of the buffer to stage log messages before they are
+     *          written to the log file. The value 0 means every message is written directly.
+     **/
+    [[nodiscard]]
+    uint32_t log_file_buffer() const noexcept;
+
+    /**
+     * \brief   Sets the size in kilobytes of the buffer to stage log messages before they are
+     *          written to the log file.
+     *
+     * \param   newValue        The buffer size in kilobytes. 0 disables buffering.
+     * \param   isTemporary     If true, the change is not saved to the configuration file.
+     **/
+    void set_file_buffer(uint32_t newValue, bool isTemporary  = false);
+
+    /**
+     * \brief   Returns the maximum time in milliseconds the log messages stay in the staging
+     *          buffer before they are written to the log file.
+     **/
+    [[nodiscard]]
+    uint32_t log_file_latency() const noexcept;
+
+    /**
+     * \brief   Sets the maximum time in milliseconds the log messages stay in the staging buffer
+     *          before they are written to the log file.
+     *
+     * \param   newValue        The latency in milliseconds.
+     * \param   isTemporary     If true, the change is not saved to the configuration file.
+     **/
+    void set_file_latency(uint32_t newValue, bool isTemporary  = false);
+
+    /**
+     * \brief   Returns the size in megabytes the log file is rotated at. The value 0 means the
+     *          log file is not rotated by size.
+     **/
+    [[nodiscard]]
+    uint32_t log_file_maxsize() const noexcept;
+
+    /**
+     * \brief   Sets the size in megabytes the log file is rotated at.
+     *
+     * \param   newValue        The size in megabytes. 0 disables rotation by size.
+     * \param   isTemporary     If true, the change is not saved to the configuration file.
+     **/
+    void set_file_maxsize(uint32_t newValue, bool isTemporary  = false);
+
+    /**
+     * \brief   Returns the interval in minutes the log file is rotated. The value 0 means the
+     *          log file is not rotated by time.
+     **/
+    [[nodiscard]]
+    uint32_t log_file_interval() const noexcept;
+
+    /**
+     * \brief   Sets the interval in minutes the log file is rotated.
+     *
+     * \param   newValue        The interval in minutes. 0 disables rotation by time.
+     * \param   isTemporary     If true, the change is not saved to the configuration file.
+     **/
+    void set_file_interval(uint32_t newValue, bool isTemporary  = false);
+
+    /**
+     * \brief   Returns the number of rotated log files to keep. The value 0 means all are kept.
+     **/
+    [[nodiscard]]
+    uint32_t log_file_retain() const noexcept;
+
+    /**
+     * \brief   Sets the number of rotated log files to keep.
+     *
+     * \param   newValue        The number of files to keep. 0 keeps all.
+     * \param   isTemporary     If true, the change is not saved to the configuration file.
+     **/
+    void set_file_retain(uint32_t newValue, bool isTemporary  = false);
+
+    /**
+     * \brief   Returns true if the log messages are formatted on the logging thread instead of
+     *          the calling thread.
+     **/
+    [[nodiscard]]
+    bool log_format_deferred() const noexcept;
+
+    /**
+     * \brief   Sets whether the log messages are formatted on the logging thread.
+     *
+     * \param   newValue        If true, the calling thread only captures the arguments and the
+     *                          logging thread formats the message.
+     * \param   isTemporary     If true, the change is not saved to the configuration file.
+     **/
+    void set_format_deferred(bool newValue, bool isTemporary  = false);
+
     /**
      * \brief   Returns the maximum queue size for log messages when there is no connection to the
      *          remote logger.
@@ -882,6 +975,26 @@ public:
      **/
     uint32_t network_drain_limit(const String& module = areg::EmptyStringA, const String& connectType = areg::EmptyStringA) const noexcept;
 
+    /**
+     * \brief   Returns the configured time in microseconds a send thread may wait for more
+     *          messages to fill a batch (net::MODULE::TRANSPORT::batchwait).
+     *          Falls back to 0, sending without waiting, when the key is absent.
+     **/
+    uint32_t network_batch_wait(const String& module = areg::EmptyStringA, const String& connectType = areg::EmptyStringA) const noexcept;
+
+    /**
+     * \brief   Returns true if the stream connection offers or accepts the compact message header
+     *          (net::MODULE::TRANSPORT::compact). Falls back to true when the key is absent.
+     **/
+    bool network_compact(const String& module = areg::EmptyStringA, const String& connectType = areg::EmptyStringA) const noexcept;
+
+    /**
+     * \brief   Returns the configured size in kilobytes from which a buffer is sent without
+     *          copying it into the kernel (net::MODULE::TRANSPORT::zerocopy).
+     *          Falls back to 0, the zero-copy send is disabled, when the key is absent.
+     **/
+    uint32_t network_zerocopy(const String& module = areg::EmptyStringA, const String& connectType = areg::EmptyStringA) const noexcept;
+
     /**
      * \brief   Returns the configured thread-pool pair count (net::MODULE::TRANSPORT::pairs).
      *          Falls back to DEFAULT_POOL_PAIRS (0) when the key is absent.
@@ -944,6 +1057,60 @@ public:
      **/
     bool queue_drop_on_full(const String& whichModule = areg::EmptyStringA) const noexcept;
 
+    /**
+     * \brief   Returns the timer manager engine (config::MODULE::timer::wheel).
+     *          false (default) -- every timer owns an OS timer object. true -- all timers are
+     *          kept in a hierarchical timing wheel driven by one OS timer, which scales to tens
+     *          of thousands of timers. Read when the timer manager starts.
+     *          Lookup order: module-specific entry --> wildcard "*" entry --> compile-time default (false).
+     *
+     * \param   whichModule     The module name; empty uses the current process module.
+     **/
+    bool timer_wheel(const String& whichModule = areg::EmptyStringA) const noexcept;
+
+    /**
+     * \brief   Sets the timer manager engine (config::MODULE::timer::wheel) of the current module.
+     *          Takes effect the next time the timer manager starts.
+     *
+     * \param   newValue        If true, the timer manager uses the timing wheel.
+     * \param   isTemporary     If true, the value is not saved in the configuration file.
+     **/
+    void set_timer_wheel(bool newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the CPU cores, the NUMA node and the scheduling policy of the thread
+     *          (thread::MODULE::THREAD::cpus|policy|priority|numa). THREAD is the name of the
+     *          thread. Every key is looked up separately.
+     *          Lookup order: module-specific entry --> wildcard "*" entry --> empty placement.
+     *
+     * \param   threadName      The name of the thread.
+     * \param   whichModule     The module name; empty uses the current process module.
+     **/
+    [[nodiscard]]
+    Thread::ThreadPlacement thread_placement(const String& threadName, const String& whichModule = areg::EmptyStringA) const;
+
+    /**
+     * \brief   Returns the time in microseconds the thread spins on its empty event queue before
+     *          it parks (thread::MODULE::THREAD::spin). THREAD is the name of the thread.
+     *          Lookup order: module-specific entry --> wildcard "*" entry --> 0, parks at once.
+     *
+     * \param   threadName      The name of the thread.
+     * \param   whichModule     The module name; empty uses the current process module.
+     **/
+    [[nodiscard]]
+    uint32_t thread_spin_time(const String& threadName, const String& whichModule = areg::EmptyStringA) const;
+
+    /**
+     * \brief   Returns the number of events the thread takes from its event queue at once
+     *          (thread::MODULE::THREAD::batch). THREAD is the name of the thread.
+     *          Lookup order: module-specific entry --> wildcard "*" entry --> 0, the default batch.
+     *
+     * \param   threadName      The name of the thread.
+     * \param   whichModule     The module name; empty uses the current process module.
+     **/
+    [[nodiscard]]
+    uint32_t thread_dispatch_batch(const String& threadName, const String& whichModule = areg::EmptyStringA) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden member variables
 //////////////////////////////////////////////////////////////////////////
@@ -209,7 +209,31 @@ namespace areg {
         , QueueWaitTimeout     = 35    //!< Dispatcher lossless full-ring block timeout in ms (format: config::*::queue::timeout). 0 = QUEUE_DEFAULT_FULL_WAIT_MS.
         , QueueDropOnFull      = 36    //!< Dispatcher full-ring policy (format: config::*::queue::drop). false (default) = lossless block, true = drop-newest.
 
-        , AnyKey               = 37    //!< Indicates any key type.
+        , TimerWheel           = 37    //!< Timer manager engine (format: config::*::timer::wheel). false (default) = one OS timer per timer, true = timing wheel.
+
+        , LogFileBufferSize    = 38    //!< The size of the log file staging buffer in kilobytes (format: log::*::file::buffer). 0 = write every message directly.
+        , LogFileLatency       = 39    //!< The maximum time in ms the logs stay in the file staging buffer (format: log::*::file::latency).
+
+        , LogFileMaxSize       = 40    //!< The size in megabytes to rotate the log file at (format: log::*::file::maxsize). 0 = no rotation by size.
+        , LogFileInterval      = 41    //!< The interval in minutes to rotate the log file (format: log::*::file::interval). 0 = no rotation by time.
+        , LogFileRetain        = 42    //!< The number of rotated log files to keep (format: log::*::file::retain). 0 = keep all.
+
+        , LogFormatDeferred    = 43    //!< Format the log messages on the logging thread (format: log::*::format::deferred). false (default) = on the calling thread.
+
+        , ThreadCpus           = 44    //!< The CPU cores of a thread (format: thread::MODULE::THREAD::cpus), a list like "0-3,8".
+        , ThreadPolicy         = 45    //!< The scheduling policy of a thread (format: thread::MODULE::THREAD::policy): normal, fifo or rr.
+        , ThreadPriority       = 46    //!< The real-time priority of a thread (format: thread::MODULE::THREAD::priority).
+        , ThreadNumaNode       = 47    //!< The NUMA node of a thread (format: thread::MODULE::THREAD::numa).
+        , ThreadSpin           = 48    //!< The time in microseconds a thread spins on its empty queue before it parks (format: thread::MODULE::THREAD::spin).
+        , ThreadBatch          = 49    //!< The number of events a thread takes from its queue at once (format: thread::MODULE::THREAD::batch).
+
+        , NetSocketBatchWait   = 50    //!< The time in microseconds a send thread may wait to fill a batch (format: net::SERVICE::TRANSPORT::batchwait). 0 = no waiting.
+
+        , NetSocketCompact     = 51    //!< Offer or accept the compact message header on a stream connection (format: net::SERVICE::TRANSPORT::compact). true by default.
+
+        , NetSocketZeroCopy    = 52    //!< The size in kilobytes from which a buffer is sent without copying (format: net::SERVICE::TRANSPORT::zerocopy). 0 = disabled.
+
+        , AnyKey               = 53    //!< Indicates any key type.
     };
 
     /**
@@ -263,7 +287,31 @@ namespace areg {
             , {"config" , "*"   , "queue"   , "timeout"         }   //! 35  , Dispatcher lossless full-ring block timeout in ms (0 = QUEUE_DEFAULT_FULL_WAIT_MS).
             , {"config" , "*"   , "queue"   , "drop"            }   //! 36  , Dispatcher full-ring policy (false = lossless block, true = drop-newest).
 
-            , {"*"      , "*"   , "*"       , "*"               }   //! 37  , Indicates any key type (AnyKey sentinel -- keep last).
+            , {"config" , "*"   , "timer"   , "wheel"           }   //! 37  , Timer manager engine (false = one OS timer per timer, true = timing wheel).
+
+            , {"log"    , "*"   , "file"    , "buffer"          }   //! 38  , The size of the log file staging buffer in kilobytes (0 = write every message directly).
+            , {"log"    , "*"   , "file"    , "latency"         }   //! 39  , The maximum time in milliseconds the logs stay in the file staging buffer.
+
+            , {"log"    , "*"   , "file"    , "maxsize"         }   //! 40  , The size in megabytes to rotate the log file at (0 = no rotation by size).
+            , {"log"    , "*"   , "file"    , "interval"        }   //! 41  , The interval in minutes to rotate the log file (0 = no rotation by time).
+            , {"log"    , "*"   , "file"    , "retain"          }   //! 42  , The number of rotated log files to keep (0 = keep all).
+
+            , {"log"    , "*"   , "format"  , "deferred"        }   //! 43  , Format the log messages on the logging thread instead of the calling thread.
+
+            , {"thread" , "*"   , "*"       , "cpus"            }   //! 44  , The CPU cores of the thread, a list like "0-3,8".
+            , {"thread" , "*"   , "*"       , "policy"          }   //! 45  , The scheduling policy of the thread: normal, fifo or rr.
+            , {"thread" , "*"   , "*"       , "priority"        }   //! 46  , The real-time priority of the thread.
+            , {"thread" , "*"   , "*"       , "numa"            }   //! 47  , The NUMA node of the memory of the thread.
+            , {"thread" , "*"   , "*"       , "spin"            }   //! 48  , The time in microseconds the thread spins on its empty queue before it parks.
+            , {"thread" , "*"   , "*"       , "batch"           }   //! 49  , The number of events the thread takes from its queue at once.
+
+            , {"net"    , "*"   , "*"       , "batchwait"       }   //! 50  , The time in microseconds to wait for more messages of a send batch (0 = send at once).
+
+            , {"net"    , "*"   , "*"       , "compact"         }   //! 51  , Use the compact message header with the session dictionary on the stream connection.
+
+            , {"net"    , "*"   , "*"       , "zerocopy"        }   //! 52  , The size in kilobytes from which a buffer is sent without copying it into the kernel (0 = disabled).
+
+            , {"*"      , "*"   , "*"       , "*"               }   //! 53  , Indicates any key type (AnyKey sentinel -- keep last).
 
     };
 
@@ -311,6 +359,36 @@ inline constexpr const areg::ConfigKey& log_file_append() noexcept
     return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::LogFileAppend)];
 }
 
+inline constexpr const areg::ConfigKey& log_file_buffer() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::LogFileBufferSize)];
+}
+
+inline constexpr const areg::ConfigKey& log_file_latency() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::LogFileLatency)];
+}
+
+inline constexpr const areg::ConfigKey& log_file_maxsize() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::LogFileMaxSize)];
+}
+
+inline constexpr const areg::ConfigKey& log_file_interval() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::LogFileInterval)];
+}
+
+inline constexpr const areg::ConfigKey& log_file_retain() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::LogFileRetain)];
+}
+
+inline constexpr const areg::ConfigKey& log_format_deferred() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::LogFormatDeferred)];
+}
+
 inline constexpr const areg::ConfigKey& remote_queue_size() noexcept
 {
     return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::LogRemoteQueueSize)];
@@ -421,6 +499,21 @@ inline constexpr const areg::ConfigKey& net_socket_drain() noexcept
     return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::NetSocketDrain)];
 }
 
+inline constexpr const areg::ConfigKey& net_socket_batch_wait() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::NetSocketBatchWait)];
+}
+
+inline constexpr const areg::ConfigKey& net_socket_compact() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::NetSocketCompact)];
+}
+
+inline constexpr const areg::ConfigKey& net_socket_zerocopy() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::NetSocketZeroCopy)];
+}
+
 inline constexpr const areg::ConfigKey& net_pool_pairs() noexcept
 {
     return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::NetPoolPairs)];
@@ -451,6 +544,41 @@ inline constexpr const areg::ConfigKey& queue_drop_on_full() noexcept
     return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::QueueDropOnFull)];
 }
 
+inline constexpr const areg::ConfigKey& timer_wheel() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::TimerWheel)];
+}
+
+inline constexpr const areg::ConfigKey& thread_cpus() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::ThreadCpus)];
+}
+
+inline constexpr const areg::ConfigKey& thread_policy() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::ThreadPolicy)];
+}
+
+inline constexpr const areg::ConfigKey& thread_priority() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::ThreadPriority)];
+}
+
+inline constexpr const areg::ConfigKey& thread_numa_node() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::ThreadNumaNode)];
+}
+
+inline constexpr const areg::ConfigKey& thread_spin() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::ThreadSpin)];
+}
+
+inline constexpr const areg::ConfigKey& thread_batch() noexcept
+{
+    return areg::DefaultPropertyKeys[static_cast<int32_t>(areg::ConfigEntry::ThreadBatch)];
+}
+
 } // namespace areg
 
 #endif  // AREG_PERSIST_PERSISTENCEDEFS_HPP
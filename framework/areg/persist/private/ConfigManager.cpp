@@ -123,6 +123,26 @@ namespace
         return (elemPos != areg::INVALID_POSITION ? &list[elemPos] : nullptr);
     }
 
+    //!< Returns the value of the thread key: the module-specific entry, else the wildcard "*" entry, else nullptr.
+    [[nodiscard]]
+    inline const areg::PropertyValue* _get_thread_value( const areg::ListProperties& listWritable
+                                                       , const areg::ListProperties& listReadonly
+                                                       , const areg::String& module
+                                                       , const areg::String& threadName
+                                                       , areg::ConfigEntry confKey) noexcept
+    {
+        const areg::ConfigKey& key{ areg::DefaultPropertyKeys[static_cast<int32_t>(confKey)] };
+        if (!module.is_empty())
+        {
+            const areg::Property* prop = _get_property(listWritable, key.section, module, threadName, key.position, confKey, true);
+            if (prop != nullptr)
+                return &prop->value();
+        }
+
+        const areg::Property* prop = _get_property(listReadonly, key.section, areg::String(areg::SYNTAX_ALL_MODULES), threadName, key.position, confKey, false);
+        return (prop != nullptr ? &prop->value() : nullptr);
+    }
+
     uint32_t _read_config(const areg::FileBase& file, areg::ListProperties& listWritable, areg::ListProperties& listReadonly, const areg::String& module)
     {
         if (!file.is_opened())
@@ -648,6 +668,120 @@ void ConfigManager::set_file_append(bool newValue, bool isTemporary /*= false*/)
     set_module_property(key.section, key.property, key.position, String::make_string(newValue), confKey, isTemporary);
 }
 
+uint32_t ConfigManager::log_file_buffer() const noexcept
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileBufferSize };
+    constexpr const areg::ConfigKey& key{ areg::log_file_buffer() };
+    const PropertyValue* prop = property_value(key.section, key.property, key.position, confKey);
+    return (prop != nullptr ? prop->as_integer() : areg::DEFAULT_LOG_FILE_BUFFER);
+}
+
+void ConfigManager::set_file_buffer(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileBufferSize };
+    constexpr const areg::ConfigKey& key{ areg::log_file_buffer() };
+    set_module_property(key.section, key.property, key.position, String::make_string(newValue), confKey, isTemporary);
+}
+
+uint32_t ConfigManager::log_file_latency() const noexcept
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileLatency };
+    constexpr const areg::ConfigKey& key{ areg::log_file_latency() };
+    const PropertyValue* prop = property_value(key.section, key.property, key.position, confKey);
+    return (prop != nullptr ? prop->as_integer() : areg::DEFAULT_LOG_FILE_LATENCY);
+}
+
+void ConfigManager::set_file_latency(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileLatency };
+    constexpr const areg::ConfigKey& key{ areg::log_file_latency() };
+    set_module_property(key.section, key.property, key.position, String::make_string(newValue), confKey, isTemporary);
+}
+
+uint32_t ConfigManager::log_file_maxsize() const noexcept
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileMaxSize };
+    constexpr const areg::ConfigKey& key{ areg::log_file_maxsize() };
+    const PropertyValue* prop = property_value(key.section, key.property, key.position, confKey);
+    return (prop != nullptr ? prop->as_integer() : 0u);
+}
+
+void ConfigManager::set_file_maxsize(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileMaxSize };
+    constexpr const areg::ConfigKey& key{ areg::log_file_maxsize() };
+    set_module_property(key.section, key.property, key.position, String::make_string(newValue), confKey, isTemporary);
+}
+
+uint32_t ConfigManager::log_file_interval() const noexcept
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileInterval };
+    constexpr const areg::ConfigKey& key{ areg::log_file_interval() };
+    const PropertyValue* prop = property_value(key.section, key.property, key.position, confKey);
+    return (prop != nullptr ? prop->as_integer() : 0u);
+}
+
+void ConfigManager::set_file_interval(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileInterval };
+    constexpr const areg::ConfigKey& key{ areg::log_file_interval() };
+    set_module_property(key.section, key.property, key.position, String::make_string(newValue), confKey, isTemporary);
+}
+
+uint32_t ConfigManager::log_file_retain() const noexcept
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileRetain };
+    constexpr const areg::ConfigKey& key{ areg::log_file_retain() };
+    const PropertyValue* prop = property_value(key.section, key.property, key.position, confKey);
+    return (prop != nullptr ? prop->as_integer() : areg::DEFAULT_LOG_FILE_RETAIN);
+}
+
+void ConfigManager::set_file_retain(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFileRetain };
+    constexpr const areg::ConfigKey& key{ areg::log_file_retain() };
+    set_module_property(key.section, key.property, key.position, String::make_string(newValue), confKey, isTemporary);
+}
+
+bool ConfigManager::log_format_deferred() const noexcept
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFormatDeferred };
+    constexpr const areg::ConfigKey& key{ areg::log_format_deferred() };
+    const PropertyValue* prop = property_value(key.section, key.property, key.position, confKey);
+    return ((prop != nullptr) && prop->as_boolean());
+}
+
+void ConfigManager::set_format_deferred(bool newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::LogFormatDeferred };
+    constexpr const areg::ConfigKey& key{ areg::log_format_deferred() };
+    set_module_property(key.section, key.property, key.position, String::make_string(newValue), confKey, isTemporary);
+}
+
 uint32_t ConfigManager::remote_queue_size() const noexcept
 {
     Lock lock(mLock);
@@ -1032,6 +1166,102 @@ bool ConfigManager::queue_drop_on_full(const String& whichModule /*= areg::Empty
     return false;
 }
 
+bool ConfigManager::timer_wheel(const String& whichModule /*= areg::EmptyStringA*/) const noexcept
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::TimerWheel };
+    constexpr const areg::ConfigKey& key{ areg::timer_wheel() };
+
+    // Step 1: module-specific entry (caller-supplied or current process).
+    const String& mod{ whichModule.is_empty() ? mModule : whichModule };
+    if (!mod.is_empty())
+    {
+        const Property* prop = _get_property(mWritableProperties, key.section, mod, key.property, key.position, confKey, true);
+        if (prop != nullptr)
+            return prop->value().as_boolean();
+    }
+
+    // Step 2: wildcard "*" entry.
+    {
+        const Property* prop = _get_property(mReadonlyProperties, key.section, String(areg::SYNTAX_ALL_MODULES), key.property, key.position, confKey, false);
+        if (prop != nullptr)
+            return prop->value().as_boolean();
+    }
+
+    // Step 3: compile-time default -- one OS timer per timer.
+    return false;
+}
+
+void ConfigManager::set_timer_wheel(bool newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::TimerWheel };
+    constexpr const areg::ConfigKey& key{ areg::timer_wheel() };
+    set_module_property(key.section, key.property, key.position, String::make_string(newValue), confKey, isTemporary);
+}
+
+Thread::ThreadPlacement ConfigManager::thread_placement(const String& threadName, const String& whichModule /*= areg::EmptyStringA*/) const
+{
+    Lock lock(mLock);
+
+    Thread::ThreadPlacement result{};
+    if (threadName.is_empty())
+        return result;
+
+    const String& mod{ whichModule.is_empty() ? mModule : whichModule };
+    const PropertyValue* value = _get_thread_value(mWritableProperties, mReadonlyProperties, mod, threadName, areg::ConfigEntry::ThreadCpus);
+    if (value != nullptr)
+    {
+        result.cpus = value->as_string();
+    }
+
+    value = _get_thread_value(mWritableProperties, mReadonlyProperties, mod, threadName, areg::ConfigEntry::ThreadPolicy);
+    if (value != nullptr)
+    {
+        result.policy = Thread::parse_sched_policy(value->as_string());
+    }
+
+    value = _get_thread_value(mWritableProperties, mReadonlyProperties, mod, threadName, areg::ConfigEntry::ThreadPriority);
+    if (value != nullptr)
+    {
+        result.priority = static_cast<int32_t>(value->as_integer());
+    }
+
+    value = _get_thread_value(mWritableProperties, mReadonlyProperties, mod, threadName, areg::ConfigEntry::ThreadNumaNode);
+    if ((value != nullptr) && (value->as_string().is_empty() == false))
+    {
+        result.numaNode = static_cast<int32_t>(value->as_integer());
+    }
+
+    return result;
+}
+
+uint32_t ConfigManager::thread_spin_time(const String& threadName, const String& whichModule /*= areg::EmptyStringA*/) const
+{
+    Lock lock(mLock);
+
+    if (threadName.is_empty())
+        return 0u;
+
+    const String& mod{ whichModule.is_empty() ? mModule : whichModule };
+    const PropertyValue* value = _get_thread_value(mWritableProperties, mReadonlyProperties, mod, threadName, areg::ConfigEntry::ThreadSpin);
+    return (value != nullptr ? static_cast<uint32_t>(value->as_integer()) : 0u);
+}
+
+uint32_t ConfigManager::thread_dispatch_batch(const String& threadName, const String& whichModule /*= areg::EmptyStringA*/) const
+{
+    Lock lock(mLock);
+
+    if (threadName.is_empty())
+        return 0u;
+
+    const String& mod{ whichModule.is_empty() ? mModule : whichModule };
+    const PropertyValue* value = _get_thread_value(mWritableProperties, mReadonlyProperties, mod, threadName, areg::ConfigEntry::ThreadBatch);
+    return (value != nullptr ? static_cast<uint32_t>(value->as_integer()) : 0u);
+}
+
 uint32_t ConfigManager::network_sndbuf(const String& module /*= areg::EmptyStringA*/, const String& connectType /*= areg::EmptyStringA*/) const noexcept
 {
     Lock lock(mLock);
@@ -1134,6 +1364,78 @@ uint32_t ConfigManager::network_drain_limit(const String& module, const String&
     return areg::DEFAULT_DRAIN_LIMIT;
 }
 
+uint32_t ConfigManager::network_batch_wait(const String& module, const String& connectType) const noexcept
+{
+    Lock lock(mLock);
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::NetSocketBatchWait };
+    constexpr const areg::ConfigKey& key{ areg::net_socket_batch_wait() };
+    const String& transport{ connectType.is_empty() ? String(areg::SYNTAX_ALL_MODULES) : connectType };
+
+    const String& mod{ module.is_empty() ? mModule : module };
+    if (!mod.is_empty())
+    {
+        const Property* prop = _get_property(mWritableProperties, key.section, mod, transport, key.position, confKey, true);
+        if (prop != nullptr)
+            return static_cast<uint32_t>(prop->value().as_integer());
+    }
+
+    {
+        const Property* prop = _get_property(mReadonlyProperties, key.section, String(areg::SYNTAX_ALL_MODULES), transport, key.position, confKey, false);
+        if (prop != nullptr)
+            return static_cast<uint32_t>(prop->value().as_integer());
+    }
+
+    return 0u;
+}
+
+bool ConfigManager::network_compact(const String& module, const String& connectType) const noexcept
+{
+    Lock lock(mLock);
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::NetSocketCompact };
+    constexpr const areg::ConfigKey& key{ areg::net_socket_compact() };
+    const String& transport{ connectType.is_empty() ? String(areg::SYNTAX_ALL_MODULES) : connectType };
+
+    const String& mod{ module.is_empty() ? mModule : module };
+    if (!mod.is_empty())
+    {
+        const Property* prop = _get_property(mWritableProperties, key.section, mod, transport, key.position, confKey, true);
+        if (prop != nullptr)
+            return prop->value().as_boolean();
+    }
+
+    {
+        const Property* prop = _get_property(mReadonlyProperties, key.section, String(areg::SYNTAX_ALL_MODULES), transport, key.position, confKey, false);
+        if (prop != nullptr)
+            return prop->value().as_boolean();
+    }
+
+    return true;
+}
+
+uint32_t ConfigManager::network_zerocopy(const String& module, const String& connectType) const noexcept
+{
+    Lock lock(mLock);
+    constexpr const areg::ConfigEntry confKey{ areg::ConfigEntry::NetSocketZeroCopy };
+    constexpr const areg::ConfigKey& key{ areg::net_socket_zerocopy() };
+    const String& transport{ connectType.is_empty() ? String(areg::SYNTAX_ALL_MODULES) : connectType };
+
+    const String& mod{ module.is_empty() ? mModule : module };
+    if (!mod.is_empty())
+    {
+        const Property* prop = _get_property(mWritableProperties, key.section, mod, transport, key.position, confKey, true);
+        if (prop != nullptr)
+            return static_cast<uint32_t>(prop->value().as_integer());
+    }
+
+    {
+        const Property* prop = _get_property(mReadonlyProperties, key.section, String(areg::SYNTAX_ALL_MODULES), transport, key.position, confKey, false);
+        if (prop != nullptr)
+            return static_cast<uint32_t>(prop->value().as_integer());
+    }
+
+    return 0u;
+}
+
 uint32_t ConfigManager::network_pool_pairs(const String& module, const String& connectType) const noexcept
 {
     Lock lock(mLock);
@@ -27,6 +27,8 @@
 #include "areg/base/String.hpp"
 #include "areg/base/SyncPrimitives.hpp"
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace areg::ext {
@@ -50,6 +52,39 @@ public:
         uint32_t    scopePrio   { 0u }; //!< Scope log prio
     };
 
+    /**
+     * \brief   The position of a log in the pages of logs. The logs are ordered by the creation
+     *          time, and the logs created at the same time by the row ID. A default cursor is
+     *          before the first log, the cursor { TIME_LAST, ROW_LAST } is after the last log.
+     **/
+    struct LogCursor
+    {
+        TIME64      lcTimestamp { 0u }; //!< The creation time of the log.
+        int64_t     lcRowId     { 0 };  //!< The row ID of the log.
+    };
+
+    //!< The creation time after all logs.
+    static constexpr TIME64     TIME_LAST   { static_cast<TIME64>(0x7FFF'FFFF'FFFF'FFFFll) };
+
+    //!< The row ID after all logs.
+    static constexpr int64_t    ROW_LAST    { 0x7FFF'FFFF'FFFF'FFFFll };
+
+    //!< The maximum number of the thread or module IDs with the cached reference of the name.
+    static constexpr uint32_t   MAX_CACHED_NAMES{ 4'096u };
+
+private:
+    /**
+     * \brief   The name of a thread or of a module and its reference in the dictionary.
+     **/
+    struct NameRef
+    {
+        std::string nrName  { };    //!< The name of the thread or of the module.
+        int64_t     nrRef   { 0 };  //!< The reference of the name in the dictionary.
+    };
+
+    //!< The references of the names cached by the writer, the key is the ID of the thread or of the module.
+    using NameCache = std::unordered_map<ITEM_ID, NameRef>;
+
 //////////////////////////////////////////////////////////////////////////
 // Static methods
 //////////////////////////////////////////////////////////////////////////
@@ -601,6 +636,47 @@ public:
         uint32_t offset = 0
     );
 
+    /**
+     * \brief   Reads the page of logs after the cursor, ordered by the creation time. Unlike the
+     *          offset of `setup_statement_read_logs()`, the page continues at the cursor in the
+     *          time index, so that the deep pages are read as fast as the first one.
+     *
+     * \param[out]     messages    On output, contains the logs of the page.
+     * \param[in,out]  cursor      The cursor to read after. On output, the cursor of the last log
+     *                              of the page, or not changed if the page is empty.
+     * \param          instId      The ID of instance to filter. If `areg::TARGET_ALL` is specified, reads logs of all instances.
+     * \param          maxEntries  The maximum number of logs in the page.
+     * \param          timeEnd     The creation time of the last log to read, inclusive.
+     * \return  Returns number of logs in the page.
+     **/
+    uint32_t log_messages_after(std::vector<areg::SharedBuffer>& messages, LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeEnd = TIME_LAST);
+
+    /**
+     * \brief   Reads the page of logs before the cursor, ordered by the creation time.
+     *
+     * \param[out]     messages    On output, contains the logs of the page.
+     * \param[in,out]  cursor      The cursor to read before. On output, the cursor of the first log
+     *                              of the page, or not changed if the page is empty.
+     * \param          instId      The ID of instance to filter. If `areg::TARGET_ALL` is specified, reads logs of all instances.
+     * \param          maxEntries  The maximum number of logs in the page.
+     * \param          timeBegin   The creation time of the first log to read, inclusive.
+     * \return  Returns number of logs in the page.
+     **/
+    uint32_t log_messages_before(std::vector<areg::SharedBuffer>& messages, LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeBegin = 0u);
+
+    /**
+     * \brief   Reads the logs created in the time window, ordered by the creation time. To read the
+     *          window in pages, call `log_messages_after()` with the cursor { timeBegin, 0 } and
+     *          the end time `timeEnd`.
+     *
+     * \param[out] messages    On output, contains the logs of the time window.
+     * \param   timeBegin   The begin of the time window, inclusive.
+     * \param   timeEnd     The end of the time window, inclusive.
+     * \param   instId      The ID of instance to filter. If `areg::TARGET_ALL` is specified, reads logs of all instances.
+     * \return  Returns number of logs in the time window.
+     **/
+    uint32_t log_messages_in_range(std::vector<areg::SharedBuffer>& messages, TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId = areg::TARGET_ALL);
+
     /**
      * \brief   Sets up the log filters.
      *
@@ -629,6 +705,17 @@ public:
     [[nodiscard]]
     uint32_t count_log_entries(ITEM_ID instId = areg::TARGET_ALL);
 
+    /**
+     * \brief   Returns number of log messages of specified instance ID created in the time window.
+     *          Returns number of all log messages in the time window if the instance ID is `areg::TARGET_ALL`.
+     *
+     * \param   timeBegin   The begin of the time window, inclusive.
+     * \param   timeEnd     The end of the time window, inclusive.
+     * \param   instId      The ID of instance to filter. If `areg::TARGET_ALL` is specified, counts logs of all instances.
+     **/
+    [[nodiscard]]
+    uint32_t count_log_entries(TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId = areg::TARGET_ALL);
+
     /**
      * \brief   Returns number of scopes of specified instance ID. Returns number of all scopes if
      *          the instance ID is `areg::TARGET_ALL`.
@@ -692,6 +779,20 @@ private:
      **/
     inline void _create_indexes() noexcept;
 
+    /**
+     * \brief   In the opened database file, creates the time indexes of the logs, if they do not exist.
+     **/
+    inline void _create_time_indexes() noexcept;
+
+    /**
+     * \brief   In the database created by the older versions, moves the thread and module names
+     *          of the logs to the dictionaries and replaces the logs table by the view.
+     *          The changes are rolled back on failure.
+     *
+     * \return  Returns true if the logs are migrated.
+     **/
+    inline bool _migrate_logs() noexcept;
+
     /**
      * \brief   Logs the initial information in the database like logging version and application name.
      **/
@@ -730,6 +831,43 @@ private:
      **/
     inline uint32_t _update_filter_log_scopes(ITEM_ID instId, const areg::ArrayList<ScopeFilter>& filter);
 
+    /**
+     * \brief   Prepares the statement to read the logs after the cursor, up to the end time.
+     *
+     * \param   stmt        The statement to prepare.
+     * \param   cursor      The cursor to read after.
+     * \param   instId      The ID of instance to filter, or `areg::TARGET_ALL`.
+     * \param   limit       The maximum number of logs to read. A negative value means no limit.
+     * \param   timeEnd     The creation time of the last log to read, inclusive.
+     * \return  Returns true if the statement is prepared and the parameters are bound.
+     **/
+    inline bool _setup_read_logs_after(areg::ext::SqliteStatement& stmt, const LogCursor& cursor, ITEM_ID instId, int64_t limit, TIME64 timeEnd);
+
+    /**
+     * \brief   Reads the logs of the page and moves the cursor to the last log of the page, if
+     *          `toLast` is true, or to the first log of the page otherwise.
+     *
+     * \param   stmt        The statement prepared to read the page.
+     * \param   messages    The vector to add the logs of the page.
+     * \param   cursor      The cursor to move.
+     * \param   toLast      Flag, indicating whether the cursor moves to the last or to the first log.
+     * \return  Returns number of logs read.
+     **/
+    inline static uint32_t _read_log_page(areg::ext::SqliteStatement& stmt, std::vector<areg::SharedBuffer>& messages, LogCursor& cursor, bool toLast);
+
+    /**
+     * \brief   Returns the reference of the thread or of the module name in the dictionary.
+     *          The name is looked up in the cache of the ID, and added to the dictionary if
+     *          it is not there.
+     *
+     * \param   cache       The cache of the thread or of the module names.
+     * \param   id          The ID of the thread or of the module.
+     * \param   name        The name of the thread or of the module.
+     * \param   isThread    Flag, indicating whether the name is the name of a thread or of a module.
+     * \return  Returns the reference of the name, or 0 on error.
+     **/
+    inline int64_t _name_ref(NameCache& cache, ITEM_ID id, const char* name, bool isThread);
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -749,6 +887,15 @@ protected:
     //!< Flag, indicating whether the database logging is enabled or not.
     bool            mDbLogEnabled;
 
+    //!< Flag, indicating whether the logs refer to the thread and module names in the dictionaries.
+    bool            mHasNameTables;
+
+    //!< The cached references of the thread names. Accessed by the writer.
+    NameCache       mThreadRefs;
+
+    //!< The cached references of the module names. Accessed by the writer.
+    NameCache       mModuleRefs;
+
     //!< Mutex to protect database operations.
     areg::Mutex     mLock;
 
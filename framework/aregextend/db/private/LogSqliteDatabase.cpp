@@ -144,11 +144,31 @@ namespace {
         "UPDATE scopes SET time_inactivated = ?, scope_is_active = 0 WHERE cookie_id = ? AND scope_id = ? AND scope_is_active = 1;"
     };
 
+    //! Create a dictionary of the thread names. A log refers to the name of the thread by the
+    //! reference, so that each name is saved once.
+    constexpr std::string_view  _sqlCreateTbThreads
+    {
+        "CREATE TABLE \"threads\" ("
+            "\"thread_ref\"         INTEGER PRIMARY KEY,"
+            "\"thread_name\"        TEXT NOT NULL UNIQUE"
+            ");"
+    };
+
+    //! Create a dictionary of the module names. A log refers to the name of the module by the
+    //! reference, so that each name is saved once.
+    constexpr std::string_view  _sqlCreateTbModules
+    {
+        "CREATE TABLE \"modules\" ("
+            "\"module_ref\"         INTEGER PRIMARY KEY,"
+            "\"module_name\"        TEXT NOT NULL UNIQUE"
+            ");"
+    };
+
     //! Create a table with logs that contain information of application cookie ID,
-    //! scope ID, log priority, log message, and information like thread.
-    constexpr std::string_view  _sqlCreateTbLogs
+    //! scope ID, log priority, log message, and the references of the thread and module names.
+    constexpr std::string_view  _sqlCreateTbLogRows
     {
-        "CREATE TABLE \"logs\" ("
+        "CREATE TABLE \"log_rows\" ("
             "\"id\"	                INTEGER NOT NULL UNIQUE,"
             "\"cookie_id\"	        INTEGER,"
             "\"scope_id\"	        INTEGER,"
@@ -158,8 +178,8 @@ namespace {
             "\"msg_module_id\"	    INTEGER,"
             "\"msg_thread_id\"	    INTEGER,"
             "\"msg_log\"	        TEXT,"
-            "\"msg_thread\"	        TEXT,"
-            "\"msg_module\"	        TEXT,"
+            "\"thread_ref\"	        INTEGER,"
+            "\"module_ref\"	        INTEGER,"
             "\"time_created\"	    NUMERIC,"
             "\"time_received\"      NUMERIC,"
             "\"time_duration\"      NUMERIC,"
@@ -167,10 +187,33 @@ namespace {
             ");"
     };
 
-    //! A statement to insert a new log message in the logs table.
-    //! The message, the thread name and the module name are bound, never placed in the
-    //! statement: they are sent by the remote log source, see CWE-89.
+    //! Create the view of the logs with the columns of the logs table of the older versions,
+    //! the thread and module names are looked up in the dictionaries. The view is flattened
+    //! in the queries, so that they use the indexes of the log_rows table.
+    constexpr std::string_view  _sqlCreateViewLogs
+    {
+        "CREATE VIEW \"logs\" AS SELECT "
+            "l.id, l.cookie_id, l.scope_id, l.session_id, l.msg_type, l.msg_prio, l.msg_module_id, l.msg_thread_id, l.msg_log, "
+            "(SELECT thread_name FROM threads WHERE thread_ref = l.thread_ref) AS msg_thread, "
+            "(SELECT module_name FROM modules WHERE module_ref = l.module_ref) AS msg_module, "
+            "l.time_created, l.time_received, l.time_duration "
+            "FROM log_rows AS l;"
+    };
+
+    //! A statement to insert a new log message in the log_rows table.
+    //! The message is bound, never placed in the statement: it is sent by the remote
+    //! log source, see CWE-89.
     constexpr std::string_view _sqlInsertLog
+    {
+        "INSERT INTO log_rows "
+        "(cookie_id, scope_id, session_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, thread_ref, module_ref, time_created, time_received, time_duration)"
+        "VALUES "
+        "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"
+    };
+
+    //! A statement to insert a new log message in the logs table of the older versions, which
+    //! keeps the thread and module names in each log. Used if the table cannot be migrated.
+    constexpr std::string_view _sqlInsertLogText
     {
         "INSERT INTO logs "
         "(cookie_id, scope_id, session_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created, time_received, time_duration)"
@@ -178,6 +221,62 @@ namespace {
         "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"
     };
 
+    //! A statement to add a thread name to the dictionary, if it is not there.
+    constexpr std::string_view _sqlInsertThread
+    {
+        "INSERT OR IGNORE INTO threads (thread_name) VALUES (?);"
+    };
+
+    //! A statement to get the reference of a thread name.
+    constexpr std::string_view _sqlGetThreadRef
+    {
+        "SELECT thread_ref FROM threads WHERE thread_name = ?;"
+    };
+
+    //! A statement to add a module name to the dictionary, if it is not there.
+    constexpr std::string_view _sqlInsertModule
+    {
+        "INSERT OR IGNORE INTO modules (module_name) VALUES (?);"
+    };
+
+    //! A statement to get the reference of a module name.
+    constexpr std::string_view _sqlGetModuleRef
+    {
+        "SELECT module_ref FROM modules WHERE module_name = ?;"
+    };
+
+    //! A script to fill the thread dictionary with the names of the logs table of the older versions.
+    constexpr std::string_view _sqlMigrateThreads
+    {
+        "INSERT OR IGNORE INTO threads (thread_name) SELECT DISTINCT COALESCE(msg_thread, '') FROM logs;"
+    };
+
+    //! A script to fill the module dictionary with the names of the logs table of the older versions.
+    constexpr std::string_view _sqlMigrateModules
+    {
+        "INSERT OR IGNORE INTO modules (module_name) SELECT DISTINCT COALESCE(msg_module, '') FROM logs;"
+    };
+
+    //! A script to copy the logs of the older versions to the log_rows table. The row IDs are
+    //! kept, so that the cursors and the order of the logs do not change.
+    constexpr std::string_view _sqlMigrateLogs
+    {
+        "INSERT INTO log_rows "
+        "(id, cookie_id, scope_id, session_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, thread_ref, module_ref, time_created, time_received, time_duration) "
+        "SELECT l.id, l.cookie_id, l.scope_id, l.session_id, l.msg_type, l.msg_prio, l.msg_module_id, l.msg_thread_id, l.msg_log, "
+        "t.thread_ref, m.module_ref, l.time_created, l.time_received, l.time_duration "
+        "FROM logs AS l "
+        "JOIN threads AS t ON t.thread_name = COALESCE(l.msg_thread, '') "
+        "JOIN modules AS m ON m.module_name = COALESCE(l.msg_module, '') "
+        "ORDER BY l.id;"
+    };
+
+    //! A script to drop the logs table of the older versions, replaced by the view.
+    constexpr std::string_view _sqlDropTbLogs
+    {
+        "DROP TABLE logs;"
+    };
+
     //! A script to create index of the instances table. 
     constexpr std::string_view  _sqlCraeteIdxCookie
     {
@@ -193,7 +292,21 @@ namespace {
     //! A script to create index of the logs table
     constexpr std::string_view  _sqlCreateIdxLogs
     {
-        "CREATE INDEX idx_logs ON logs(scope_id, msg_prio, cookie_id);"
+        "CREATE INDEX idx_logs ON log_rows(scope_id, msg_prio, cookie_id);"
+    };
+
+    //! A script to create the time index of the logs table. The index keeps the row ID,
+    //! so that the logs are read in pages ordered by the creation time and the row ID.
+    //! The table is log_rows, or logs in the databases of the older versions.
+    constexpr std::string_view  _sqlCreateIdxLogsTime
+    {
+        "CREATE INDEX IF NOT EXISTS idx_logs_time ON %s(time_created);"
+    };
+
+    //! A script to create the time index of the logs of each instance.
+    constexpr std::string_view  _sqlCreateIdxLogsInstTime
+    {
+        "CREATE INDEX IF NOT EXISTS idx_logs_inst_time ON %s(cookie_id, time_created);"
     };
 
     //! A script to extract the names of connected log instances
@@ -214,6 +327,12 @@ namespace {
         "SELECT msg_thread FROM logs GROUP BY msg_thread;"
     };
 
+    //! A script to extract the names of logging threads from the dictionary
+    constexpr std::string_view _sqlGetThreadNamesDict
+    {
+        "SELECT thread_name FROM threads ORDER BY thread_name;"
+    };
+
     //! A script to extract the IDs of logging threads
     constexpr std::string_view _sqlGetThreadIds
     {
@@ -273,6 +392,70 @@ namespace {
         "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM logs WHERE scope_id = ? AND cookie_id = ? ORDER BY time_created;"
     };
 
+    //! A script to extract a page of logged messages after the cursor, up to the end time.
+    //! The row value comparison continues at the cursor in the time index instead of skipping rows.
+    constexpr std::string_view _sqlGetLogMessagesAfter
+    {
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, "
+        "time_created, time_received, time_duration, scope_id, session_id, "
+        "msg_log, msg_thread, msg_module, id "
+        "FROM logs "
+        "WHERE (time_created, id) > (?, ?) AND time_created <= ? "
+        "ORDER BY time_created, id "
+        "LIMIT ?;"
+    };
+
+    //! A script to extract a page of logged messages of the certain instance source after the cursor, up to the end time.
+    constexpr std::string_view _sqlGetInstLogMessagesAfter
+    {
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, "
+        "time_created, time_received, time_duration, scope_id, session_id, "
+        "msg_log, msg_thread, msg_module, id "
+        "FROM logs "
+        "WHERE cookie_id = ? AND (time_created, id) > (?, ?) AND time_created <= ? "
+        "ORDER BY time_created, id "
+        "LIMIT ?;"
+    };
+
+    //! A script to extract a page of logged messages before the cursor, down to the begin time.
+    //! The page is read backwards in the time index and returned in the order of time.
+    constexpr std::string_view _sqlGetLogMessagesBefore
+    {
+        "SELECT * FROM ("
+        "   SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, "
+        "   time_created, time_received, time_duration, scope_id, session_id, "
+        "   msg_log, msg_thread, msg_module, id "
+        "   FROM logs "
+        "   WHERE (time_created, id) < (?, ?) AND time_created >= ? "
+        "   ORDER BY time_created DESC, id DESC "
+        "   LIMIT ?"
+        ") ORDER BY time_created, id;"
+    };
+
+    //! A script to extract a page of logged messages of the certain instance source before the cursor, down to the begin time.
+    constexpr std::string_view _sqlGetInstLogMessagesBefore
+    {
+        "SELECT * FROM ("
+        "   SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, "
+        "   time_created, time_received, time_duration, scope_id, session_id, "
+        "   msg_log, msg_thread, msg_module, id "
+        "   FROM logs "
+        "   WHERE cookie_id = ? AND (time_created, id) < (?, ?) AND time_created >= ? "
+        "   ORDER BY time_created DESC, id DESC "
+        "   LIMIT ?"
+        ") ORDER BY time_created, id;"
+    };
+
+    constexpr std::string_view _sqlCountLogsInRange
+    {
+        "SELECT COUNT(id) FROM logs WHERE time_created BETWEEN ? AND ?;"
+    };
+
+    constexpr std::string_view _sqlCountInstanceLogsInRange
+    {
+        "SELECT COUNT(id) FROM logs WHERE cookie_id = ? AND time_created BETWEEN ? AND ?;"
+    };
+
     constexpr std::string_view _sqlCountInstanceLogs
     {
         "SELECT COUNT(id) FROM logs WHERE cookie_id = ?;"
@@ -468,6 +651,9 @@ LogSqliteDatabase::LogSqliteDatabase()
     , mDbInitPath           ( )
     , mIsInitialized        ( false )
     , mDbLogEnabled         ( true )
+    , mHasNameTables        ( false )
+    , mThreadRefs           ( )
+    , mModuleRefs           ( )
     , mLock                 ( false )
 {
 }
@@ -507,7 +693,11 @@ inline void LogSqliteDatabase::_create_tables() noexcept
     VERIFY(mDatabase.execute(_sqlCreateTbVersion));
     VERIFY(mDatabase.execute(_sqlCreateTbInstances));
     VERIFY(mDatabase.execute(_sqlCreateTbScopes));
-    VERIFY(mDatabase.execute(_sqlCreateTbLogs));
+    VERIFY(mDatabase.execute(_sqlCreateTbThreads));
+    VERIFY(mDatabase.execute(_sqlCreateTbModules));
+    VERIFY(mDatabase.execute(_sqlCreateTbLogRows));
+    VERIFY(mDatabase.execute(_sqlCreateViewLogs));
+    mHasNameTables = true;
 }
 
 inline void LogSqliteDatabase::_create_indexes() noexcept
@@ -515,6 +705,35 @@ inline void LogSqliteDatabase::_create_indexes() noexcept
     VERIFY(mDatabase.execute(_sqlCraeteIdxCookie));
     VERIFY(mDatabase.execute(_sqlCreateIdxScopes));
     VERIFY(mDatabase.execute(_sqlCreateIdxLogs));
+    _create_time_indexes();
+}
+
+inline void LogSqliteDatabase::_create_time_indexes() noexcept
+{
+    const char* table{ mHasNameTables ? "log_rows" : "logs" };
+    String sql;
+    VERIFY(mDatabase.execute(sql.format(_sqlCreateIdxLogsTime.data(), table)));
+    VERIFY(mDatabase.execute(sql.format(_sqlCreateIdxLogsInstTime.data(), table)));
+}
+
+inline bool LogSqliteDatabase::_migrate_logs() noexcept
+{
+    // The logs table of the older versions keeps the names in each log. Move the names to the
+    // dictionaries and the logs to the log_rows table, then replace the table by the view.
+    mDatabase.begin();
+    const bool result{    mDatabase.execute(_sqlCreateTbThreads)
+                       && mDatabase.execute(_sqlCreateTbModules)
+                       && mDatabase.execute(_sqlCreateTbLogRows)
+                       && mDatabase.execute(_sqlMigrateThreads)
+                       && mDatabase.execute(_sqlMigrateModules)
+                       && mDatabase.execute(_sqlMigrateLogs)
+                       && mDatabase.execute(_sqlDropTbLogs)
+                       && mDatabase.execute(_sqlCreateViewLogs)
+                       && mDatabase.execute(_sqlCreateIdxLogs) };
+
+    mHasNameTables = result;
+    mDatabase.commit(result);
+    return result;
 }
 
 inline void LogSqliteDatabase::_initialize() noexcept
@@ -524,6 +743,8 @@ inline void LogSqliteDatabase::_initialize() noexcept
     String module{ proc.app_name() };
     id_type threadId{ Thread::current_thread_id() };
     String thread{ Thread::thread_name(threadId) };
+    const int64_t threadRef{ _name_ref(mThreadRefs, static_cast<ITEM_ID>(threadId), thread.as_string(), true) };
+    const int64_t moduleRef{ _name_ref(mModuleRefs, static_cast<ITEM_ID>(proc.id()), module.as_string(), false) };
 
     {
         SqliteStatement stmt(mDatabase, _sqlInsertVersion);
@@ -546,8 +767,8 @@ inline void LogSqliteDatabase::_initialize() noexcept
         stmt.bind_uint64( 5, static_cast<uint64_t>(proc.id()));
         stmt.bind_uint64( 6, static_cast<uint64_t>(threadId));
         stmt.bind_text(   7, String("Starting database logging..."));
-        stmt.bind_text(   8, thread);
-        stmt.bind_text(   9, module);
+        stmt.bind_int64(  8, threadRef);
+        stmt.bind_int64(  9, moduleRef);
         stmt.bind_uint64(10, static_cast<uint64_t>(now.time()));
         stmt.bind_uint64(11, static_cast<uint64_t>(now.time()));
         stmt.bind_uint32(12, static_cast<uint32_t>(0u));
@@ -620,6 +841,7 @@ bool LogSqliteDatabase::connect(const String& dbPath, bool readOnly)
     {
         bool exists = File::has_file(dbPath);
         ASSERT(mIsInitialized == false);
+        mHasNameTables = false;
         if (_open(dbPath, readOnly))
         {
             if (exists == false)
@@ -630,10 +852,28 @@ bool LogSqliteDatabase::connect(const String& dbPath, bool readOnly)
                 commit(true);
             }
 
+            else if (table_exists("log_rows"))
+            {
+                mHasNameTables = true;
+            }
+
+            if (exists && (readOnly == false))
+            {
+                // The databases created by the older versions keep the names in each log
+                // and have no time indexes.
+                if (mHasNameTables == false)
+                {
+                    _migrate_logs();
+                }
+
+                _create_time_indexes();
+                commit(true);
+            }
+
             mIsInitialized = true;
             if (readOnly == false)
             {
-                mStmtLogs.prepare(_sqlInsertLog);
+                mStmtLogs.prepare(mHasNameTables ? _sqlInsertLog : _sqlInsertLogText);
             }
         }
     }
@@ -654,6 +894,9 @@ void LogSqliteDatabase::disconnect()
     mDatabase.commit(true);
     mDatabase.disconnect();
     mIsInitialized = false;
+    mHasNameTables = false;
+    mThreadRefs.clear();
+    mModuleRefs.clear();
 }
 
 bool LogSqliteDatabase::execute(const String& sql)
@@ -671,6 +914,13 @@ bool LogSqliteDatabase::begin()
 bool LogSqliteDatabase::commit(bool doCommit)
 {
     Lock lock(mLock);
+    if (doCommit == false)
+    {
+        // The names added in the transaction are rolled back.
+        mThreadRefs.clear();
+        mModuleRefs.clear();
+    }
+
     return mDatabase.commit(doCommit);
 }
 
@@ -695,8 +945,17 @@ bool LogSqliteDatabase::log_message(const areg::LogEntry& message)
     mStmtLogs.bind_uint32( 5, static_cast<uint32_t>(message.logModuleId));
     mStmtLogs.bind_uint32( 6, static_cast<uint32_t>(message.logThreadId));
     mStmtLogs.bind_text(   7, message.logMessage);
-    mStmtLogs.bind_text(   8, message.logThread);
-    mStmtLogs.bind_text(   9, message.logModule);
+    if (mHasNameTables)
+    {
+        mStmtLogs.bind_int64(8, _name_ref(mThreadRefs, message.logThreadId, message.logThread, true));
+        mStmtLogs.bind_int64(9, _name_ref(mModuleRefs, message.logModuleId, message.logModule, false));
+    }
+    else
+    {
+        mStmtLogs.bind_text( 8, message.logThread);
+        mStmtLogs.bind_text( 9, message.logModule);
+    }
+
     mStmtLogs.bind_uint64(10, static_cast<uint64_t>(message.logTimestamp));
     mStmtLogs.bind_uint64(11, static_cast<uint64_t>(message.logReceived));
     mStmtLogs.bind_uint32(12, static_cast<uint32_t>(message.logDuration));
@@ -798,8 +1057,7 @@ bool LogSqliteDatabase::log_scope_deactivate(const ITEM_ID& cookie, uint32_t sco
 
 bool LogSqliteDatabase::rollback()
 {
-    Lock lock(mLock);
-    return mDatabase.rollback();
+    return commit(false);
 }
 
 std::vector<String> LogSqliteDatabase::log_instance_names()
@@ -864,7 +1122,7 @@ void LogSqliteDatabase::log_thread_names(std::vector<String>& names)
 {
     Lock lock(mLock);
     names.clear();
-    SqliteStatement stmt(mDatabase, _sqlGetThreadNames);
+    SqliteStatement stmt(mDatabase, mHasNameTables ? _sqlGetThreadNamesDict : _sqlGetThreadNames);
     if (stmt.is_valid())
     {
         while (stmt.next() == SqliteStatement::QueryResult::HasMore)
@@ -1261,6 +1519,59 @@ uint32_t LogSqliteDatabase::setup_statement_read_logs(
     ) ? count_log_entries(instId) : 0u;
 }
 
+uint32_t LogSqliteDatabase::log_messages_after(std::vector<SharedBuffer>& messages, LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeEnd /*= LogSqliteDatabase::TIME_LAST*/)
+{
+    Lock lock(mLock);
+    messages.clear();
+    if ((maxEntries == 0u) || (mDatabase.is_operable() == false))
+        return 0u;
+
+    SqliteStatement stmt(mDatabase);
+    return (_setup_read_logs_after(stmt, cursor, instId, static_cast<int64_t>(maxEntries), timeEnd) ? _read_log_page(stmt, messages, cursor, true) : 0u);
+}
+
+uint32_t LogSqliteDatabase::log_messages_before(std::vector<SharedBuffer>& messages, LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeBegin /*= 0u*/)
+{
+    Lock lock(mLock);
+    messages.clear();
+    if ((maxEntries == 0u) || (mDatabase.is_operable() == false))
+        return 0u;
+
+    SqliteStatement stmt(mDatabase);
+    bool prepared{ false };
+    if (instId == areg::TARGET_ALL)
+    {
+        prepared =  stmt.prepare(_sqlGetLogMessagesBefore) &&
+                    stmt.bind_uint64(0, static_cast<uint64_t>(cursor.lcTimestamp)) &&
+                    stmt.bind_int64(1, cursor.lcRowId) &&
+                    stmt.bind_uint64(2, static_cast<uint64_t>(timeBegin)) &&
+                    stmt.bind_uint32(3, maxEntries);
+    }
+    else
+    {
+        prepared =  stmt.prepare(_sqlGetInstLogMessagesBefore) &&
+                    stmt.bind_uint32(0, static_cast<uint32_t>(instId)) &&
+                    stmt.bind_uint64(1, static_cast<uint64_t>(cursor.lcTimestamp)) &&
+                    stmt.bind_int64(2, cursor.lcRowId) &&
+                    stmt.bind_uint64(3, static_cast<uint64_t>(timeBegin)) &&
+                    stmt.bind_uint32(4, maxEntries);
+    }
+
+    return (prepared ? _read_log_page(stmt, messages, cursor, false) : 0u);
+}
+
+uint32_t LogSqliteDatabase::log_messages_in_range(std::vector<SharedBuffer>& messages, TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId /*= areg::TARGET_ALL*/)
+{
+    Lock lock(mLock);
+    messages.clear();
+    if (mDatabase.is_operable() == false)
+        return 0u;
+
+    SqliteStatement stmt(mDatabase);
+    LogCursor cursor{ timeBegin, 0 };
+    return (_setup_read_logs_after(stmt, cursor, instId, -1, timeEnd) ? _read_log_page(stmt, messages, cursor, true) : 0u);
+}
+
 uint32_t LogSqliteDatabase::setup_filter_logs(ITEM_ID instId, const ArrayList<ScopeFilter>& filter)
 {
     Lock lock(mLock);
@@ -1381,6 +1692,31 @@ uint32_t LogSqliteDatabase::count_log_entries(ITEM_ID instId)
     return (stmt.next() != SqliteStatement::QueryResult::Failed ? stmt.as_uint32(0) : 0);
 }
 
+uint32_t LogSqliteDatabase::count_log_entries(TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId /*= areg::TARGET_ALL*/)
+{
+    Lock lock(mLock);
+    if (mDatabase.is_operable() == false)
+        return 0u;
+
+    SqliteStatement stmt(mDatabase);
+    bool prepared{ false };
+    if (instId == areg::TARGET_ALL)
+    {
+        prepared =  stmt.prepare(_sqlCountLogsInRange) &&
+                    stmt.bind_uint64(0, static_cast<uint64_t>(timeBegin)) &&
+                    stmt.bind_uint64(1, static_cast<uint64_t>(timeEnd));
+    }
+    else
+    {
+        prepared =  stmt.prepare(_sqlCountInstanceLogsInRange) &&
+                    stmt.bind_uint32(0, static_cast<uint32_t>(instId)) &&
+                    stmt.bind_uint64(1, static_cast<uint64_t>(timeBegin)) &&
+                    stmt.bind_uint64(2, static_cast<uint64_t>(timeEnd));
+    }
+
+    return (prepared && (stmt.next() != SqliteStatement::QueryResult::Failed) ? stmt.as_uint32(0) : 0u);
+}
+
 uint32_t LogSqliteDatabase::count_scope_entries(ITEM_ID instId)
 {
     Lock lock(mLock);
@@ -1467,6 +1803,81 @@ bool LogSqliteDatabase::disable_filter_mask(ITEM_ID instId)
     return stmt.execute();
 }
 
+inline bool LogSqliteDatabase::_setup_read_logs_after(SqliteStatement& stmt, const LogCursor& cursor, ITEM_ID instId, int64_t limit, TIME64 timeEnd)
+{
+    if (instId == areg::TARGET_ALL)
+    {
+        return  stmt.prepare(_sqlGetLogMessagesAfter) &&
+                stmt.bind_uint64(0, static_cast<uint64_t>(cursor.lcTimestamp)) &&
+                stmt.bind_int64(1, cursor.lcRowId) &&
+                stmt.bind_uint64(2, static_cast<uint64_t>(timeEnd)) &&
+                stmt.bind_int64(3, limit);
+    }
+    else
+    {
+        return  stmt.prepare(_sqlGetInstLogMessagesAfter) &&
+                stmt.bind_uint32(0, static_cast<uint32_t>(instId)) &&
+                stmt.bind_uint64(1, static_cast<uint64_t>(cursor.lcTimestamp)) &&
+                stmt.bind_int64(2, cursor.lcRowId) &&
+                stmt.bind_uint64(3, static_cast<uint64_t>(timeEnd)) &&
+                stmt.bind_int64(4, limit);
+    }
+}
+
+inline uint32_t LogSqliteDatabase::_read_log_page(SqliteStatement& stmt, std::vector<SharedBuffer>& messages, LogCursor& cursor, bool toLast)
+{
+    constexpr int32_t _colRowId{ 13 };
+    while (stmt.next() == SqliteStatement::QueryResult::HasMore)
+    {
+        SharedBuffer buf;
+        _copy_log_message(stmt, buf);
+        messages.push_back(buf);
+
+        if (toLast || (messages.size() == 1u))
+        {
+            cursor.lcTimestamp  = static_cast<TIME64>(stmt.as_uint64(5));
+            cursor.lcRowId      = stmt.as_int64(_colRowId);
+        }
+    }
+
+    return static_cast<uint32_t>(messages.size());
+}
+
+inline int64_t LogSqliteDatabase::_name_ref(NameCache& cache, ITEM_ID id, const char* name, bool isThread)
+{
+    // The IDs of the threads and modules seldom change the name, check the cached name of the ID
+    // before looking up the name in the dictionary.
+    auto pos = cache.find(id);
+    if ((pos != cache.end()) && (pos->second.nrName.compare(name) == 0))
+        return pos->second.nrRef;
+
+    int64_t result{ 0 };
+    SqliteStatement stmt(mDatabase, isThread ? _sqlInsertThread : _sqlInsertModule);
+    stmt.bind_text(0, name);
+    if (stmt.execute())
+    {
+        stmt.reset();
+        if (stmt.prepare(isThread ? _sqlGetThreadRef : _sqlGetModuleRef) && stmt.bind_text(0, name) && (stmt.next() == SqliteStatement::QueryResult::HasMore))
+        {
+            result = stmt.as_int64(0);
+        }
+    }
+
+    if (result != 0)
+    {
+        if (cache.size() >= LogSqliteDatabase::MAX_CACHED_NAMES)
+        {
+            cache.clear();
+        }
+
+        NameRef& entry{ cache[id] };
+        entry.nrName.assign(name);
+        entry.nrRef = result;
+    }
+
+    return result;
+}
+
 bool LogSqliteDatabase::table_exists(const char* table, const char* master /*= nullptr*/)
 {
     bool result{ false };
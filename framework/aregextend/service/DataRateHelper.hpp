@@ -21,6 +21,7 @@
  ************************************************************************/
 #include "areg/base/areg_global.h"
 #include "areg/base/CommonDefs.hpp"
+#include "areg/ipc/DataRateStats.hpp"
 
 #include <utility>
 #include <string>
@@ -99,6 +100,18 @@ public:
 
     void query_data_received(uint64_t& sizeRecv, uint32_t& msgRecv) noexcept;
 
+    /**
+     * \brief   Queries the number of droppable messages lost on sending and receiving since the
+     *          last call, and resets counters.
+     **/
+    void query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept;
+
+    /**
+     * \brief   Returns the cumulative counters of the raw buffer pool of this process.
+     **/
+    [[nodiscard]]
+    BufferPoolStats query_buffer_pool() const noexcept;
+
     /**
      * \brief   Converts byte size to a formatted DataRate with appropriate units.
      *
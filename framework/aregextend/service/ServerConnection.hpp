@@ -93,6 +93,11 @@ public:
      **/
     inline const ITEM_ID & channel_id() const;
 
+    /**
+     * \brief   Returns the framings and links attached to the sockets of the clients.
+     **/
+    using SocketConnectionBase::links;
+
     /**
      * \brief   Call to reject connection. When rejected, the socket connection will be closed and
      *          no more data will be accepted from connection.
@@ -128,6 +133,18 @@ public:
 
     inline int32_t send_messages_batch(const areg::IoBuffer* messages, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize = 0) const;
 
+    /**
+     * \brief   Sends the messages to the client only if it is possible without waiting.
+     *          Returns bytes sent on success; zero if nothing is sent; negative on error.
+     **/
+    inline int32_t try_send_messages_batch(const areg::IoBuffer* messages, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize = 0) const;
+
+    /**
+     * \brief   Sends the groups of messages of many clients at once, with the send timeout of
+     *          the connection. On output, each group has the result of its send.
+     **/
+    inline void send_messages_groups(areg::IoGroup* groups, uint32_t count) const;
+
     /**
      * \brief   Receives message data via socket connection into an MessageEnvelope.
      *          Returns bytes received, zero if invalid checksum, or negative on failure.
@@ -201,6 +218,16 @@ inline int32_t ServerConnection::send_messages_batch(const areg::IoBuffer* messa
     return SocketConnectionBase::send_messages_batch(messages, count, hSocket, totalSize);
 }
 
+inline int32_t ServerConnection::try_send_messages_batch(const areg::IoBuffer* messages, uint32_t count, SOCKETHANDLE hSocket, uint32_t totalSize /*= 0*/) const
+{
+    return SocketConnectionBase::try_send_messages_batch(messages, count, hSocket, totalSize);
+}
+
+inline void ServerConnection::send_messages_groups(areg::IoGroup* groups, uint32_t count) const
+{
+    SocketConnectionBase::send_messages_groups(groups, count, mSockSendTimeoutMs);
+}
+
 inline int32_t ServerConnection::receive_message(MessageEnvelope & out_message, const SocketAccepted & clientSocket) const
 {
     return SocketConnectionBase::receive_message(out_message, clientSocket);
@@ -33,15 +33,19 @@
 #include "areg/base/OrderedMap.hpp"
 #include "areg/base/SyncPrimitives.hpp"
 #include "areg/component/Timer.hpp"
+#include "areg/ipc/CompactFraming.hpp"
 #include "areg/ipc/RemoteServiceDefs.hpp"
 #include "aregextend/service/ServerConnection.hpp"
 #include "aregextend/service/private/ClientConnectionPair.hpp"
+#include "aregextend/service/private/ServerDatagramThread.hpp"
 #include "aregextend/service/private/ServerReceiveThread.hpp"
 #include "aregextend/service/private/ServerSendThread.hpp"
+#include "aregextend/service/private/SharedMemoryReceiveThread.hpp"
 
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace areg::ext {
@@ -79,6 +83,16 @@ private:
     // List of client send/receive pair.
     using ClientPairList = std::vector<std::unique_ptr<ClientConnectionPair>>;
 
+    // The threads receiving the messages of the clients connected through shared memory.
+    using SharedMemoryReceiver  = std::unique_ptr<SharedMemoryReceiveThread>;
+    using SharedMemoryMap       = std::unordered_map<ITEM_ID, SharedMemoryReceiver>;
+    using SharedMemoryList      = std::vector<SharedMemoryReceiver>;
+
+    // The compact framings of the clients, which agreed to the compact message header.
+    using CompactFramer         = std::unique_ptr<areg::CompactFraming>;
+    using CompactMap            = std::unordered_map<ITEM_ID, CompactFramer>;
+    using CompactList           = std::vector<CompactFramer>;
+
     // Dispatch functions assigned by update_dispatch_mode() based on mNumPairs.
     // Initially set in the constructor; may be re-assigned by setup_connection_data() if config overrides mNumPairs.
     using SendCopyFn = std::function<bool(const areg::MessageEnvelope &, areg::EventPriority)>;
@@ -226,6 +240,8 @@ public:
 
     inline void query_data_received(uint64_t& sizeRecv, uint32_t& msgRecv) noexcept;
 
+    inline void query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept;
+
     /**
      * \brief   Enable or disable the data rate calculation. Also propagates the flag to
      *          all currently active pool thread pairs.
@@ -657,6 +673,64 @@ private:
      **/
     void update_dispatch_mode();
 
+    /**
+     * \brief   Opens the shared memory channel that the client offered with its connect request
+     *          and starts receiving the messages of the client through it, if the configuration
+     *          enables shared memory connections.
+     *
+     * \param   cookie      The cookie of the client connection.
+     * \param   name        The name of the channel received with the connect request.
+     * \param   hSocket     The socket of the client connection.
+     * \return  Returns true if the channel is used, the connect response confirms it then.
+     **/
+    bool start_shared_memory(const ITEM_ID & cookie, const String & name, SOCKETHANDLE hSocket);
+
+    /**
+     * \brief   Detaches the shared memory channel of the client, if any. The thread receiving
+     *          through it is joined later, so that this can be called on any thread, including
+     *          the thread holding the writer lock of the socket.
+     *
+     * \param   cookie      The cookie of the client connection.
+     **/
+    void detach_shared_memory(const ITEM_ID & cookie);
+
+    /**
+     * \brief   Detaches the shared memory channels of all clients and, if \a join is true,
+     *          waits for their receiving threads and releases them.
+     **/
+    void stop_shared_memory(bool join);
+
+    /**
+     * \brief   Attaches the compact framing to the socket of the client, which offered it with its
+     *          connect request, and starts sending in the compact frames, if the configuration
+     *          enables the compact message header.
+     *
+     * \param   cookie      The cookie of the client connection.
+     * \param   hSocket     The socket of the client connection.
+     * \return  Returns true if the framing is used, the connect response confirms it then.
+     **/
+    bool start_compact(const ITEM_ID & cookie, SOCKETHANDLE hSocket);
+
+    /**
+     * \brief   Detaches the compact framing of the client, if any. The framing is kept for the
+     *          next client, since the thread receiving from the closing socket may still use it.
+     *
+     * \param   cookie      The cookie of the client connection.
+     **/
+    void detach_compact(const ITEM_ID & cookie);
+
+    /**
+     * \brief   Detaches and releases the compact framings of all clients. Call when no thread
+     *          receives from the sockets of the clients anymore.
+     **/
+    void stop_compact();
+
+    /**
+     * \brief   Starts receiving the datagrams of the clients, if the configuration enables the
+     *          UDP connections. The UDP socket uses the address and the port of the router.
+     **/
+    void start_datagrams();
+
 //////////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////////
@@ -669,6 +743,7 @@ protected:
     Timer                           mTimerConnect;      //!< The timer object to trigger in case if failed to create server socket.
     ServerSendThread                mThreadSend;        //!< The thread to send messages to clients
     ServerReceiveThread             mThreadReceive;     //!< The thread to receive messages from clients
+    ServerDatagramThread            mThreadDatagram;    //!< The thread to receive datagrams from clients
 
     ClientPairList                  mClientPairs;       //!< Pool thread pairs; size == mNumPairs when running, mst be declared before mDataRateHelper.
     std::atomic_bool                mShuttingDown;      //!< True during stop_connection() -- suppresses spurious disconnect callbacks.
@@ -681,6 +756,10 @@ protected:
     areg::MapInstances              mInstanceMap;       //!< The map of connected instance.
     areg::SyncEvent                 mEventSendStop;     //!< The event set when cannot send and receive data anymore.
     mutable ResourceLock            mLock;              //!< The synchronization object to be accessed from different threads.
+    SharedMemoryMap                 mSharedMemory;      //!< The receiving threads of the clients connected through shared memory, guarded by mLock.
+    SharedMemoryList                mSharedRetired;     //!< The detached receiving threads to join, guarded by mLock.
+    CompactMap                      mCompact;           //!< The compact framings of the clients, guarded by mLock.
+    CompactList                     mCompactSpare;      //!< The detached compact framings to reuse, guarded by mLock.
 
     SendCopyFn      mSendFn;        //!< Routes const-ref send to shared or pool path; set in constructor.
     SendMoveFn      mSendMoveFn;    //!< Routes move-send to shared or pool path; set in constructor.
@@ -795,6 +874,12 @@ inline void ServiceCommunicationBase::query_data_received(uint64_t& sizeRecv, ui
     msgRecv  = mThreadReceive.extract_msgs_received();
 }
 
+inline void ServiceCommunicationBase::query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept
+{
+    lostSent = mThreadSend.extract_msgs_lost();
+    lostRecv = mThreadReceive.extract_msgs_lost();
+}
+
 inline bool ServiceCommunicationBase::is_data_rate_enabled() const noexcept
 {
     return mThreadSend.is_data_rate_enabled() && mThreadReceive.is_data_rate_enabled();
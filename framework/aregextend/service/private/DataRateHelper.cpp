@@ -52,6 +52,16 @@ void DataRateHelper::query_data_received(uint64_t& sizeRecv, uint32_t& msgRecv)
     mServer.query_data_received(sizeRecv, msgRecv);
 }
 
+void DataRateHelper::query_data_lost(uint32_t& lostSent, uint32_t& lostRecv) noexcept
+{
+    mServer.query_data_lost(lostSent, lostRecv);
+}
+
+BufferPoolStats DataRateHelper::query_buffer_pool() const noexcept
+{
+    return RawBufferPool::stats();
+}
+
 DataRateHelper::DataRate DataRateHelper::convert_data_rate_literals(uint64_t sizeBytes)
 {
     DataRate dataRate{ 0.0f, "" };
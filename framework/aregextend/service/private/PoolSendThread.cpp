@@ -47,6 +47,8 @@ PoolSendThread::PoolSendThread( ClientConnectionPair & owner
     , mBatch            ( )
     , mSendGate         ( )
 {
+    // One event at a time, run_send_batch() takes the rest of the queue.
+    set_dispatch_batch(1u);
 }
 
 void PoolSendThread::ready_for_events( bool is_ready )
@@ -103,7 +105,18 @@ void PoolSendThread::start_event_processing( areg::Event & eventElem )
 
 bool PoolSendThread::post_event( Event & eventElem )
 {
-    return EventDispatcher::post_event( eventElem );
+    const bool droppable{ eventElem.is_droppable() };
+    if ( EventDispatcher::post_event( eventElem ) )
+        return true;
+
+    // The full queue refuses the droppable messages, the next update replaces them.
+    if ( droppable )
+    {
+        mSendGate.leave(1u);
+        mGlobalStats.accumulate_lost(1u);
+    }
+
+    return false;
 }
 
 } // namespace areg::ext
@@ -0,0 +1,204 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        aregextend/service/private/ServerDatagramThread.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the thread receiving the datagrams of the clients.
+ ************************************************************************/
+#include "aregextend/service/private/ServerDatagramThread.hpp"
+
+#include "areg/base/MessageEnvelope.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/ipc/RemoteMessageHandler.hpp"
+#include "areg/ipc/private/ConnectionDefs.hpp"
+#include "areg/logging/areg_log.h"
+
+#include "aregextend/service/ServerConnection.hpp"
+#include "aregextend/service/private/ServerReceiveThread.hpp"
+
+#include <vector>
+
+namespace areg::ext {
+
+DEF_LOG_SCOPE(areg_aregextend_service_ServerDatagramThread, add_client);
+DEF_LOG_SCOPE(areg_aregextend_service_ServerDatagramThread, on_run);
+
+ServerDatagramThread::ServerDatagramThread( areg::RemoteMessageHandler & remoteService
+                                          , ServerConnection & connection
+                                          , ServerReceiveThread & globalStats )
+    : ThreadConsumer    ( )
+    , mRemoteService    ( remoteService )
+    , mConnection       ( connection )
+    , mGlobalStats      ( globalStats )
+    , mSocket           ( areg::InvalidSocketHandle )
+    , mPort             ( 0u )
+    , mLock             ( )
+    , mClients          ( )
+    , mStopped          ( false )
+    , mDatagramThread   ( static_cast<ThreadConsumer &>(self()), String(areg::SERVER_DATAGRAM_THREAD) )
+{
+}
+
+ServerDatagramThread::~ServerDatagramThread()
+{
+    stop();
+}
+
+bool ServerDatagramThread::start( const String & hostName, uint16_t portNr )
+{
+    ASSERT(mDatagramThread.is_running() == false);
+
+    mSocket = areg::datagram_socket_create(hostName, portNr);
+    const uint16_t port{ areg::datagram_socket_port(mSocket) };
+    mStopped.store(false, std::memory_order_release);
+    if ( (port == 0u) || !mDatagramThread.start(areg::WAIT_INFINITE) )
+    {
+        areg::socket_close(mSocket);
+        mSocket = areg::InvalidSocketHandle;
+        return false;
+    }
+
+    Lock lock(mLock);
+    mPort = port;
+    return true;
+}
+
+void ServerDatagramThread::stop()
+{
+    DatagramMap clients;
+    do
+    {
+        Lock lock(mLock);
+        clients.swap(mClients);
+        mPort = 0u;
+    } while (false);
+
+    for (auto & entry : clients)
+    {
+        entry.second->detach();
+    }
+
+    mStopped.store(true, std::memory_order_release);
+    mDatagramThread.shutdown(areg::WAIT_INFINITE);
+    if (areg::is_valid_socket(mSocket))
+    {
+        areg::socket_close(mSocket);
+        mSocket = areg::InvalidSocketHandle;
+    }
+}
+
+uint16_t ServerDatagramThread::add_client( const ITEM_ID & cookie, const SocketAccepted & client, uint16_t clientPort )
+{
+    LOG_SCOPE(areg_aregextend_service_ServerDatagramThread, add_client);
+
+    areg::DatagramEndpoint peer{ };
+    DatagramClient link{ std::make_shared<DatagramLink>() };
+    Lock lock(mLock);
+    const bool valid{ (mPort != 0u) && (clientPort != 0u) && !areg::is_local_socket(client.handle()) &&
+                      areg::datagram_endpoint(client.address().host_address(), clientPort, peer) };
+
+    // The previous link of the client leaves the socket, so that the new one can take it.
+    auto pos = (valid ? mClients.find(cookie) : mClients.end());
+    if (pos != mClients.end())
+    {
+        pos->second->detach();
+        mClients.erase(pos);
+    }
+
+    if ( !valid || !link->attach(client.handle(), mConnection.links(), mSocket, peer) )
+    {
+        LOG_DBG("Declining the UDP port [ %u ] of client [ %u ]", static_cast<uint32_t>(clientPort), static_cast<uint32_t>(cookie));
+        return 0u;
+    }
+
+    link->activate_send();
+    mClients[cookie] = std::move(link);
+    LOG_INFO("Client [ %u ] receives the droppable messages as datagrams on [ %s : %u ]"
+                , static_cast<uint32_t>(cookie)
+                , client.address().host_address().as_string()
+                , static_cast<uint32_t>(clientPort));
+
+    return mPort;
+}
+
+void ServerDatagramThread::remove_client( const ITEM_ID & cookie )
+{
+    DatagramClient link;
+    do
+    {
+        Lock lock(mLock);
+        auto pos = mClients.find(cookie);
+        if (pos == mClients.end())
+            return;
+
+        link = std::move(pos->second);
+        mClients.erase(pos);
+    } while (false);
+
+    // Out of the lock: detaching waits for the senders holding the writer lock of the socket.
+    link->detach();
+}
+
+ServerDatagramThread::DatagramClient ServerDatagramThread::_find_client( const ITEM_ID & cookie ) const
+{
+    Lock lock(mLock);
+    auto pos = mClients.find(cookie);
+    return (pos != mClients.end() ? pos->second : DatagramClient());
+}
+
+void ServerDatagramThread::on_run()
+{
+    LOG_SCOPE(areg_aregextend_service_ServerDatagramThread, on_run);
+    LOG_DBG("Receiving the datagrams of the clients through the UDP socket [ %u ]", static_cast<uint32_t>(mSocket));
+
+    std::vector<uint8_t> buffer(static_cast<size_t>(DatagramLink::BATCH_SIZE) * DatagramLink::MAX_DATAGRAM_SIZE);
+    areg::DatagramIn datagrams[DatagramLink::BATCH_SIZE];
+    for (uint32_t i = 0u; i < DatagramLink::BATCH_SIZE; ++ i)
+    {
+        datagrams[i] = areg::DatagramIn{ buffer.data() + i * DatagramLink::MAX_DATAGRAM_SIZE, DatagramLink::MAX_DATAGRAM_SIZE, 0u, { 0u, 0u } };
+    }
+
+    areg::MessageEnvelope msgReceived;
+    while (mStopped.load(std::memory_order_acquire) == false)
+    {
+        const int32_t count{ areg::datagram_receive(mSocket, datagrams, DatagramLink::BATCH_SIZE, RECEIVE_TIMEOUT) };
+        if (count < 0)
+            break;
+
+        for (int32_t i = 0; i < count; ++ i)
+        {
+            uint32_t sequence{ 0u };
+            const int32_t sizeReceived{ DatagramLink::decode(datagrams[i], msgReceived, sequence) };
+            const DatagramClient link{ sizeReceived > 0 ? _find_client(static_cast<ITEM_ID>(msgReceived.source())) : DatagramClient() };
+            if (link && link->is_peer(datagrams[i].peer))
+            {
+                const int32_t lost{ link->accept_sequence(sequence) };
+                SocketAccepted client{ mConnection.client_by_handle(link->socket()) };
+                if ((lost < 0) || (client.is_valid() == false))
+                {
+                    // Late datagram, a newer value is already delivered, or the client is gone.
+                    mGlobalStats.accumulate_lost(1u);
+                }
+                else
+                {
+                    mGlobalStats.accumulate_lost(static_cast<uint32_t>(lost));
+                    mGlobalStats.accumulate_received(static_cast<uint64_t>(sizeReceived), 1u);
+                    mRemoteService.process_received_message(msgReceived, client);
+                }
+            }
+
+            msgReceived.invalidate();
+        }
+    }
+
+    LOG_DBG("Stopped receiving the datagrams of the clients");
+}
+
+} // namespace areg::ext
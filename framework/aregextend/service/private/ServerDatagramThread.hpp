@@ -0,0 +1,201 @@
+#ifndef AREG_AREGEXTEND_SERVICE_PRIVATE_SERVERDATAGRAMTHREAD_HPP
+#define AREG_AREGEXTEND_SERVICE_PRIVATE_SERVERDATAGRAMTHREAD_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        aregextend/service/private/ServerDatagramThread.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the thread receiving the datagrams of the clients.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/SyncPrimitives.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/base/ThreadConsumer.hpp"
+#include "areg/ipc/DatagramLink.hpp"
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+namespace areg {
+    class RemoteMessageHandler;
+    class SocketAccepted;
+} // namespace areg
+
+namespace areg::ext {
+    class ServerConnection;
+    class ServerReceiveThread;
+} // namespace areg::ext
+
+namespace areg::ext {
+
+//////////////////////////////////////////////////////////////////////////
+// ServerDatagramThread class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Owns the UDP socket of the router and the datagram links of the clients, which
+ *          offered their UDP port with the connect request, see DatagramLink. The thread
+ *          receives the droppable messages of all clients through the single socket and passes
+ *          them to the remote message handler, as if they arrived from the socket of the client.
+ *          The client is found by the cookie in the source of the message, and the datagram
+ *          is accepted only from the address the client offered.
+ **/
+class ServerDatagramThread final    : private   ThreadConsumer
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    using DatagramClient    = std::shared_ptr<DatagramLink>;
+    using DatagramMap       = std::unordered_map<ITEM_ID, DatagramClient>;
+
+    //!< The time in milliseconds to wait for the datagrams before checking the exit request.
+    static constexpr uint32_t   RECEIVE_TIMEOUT { 100u };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the thread of the router.
+     *
+     * \param   remoteService   The remote message handler to pass the received messages.
+     * \param   connection      The server connection object, which owns the client sockets.
+     * \param   globalStats     The global receive thread, which accumulates the received data.
+     **/
+    ServerDatagramThread( areg::RemoteMessageHandler & remoteService
+                        , ServerConnection & connection
+                        , ServerReceiveThread & globalStats );
+
+    ~ServerDatagramThread() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the thread runs.
+     **/
+    [[nodiscard]]
+    inline bool is_running() const noexcept;
+
+    /**
+     * \brief   Creates the UDP socket bound to the address of the router and starts the thread.
+     *
+     * \param   hostName    The address of the router.
+     * \param   portNr      The TCP port of the router, the UDP socket uses the same number.
+     * \return  Returns true if the thread runs.
+     **/
+    bool start( const String & hostName, uint16_t portNr );
+
+    /**
+     * \brief   Detaches the links of all clients, waits for the thread to leave and closes the
+     *          UDP socket.
+     **/
+    void stop();
+
+    /**
+     * \brief   Attaches the datagram link to the socket of the client, which offered its UDP port
+     *          with the connect request. The clients connected through the local socket have no
+     *          address to send the datagrams, they are declined.
+     *
+     * \param   cookie      The cookie of the client connection.
+     * \param   client      The socket of the client connection.
+     * \param   clientPort  The UDP port offered by the client.
+     * \return  Returns the port of the UDP socket of the router to answer the client, zero if
+     *          the client stays on TCP.
+     **/
+    uint16_t add_client( const ITEM_ID & cookie, const SocketAccepted & client, uint16_t clientPort );
+
+    /**
+     * \brief   Detaches the datagram link of the client, if there is one.
+     *          Does not wait for the thread, it can be called on any thread.
+     **/
+    void remove_client( const ITEM_ID & cookie );
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+private:
+/************************************************************************/
+// ThreadConsumer interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Receives the datagrams of the clients until the thread is stopped.
+     **/
+    void on_run() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    inline ServerDatagramThread & self();
+
+    /**
+     * \brief   Returns the link of the client, empty if there is none.
+     **/
+    DatagramClient _find_client( const ITEM_ID & cookie ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The instance of remote service message handler.
+    areg::RemoteMessageHandler &    mRemoteService;
+    //!< The instance of server connection object.
+    ServerConnection &              mConnection;
+    //!< The global receive thread, which accumulates the received data.
+    ServerReceiveThread &           mGlobalStats;
+    //!< The UDP socket of the router.
+    SOCKETHANDLE                    mSocket;
+    //!< The port of the UDP socket, zero if there is none.
+    uint16_t                        mPort;
+    //!< The synchronization object of the links.
+    mutable ResourceLock            mLock;
+    //!< The datagram links of the clients, guarded by mLock.
+    DatagramMap                     mClients;
+    //!< Set when the thread should leave.
+    std::atomic_bool                mStopped;
+    //!< The receiving thread.
+    Thread                          mDatagramThread;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    ServerDatagramThread() = delete;
+    AREG_NOCOPY_NOMOVE( ServerDatagramThread );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// ServerDatagramThread class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool ServerDatagramThread::is_running() const noexcept
+{
+    return mDatagramThread.is_running();
+}
+
+inline ServerDatagramThread & ServerDatagramThread::self()
+{
+    return (*this);
+}
+
+} // namespace areg::ext
+
+#endif  // AREG_AREGEXTEND_SERVICE_PRIVATE_SERVERDATAGRAMTHREAD_HPP
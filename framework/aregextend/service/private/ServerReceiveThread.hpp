@@ -82,6 +82,13 @@ public:
     [[nodiscard]]
     inline uint32_t extract_msgs_received() const noexcept;
 
+    /**
+     * \brief   Returns accumulative count of droppable messages lost on receiving and resets the existing
+     *          value to zero. The operations are atomic.
+     **/
+    [[nodiscard]]
+    inline uint32_t extract_msgs_lost() const noexcept;
+
     /**
      * \brief   Call to enable or disable the received data calculation. It also resets the existing
      *          calculated data.
@@ -106,6 +113,13 @@ public:
      **/
     inline void accumulate_received(uint64_t bytes, uint32_t msgs) noexcept;
 
+    /**
+     * \brief   Accumulates the count of droppable messages lost on receiving. Thread-safe: uses atomic add.
+     *
+     * \param   msgs    Number of lost messages.
+     **/
+    inline void accumulate_lost(uint32_t msgs) noexcept;
+
 protected:
 /************************************************************************/
 // DispatcherThread overrides
@@ -181,6 +195,11 @@ inline uint32_t ServerReceiveThread::extract_msgs_received() const noexcept
     return mRecvStats.extract_msgs();
 }
 
+inline uint32_t ServerReceiveThread::extract_msgs_lost() const noexcept
+{
+    return mRecvStats.extract_lost();
+}
+
 inline void ServerReceiveThread::set_data_rate_enabled(bool enable) noexcept
 {
     mRecvStats.set_enabled(enable);
@@ -196,6 +215,11 @@ inline void ServerReceiveThread::accumulate_received(uint64_t bytes, uint32_t ms
     mRecvStats.accumulate(bytes, msgs);
 }
 
+inline void ServerReceiveThread::accumulate_lost(uint32_t msgs) noexcept
+{
+    mRecvStats.accumulate_lost(msgs);
+}
+
 } // namespace areg::ext
 
 #endif  // AREG_AREGEXTEND_SERVICE_PRIVATE_SERVERRECEIVETHREAD_HPP
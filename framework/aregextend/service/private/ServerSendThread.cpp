@@ -39,6 +39,8 @@ ServerSendThread::ServerSendThread(RemoteMessageHandler& remoteService, ServerCo
     , mSendStats        ( )
     , mSendGate         ( )
 {
+    // run_send_batch() drains the queue itself, a batch taken by the loop would reorder the messages.
+    set_dispatch_batch(1u);
 }
 
 void ServerSendThread::ready_for_events( bool is_ready )
@@ -99,7 +101,18 @@ void ServerSendThread::start_event_processing( areg::Event & eventElem )
 
 bool ServerSendThread::post_event( Event & eventElem )
 {
-    return EventDispatcher::post_event( eventElem );
+    const bool droppable{ eventElem.is_droppable() };
+    if ( EventDispatcher::post_event( eventElem ) )
+        return true;
+
+    // The full queue refuses the droppable messages, the next update replaces them.
+    if ( droppable )
+    {
+        mSendGate.leave(1u);
+        accumulate_lost(1u);
+    }
+
+    return false;
 }
 
 } // namespace areg::ext
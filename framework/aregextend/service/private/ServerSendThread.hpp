@@ -95,6 +95,13 @@ public:
     [[nodiscard]]
     inline uint32_t extract_msgs_sent() const noexcept;
 
+    /**
+     * \brief   Returns accumulative count of droppable messages lost on sending and resets the existing
+     *          value to zero. The operations are atomic.
+     **/
+    [[nodiscard]]
+    inline uint32_t extract_msgs_lost() const noexcept;
+
     /**
      * \brief   Call to enable or disable the received data calculation. It also resets the existing
      *          calculated data.
@@ -116,6 +123,13 @@ public:
      **/
     inline void accumulate_sent(uint64_t bytes, uint32_t msgs) noexcept;
 
+    /**
+     * \brief   Accumulates the count of droppable messages lost on sending. Thread-safe: uses atomic add.
+     *
+     * \param   msgs    Number of lost messages.
+     **/
+    inline void accumulate_lost(uint32_t msgs) noexcept;
+
     /**
      * \brief   Returns the gate of the send queue of this thread. A producer that wants to write
      *          a message into the socket itself must find the gate clear first, and must announce
@@ -219,6 +233,11 @@ inline uint32_t ServerSendThread::extract_msgs_sent() const noexcept
     return mSendStats.extract_msgs();
 }
 
+inline uint32_t ServerSendThread::extract_msgs_lost() const noexcept
+{
+    return mSendStats.extract_lost();
+}
+
 inline void ServerSendThread::set_data_rate_enabled(bool enable) noexcept
 {
     mSendStats.set_enabled(enable);
@@ -234,6 +253,11 @@ inline void ServerSendThread::accumulate_sent(uint64_t bytes, uint32_t msgs) noe
     mSendStats.accumulate(bytes, msgs);
 }
 
+inline void ServerSendThread::accumulate_lost(uint32_t msgs) noexcept
+{
+    mSendStats.accumulate_lost(msgs);
+}
+
 inline uint32_t ServerSendThread::drain_limit() const noexcept
 {
     return mDrainLimit;
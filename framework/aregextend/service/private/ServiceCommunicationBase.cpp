@@ -30,6 +30,20 @@
 
 #include "areg/base/private/DebugDefs.hpp"
 
+namespace {
+
+    /**
+     * \brief   Returns the number of bytes of the message left to read.
+     **/
+    inline uint32_t _size_left( const areg::MessageEnvelope & msg ) noexcept
+    {
+        const uint32_t pos{ msg.position() };
+        const uint32_t used{ msg.size_used() };
+        return (pos < used ? used - pos : 0u);
+    }
+
+} // namespace
+
 namespace areg::ext {
 
 DEF_LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, connect_service_host);
@@ -51,6 +65,9 @@ DEF_LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, failed_receive_me
 
 DEF_LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, connection_failure);
 DEF_LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, do_accept_client_pool);
+DEF_LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, start_shared_memory);
+DEF_LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, start_compact);
+DEF_LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, start_datagrams);
 
 DEBUG_DEF_LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, process_received_message);
 
@@ -80,6 +97,7 @@ ServiceCommunicationBase::ServiceCommunicationBase( const ITEM_ID & serviceId
     , mTimerConnect     ( static_cast<TimerConsumer &>(mTimerConsumer), areg::SERVER_CONNECT_TIMER_NAME.data( ) )
     , mThreadSend       ( static_cast<RemoteMessageHandler&>(self()), mServerConnection )
     , mThreadReceive    ( static_cast<ConnectionHandler&>(self()), static_cast<RemoteMessageHandler&>(self()), mServerConnection )
+    , mThreadDatagram   ( static_cast<RemoteMessageHandler&>(self()), mServerConnection, mThreadReceive )
     , mClientPairs      ( )
     , mShuttingDown     ( false )
     , mDataRateHelper   ( self() , areg::ext::DEFAULT_VERBOSE)
@@ -91,6 +109,10 @@ ServiceCommunicationBase::ServiceCommunicationBase( const ITEM_ID & serviceId
     , mInstanceMap      (  )
     , mEventSendStop    ( false, false )
     , mLock             ( )
+    , mSharedMemory     ( )
+    , mSharedRetired    ( )
+    , mCompact          ( )
+    , mCompactSpare     ( )
     , mSendFn           ( )
     , mSendMoveFn       ( )
     , mAcceptFn         ( )
@@ -153,6 +175,10 @@ bool ServiceCommunicationBase::setup_connection_data(areg::RemoteServiceKind ser
     mServerConnection.set_socket_buffers(config.socket_send_buffer(), config.socket_recv_buffer());
     mServerConnection.set_send_timeout(config.socket_send_timeout());
 
+    // The local stream socket is opened in parallel with TCP for the processes of the same host.
+    ConnectionConfiguration local(mService, areg::ConnectionType::UnixSocket);
+    mServerConnection.set_local_socket_enabled(local.is_connection_listed() && local.connection_enable_flag());
+
     const uint32_t configPairs{ config.pool_pairs() };
     if (configPairs != mNumPairs)
     {
@@ -283,6 +309,9 @@ void ServiceCommunicationBase::connection_lost( SocketAccepted & clientSocket )
     if ( cookie != areg::COOKIE_UNKNOWN )
     {
         mLostFn(cookie);
+        detach_shared_memory(cookie);
+        mThreadDatagram.remove_client(cookie);
+        detach_compact(cookie);
         remove_instance(cookie);
         areg::MessageEnvelope msgDisconnect{ areg::create_disconnect_request(cookie, channel) };
         send_received_message(std::move(msgDisconnect), areg::EventPriority::HighPrio);
@@ -417,6 +446,7 @@ bool ServiceCommunicationBase::start_connection()
         if ( start_send_thread( ) && start_receive_thread( ) )
         {
             result = true;
+            start_datagrams( );
             LOG_DBG( "The threads are created. Ready to send-receive messages." );
         }
         else
@@ -497,6 +527,8 @@ void ServiceCommunicationBase::stop_connection()
     }
 
     mThreadSend.wait_completion( areg::WAIT_INFINITE );
+    stop_shared_memory(false);
+    mThreadDatagram.stop();
     mServerConnection.close_socket();
 
     mThreadSend.shutdown( areg::WAIT_INFINITE );
@@ -510,6 +542,8 @@ void ServiceCommunicationBase::stop_connection()
         }
     }
 
+    stop_shared_memory(true);
+    stop_compact();
     mShuttingDown.store(false, std::memory_order_release);
 }
 
@@ -559,6 +593,222 @@ bool ServiceCommunicationBase::do_accept_client_pool( SocketAccepted & clientSoc
     return true;
 }
 
+bool ServiceCommunicationBase::start_shared_memory( const ITEM_ID & cookie, const String & name, SOCKETHANDLE hSocket )
+{
+    LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, start_shared_memory);
+
+    // Join the receiving threads of the channels detached before.
+    SharedMemoryList finished;
+    do
+    {
+        Lock lock(mLock);
+        for (auto it = mSharedRetired.begin(); it != mSharedRetired.end(); )
+        {
+            if ((*it)->is_running() == false)
+            {
+                finished.push_back(std::move(*it));
+                it = mSharedRetired.erase(it);
+            }
+            else
+            {
+                ++ it;
+            }
+        }
+    } while (false);
+
+    finished.clear();
+
+    ConnectionConfiguration config(mService, areg::ConnectionType::SharedMemory);
+    if ( name.is_empty() || mShuttingDown.load(std::memory_order_acquire) ||
+         !config.is_connection_listed() || !config.connection_enable_flag() )
+    {
+        LOG_DBG("Declining the shared memory channel [ %s ] of client [ %u ]", name.as_string(), static_cast<uint32_t>(cookie));
+        return false;
+    }
+
+    SharedMemoryReceiver receiver{ std::make_unique<SharedMemoryReceiveThread>(static_cast<RemoteMessageHandler &>(self()), mServerConnection, mThreadReceive, cookie) };
+    if ( !receiver->start(name, hSocket, areg::SOCKET_SEND_TIMEOUT_MS) )
+    {
+        LOG_WARN("Failed to open the shared memory channel [ %s ] of client [ %u ], the client stays on TCP", name.as_string(), static_cast<uint32_t>(cookie));
+        return false;
+    }
+
+    LOG_INFO("Client [ %u ] is connected through the shared memory channel [ %s ]", static_cast<uint32_t>(cookie), name.as_string());
+    SharedMemoryReceiver previous;
+    do
+    {
+        Lock lock(mLock);
+        previous = std::move(mSharedMemory[cookie]);
+        mSharedMemory[cookie] = std::move(receiver);
+    } while (false);
+
+    if (previous)
+    {
+        previous->stop();
+    }
+
+    return true;
+}
+
+void ServiceCommunicationBase::detach_shared_memory( const ITEM_ID & cookie )
+{
+    SharedMemoryReceiver receiver;
+    do
+    {
+        Lock lock(mLock);
+        auto pos = mSharedMemory.find(cookie);
+        if (pos == mSharedMemory.end())
+            return;
+
+        receiver = std::move(pos->second);
+        mSharedMemory.erase(pos);
+    } while (false);
+
+    // Out of the lock: detaching waits for the senders holding the writer lock of the socket.
+    // The thread is not joined here, the caller may be the thread itself.
+    receiver->detach();
+
+    Lock lock(mLock);
+    mSharedRetired.push_back(std::move(receiver));
+}
+
+bool ServiceCommunicationBase::start_compact( const ITEM_ID & cookie, SOCKETHANDLE hSocket )
+{
+    LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, start_compact);
+
+    ConnectionConfiguration config(mService, areg::ConnectionType::Tcpip);
+    if ( mShuttingDown.load(std::memory_order_acquire) || !config.compact_header() )
+    {
+        LOG_DBG("Declining the compact header of client [ %u ]", static_cast<uint32_t>(cookie));
+        return false;
+    }
+
+    detach_compact(cookie);
+
+    CompactFramer framing;
+    do
+    {
+        Lock lock(mLock);
+        if (mCompactSpare.empty() == false)
+        {
+            framing = std::move(mCompactSpare.back());
+            mCompactSpare.pop_back();
+        }
+    } while (false);
+
+    if (!framing)
+    {
+        framing = std::make_unique<areg::CompactFraming>();
+    }
+
+    if ( !framing->attach(hSocket, mServerConnection.links()) )
+    {
+        LOG_WARN("Failed to attach the compact framing to client [ %u ], the client keeps the full header", static_cast<uint32_t>(cookie));
+        Lock lock(mLock);
+        mCompactSpare.push_back(std::move(framing));
+        return false;
+    }
+
+    // The client decodes the compact frames since it offered them, the response may be one.
+    framing->activate_send();
+    LOG_DBG("Client [ %u ] exchanges the messages with the compact header", static_cast<uint32_t>(cookie));
+
+    Lock lock(mLock);
+    mCompact[cookie] = std::move(framing);
+    return true;
+}
+
+void ServiceCommunicationBase::detach_compact( const ITEM_ID & cookie )
+{
+    CompactFramer framing;
+    do
+    {
+        Lock lock(mLock);
+        auto pos = mCompact.find(cookie);
+        if (pos == mCompact.end())
+            return;
+
+        framing = std::move(pos->second);
+        mCompact.erase(pos);
+    } while (false);
+
+    // Out of the lock: detaching waits for the senders holding the writer lock of the socket.
+    framing->detach();
+
+    Lock lock(mLock);
+    mCompactSpare.push_back(std::move(framing));
+}
+
+void ServiceCommunicationBase::stop_compact()
+{
+    CompactList framings;
+    do
+    {
+        Lock lock(mLock);
+        framings.swap(mCompactSpare);
+        for (auto & entry : mCompact)
+        {
+            framings.push_back(std::move(entry.second));
+        }
+
+        mCompact.clear();
+    } while (false);
+
+    // The destructors detach the framings.
+    framings.clear();
+}
+
+void ServiceCommunicationBase::stop_shared_memory( bool join )
+{
+    SharedMemoryList receivers;
+    do
+    {
+        Lock lock(mLock);
+        receivers.swap(mSharedRetired);
+        for (auto & entry : mSharedMemory)
+        {
+            receivers.push_back(std::move(entry.second));
+        }
+
+        mSharedMemory.clear();
+    } while (false);
+
+    for (const auto & receiver : receivers)
+    {
+        receiver->detach();
+    }
+
+    if (join == false)
+    {
+        Lock lock(mLock);
+        for (auto & receiver : receivers)
+        {
+            mSharedRetired.push_back(std::move(receiver));
+        }
+    }
+
+    // Otherwise the destructors join the threads and unmap the channels.
+    receivers.clear();
+}
+
+void ServiceCommunicationBase::start_datagrams()
+{
+    LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase, start_datagrams);
+
+    ConnectionConfiguration config(mService, areg::ConnectionType::Udp);
+    if ( !config.is_connection_listed() || !config.connection_enable_flag() )
+        return;
+
+    if ( mThreadDatagram.start(mServerConnection.address().host_address(), mServerConnection.address().host_port()) )
+    {
+        LOG_INFO("The router receives the droppable messages as datagrams on UDP port [ %u ]", static_cast<uint32_t>(mServerConnection.address().host_port()));
+    }
+    else
+    {
+        LOG_WARN("Failed to open the UDP socket on port [ %u ], all messages stay on TCP", static_cast<uint32_t>(mServerConnection.address().host_port()));
+    }
+}
+
 void ServiceCommunicationBase::do_client_lost_shared( ITEM_ID /*cookie*/ )
 {
 }
@@ -604,7 +854,7 @@ bool ServiceCommunicationBase::try_send_inline( areg::MessageEnvelope & data, SO
     {
         AREG_LT_SCOPE(areg::LtStage::SendSyscall);
         const areg::IoBuffer ioBuffer{ reinterpret_cast<const uint8_t *>(hdr), wireSize };
-        sent = areg::try_send_data_v(hSocket, &ioBuffer, 1u, wireSize);
+        sent = mServerConnection.try_send_messages_batch(&ioBuffer, 1u, hSocket, wireSize);
     }
 
     writer.release();
@@ -815,6 +1065,9 @@ void ServiceCommunicationBase::process_received_message(areg::MessageEnvelope &
     {
         if ( msgId == areg::FuncIdRange::SystemServiceDisconnect )
         {
+            detach_shared_memory( cookie );
+            mThreadDatagram.remove_client( cookie );
+            detach_compact( cookie );
             remove_instance( cookie );
             mServerConnection.close_connection( cookie );
         }
@@ -829,6 +1082,51 @@ void ServiceCommunicationBase::process_received_message(areg::MessageEnvelope &
         instance.ciCookie = cookie;
         add_instance(cookie, instance);
         areg::MessageEnvelope msgConnect{ connect_message(mServerConnection.channel_id(), cookie, areg::MessageSource::SourceService) };
+
+        // The client may offer a shared memory channel, a UDP port and the compact header: the
+        // name of the channel, empty if there is none, follows the instance, then the port,
+        // zero if there is none, then the flag of the compact header.
+        bool sharedMemory{ false };
+        uint16_t datagramPort{ 0u };
+        bool compact{ false };
+        if ( _size_left(msgReceived) != 0u )
+        {
+            String name;
+            msgReceived >> name;
+            sharedMemory = (name.is_empty() == false) && start_shared_memory(cookie, name, whichSource.handle());
+            if ( _size_left(msgReceived) >= sizeof(uint16_t) )
+            {
+                uint16_t clientPort{ 0u };
+                msgReceived >> clientPort;
+                if ( clientPort != 0u )
+                {
+                    datagramPort = mThreadDatagram.add_client(cookie, mServerConnection.client_by_handle(whichSource.handle()), clientPort);
+                }
+            }
+
+            if ( _size_left(msgReceived) >= sizeof(bool) )
+            {
+                bool offered{ false };
+                msgReceived >> offered;
+                compact = offered && start_compact(cookie, whichSource.handle());
+            }
+        }
+
+        if ( sharedMemory || (datagramPort != 0u) || compact )
+        {
+            msgConnect.move_to_end();
+            msgConnect << sharedMemory;
+            if ( (datagramPort != 0u) || compact )
+            {
+                msgConnect << datagramPort;
+            }
+
+            if ( compact )
+            {
+                msgConnect << compact;
+            }
+        }
+
         DEBUG_LOG_DBG("Received request connect message, sending response [ %s ] of id [ %u ], to new target [ %u ], connection socket [ %u ], checksum [ %u ]"
                     , areg::as_string( static_cast<areg::FuncIdRange>(msgConnect.message_id()))
                     , msgConnect.message_id()
@@ -68,10 +68,11 @@ inline void sort_pending_sends(areg::ext::PendingSend * batch, uint32_t count) n
 }
 
 /**
- * \brief   Phase 3 of the send batch pipeline: send each same-socket group
- *          with a single syscall and accumulate stats.
+ * \brief   Phase 3 of the send batch pipeline: make one group of buffers of each same-socket
+ *          run, send all groups at once and accumulate stats. On Linux built with AREG_IO_URING,
+ *          the groups of all sockets are written with a single system call.
  *
- * \param   batch   Sorted ascending by socket handle batch.
+ * \param   batch   Sorted ascending by socket handle batch, up to areg::DEFAULT_DRAIN_LIMIT entries.
  * \param   count   Number of valid entries in \a batch.
  * \param   conn    Server connection (send + client-lookup API).
  * \param   handler Remote message handler (failure callback).
@@ -85,92 +86,79 @@ inline void send_pending_groups( areg::ext::PendingSend * batch
                                , areg::RemoteMessageHandler & handler
                                , AccumFn && accum )
 {
-    for ( uint32_t i{ 0u }; i < count; )
+    areg::IoBuffer ioBuffer[areg::DEFAULT_DRAIN_LIMIT];
+    areg::IoGroup  groups[areg::DEFAULT_DRAIN_LIMIT];
+    uint32_t       firstMsg[areg::DEFAULT_DRAIN_LIMIT];  // The batch entry reported when a group fails.
+    uint32_t bufCount  { 0u };
+    uint32_t groupCount{ 0u };
+
+    for ( uint32_t i{ 0u }; (i < count) && (bufCount < areg::DEFAULT_DRAIN_LIMIT); )
     {
         const SOCKETHANDLE hSocket{ batch[i].socket };
         uint32_t j{ i + 1u };
         while ( (j < count) && (batch[j].socket == hSocket) )
             ++j;
 
-        const uint32_t groupSize{ j - i };
-
-        // Single writer per socket: the writes below belong to one message group and must not
-        // be split by another thread writing into the same socket.
-        areg::SocketWriteGuard writeGuard{ hSocket };
-
-        areg::IoBuffer ioBuffer[areg::DEFAULT_DRAIN_LIMIT];
-        uint32_t bufCount  { 0u };
-        uint64_t totalSize { 0u };  // 64-bit: sum of up to DEFAULT_DRAIN_LIMIT wire sizes cannot overflow.
-
-        for ( uint32_t k{ 0u }; k < groupSize; ++k )
+        // send_messages_groups() returns the byte count of a group as a signed int32, so one group must
+        // never carry more than MAX_SEND_BATCH_BYTES (else the result overflows negative and the send
+        // looks like a failure -> the client is dropped). A rare oversized run is split into several
+        // groups of the same socket, which are sent in order. A single message is capped at MAX_BUF_LENGTH
+        // (< MAX_SEND_BATCH_BYTES), always fitting one group.
+        uint32_t groupStart{ bufCount };
+        uint32_t groupBytes{ 0u };
+        for ( uint32_t k{ i }; (k < j) && (bufCount < areg::DEFAULT_DRAIN_LIMIT); ++k )
         {
             // PendingSend::msg is the wire-ready IPC envelope; header + payload sent verbatim.
             // internal1/internal2/custom were zeroed by the send thread before storage here.
-            const areg::MessageEnvelope & env{ batch[i + k].msg };
+            const areg::MessageEnvelope & env{ batch[k].msg };
             env.buffer_completion_fix(); // compute checksum if still CHECKSUM_INVALID (e.g. connect/register messages)
             const areg::EventHeader* ipcHdr{ env.header() };
             if (ipcHdr == nullptr)
                 continue;
 
             const uint32_t wireSize{ static_cast<uint32_t>(sizeof(areg::EventHeader)) + ipcHdr->bufHeader.biUsed };
+            if ( (bufCount != groupStart) && (wireSize > (areg::MAX_SEND_BATCH_BYTES - groupBytes)) )
+            {
+                groups[groupCount]   = areg::IoGroup{ hSocket, ioBuffer + groupStart, bufCount - groupStart, groupBytes, 0 };
+                firstMsg[groupCount] = i;
+                ++groupCount;
+                groupStart = bufCount;
+                groupBytes = 0u;
+            }
+
             ioBuffer[bufCount++] = { reinterpret_cast<const uint8_t*>(ipcHdr), wireSize };
-            totalSize += wireSize;
+            groupBytes += wireSize;
         }
 
-        if ( bufCount == 0u )
+        if ( bufCount != groupStart )
         {
-            i = j;
-            continue;
+            groups[groupCount]   = areg::IoGroup{ hSocket, ioBuffer + groupStart, bufCount - groupStart, groupBytes, 0 };
+            firstMsg[groupCount] = i;
+            ++groupCount;
         }
 
-        // send_messages_batch() returns the byte count as a signed int32, so one call must never carry
-        // more than MAX_SEND_BATCH_BYTES (else the return overflows negative and the send looks like a
-        // failure -> the client is dropped). The common case (the whole group fits the cap) is one send
-        // call with no extra pass over the buffers; only a rare oversized aggregate enters the split
-        // loop. A single message is capped at MAX_BUF_LENGTH (< MAX_SEND_BATCH_BYTES), always fitting one batch.
-        if ( totalSize <= areg::MAX_SEND_BATCH_BYTES )
+        i = j;
+    }
+
+    if ( groupCount == 0u )
+        return;
+
+    // Single writer per socket: send_messages_groups() takes the writer lock of every socket, so the
+    // groups are not split by another thread writing into the same socket.
+    conn.send_messages_groups(groups, groupCount);
+
+    for ( uint32_t g{ 0u }; g < groupCount; ++g )
+    {
+        const areg::IoGroup & group{ groups[g] };
+        if ( group.result > 0 )
         {
-            const int32_t sent{ conn.send_messages_batch(ioBuffer, bufCount, hSocket, static_cast<uint32_t>(totalSize)) };
-            if ( sent > 0 )
-            {
-                accum(static_cast<uint64_t>(sent), bufCount);
-            }
-            else if ( !conn.is_interrupted() )
-            {
-                areg::SocketAccepted client{ conn.client_by_handle(hSocket) };
-                handler.failed_send_message(batch[i].msg, client);
-            }
+            accum(static_cast<uint64_t>(group.result), group.count);
         }
-        else
+        else if ( !conn.is_interrupted() )
         {
-            for ( uint32_t start{ 0u }; start < bufCount; )
-            {
-                uint32_t end       { start };
-                uint32_t batchBytes{ 0u };
-                do
-                {
-                    batchBytes += static_cast<uint32_t>(ioBuffer[end].size);
-                    ++end;
-                }
-                while ( (end < bufCount) &&
-                        (static_cast<uint32_t>(ioBuffer[end].size) <= (areg::MAX_SEND_BATCH_BYTES - batchBytes)) );
-
-                const int32_t sent{ conn.send_messages_batch(ioBuffer + start, end - start, hSocket, batchBytes) };
-                if ( sent > 0 )
-                {
-                    accum(static_cast<uint64_t>(sent), end - start);
-                }
-                else if ( !conn.is_interrupted() )
-                {
-                    areg::SocketAccepted client{ conn.client_by_handle(hSocket) };
-                    handler.failed_send_message(batch[i].msg, client);
-                }
-
-                start = end;
-            }
+            areg::SocketAccepted client{ conn.client_by_handle(group.socket) };
+            handler.failed_send_message(batch[firstMsg[g]].msg, client);
         }
-
-        i = j;
     }
 }
 
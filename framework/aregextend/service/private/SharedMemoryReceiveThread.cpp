@@ -0,0 +1,144 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        aregextend/service/private/SharedMemoryReceiveThread.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the thread receiving the messages of a client through shared memory.
+ ************************************************************************/
+#include "aregextend/service/private/SharedMemoryReceiveThread.hpp"
+
+#include "areg/base/MessageEnvelope.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/ipc/RemoteMessageHandler.hpp"
+#include "areg/logging/areg_log.h"
+
+#include "aregextend/service/ServerConnection.hpp"
+#include "aregextend/service/private/ServerReceiveThread.hpp"
+
+namespace {
+
+    /**
+     * \brief   Returns the unique name of the thread receiving the messages of the client.
+     **/
+    areg::String _thread_name( const ITEM_ID & cookie )
+    {
+        areg::String result;
+        result.format("AregShmRecv_%u", static_cast<uint32_t>(cookie));
+        return result;
+    }
+
+} // namespace
+
+namespace areg::ext {
+
+DEF_LOG_SCOPE(areg_aregextend_service_SharedMemoryReceiveThread, on_run);
+
+SharedMemoryReceiveThread::SharedMemoryReceiveThread( areg::RemoteMessageHandler & remoteService
+                                                    , ServerConnection & connection
+                                                    , ServerReceiveThread & globalStats
+                                                    , const ITEM_ID & cookie )
+    : ThreadConsumer    ( )
+    , mRemoteService    ( remoteService )
+    , mConnection       ( connection )
+    , mGlobalStats      ( globalStats )
+    , mLink             ( )
+    , mSocket           ( areg::InvalidSocketHandle )
+    , mReceiveThread    ( static_cast<ThreadConsumer &>(self()), _thread_name(cookie) )
+{
+}
+
+SharedMemoryReceiveThread::~SharedMemoryReceiveThread()
+{
+    stop();
+}
+
+bool SharedMemoryReceiveThread::start( const String & name, SOCKETHANDLE hSocket, uint32_t timeoutMs )
+{
+    ASSERT(mReceiveThread.is_running() == false);
+
+    if ( !mLink.open(name, timeoutMs) )
+        return false;
+
+    if ( !mLink.attach(hSocket, mConnection.links()) )
+    {
+        mLink.release();
+        return false;
+    }
+
+    mSocket = hSocket;
+    if ( !mReceiveThread.start(areg::WAIT_INFINITE) )
+    {
+        mLink.detach();
+        mLink.release();
+        mSocket = areg::InvalidSocketHandle;
+        return false;
+    }
+
+    return true;
+}
+
+void SharedMemoryReceiveThread::detach() noexcept
+{
+    mLink.detach();
+}
+
+void SharedMemoryReceiveThread::stop()
+{
+    mLink.detach();
+    mReceiveThread.shutdown(areg::WAIT_INFINITE);
+    mLink.release();
+    mSocket = areg::InvalidSocketHandle;
+}
+
+void SharedMemoryReceiveThread::on_run()
+{
+    LOG_SCOPE(areg_aregextend_service_SharedMemoryReceiveThread, on_run);
+
+    SocketAccepted client{ mConnection.client_by_handle(mSocket) };
+    LOG_DBG("Receiving the messages of socket [ %u ] through the shared memory channel [ %s ]"
+                , static_cast<uint32_t>(mSocket)
+                , mLink.name().as_string());
+
+    areg::MessageEnvelope msgReceived;
+    bool first{ true };
+    while (client.is_valid())
+    {
+        const int32_t sizeReceived{ mLink.receive_message(msgReceived, areg::WAIT_INFINITE) };
+        if (sizeReceived > 0)
+        {
+            if (first)
+            {
+                // The client sends through the channel now, answer it the same way.
+                first = false;
+                mLink.activate_send();
+            }
+
+            mGlobalStats.accumulate_received(static_cast<uint64_t>(sizeReceived), 1u);
+            mRemoteService.process_received_message(msgReceived, client);
+        }
+        else
+        {
+            if (sizeReceived == 0)
+            {
+                LOG_WARN("Received a corrupted message from socket [ %u ] through the shared memory, closing connection"
+                            , static_cast<uint32_t>(mSocket));
+                mRemoteService.failed_receive_message(client);
+            }
+
+            break;
+        }
+
+        msgReceived.invalidate();
+    }
+
+    LOG_DBG("Stopped receiving the messages of socket [ %u ] through the shared memory", static_cast<uint32_t>(mSocket));
+}
+
+} // namespace areg::ext
@@ -0,0 +1,168 @@
+#ifndef AREG_AREGEXTEND_SERVICE_PRIVATE_SHAREDMEMORYRECEIVETHREAD_HPP
+#define AREG_AREGEXTEND_SERVICE_PRIVATE_SHAREDMEMORYRECEIVETHREAD_HPP
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        aregextend/service/private/SharedMemoryReceiveThread.hpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, the thread receiving the messages of a client through shared memory.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/Thread.hpp"
+#include "areg/base/ThreadConsumer.hpp"
+#include "areg/ipc/SharedMemoryLink.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+namespace areg {
+    class RemoteMessageHandler;
+} // namespace areg
+
+namespace areg::ext {
+    class ServerConnection;
+    class ServerReceiveThread;
+} // namespace areg::ext
+
+namespace areg::ext {
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryReceiveThread class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Receives the messages of one client that offered a shared memory channel with its
+ *          connect request, see SharedMemoryLink. The thread owns the router side of the link:
+ *          it opens the channel, attaches it to the socket of the client and passes every
+ *          received message to the remote message handler, as if it arrived from the socket.
+ *          The sending to the client switches to the channel with the first received message.
+ *
+ *          The thread stops when the link is detached or when the client shuts the channel
+ *          down. The end of the connection itself is reported by the socket.
+ **/
+class SharedMemoryReceiveThread final   : private   ThreadConsumer
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the thread of the client connection.
+     *
+     * \param   remoteService   The remote message handler to pass the received messages.
+     * \param   connection      The server connection object, which owns the client sockets.
+     * \param   globalStats     The global receive thread, which accumulates the received data.
+     * \param   cookie          The cookie of the client connection, makes the thread name unique.
+     **/
+    SharedMemoryReceiveThread( areg::RemoteMessageHandler & remoteService
+                             , ServerConnection & connection
+                             , ServerReceiveThread & globalStats
+                             , const ITEM_ID & cookie );
+
+    ~SharedMemoryReceiveThread() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the thread runs.
+     **/
+    [[nodiscard]]
+    inline bool is_running() const noexcept;
+
+    /**
+     * \brief   Opens the channel offered by the client, attaches it to the socket and starts
+     *          the thread.
+     *
+     * \param   name        The name of the channel received with the connect request.
+     * \param   hSocket     The socket of the client connection.
+     * \param   timeoutMs   The time in milliseconds a sender waits for free space in the ring.
+     * \return  Returns true if the channel is attached and the thread runs. On failure the
+     *          client stays on TCP.
+     **/
+    bool start( const String & name, SOCKETHANDLE hSocket, uint32_t timeoutMs );
+
+    /**
+     * \brief   Detaches the link from the socket and shuts the channel down, so that the thread
+     *          leaves. Does not wait for the thread, it can be called on any thread, including
+     *          the thread holding the writer lock of the socket.
+     **/
+    void detach() noexcept;
+
+    /**
+     * \brief   Detaches the link, waits for the thread to leave and unmaps the channel.
+     **/
+    void stop();
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+private:
+/************************************************************************/
+// ThreadConsumer interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Receives the messages of the client until the channel is shut down.
+     **/
+    void on_run() override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    inline SharedMemoryReceiveThread & self();
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The instance of remote service message handler.
+    areg::RemoteMessageHandler &    mRemoteService;
+    //!< The instance of server connection object.
+    ServerConnection &              mConnection;
+    //!< The global receive thread, which accumulates the received data.
+    ServerReceiveThread &           mGlobalStats;
+    //!< The router side of the link.
+    SharedMemoryLink                mLink;
+    //!< The socket of the client connection.
+    SOCKETHANDLE                    mSocket;
+    //!< The receiving thread.
+    Thread                          mReceiveThread;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    SharedMemoryReceiveThread() = delete;
+    AREG_NOCOPY_NOMOVE( SharedMemoryReceiveThread );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryReceiveThread class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SharedMemoryReceiveThread::is_running() const noexcept
+{
+    return mReceiveThread.is_running();
+}
+
+inline SharedMemoryReceiveThread & SharedMemoryReceiveThread::self()
+{
+    return (*this);
+}
+
+} // namespace areg::ext
+
+#endif  // AREG_AREGEXTEND_SERVICE_PRIVATE_SHAREDMEMORYRECEIVETHREAD_HPP
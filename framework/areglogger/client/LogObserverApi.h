@@ -59,6 +59,12 @@
 
 #define ID_IGNORE           0u
 
+/**
+ * \brief   The creation time and the row ID after all logs, to read the last page of logs.
+ **/
+#define LOG_TIME_LAST       0x7FFFFFFFFFFFFFFFull
+#define LOG_ROW_LAST        0x7FFFFFFFFFFFFFFFll
+
 /**
  * \brief   The structure of the connected instance.
  **/
@@ -166,6 +172,20 @@ struct LogRecord
     char            msgModule[LENGTH_NAME];
 };
 
+/**
+ * \brief   The position of a log in the pages of logs read from the log database. The logs are
+ *          ordered by the creation time, and the logs created at the same time by the row ID.
+ *          The cursor { 0, 0 } is before the first log, the cursor { LOG_TIME_LAST, LOG_ROW_LAST }
+ *          is after the last log, and the cursor { time, 0 } is before the logs created at `time`.
+ **/
+struct LogCursor
+{
+    /* The creation time of the log. */
+    TIME64      lcTimestamp;
+    /* The row ID of the log in the log database. */
+    int64_t     lcRowId;
+};
+
 /**
  * \brief   The states of the log observer.
  **/
@@ -535,4 +555,41 @@ LOGGER_API bool log_observer_set_config_database_name(const char* dbName);
  **/
 LOGGER_API bool log_observer_config_update(const char* address, uint16_t portNr, const char * dbFilePath, bool makeSave);
 
+/**
+ * \brief   Call to read the page of logs after the cursor from the log database, ordered by the
+ *          creation time. The page continues at the cursor, so that scrolling deep into the logs
+ *          is as fast as reading the first page. To read the logs of a time window in pages, start
+ *          with the cursor { timeBegin, 0 } and set `timeEnd` to the end of the window.
+ * \param   target  The cookie ID of the instance to read logs. If ID_IGNORE (or 0), reads logs of all instances.
+ * \param   cursor  The cursor to read after. On output, the cursor of the last log of the page.
+ * \param   timeEnd The creation time of the last log to read, inclusive. LOG_TIME_LAST to read up to the last log.
+ * \param   logs    The array of log records to fill.
+ * \param   count   The number of log records in the array, the maximum size of the page.
+ * \return  Returns number of log records set in the array. Returns -1 if the observer is not
+ *          initialized or the parameters are invalid.
+ **/
+LOGGER_API int log_observer_read_logs_after(ITEM_ID target, LogCursor* cursor, TIME64 timeEnd, LogRecord* logs, uint32_t count);
+
+/**
+ * \brief   Call to read the page of logs before the cursor from the log database, ordered by the
+ *          creation time. To read the last page, start with the cursor { LOG_TIME_LAST, LOG_ROW_LAST }.
+ * \param   target      The cookie ID of the instance to read logs. If ID_IGNORE (or 0), reads logs of all instances.
+ * \param   cursor      The cursor to read before. On output, the cursor of the first log of the page.
+ * \param   timeBegin   The creation time of the first log to read, inclusive. 0 to read down to the first log.
+ * \param   logs        The array of log records to fill.
+ * \param   count       The number of log records in the array, the maximum size of the page.
+ * \return  Returns number of log records set in the array. Returns -1 if the observer is not
+ *          initialized or the parameters are invalid.
+ **/
+LOGGER_API int log_observer_read_logs_before(ITEM_ID target, LogCursor* cursor, TIME64 timeBegin, LogRecord* logs, uint32_t count);
+
+/**
+ * \brief   Call to get the number of logs in the log database created in the time window.
+ * \param   target      The cookie ID of the instance to count logs. If ID_IGNORE (or 0), counts logs of all instances.
+ * \param   timeBegin   The begin of the time window, inclusive.
+ * \param   timeEnd     The end of the time window, inclusive.
+ * \return  Returns number of logs created in the time window.
+ **/
+LOGGER_API uint32_t log_observer_count_logs_in_range(ITEM_ID target, TIME64 timeBegin, TIME64 timeEnd);
+
 #endif  // AREG_AREGLOGGER_CLIENT_LOGOBSERVERAPI_H
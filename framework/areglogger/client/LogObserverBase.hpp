@@ -365,6 +365,58 @@ public:
      **/
     void log_messages(std::vector<areg::SharedBuffer>& messages, ITEM_ID instId, uint32_t scopeId);
 
+    /**
+     * \brief   Returns the page of log messages after the cursor from the log database, ordered by
+     *          the creation time. The page continues at the cursor instead of skipping the rows
+     *          before it, so that scrolling deep into the log database stays fast.
+     *
+     * \param[out]     messages    On output, contains the log messages of the page.
+     * \param[in,out]  cursor      The cursor to read after. On output, the cursor of the last
+     *                              message of the page, or not changed if the page is empty.
+     * \param          instId      The ID of the instance to get log messages from. If
+     *                              `areg::COOKIE_ANY`, returns log messages of all instances.
+     * \param          maxEntries  The maximum number of log messages in the page.
+     * \param          timeEnd     The creation time of the last log message to read, inclusive.
+     * \return  Returns number of log messages in the page.
+     **/
+    uint32_t log_messages_after(std::vector<areg::SharedBuffer>& messages, LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeEnd = LOG_TIME_LAST);
+
+    /**
+     * \brief   Returns the page of log messages before the cursor from the log database, ordered
+     *          by the creation time.
+     *
+     * \param[out]     messages    On output, contains the log messages of the page.
+     * \param[in,out]  cursor      The cursor to read before. On output, the cursor of the first
+     *                              message of the page, or not changed if the page is empty.
+     * \param          instId      The ID of the instance to get log messages from. If
+     *                              `areg::COOKIE_ANY`, returns log messages of all instances.
+     * \param          maxEntries  The maximum number of log messages in the page.
+     * \param          timeBegin   The creation time of the first log message to read, inclusive.
+     * \return  Returns number of log messages in the page.
+     **/
+    uint32_t log_messages_before(std::vector<areg::SharedBuffer>& messages, LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeBegin = 0);
+
+    /**
+     * \brief   Returns log messages created in the time window from the log database.
+     *
+     * \param[out] messages On output, contains the log messages of the time window.
+     * \param   timeBegin   The begin of the time window, inclusive.
+     * \param   timeEnd     The end of the time window, inclusive.
+     * \param   instId      The ID of the instance to get log messages from. If
+     *                      `areg::COOKIE_ANY`, returns log messages of all instances.
+     **/
+    void log_messages_in_range(std::vector<areg::SharedBuffer>& messages, TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId = areg::COOKIE_ANY);
+
+    /**
+     * \brief   Returns number of log messages created in the time window.
+     *
+     * \param   timeBegin   The begin of the time window, inclusive.
+     * \param   timeEnd     The end of the time window, inclusive.
+     * \param   instId      The ID of the instance to count log messages. If
+     *                      `areg::COOKIE_ANY`, counts log messages of all instances.
+     **/
+    uint32_t count_log_messages(TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId = areg::COOKIE_ANY);
+
 //////////////////////////////////////////////////////////////////////////
 // Actions
 //////////////////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@
 #include "areglogger/client/private/LoggerClient.hpp"
 
 #include <atomic>
+#include <vector>
 
 // Use these options if compile for Windows with MSVC
 #ifdef _MSC_VER
@@ -473,3 +474,56 @@ LOGGER_API_IMPL bool log_observer_config_update(const char* address, uint16_t po
 
     return result;
 }
+
+LOGGER_API_IMPL int32_t log_observer_read_logs_after(ITEM_ID target, LogCursor* cursor, TIME64 timeEnd, LogRecord* logs, uint32_t count)
+{
+    LogObserverStruct& theObserver{ log_observer_data() };
+    areg::Lock lock(theObserver.losLock);
+    if ((cursor == nullptr) || (logs == nullptr) || (_is_initialized(theObserver.losState) == false))
+        return -1;
+
+    std::vector<areg::SharedBuffer> messages;
+    areg::ext::LogSqliteDatabase::LogCursor dbCursor{ cursor->lcTimestamp, cursor->lcRowId };
+    const ITEM_ID instId{ target == ID_IGNORE ? areg::TARGET_ALL : target };
+    areg::logger::LoggerClient::instance().log_messages_after(messages, dbCursor, instId, count, timeEnd);
+    for (uint32_t i = 0; i < static_cast<uint32_t>(messages.size()); ++ i)
+    {
+        areg::logger::ObserverMessageProcessor::copy_log_record(logs[i], *reinterpret_cast<const areg::LogEntry*>(messages[i].buffer()));
+    }
+
+    cursor->lcTimestamp = dbCursor.lcTimestamp;
+    cursor->lcRowId     = dbCursor.lcRowId;
+    return static_cast<int32_t>(messages.size());
+}
+
+LOGGER_API_IMPL int32_t log_observer_read_logs_before(ITEM_ID target, LogCursor* cursor, TIME64 timeBegin, LogRecord* logs, uint32_t count)
+{
+    LogObserverStruct& theObserver{ log_observer_data() };
+    areg::Lock lock(theObserver.losLock);
+    if ((cursor == nullptr) || (logs == nullptr) || (_is_initialized(theObserver.losState) == false))
+        return -1;
+
+    std::vector<areg::SharedBuffer> messages;
+    areg::ext::LogSqliteDatabase::LogCursor dbCursor{ cursor->lcTimestamp, cursor->lcRowId };
+    const ITEM_ID instId{ target == ID_IGNORE ? areg::TARGET_ALL : target };
+    areg::logger::LoggerClient::instance().log_messages_before(messages, dbCursor, instId, count, timeBegin);
+    for (uint32_t i = 0; i < static_cast<uint32_t>(messages.size()); ++ i)
+    {
+        areg::logger::ObserverMessageProcessor::copy_log_record(logs[i], *reinterpret_cast<const areg::LogEntry*>(messages[i].buffer()));
+    }
+
+    cursor->lcTimestamp = dbCursor.lcTimestamp;
+    cursor->lcRowId     = dbCursor.lcRowId;
+    return static_cast<int32_t>(messages.size());
+}
+
+LOGGER_API_IMPL uint32_t log_observer_count_logs_in_range(ITEM_ID target, TIME64 timeBegin, TIME64 timeEnd)
+{
+    LogObserverStruct& theObserver{ log_observer_data() };
+    areg::Lock lock(theObserver.losLock);
+    if (_is_initialized(theObserver.losState) == false)
+        return 0u;
+
+    const ITEM_ID instId{ target == ID_IGNORE ? areg::TARGET_ALL : target };
+    return areg::logger::LoggerClient::instance().count_log_messages(timeBegin, timeEnd, instId);
+}
@@ -266,4 +266,32 @@ void LogObserverBase::log_messages(std::vector<SharedBuffer>& messages, ITEM_ID
     LoggerClient::instance().log_messages(messages, instId, scopeId);
 }
 
+uint32_t LogObserverBase::log_messages_after(std::vector<SharedBuffer>& messages, LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeEnd /*= LOG_TIME_LAST*/)
+{
+    areg::ext::LogSqliteDatabase::LogCursor dbCursor{ cursor.lcTimestamp, cursor.lcRowId };
+    uint32_t result{ LoggerClient::instance().log_messages_after(messages, dbCursor, instId, maxEntries, timeEnd) };
+    cursor.lcTimestamp  = dbCursor.lcTimestamp;
+    cursor.lcRowId      = dbCursor.lcRowId;
+    return result;
+}
+
+uint32_t LogObserverBase::log_messages_before(std::vector<SharedBuffer>& messages, LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeBegin /*= 0*/)
+{
+    areg::ext::LogSqliteDatabase::LogCursor dbCursor{ cursor.lcTimestamp, cursor.lcRowId };
+    uint32_t result{ LoggerClient::instance().log_messages_before(messages, dbCursor, instId, maxEntries, timeBegin) };
+    cursor.lcTimestamp  = dbCursor.lcTimestamp;
+    cursor.lcRowId      = dbCursor.lcRowId;
+    return result;
+}
+
+void LogObserverBase::log_messages_in_range(std::vector<SharedBuffer>& messages, TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId /*= areg::COOKIE_ANY*/)
+{
+    LoggerClient::instance().log_messages_in_range(messages, timeBegin, timeEnd, instId);
+}
+
+uint32_t LogObserverBase::count_log_messages(TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId /*= areg::COOKIE_ANY*/)
+{
+    return LoggerClient::instance().count_log_messages(timeBegin, timeEnd, instId);
+}
+
 } // namespace areg::logger
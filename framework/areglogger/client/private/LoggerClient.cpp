@@ -695,6 +695,8 @@ void LoggerClient::process_received_message(MessageEnvelope& msgReceived, Socket
         case areg::FuncIdRange::ServiceLogUpdateScopes:           // fall through
         case areg::FuncIdRange::ServiceLogQueryScopes:            // fall through
         case areg::FuncIdRange::ServiceSaveLogConfiguration:      // fall through
+        case areg::FuncIdRange::ServiceLogRecordFormat:           // fall through
+        case areg::FuncIdRange::ServiceLogCompactMessage:         // fall through
         default:
             ASSERT(false);
         }
@@ -396,6 +396,51 @@ public:
      **/
     inline void log_messages(std::vector<SharedBuffer>& messages, ITEM_ID instId, uint32_t scopeId);
 
+    /**
+     * \brief   Retrieves the page of log messages after the cursor, ordered by the creation time.
+     *
+     * \param[out]     messages    On output, contains the log messages of the page.
+     * \param[in,out]  cursor      The cursor to read after. On output, the cursor of the last
+     *                              message of the page.
+     * \param          instId      The ID of the instance, or areg::COOKIE_ANY for all instances.
+     * \param          maxEntries  The maximum number of log messages in the page.
+     * \param          timeEnd     The creation time of the last log message to read, inclusive.
+     * \return  Returns number of log messages in the page.
+     **/
+    inline uint32_t log_messages_after(std::vector<SharedBuffer>& messages, areg::ext::LogSqliteDatabase::LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeEnd);
+
+    /**
+     * \brief   Retrieves the page of log messages before the cursor, ordered by the creation time.
+     *
+     * \param[out]     messages    On output, contains the log messages of the page.
+     * \param[in,out]  cursor      The cursor to read before. On output, the cursor of the first
+     *                              message of the page.
+     * \param          instId      The ID of the instance, or areg::COOKIE_ANY for all instances.
+     * \param          maxEntries  The maximum number of log messages in the page.
+     * \param          timeBegin   The creation time of the first log message to read, inclusive.
+     * \return  Returns number of log messages in the page.
+     **/
+    inline uint32_t log_messages_before(std::vector<SharedBuffer>& messages, areg::ext::LogSqliteDatabase::LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeBegin);
+
+    /**
+     * \brief   Retrieves log messages created in the time window.
+     *
+     * \param[out] messages    On output, contains the log messages of the time window.
+     * \param   timeBegin   The begin of the time window, inclusive.
+     * \param   timeEnd     The end of the time window, inclusive.
+     * \param   instId      The ID of the instance, or areg::COOKIE_ANY for all instances.
+     **/
+    inline void log_messages_in_range(std::vector<SharedBuffer>& messages, TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId);
+
+    /**
+     * \brief   Returns number of log messages created in the time window.
+     *
+     * \param   timeBegin   The begin of the time window, inclusive.
+     * \param   timeEnd     The end of the time window, inclusive.
+     * \param   instId      The ID of the instance, or areg::COOKIE_ANY for all instances.
+     **/
+    inline uint32_t count_log_messages(TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId);
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -653,6 +698,26 @@ inline void LoggerClient::log_messages(std::vector<SharedBuffer>& messages, ITEM
     mLogDatabase.log_messages(messages, instId, scopeId);
 }
 
+inline uint32_t LoggerClient::log_messages_after(std::vector<SharedBuffer>& messages, areg::ext::LogSqliteDatabase::LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeEnd)
+{
+    return mLogDatabase.log_messages_after(messages, cursor, instId, maxEntries, timeEnd);
+}
+
+inline uint32_t LoggerClient::log_messages_before(std::vector<SharedBuffer>& messages, areg::ext::LogSqliteDatabase::LogCursor& cursor, ITEM_ID instId, uint32_t maxEntries, TIME64 timeBegin)
+{
+    return mLogDatabase.log_messages_before(messages, cursor, instId, maxEntries, timeBegin);
+}
+
+inline void LoggerClient::log_messages_in_range(std::vector<SharedBuffer>& messages, TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId)
+{
+    mLogDatabase.log_messages_in_range(messages, timeBegin, timeEnd, instId);
+}
+
+inline uint32_t LoggerClient::count_log_messages(TIME64 timeBegin, TIME64 timeEnd, ITEM_ID instId)
+{
+    return mLogDatabase.count_log_entries(timeBegin, timeEnd, instId);
+}
+
 inline LoggerClient& LoggerClient::self()
 {
     return (*this);
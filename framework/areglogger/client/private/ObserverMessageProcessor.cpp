@@ -243,21 +243,7 @@ void ObserverMessageProcessor::notify_log_message(const areg::MessageEnvelope& m
             {
                 callback = mLoggerClient.mCallbacks->evtLogMessage;
 
-                msgLog.msgType      = static_cast<LogType>(msgRemote->logMsgType);
-                msgLog.msgPriority  = static_cast<::LogPriority>(msgRemote->logMessagePrio);
-                msgLog.msgSource    = static_cast<uint64_t>(msgRemote->logSource);
-                msgLog.msgCookie    = static_cast<uint64_t>(msgRemote->logCookie);
-                msgLog.msgModuleId  = static_cast<uint64_t>(msgRemote->logModuleId);
-                msgLog.msgThreadId  = static_cast<uint64_t>(msgRemote->logThreadId);
-                msgLog.msgTimestamp = static_cast<uint64_t>(msgRemote->logTimestamp);
-                msgLog.msgReceived  = static_cast<uint64_t>(msgRemote->logReceived);
-                msgLog.msgDuration  = static_cast<uint32_t>(msgRemote->logDuration);
-                msgLog.msgScopeId   = static_cast<uint32_t>(msgRemote->logScopeId);
-                msgLog.msgSessionId = static_cast<uint32_t>(msgRemote->logSessionId);
-
-                areg::mem_copy(msgLog.msgLogText, LENGTH_MESSAGE , msgRemote->logMessage , msgRemote->logMessageLen + 1);
-                areg::mem_copy(msgLog.msgThread,  LENGTH_NAME    , msgRemote->logThread  , msgRemote->logThreadLen  + 1);
-                areg::mem_copy(msgLog.msgModule,  LENGTH_NAME    , msgRemote->logModule  , msgRemote->logModuleLen  + 1);
+                copy_log_record(msgLog, *msgRemote);
             }
             else if (mLoggerClient.mCallbacks->evtLogMessageEx != nullptr)
             {
@@ -278,6 +264,25 @@ void ObserverMessageProcessor::notify_log_message(const areg::MessageEnvelope& m
     }
 }
 
+void ObserverMessageProcessor::copy_log_record(LogRecord& record, const areg::LogEntry& log)
+{
+    record.msgType      = static_cast<LogType>(log.logMsgType);
+    record.msgPriority  = static_cast<::LogPriority>(log.logMessagePrio);
+    record.msgSource    = static_cast<uint64_t>(log.logSource);
+    record.msgCookie    = static_cast<uint64_t>(log.logCookie);
+    record.msgModuleId  = static_cast<uint64_t>(log.logModuleId);
+    record.msgThreadId  = static_cast<uint64_t>(log.logThreadId);
+    record.msgTimestamp = static_cast<uint64_t>(log.logTimestamp);
+    record.msgReceived  = static_cast<uint64_t>(log.logReceived);
+    record.msgDuration  = static_cast<uint32_t>(log.logDuration);
+    record.msgScopeId   = static_cast<uint32_t>(log.logScopeId);
+    record.msgSessionId = static_cast<uint32_t>(log.logSessionId);
+
+    areg::mem_copy(record.msgLogText, LENGTH_MESSAGE , log.logMessage , log.logMessageLen + 1);
+    areg::mem_copy(record.msgThread,  LENGTH_NAME    , log.logThread  , log.logThreadLen  + 1);
+    areg::mem_copy(record.msgModule,  LENGTH_NAME    , log.logModule  , log.logModuleLen  + 1);
+}
+
 void ObserverMessageProcessor::_clients_connected(const areg::MessageEnvelope& msgReceived)
 {
     ArrayList< areg::ConnectedInstance > listConnected;
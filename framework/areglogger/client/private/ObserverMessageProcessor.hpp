@@ -33,6 +33,8 @@ namespace areg::logger {
     class LoggerClient;
 }
 
+struct LogRecord;
+
 namespace areg::logger {
 
 //////////////////////////////////////////////////////////////////////////
@@ -97,6 +99,14 @@ public:
      **/
     void notify_log_message(const areg::MessageEnvelope& msgReceived);
 
+    /**
+     * \brief   Copies the log message to the log record of the Log Observer API.
+     *
+     * \param[out] record  The log record to set.
+     * \param   log         The log message to copy.
+     **/
+    static void copy_log_record(LogRecord& record, const areg::LogEntry& log);
+
 private:
 
     //!< Triggered to process client connected message.
@@ -247,7 +247,8 @@ private:
 // Member variables
 //////////////////////////////////////////////////////////////////////////
 private:
-    //!< The SQLite database of the logs.
+    //!< The SQLite database of the logs. Written by the writer thread only, which keeps the cache
+    //!< of the thread and module name references warm across the batches.
     areg::ext::LogSqliteDatabase    mDatabase;
 
     //!< The thread that writes the queued entries in the database.
@@ -22,6 +22,7 @@ LogCollectorMessageProcessor::LogCollectorMessageProcessor(LogCollectorServerSer
     : mLoggerService    ( loggerService )
     , mListSaveConfig   ( )
     , mPendingSave      ( areg::COOKIE_UNKNOWN )
+    , mDecoders         ( )
 {
 }
 
@@ -218,6 +219,7 @@ void LogCollectorMessageProcessor::process_next_save_config()
 
 void LogCollectorMessageProcessor::client_disconnected(const ITEM_ID& cookie)
 {
+    mDecoders.erase(cookie);
     if ((cookie > areg::TARGET_ALL) && (mPendingSave == cookie))
     {
         process_next_save_config();
@@ -231,6 +233,33 @@ void LogCollectorMessageProcessor::log_message(const areg::MessageEnvelope & msg
     _forward_message_to_observers(msgReceived);
 }
 
+void LogCollectorMessageProcessor::accept_record_format(const areg::MessageEnvelope& msgReceived)
+{
+    ASSERT(msgReceived.message_id() == static_cast<uint32_t>(areg::FuncIdRange::ServiceLogRegisterScopes));
+
+    const ITEM_ID source{ static_cast<ITEM_ID>(msgReceived.source()) };
+    const areg::MapInstances& instances{ mLoggerService.instances() };
+    auto srcPos = instances.find(source);
+    if (instances.is_valid_position(srcPos) && is_log_source(instances.value_at(srcPos).ciSource) && areg::LogRecordDecoder::is_format_offered(msgReceived))
+    {
+        mDecoders[source].reset();
+        mLoggerService.send_message(areg::message_record_format(areg::COOKIE_LOGGER, source, areg::LogRecordFormat::Compact));
+    }
+}
+
+areg::MessageEnvelope LogCollectorMessageProcessor::decode_log_message(const areg::MessageEnvelope& msgReceived)
+{
+    ASSERT(msgReceived.message_id() == static_cast<uint32_t>(areg::FuncIdRange::ServiceLogCompactMessage));
+
+    auto pos = mDecoders.find(static_cast<ITEM_ID>(msgReceived.source()));
+    return (pos != mDecoders.end() ? pos->second.decode(msgReceived) : areg::MessageEnvelope{});
+}
+
+void LogCollectorMessageProcessor::clear_record_formats()
+{
+    mDecoders.clear();
+}
+
 bool LogCollectorMessageProcessor::is_log_source(areg::MessageSource msgSource)
 {
     switch (msgSource)
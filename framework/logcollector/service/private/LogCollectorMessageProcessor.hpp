@@ -22,8 +22,11 @@
 
 #include "areg/component/ServiceDefs.hpp"
 #include "areg/base/ArrayList.hpp"
+#include "areg/logging/private/LogRecordCodec.hpp"
 #include "aregextend/service/ServiceCommunicationBase.hpp"
 
+#include <unordered_map>
+
 /************************************************************************
  * Dependencies
  ************************************************************************/
@@ -141,6 +144,31 @@ public:
      **/
     void log_message(const areg::MessageEnvelope& msgReceived) const;
 
+    /**
+     * \brief   Called when a log source registers the scopes on connect. If the log source offers
+     *          the compact format of the log records, starts decoding the records of the log source
+     *          and notifies it to send the compact records.
+     *
+     * \param   msgReceived     The scope registration received from the log source.
+     **/
+    void accept_record_format(const areg::MessageEnvelope& msgReceived);
+
+    /**
+     * \brief   Decodes the compact log record received from a log source to the plain log record,
+     *          which is forwarded to the observers and saved in the database.
+     *
+     * \param   msgReceived     The compact log record to decode.
+     * \return  The plain log record, or an invalid message if the log source did not agree the
+     *          compact format or the record is malformed.
+     **/
+    [[nodiscard]]
+    areg::MessageEnvelope decode_log_message(const areg::MessageEnvelope& msgReceived);
+
+    /**
+     * \brief   Stops decoding the compact log records of all log sources.
+     **/
+    void clear_record_formats();
+
     /**
      * \brief   Called when the connected instance of log source updates the scope priorities. The
      *          message contains the list of scope names, ID and log priority. The message should be
@@ -228,6 +256,9 @@ private:
     //!< The ID of an application pending to save the configuration.
     ITEM_ID                     mPendingSave;
 
+    //!< The decoders of the log sources that send the compact log records.
+    std::unordered_map<ITEM_ID, areg::LogRecordDecoder> mDecoders;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
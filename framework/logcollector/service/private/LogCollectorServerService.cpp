@@ -160,6 +160,7 @@ void LogCollectorServerService::remove_all_instances()
     }
 
     mObservers.clear();
+    mLoggerProcessor.clear_record_formats();
 }
 
 void LogCollectorServerService::dispatch_and_forward_logger_message(const areg::MessageEnvelope& msgForward)
@@ -201,6 +202,8 @@ void LogCollectorServerService::dispatch_and_forward_logger_message(const areg::
     case areg::FuncIdRange::ServiceLogScopesUpdated:          // fall through
     case areg::FuncIdRange::ServiceLogConfigurationSaved:     // fall through
     case areg::FuncIdRange::ServiceLogMessage:                // fall through
+    case areg::FuncIdRange::ServiceLogRecordFormat:           // fall through
+    case areg::FuncIdRange::ServiceLogCompactMessage:         // fall through
     case areg::FuncIdRange::RequestFirstId:                   // fall through
     case areg::FuncIdRange::ResponseFirstId:                  // fall through
     case areg::FuncIdRange::AttributeFirstId:                 // fall through
@@ -237,6 +240,7 @@ void LogCollectorServerService::on_message_received(const areg::MessageEnvelope
     case areg::FuncIdRange::ServiceLogRegisterScopes:
         mLoggerProcessor.register_scopes_at_observer(msgReceived);
         mDatabase.save_scopes(static_cast<ITEM_ID>(msgReceived.source()), msgReceived);
+        mLoggerProcessor.accept_record_format(msgReceived);
         break;
 
     case areg::FuncIdRange::ServiceLogUpdateScopes:
@@ -266,11 +270,28 @@ void LogCollectorServerService::on_message_received(const areg::MessageEnvelope
         mDatabase.save_log_message(msgReceived);
         break;
 
+    case areg::FuncIdRange::ServiceLogCompactMessage:
+        {
+            // The observers and the database receive the plain record.
+            const areg::MessageEnvelope msgLog{ mLoggerProcessor.decode_log_message(msgReceived) };
+            if (msgLog.is_valid())
+            {
+                mLoggerProcessor.log_message(msgLog);
+                mDatabase.save_log_message(msgLog);
+            }
+            else
+            {
+                LOG_WARN("Ignoring the malformed compact log record of source [ %u ]", msgReceived.source());
+            }
+        }
+        break;
+
     case areg::FuncIdRange::SystemServiceConnect:
     case areg::FuncIdRange::SystemServiceDisconnect:
         break;
 
     case areg::FuncIdRange::SystemServiceNotifyInstances:
+    case areg::FuncIdRange::ServiceLogRecordFormat:           // fall through
 
     case areg::FuncIdRange::RequestRegisterService:           // fall through
     case areg::FuncIdRange::RequestServiceProviderVersion:    // fall through
@@ -51,9 +51,14 @@ ServiceProxy & ListServiceProxies::register_service(const areg::ProxyAddress & a
         pos = last_position();
     }
 
+    return register_service(pos, stubService);
+}
+
+ServiceProxy & ListServiceProxies::register_service(LISTPOS pos, const ServiceStub & stubService)
+{
     const areg::StubAddress & addrStub = stubService.service_address();
     ServiceProxy & proxyService = value_at(pos);
-    if ( addrStub == addrProxy)
+    if ( addrStub == proxyService.service_address() )
     {
         if ( stubService.service_status() == areg::ServiceConnectionState::Connected )
         {
@@ -84,6 +89,13 @@ ServiceProxy ListServiceProxies::unregister_service( const areg::ProxyAddress &
     return result;
 }
 
+ServiceProxy ListServiceProxies::unregister_service( LISTPOS pos )
+{
+    ServiceProxy result{ std::move(value_at(pos)) };
+    remove_at(pos);
+    return result;
+}
+
 int32_t ListServiceProxies::stub_service_available( const areg::StubAddress & addrStub )
 {
     int32_t result = 0;
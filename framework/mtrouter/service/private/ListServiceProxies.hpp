@@ -131,6 +131,16 @@ public:
      **/
     ServiceProxy & register_service( const areg::ProxyAddress & addrProxy, const ServiceStub & stubService );
 
+    /**
+     * \brief   Updates the connection state of the proxy entry at the given position with the
+     *          stub service availability, as register_service() does for a found entry.
+     *
+     * \param   pos             The valid position of the proxy entry in the list.
+     * \param   stubService     The stub service to associate with the proxy.
+     * \return  Returns the proxy service entry.
+     **/
+    ServiceProxy & register_service( LISTPOS pos, const ServiceStub & stubService );
+
     /**
      * \brief   Unregisters and removes the proxy service entry. Returns an invalid entry if not
      *          found.
@@ -140,6 +150,14 @@ public:
      **/
     ServiceProxy unregister_service( const areg::ProxyAddress & addrProxy );
 
+    /**
+     * \brief   Removes the proxy service entry at the given position without searching the list.
+     *
+     * \param   pos     The valid position of the proxy entry in the list.
+     * \return  Returns the unregistered proxy service.
+     **/
+    ServiceProxy unregister_service( LISTPOS pos );
+
     /**
      * \brief   Sets all registered proxy services to connected state and returns the number of
      *          entries modified.
@@ -17,6 +17,7 @@
 #include "areg/ipc/private/ConnectionDefs.hpp"
 #include "areg/ipc/ConnectionConfiguration.hpp"
 #include "areg/ipc/RemoteServiceDefs.hpp"
+#include "areg/component/MulticastEnvelope.hpp"
 #include "areg/logging/areg_log.h"
 #include "aregextend/service/SystemServiceDefs.hpp"
 
@@ -193,6 +194,8 @@ void RouterServerService::on_message_received(const areg::MessageEnvelope &msgRe
     case areg::FuncIdRange::ServiceSaveLogConfiguration:      // fall through
     case areg::FuncIdRange::ServiceLogConfigurationSaved:     // fall through
     case areg::FuncIdRange::ServiceLogMessage:                // fall through
+    case areg::FuncIdRange::ServiceLogRecordFormat:           // fall through
+    case areg::FuncIdRange::ServiceLogCompactMessage:         // fall through
         break;
 
     case areg::FuncIdRange::ResponseServiceProviderConnection:// fall through
@@ -211,7 +214,22 @@ void RouterServerService::on_message_received(const areg::MessageEnvelope &msgRe
                        , msgReceived.target()
                        , source);
 
-            if ( msgReceived.target() != static_cast<uint32_t>(areg::TARGET_UNKNOWN) )
+            if ( msgReceived.target() == static_cast<uint32_t>(areg::COOKIE_ROUTER) )
+            {
+                // A multicast response: one envelope per process of the target list.
+                areg::ArrayList<areg::MessageEnvelope> listMessages;
+                const uint32_t count{ areg::MulticastEnvelope::split_by_process(msgReceived, listMessages) };
+                LOG_DBG("Message [ %u ] is multicast to [ %u ] consumers, forwarding to [ %u ] targets"
+                           , static_cast<uint32_t>(msgId)
+                           , areg::MulticastEnvelope::target_count(msgReceived)
+                           , count);
+
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    send_message( std::move(listMessages[i]) );
+                }
+            }
+            else if ( msgReceived.target() != static_cast<uint32_t>(areg::TARGET_UNKNOWN) )
             {
                 send_message( msgReceived );
             }
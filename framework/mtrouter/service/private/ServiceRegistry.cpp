@@ -47,7 +47,7 @@ bool ServiceRegistry::is_service_registered(const areg::StubAddress & addrStub)
 
 bool ServiceRegistry::is_service_registered(const areg::ProxyAddress & addrProxy) const
 {
-    return proxy_service_list( static_cast<const areg::ServiceAddress &>(addrProxy) ).is_service_registered(addrProxy);
+    return (_find_proxy(addrProxy) != mProxyIndex.end());
 }
 
 const ServiceStub & ServiceRegistry::stub_service( const areg::ServiceAddress & addrService ) const
@@ -64,7 +64,8 @@ const ListServiceProxies & ServiceRegistry::proxy_service_list( const areg::Serv
 
 const ServiceProxy & ServiceRegistry::proxy_service(const areg::ProxyAddress & addProxy) const
 {
-    return proxy_service_list( static_cast<const areg::ServiceAddress &>(addProxy) ).service(addProxy);
+    ProxyIndex::const_iterator pos = _find_proxy(addProxy);
+    return (pos != mProxyIndex.end() ? static_cast<const ServiceProxy &>(*pos->second) : ServiceRegistry::EmptyProxiesList.service(addProxy));
 }
 
 areg::ServiceConnectionState ServiceRegistry::service_status(const areg::StubAddress & addrStub) const
@@ -85,16 +86,30 @@ const ServiceStub & ServiceRegistry::register_service_proxy(const areg::ProxyAdd
 
     const ServiceStub & result = key_at(pos.first);
     ListServiceProxies& proxies = value_at(pos.first);
+
+    ListServiceProxiesBase::LISTPOS posProxy;
+    ProxyIndex::const_iterator found = _find_proxy(addrProxy);
+    if ( found != mProxyIndex.end() )
+    {
+        posProxy = found->second;
+    }
+    else
+    {
+        proxies.push_last(ServiceProxy(addrProxy));
+        posProxy = proxies.last_position();
+        _index_proxy(addrProxy, posProxy);
+    }
+
     if ( pos.second )
     {
         LOG_DBG("Proxy [ %s ] registers new entry and wait for service"
                     , areg::ProxyAddress::to_path(addrProxy).as_string());
 
-        out_proxyService = proxies.register_service( addrProxy );
+        out_proxyService = proxies.value_at(posProxy);
     }
     else
     {
-        out_proxyService = proxies.register_service(addrProxy, result);
+        out_proxyService = proxies.register_service(posProxy, result);
 
         LOG_DBG("Proxy [ %s ] is registered for service with status [ %s ]"
                         , areg::ProxyAddress::to_path(addrProxy).as_string()
@@ -113,7 +128,18 @@ const ServiceStub & ServiceRegistry::unregister_service_proxy(const areg::ProxyA
     {
         const ServiceStub & stub = key_at(pos);
         ListServiceProxies & proxies = value_at(pos);
-        out_proxyService = proxies.unregister_service(addrProxy);
+        ProxyIndex::const_iterator found = _find_proxy(addrProxy);
+        if ( found != mProxyIndex.end() )
+        {
+            ListServiceProxiesBase::LISTPOS posProxy = found->second;
+            _unindex_proxy(found);
+            out_proxyService = proxies.unregister_service(posProxy);
+        }
+        else
+        {
+            out_proxyService = ServiceProxy();
+        }
+
         if ( proxies.is_empty() && (stub.is_valid() == false) )
         {
             LOG_INFO("Proxy [ %s ] is unregistered, remove empty and invalid service entry with status [ %s ]"
@@ -155,11 +181,14 @@ const ServiceStub & ServiceRegistry::register_service_provider(const areg::StubA
                     , areg::StubAddress::to_path(addrStub).as_string());
 
         result.set_service_status( areg::ServiceConnectionState::Connected );
+        _index_stub(result.service_address());
         out_listProxies = proxies;
     }
     else
     {
+        _unindex_stub(result.service_address());
         result.set_service( addrStub, areg::ServiceConnectionState::Connected );
+        _index_stub(result.service_address());
         proxies.stub_service_available(addrStub);
         out_listProxies = proxies;
 
@@ -181,6 +210,7 @@ const ServiceStub & ServiceRegistry::unregister_service_provider(const areg::Stu
         ServiceStub & stub = key_at(pos);
         ListServiceProxies & proxies = value_at(pos);
 
+        _unindex_stub(stub.service_address());
         stub.set_service_status( areg::ServiceConnectionState::Pending );
         proxies.stub_service_unavailable( );
         if ( proxies.is_empty() )
@@ -271,11 +301,20 @@ void ServiceRegistry::service_sources(const ITEM_ID & cookie, areg::ArrayList<ar
     LOG_SCOPE( mtrouter_service_private_ServiceRegistry, get_service_sources );
     LOG_DBG("Pickup services with [ %u ] sources ", static_cast<uint32_t>(cookie));
 
-    for (ServiceRegistry::MAPPOS posMap = first_position(); is_valid_position(posMap); posMap = next_position(posMap) )
+    // Only the services of the source are visited, not the whole registry.
+    SourceIndex::const_iterator entry = mSourceIndex.find(cookie);
+    if (entry == mSourceIndex.end())
+    {
+        LOG_DBG("There are no services of source [ %u ]", static_cast<uint32_t>(cookie));
+        return;
+    }
+
+    for (const areg::ServiceAddress & addrService : entry->second.stubs)
     {
+        MAPPOS posMap = find_service(addrService);
+        ASSERT(is_valid_position(posMap));
         const ServiceStub & svcStub  = key_at(posMap);
         const areg::StubAddress & addrStub = svcStub.service_address();
-        const ListServiceProxies & listProxies = value_at(posMap);
 
         if (svcStub.is_valid() && (cookie == addrStub.source()))
         {
@@ -288,21 +327,23 @@ void ServiceRegistry::service_sources(const ITEM_ID & cookie, areg::ArrayList<ar
                         , addrStub.to_string().as_string()
                         , static_cast<uint32_t>(cookie));
         }
+    }
 
-        for (ListServiceProxiesBase::LISTPOS posList = listProxies.first_position(); listProxies.is_valid_position(posList); posList = listProxies.next_position(posList) )
-        {
-            const ServiceProxy & svcProxy   = listProxies.value_at(posList);
-            const areg::ProxyAddress & addrProxy  = svcProxy.service_address();
+    for (const areg::ProxyAddress & addrIndex : entry->second.proxies)
+    {
+        ProxyIndex::const_iterator posProxy = _find_proxy(addrIndex);
+        ASSERT(posProxy != mProxyIndex.end());
+        const ServiceProxy & svcProxy   = *posProxy->second;
+        const areg::ProxyAddress & addrProxy  = svcProxy.service_address();
 
-            if (svcProxy.is_valid() && (cookie == addrProxy.source()))
-            {
-                LOG_INFO("Found proxy [ %s ] of source [ %u ]", addrProxy.to_string().as_string(), static_cast<uint32_t>(cookie));
-                proxySources.add(addrProxy);
-            }
-            else
-            {
-                LOG_DBG("Ignore proxy [ %s ], it is either invalid or has different source than [ %u ]", addrProxy.to_string().as_string(), static_cast<uint32_t>(cookie));
-            }
+        if (svcProxy.is_valid() && (cookie == addrProxy.source()))
+        {
+            LOG_INFO("Found proxy [ %s ] of source [ %u ]", addrProxy.to_string().as_string(), static_cast<uint32_t>(cookie));
+            proxySources.add(addrProxy);
+        }
+        else
+        {
+            LOG_DBG("Ignore proxy [ %s ], it is either invalid or has different source than [ %u ]", addrProxy.to_string().as_string(), static_cast<uint32_t>(cookie));
         }
     }
 }
@@ -313,8 +354,8 @@ const ServiceStub & ServiceRegistry::disconnect_proxy(const areg::ProxyAddress &
     MAPPOS pos = find_service( static_cast<const areg::ServiceAddress &>(addrProxy) );
     if ( is_valid_position(pos) )
     {
-        ListServiceProxies & proxies = value_at(pos);
-        ServiceProxy * svcProxy = proxies.service(addrProxy);
+        ProxyIndex::const_iterator found = _find_proxy(addrProxy);
+        ServiceProxy * svcProxy = (found != mProxyIndex.end() ? &(*found->second) : nullptr);
         if ((svcProxy != nullptr) && svcProxy->is_valid())
         {
             LOG_INFO("Found service of proxy [ %s ] to disconnect, current state [ %s ]", addrProxy.to_string().as_string(), areg::as_string(svcProxy->service_status()));
@@ -332,3 +373,53 @@ const ServiceStub & ServiceRegistry::disconnect_proxy(const areg::ProxyAddress &
 
     return ( is_valid_position(pos) ? key_at(pos) : ServiceRegistry::InvalidProviderService);
 }
+
+void ServiceRegistry::clear()
+{
+    mProxyIndex.clear();
+    mSourceIndex.clear();
+    ServiceRegistryBase::clear();
+}
+
+void ServiceRegistry::_index_proxy(const areg::ProxyAddress & addrProxy, ListServiceProxiesBase::LISTPOS pos)
+{
+    mProxyIndex.emplace(addrProxy, pos);
+    mSourceIndex[addrProxy.source()].proxies.insert(addrProxy);
+}
+
+void ServiceRegistry::_unindex_proxy(ProxyIndex::const_iterator pos)
+{
+    const areg::ProxyAddress & addrProxy = pos->second->service_address();
+    SourceIndex::iterator entry = mSourceIndex.find(addrProxy.source());
+    if (entry != mSourceIndex.end())
+    {
+        entry->second.proxies.erase(addrProxy);
+        if (entry->second.proxies.empty() && entry->second.stubs.empty())
+        {
+            mSourceIndex.erase(entry);
+        }
+    }
+
+    mProxyIndex.erase(pos);
+}
+
+void ServiceRegistry::_index_stub(const areg::StubAddress & addrStub)
+{
+    if (addrStub.source() != areg::SOURCE_UNKNOWN)
+    {
+        mSourceIndex[addrStub.source()].stubs.insert(static_cast<const areg::ServiceAddress &>(addrStub));
+    }
+}
+
+void ServiceRegistry::_unindex_stub(const areg::StubAddress & addrStub)
+{
+    SourceIndex::iterator entry = mSourceIndex.find(addrStub.source());
+    if (entry != mSourceIndex.end())
+    {
+        entry->second.stubs.erase(static_cast<const areg::ServiceAddress &>(addrStub));
+        if (entry->second.proxies.empty() && entry->second.stubs.empty())
+        {
+            mSourceIndex.erase(entry);
+        }
+    }
+}
@@ -24,6 +24,9 @@
 #include "mtrouter/service/private/ListServiceProxies.hpp"
 #include "areg/base/ArrayList.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
 //////////////////////////////////////////////////////////////////////////
 // ServiceRegistry class declaration
 //////////////////////////////////////////////////////////////////////////
@@ -31,6 +34,14 @@ using ServiceRegistryBase = areg::HashMap<ServiceStub, ListServiceProxies>;
 
 /**
  * \brief   The remote services registration map, which is a map of stub and list of connected proxies.
+ *
+ *          Two secondary indexes are kept in step with the map, so that the operations of one
+ *          service or one connection cost the number of the entries involved, and not the size
+ *          of the registry:
+ *              - the position of every registered proxy in the list of its service;
+ *              - the stubs and the proxies of every source (connection cookie), used when a
+ *                connection is lost.
+ *          The map must be modified only by the methods of this class, including clear().
  **/
 class ServiceRegistry   : public ServiceRegistryBase
 {
@@ -38,6 +49,47 @@ class ServiceRegistry   : public ServiceRegistryBase
 // Predefined types and constants
 //////////////////////////////////////////////////////////////////////////
 
+    /**
+     * \brief   ServiceRegistry::ProxyHasher
+     *          Hashes the proxy address with the fields compared by ServiceProxy, i.e. the service,
+     *          the thread and the cookie.
+     **/
+    struct ProxyHasher
+    {
+        inline std::size_t operator()( const areg::ProxyAddress & addrProxy ) const noexcept;
+    };
+
+    /**
+     * \brief   ServiceRegistry::ProxyEqual
+     *          Compares the proxy addresses the same way as ServiceProxy does.
+     **/
+    struct ProxyEqual
+    {
+        inline bool operator()( const areg::ProxyAddress & lhs, const areg::ProxyAddress & rhs ) const noexcept;
+    };
+
+    /**
+     * \brief   ServiceRegistry::ProxyIndex
+     *          The position of every registered proxy in the list of its service.
+     **/
+    using ProxyIndex    = std::unordered_map<areg::ProxyAddress, ListServiceProxiesBase::LISTPOS, ProxyHasher, ProxyEqual>;
+
+    /**
+     * \brief   ServiceRegistry::SourceServices
+     *          The stubs and the proxies registered by one source.
+     **/
+    struct SourceServices
+    {
+        std::unordered_set<areg::ServiceAddress>                        stubs;      //!< The services of the stubs of the source.
+        std::unordered_set<areg::ProxyAddress, ProxyHasher, ProxyEqual> proxies;    //!< The proxies of the source.
+    };
+
+    /**
+     * \brief   ServiceRegistry::SourceIndex
+     *          The stubs and the proxies of every source.
+     **/
+    using SourceIndex   = std::unordered_map<ITEM_ID, SourceServices>;
+
     /**
      * \brief   ServiceRegistry::InvalidProviderService
      *          Defines invalid provider service
@@ -216,11 +268,43 @@ public:
      **/
     const ServiceStub & disconnect_proxy( const areg::ProxyAddress & addrProxy );
 
+    /**
+     * \brief   Removes all services and proxies from the registry and its indexes.
+     **/
+    void clear();
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden calls
 //////////////////////////////////////////////////////////////////////////
 private:
 
+    /**
+     * \brief   Returns the position of the registered proxy in the list of its service, or the
+     *          end position of the proxy index if the proxy is not registered.
+     **/
+    [[nodiscard]]
+    inline ProxyIndex::const_iterator _find_proxy( const areg::ProxyAddress & addrProxy ) const;
+
+    /**
+     * \brief   Adds the proxy at the given position of the list of its service to the indexes.
+     **/
+    void _index_proxy( const areg::ProxyAddress & addrProxy, ListServiceProxiesBase::LISTPOS pos );
+
+    /**
+     * \brief   Removes the proxy at the given position of the proxy index from the indexes.
+     **/
+    void _unindex_proxy( ProxyIndex::const_iterator pos );
+
+    /**
+     * \brief   Adds the valid stub to the index of its source.
+     **/
+    void _index_stub( const areg::StubAddress & addrStub );
+
+    /**
+     * \brief   Removes the stub from the index of its source.
+     **/
+    void _unindex_stub( const areg::StubAddress & addrStub );
+
     /**
      * \brief   Searches the entry of registered servicing by given address of service.
      *
@@ -231,6 +315,13 @@ private:
     [[nodiscard]]
     MAPPOS find_service( const areg::ServiceAddress & addrService ) const;
 
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    ProxyIndex  mProxyIndex;    //!< The position of every registered proxy.
+    SourceIndex mSourceIndex;   //!< The stubs and the proxies of every source.
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -238,4 +329,27 @@ private:
     AREG_NOCOPY_NOMOVE( ServiceRegistry );
 };
 
+//////////////////////////////////////////////////////////////////////////
+// ServiceRegistry class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline std::size_t ServiceRegistry::ProxyHasher::operator()( const areg::ProxyAddress & addrProxy ) const noexcept
+{
+    const std::size_t service{ static_cast<uint32_t>(static_cast<const areg::ServiceAddress &>(addrProxy)) };
+    const std::size_t thread { static_cast<uint32_t>(addrProxy.thread()) };
+    return (service ^ (thread * 0x9E3779B1u) ^ (static_cast<std::size_t>(addrProxy.cookie()) << 7));
+}
+
+inline bool ServiceRegistry::ProxyEqual::operator()( const areg::ProxyAddress & lhs, const areg::ProxyAddress & rhs ) const noexcept
+{
+    return (static_cast<const areg::ServiceAddress &>(lhs) == static_cast<const areg::ServiceAddress &>(rhs))
+        && (lhs.thread() == rhs.thread())
+        && (lhs.cookie() == rhs.cookie());
+}
+
+inline ServiceRegistry::ProxyIndex::const_iterator ServiceRegistry::_find_proxy( const areg::ProxyAddress & addrProxy ) const
+{
+    return mProxyIndex.find(addrProxy);
+}
+
 #endif  // AREG_mtrouter_SERVICE_PRIVATE_SERVICEREGISTRY_HPP
@@ -0,0 +1,216 @@
+/************************************************************************
+ * Churn test and benchmark of the service registry of the message router.
+ *
+ * SOURCES connections register STUBS_PER_SOURCE services each, and every connection
+ * subscribes PROXIES_PER_SOURCE proxies to the services of the other connections.
+ * Then every connection disconnects in turn, the way the router handles a dropped
+ * connection: it picks up the services of the source, unregisters its proxies and
+ * then its services. After every disconnect the test checks that nothing of the
+ * source is left and that nothing of the other sources is lost.
+ *
+ * The benchmark reports how long the registration, the lookup of one proxy, the
+ * lookup of the services of one source and the whole disconnect storm take, and
+ * compares the lookup of one source with the full scan of the registry.
+ ************************************************************************/
+#include "areg/base/areg_global.h"
+#include "areg/base/ArrayList.hpp"
+#include "areg/component/ProxyAddress.hpp"
+#include "areg/component/StubAddress.hpp"
+#include "mtrouter/service/private/ServiceRegistry.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#ifdef _MSC_VER
+    #pragma comment(lib, "areg")
+#endif // _MSC_VER
+
+namespace
+{
+    //!< The connections of the router.
+    constexpr uint32_t  SOURCES             { 64u };
+    //!< The services of one connection.
+    constexpr uint32_t  STUBS_PER_SOURCE    { 16u };
+    //!< The proxies of one connection, spread over the services of the other connections.
+    constexpr uint32_t  PROXIES_PER_SOURCE  { 3'000u };
+    //!< The proxies of one connection that run in one thread.
+    constexpr uint32_t  PROXIES_PER_THREAD  { 50u };
+    //!< The first cookie of a connection.
+    constexpr ITEM_ID   FIRST_COOKIE        { 1'000u };
+    //!< The number of the first service, the role and the thread.
+    constexpr uint32_t  FIRST_NUMBER        { 10'000u };
+
+    using Clock = std::chrono::steady_clock;
+
+    inline double elapsed_ms(Clock::time_point since)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+    }
+
+    inline ITEM_ID source_cookie(uint32_t source)
+    {
+        return (FIRST_COOKIE + static_cast<ITEM_ID>(source));
+    }
+
+    areg::StubAddress make_stub(uint32_t source, uint32_t index)
+    {
+        const uint32_t number{ FIRST_NUMBER + source * STUBS_PER_SOURCE + index };
+        areg::StubAddress result(number, areg::Version(1, 0, 0), areg::ServiceType::Public, number, FIRST_NUMBER + source, number);
+        result.set_cookie(source_cookie(source));
+        result.set_source(source_cookie(source));
+        return result;
+    }
+
+    areg::ProxyAddress make_proxy(uint32_t source, uint32_t index)
+    {
+        // The services of the next connections, round robin, never the own ones.
+        const uint32_t other { (source + 1u + (index % (SOURCES - 1u))) % SOURCES };
+        const uint32_t number{ FIRST_NUMBER + other * STUBS_PER_SOURCE + ((index / SOURCES) % STUBS_PER_SOURCE) };
+        const uint32_t thread{ FIRST_NUMBER * 10u + source * PROXIES_PER_SOURCE + index / PROXIES_PER_THREAD };
+        areg::ProxyAddress result(number, areg::Version(1, 0, 0), areg::ServiceType::Public, number, thread, FIRST_NUMBER + index);
+        result.set_cookie(source_cookie(source));
+        result.set_source(source_cookie(source));
+        return result;
+    }
+
+    uint32_t count_proxies(const ServiceRegistry & registry)
+    {
+        uint32_t result{ 0u };
+        for (ServiceRegistry::MAPPOS pos = registry.first_position(); registry.is_valid_position(pos); pos = registry.next_position(pos))
+        {
+            result += registry.value_at(pos).size();
+        }
+
+        return result;
+    }
+}
+
+int main()
+{
+    bool failed{ false };
+    ServiceRegistry registry;
+
+    ServiceProxy proxy;
+    ListServiceProxies proxies;
+
+    Clock::time_point start{ Clock::now() };
+    for (uint32_t source = 0u; source < SOURCES; ++source)
+    {
+        for (uint32_t i = 0u; i < STUBS_PER_SOURCE; ++i)
+        {
+            registry.register_service_provider(make_stub(source, i), proxies);
+        }
+    }
+
+    for (uint32_t source = 0u; source < SOURCES; ++source)
+    {
+        for (uint32_t i = 0u; i < PROXIES_PER_SOURCE; ++i)
+        {
+            registry.register_service_proxy(make_proxy(source, i), proxy);
+        }
+    }
+
+    const double registerMs{ elapsed_ms(start) };
+    const uint32_t totalProxies{ SOURCES * PROXIES_PER_SOURCE };
+    if ((registry.size() != SOURCES * STUBS_PER_SOURCE) || (count_proxies(registry) != totalProxies))
+    {
+        std::fprintf(stderr, "FAILED: registered %u services and %u proxies\n", registry.size(), count_proxies(registry));
+        failed = true;
+    }
+
+    // The lookup of one proxy, which every message to the service needs.
+    start = Clock::now();
+    uint32_t found{ 0u };
+    for (uint32_t source = 0u; source < SOURCES; ++source)
+    {
+        for (uint32_t i = 0u; i < PROXIES_PER_SOURCE; ++i)
+        {
+            found += (registry.proxy_service(make_proxy(source, i)).is_connected() ? 1u : 0u);
+        }
+    }
+
+    const double lookupMs{ elapsed_ms(start) };
+    if (found != totalProxies)
+    {
+        std::fprintf(stderr, "FAILED: %u of %u proxies are connected\n", found, totalProxies);
+        failed = true;
+    }
+
+    // The full scan, which the services of one source used to cost.
+    areg::ArrayList<areg::StubAddress> stubs;
+    areg::ArrayList<areg::ProxyAddress> consumers;
+    start = Clock::now();
+    registry.service_list(areg::COOKIE_ANY, stubs, consumers);
+    const double scanMs{ elapsed_ms(start) };
+
+    double sourcesMs{ 0.0 };
+    start = Clock::now();
+    for (uint32_t source = 0u; source < SOURCES; ++source)
+    {
+        const ITEM_ID cookie{ source_cookie(source) };
+        stubs.clear();
+        consumers.clear();
+
+        Clock::time_point lookup{ Clock::now() };
+        registry.service_sources(cookie, stubs, consumers);
+        sourcesMs += elapsed_ms(lookup);
+
+        if ((stubs.size() != STUBS_PER_SOURCE) || (consumers.size() != PROXIES_PER_SOURCE))
+        {
+            std::fprintf(stderr, "FAILED: source %u has %u services and %u proxies\n"
+                        , static_cast<uint32_t>(cookie), stubs.size(), consumers.size());
+            failed = true;
+        }
+
+        for (uint32_t i = 0u; i < consumers.size(); ++i)
+        {
+            registry.unregister_service_proxy(consumers[i], proxy);
+        }
+
+        for (uint32_t i = 0u; i < stubs.size(); ++i)
+        {
+            registry.unregister_service_provider(stubs[i], proxies);
+        }
+
+        stubs.clear();
+        consumers.clear();
+        registry.service_sources(cookie, stubs, consumers);
+        if ((stubs.is_empty() == false) || (consumers.is_empty() == false))
+        {
+            std::fprintf(stderr, "FAILED: source %u left %u services and %u proxies\n"
+                        , static_cast<uint32_t>(cookie), stubs.size(), consumers.size());
+            failed = true;
+        }
+
+        const uint32_t left{ count_proxies(registry) };
+        if (left != totalProxies - (source + 1u) * PROXIES_PER_SOURCE)
+        {
+            std::fprintf(stderr, "FAILED: %u proxies left after source %u\n", left, static_cast<uint32_t>(cookie));
+            failed = true;
+        }
+    }
+
+    const double stormMs{ elapsed_ms(start) };
+    if (count_proxies(registry) != 0u)
+    {
+        std::fprintf(stderr, "FAILED: proxies are left after all sources disconnected\n");
+        failed = true;
+    }
+
+    registry.clear();
+    if ((registry.is_empty() == false) || registry.is_service_registered(make_proxy(0u, 0u)))
+    {
+        std::fprintf(stderr, "FAILED: the registry is not empty after clear\n");
+        failed = true;
+    }
+
+    std::printf("registry: %u sources, %u services, %u proxies\n", SOURCES, SOURCES * STUBS_PER_SOURCE, totalProxies);
+    std::printf("  register all          : %9.3f ms\n", registerMs);
+    std::printf("  lookup one proxy      : %9.3f us\n", lookupMs * 1000.0 / totalProxies);
+    std::printf("  services of a source  : %9.3f ms (full scan %.3f ms)\n", sourcesMs / SOURCES, scanMs);
+    std::printf("  disconnect all sources: %9.3f ms\n", stormMs);
+    std::printf("%s\n", failed ? "FAILED" : "PASSED");
+
+    return (failed ? 1 : 0);
+}
@@ -1,7 +1,11 @@
 /************************************************************************
  * Stress test of the timer and the watchdog backend: arms, disarms, restarts and
  * destroys timers from several threads while they are firing, then tears the whole
- * application down and checks that Application::release() returns.
+ * application down and checks that Application::release() returns. The cycles
+ * alternate the timer manager engine (one OS timer per timer / timing wheel).
+ *
+ * Afterwards a benchmark runs BENCH_TIMERS timers on each engine and reports how long
+ * it takes to start them, to stop them, and to deliver all expiries.
  *
  * The test fails instead of hanging in three ways:
  *   - the built-in watchdog thread ends the process with code 2 when a phase takes
@@ -19,8 +23,10 @@
 #include "areg/component/TimerConsumer.hpp"
 #include "areg/base/Thread.hpp"
 #include "areg/base/String.hpp"
+#include "areg/persist/ConfigManager.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
@@ -33,6 +39,7 @@
 #endif // _MSC_VER
 
 class ChurnComponent;
+class BenchComponent;
 
 namespace
 {
@@ -60,11 +67,27 @@ namespace
     //!< A phase that takes longer than this is a hang, not a slow machine.
     constexpr uint32_t      TEST_WATCHDOG_MS    { 90u * 1000u };
 
+    constexpr char const    BENCH_MODEL[]       { "TimerBenchModel" };
+    constexpr char const    ROLE_BENCH[]        { "TimerBench" };
+    constexpr char const    THREAD_BENCH[]      { "TimerBenchThread" };
+
+    //!< Timers of the benchmark, like the per-request timeouts of a busy gateway.
+    constexpr uint32_t      BENCH_TIMERS        { 10'000u };
+    //!< The benchmark timeouts are spread over this range, milliseconds.
+    constexpr uint32_t      BENCH_TIMEOUT_MIN_MS{ 50u };
+    constexpr uint32_t      BENCH_TIMEOUT_SPAN  { 200u };
+    //!< The timeout of the timers that are stopped before they fire, milliseconds.
+    constexpr uint32_t      BENCH_CANCEL_MS     { 60u * 1000u };
+    //!< How long the benchmark waits for all expiries, milliseconds.
+    constexpr uint32_t      BENCH_WAIT_MS       { 20u * 1000u };
+
     std::atomic_uint        gExpired    { 0u };      //!< expiries seen in the current cycle
     std::atomic_int         gAlive      { 0 };       //!< live components
     std::atomic_bool        gChurnStop  { false };   //!< tells the churn threads to leave
     std::atomic_bool        gFinished   { false };   //!< tells the watchdog the run is over
     std::atomic_uint        gPhase      { 0u };      //!< last phase the run reached
+    std::atomic_uint        gBenchExpired{ 0u };     //!< expiries seen by the benchmark
+    std::atomic<BenchComponent *> gBench{ nullptr }; //!< the benchmark component when it runs
 
     /**
      * \brief   The live components, so that a churn thread reaches them without asking the
@@ -222,6 +245,76 @@ private:
     uint32_t                                    mSeed;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// A component that owns the benchmark timers. The main thread drives them.
+//////////////////////////////////////////////////////////////////////////
+class BenchComponent   : public areg::Component
+                       , private areg::TimerConsumer
+{
+public:
+    BenchComponent(const areg::ComponentEntry & entry, areg::ComponentThread & owner)
+        : areg::Component   (entry, owner)
+        , areg::TimerConsumer()
+        , mTimers           ()
+        , mThread           (&owner)
+    {
+    }
+
+    virtual ~BenchComponent()
+    {
+        gBench.store(nullptr);
+        mTimers.clear();
+    }
+
+    void startup_component(areg::ComponentThread & comThread) override
+    {
+        areg::Component::startup_component(comThread);
+
+        mTimers.reserve(BENCH_TIMERS);
+        for (uint32_t i = 0u; i < BENCH_TIMERS; ++i)
+        {
+            areg::String name{ "bench_" + areg::String::make_string(i) };
+            mTimers.push_back(std::make_unique<areg::Timer>(static_cast<areg::TimerConsumer &>(*this), name));
+        }
+
+        gBench.store(this);
+    }
+
+    void shutdown_component(areg::ComponentThread & comThread) override
+    {
+        gBench.store(nullptr);
+        stop_all();
+        areg::Component::shutdown_component(comThread);
+    }
+
+    //!< Starts every timer once, with a timeout spread over the span.
+    void start_all(uint32_t minMs, uint32_t span)
+    {
+        for (uint32_t i = 0u; i < mTimers.size(); ++i)
+        {
+            mTimers[i]->start_timer(minMs + (span != 0u ? i % span : 0u), *mThread, areg::Timer::ONE_TIME);
+        }
+    }
+
+    void stop_all()
+    {
+        for (auto & timer : mTimers)
+        {
+            timer->stop_timer();
+        }
+    }
+
+private:
+
+    void process_timer(areg::Timer & /* timer */) override
+    {
+        gBenchExpired.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    std::vector<std::unique_ptr<areg::Timer>>   mTimers;
+    areg::ComponentThread *                     mThread;
+};
+
 BEGIN_MODEL(MODEL_NAME)
     BEGIN_REGISTER_THREAD(THREAD_ONE)
         BEGIN_REGISTER_COMPONENT(ROLE_ONE, ChurnComponent)
@@ -251,6 +344,72 @@ namespace
             std::this_thread::sleep_for(std::chrono::milliseconds(CHURN_PAUSE_MS));
         }
     }
+
+    //!< Milliseconds since the given time point.
+    double elapsed_ms(const std::chrono::steady_clock::time_point & since)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+    }
+
+    /**
+     * \brief   Runs BENCH_TIMERS timers on the given engine: starts and stops them before they
+     *          fire, then starts them again and waits for every expiry.
+     * \return  Returns the number of expiries delivered.
+     **/
+    uint32_t run_benchmark(bool wheel)
+    {
+        areg::Application::config_manager().set_timer_wheel(wheel, true);
+        areg::Application::setup(false, true, false, true, false, nullptr);
+        const bool engineWheel{ areg::Application::config_manager().timer_wheel() };
+
+        // One static model per file, so the benchmark model is created at run-time.
+        // The second run finds it registered already.
+        areg::Model model(BENCH_MODEL);
+        model.add_thread(THREAD_BENCH).add_component<BenchComponent>(ROLE_BENCH);
+        areg::ComponentLoader::add_model_unique(model);
+
+        areg::Application::load_model(BENCH_MODEL);
+
+        for (uint32_t waited = 0u; (gBench.load() == nullptr) && (waited < BENCH_WAIT_MS); waited += 10u)
+        {
+            areg::Thread::sleep(10u);
+        }
+
+        BenchComponent * bench{ gBench.load() };
+        uint32_t expired{ 0u };
+        if (bench != nullptr)
+        {
+            // The common case of a request timeout: armed, then cancelled by the reply.
+            auto started = std::chrono::steady_clock::now();
+            bench->start_all(BENCH_CANCEL_MS, 0u);
+            const double startCancelMs{ elapsed_ms(started) };
+
+            started = std::chrono::steady_clock::now();
+            bench->stop_all();
+            const double stopMs{ elapsed_ms(started) };
+
+            gBenchExpired.store(0u);
+            started = std::chrono::steady_clock::now();
+            bench->start_all(BENCH_TIMEOUT_MIN_MS, BENCH_TIMEOUT_SPAN);
+            const double startMs{ elapsed_ms(started) };
+
+            const uint32_t lastTimeout{ BENCH_TIMEOUT_MIN_MS + BENCH_TIMEOUT_SPAN - 1u };
+            for (uint32_t waited = 0u; (gBenchExpired.load() < BENCH_TIMERS) && (waited < BENCH_WAIT_MS + lastTimeout); waited += 5u)
+            {
+                areg::Thread::sleep(5u);
+            }
+
+            const double drainMs{ elapsed_ms(started) };
+            expired = gBenchExpired.load();
+
+            std::printf("benchmark %-7s: %u timers, start+cancel %.1f ms / stop %.1f ms, start %.1f ms, %u expiries in %.1f ms (last timeout %u ms)\n"
+                       , engineWheel ? "wheel" : "timerfd", BENCH_TIMERS, startCancelMs, stopMs, startMs, expired, drainMs, lastTimeout);
+            std::fflush(stdout);
+        }
+
+        areg::Application::release();
+        return expired;
+    }
 }
 
 int main()
@@ -265,9 +424,13 @@ int main()
         gExpired.store(0u);
         gChurnStop.store(false);
 
+        // Odd cycles run one OS timer per timer, even cycles the timing wheel.
+        areg::Application::config_manager().set_timer_wheel((cycle % 2u) == 0u, true);
+
         // The watchdog uses the same TimerPosix object and manager loop as the timer, so
         // every dispatch below exercises the watchdog backend too.
         areg::Application::setup(false, true, false, true, true, nullptr);
+        const bool wheel{ areg::Application::config_manager().timer_wheel() };
         areg::Application::load_model(MODEL_NAME);
 
         gPhase.store(cycle * 10u + 2u);
@@ -298,8 +461,8 @@ int main()
         const bool   threadsGone{ (areg::Thread::find_by_address(areg::ThreadAddress(THREAD_ONE)) == nullptr) &&
                                   (areg::Thread::find_by_address(areg::ThreadAddress(THREAD_TWO)) == nullptr) };
 
-        std::printf("cycle %u: expiries %u, components left %d, threads gone %s\n"
-                   , cycle, expired, alive, threadsGone ? "yes" : "no");
+        std::printf("cycle %u (%s): expiries %u, components left %d, threads gone %s\n"
+                   , cycle, wheel ? "wheel" : "timerfd", expired, alive, threadsGone ? "yes" : "no");
         std::fflush(stdout);
 
         if (expired == 0u)
@@ -321,6 +484,18 @@ int main()
         }
     }
 
+    // The one-timer-per-timer engine may run out of descriptors on a low limit, so only
+    // the timing wheel has to deliver every expiry.
+    gPhase.store(100u);
+    run_benchmark(false);
+
+    gPhase.store(110u);
+    if (run_benchmark(true) != BENCH_TIMERS)
+    {
+        std::printf("FAILED: the timing wheel lost expiries in the benchmark\n");
+        failed = true;
+    }
+
     gFinished.store(true);
 
     std::printf("%s\n", failed ? "timer churn test FAILED" : "timer churn test passed");
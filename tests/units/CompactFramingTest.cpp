@@ -0,0 +1,278 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/CompactFramingTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the compact message framing.
+ *              Covers: the definition and the reuse of a session, the inline and the
+ *              separate payload, the try mode, the rebuilt EventHeader and the
+ *              framings of the sockets of one connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/ipc/CompactFraming.hpp"
+#include "areg/ipc/SocketLinkMap.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    //!< The port, which names the local sockets of the tests. No TCP socket is opened.
+    constexpr uint16_t TEST_PORT{ 48941u };
+
+    //!< The size of the full header.
+    constexpr uint32_t FULL_HEADER{ static_cast<uint32_t>(sizeof(areg::EventHeader)) };
+
+    /**
+     * \brief   A connected pair of local stream sockets, the framings are attached to them.
+     **/
+    struct SocketPair
+    {
+        SOCKETHANDLE    server  { areg::InvalidSocketHandle };
+        SOCKETHANDLE    client  { areg::InvalidSocketHandle };
+        SOCKETHANDLE    accepted{ areg::InvalidSocketHandle };
+        areg::String    path    { };
+
+        bool open(uint16_t port)
+        {
+            path    = areg::local_socket_path(port);
+            server  = areg::local_server_connect(path);
+            if ((areg::is_valid_socket(server) == false) || (areg::server_listen(server) == false))
+                return false;
+
+            client = areg::local_socket_create();
+            if ((areg::is_valid_socket(client) == false) || (areg::local_connect_fd(client, path) == false))
+                return false;
+
+            accepted = areg::local_server_accept(server);
+            return areg::is_valid_socket(accepted);
+        }
+
+        ~SocketPair()
+        {
+            areg::socket_close(accepted);
+            areg::socket_close(client);
+            areg::socket_close(server);
+            areg::local_socket_remove(path);
+        }
+    };
+
+    /**
+     * \brief   Builds a message of a session with the payload of the given size.
+     **/
+    std::vector<uint8_t> makeMessage(uint32_t consumer, uint32_t messageId, uint32_t payload)
+    {
+        std::vector<uint8_t> message(FULL_HEADER + payload);
+        areg::EventHeader header{ };
+        header.bufHeader.biLength   = FULL_HEADER + payload;
+        header.bufHeader.biOffset   = FULL_HEADER;
+        header.bufHeader.biUsed     = payload;
+        header.target               = 7u;
+        header.source               = 3u;
+        header.consumer.id          = consumer;
+        header.provider.id          = 11u;
+        header.channel              = 0x1234u;
+        header.messageId            = messageId;
+        header.sequenceNr           = 1000u + messageId;
+        header.result               = 2u;
+        header.eventType            = 0x0040u;
+        header.callType             = 1u;
+        header.priority             = 2u;
+        header.checksum             = 0xCAFEu;
+        header.eventId              = 99u;
+        std::memcpy(message.data(), &header, sizeof(header));
+        for (uint32_t i = 0u; i < payload; ++ i)
+        {
+            message[FULL_HEADER + i] = static_cast<uint8_t>(i + messageId);
+        }
+
+        return message;
+    }
+
+    /**
+     * \brief   Joins the encoded buffers into the bytes, which the socket would carry.
+     **/
+    std::vector<uint8_t> joinBuffers(const areg::IoBuffer * buffers, uint32_t count)
+    {
+        std::vector<uint8_t> wire;
+        for (uint32_t i = 0u; i < count; ++ i)
+        {
+            wire.insert(wire.end(), buffers[i].data, buffers[i].data + buffers[i].size);
+        }
+
+        return wire;
+    }
+
+    /**
+     * \brief   Decodes the frame at the position into the message, as the receiving thread does.
+     *          Returns the position of the next frame.
+     **/
+    std::size_t decodeFrame(areg::CompactFraming & framing, const std::vector<uint8_t> & wire, std::size_t pos, std::vector<uint8_t> & message)
+    {
+        uint32_t frame{ 0u };
+        std::memcpy(&frame, wire.data() + pos, sizeof(frame));
+        if (areg::is_compact_frame(frame) == false)
+        {
+            const uint32_t size{ areg::wire_frame_size(wire.data() + pos) };
+            message.assign(wire.begin() + pos, wire.begin() + pos + size);
+            return pos + size;
+        }
+
+        areg::CompactHeader header{ };
+        std::memcpy(&header, wire.data() + pos, sizeof(header));
+        pos += sizeof(header);
+
+        areg::CompactSession define{ };
+        const bool hasDefine{ (header.frame & areg::COMPACT_FLAG_DEFINE) != 0u };
+        if (hasDefine)
+        {
+            std::memcpy(&define, wire.data() + pos, sizeof(define));
+            pos += sizeof(define);
+        }
+
+        areg::EventHeader evtHeader{ };
+        if (framing.restore(header, hasDefine ? &define : nullptr, evtHeader) == false)
+            return wire.size() + 1u;
+
+        message.resize(FULL_HEADER + header.used);
+        std::memcpy(message.data(), &evtHeader, sizeof(evtHeader));
+        std::memcpy(message.data() + FULL_HEADER, wire.data() + pos, header.used);
+        return pos + header.used;
+    }
+}
+
+/**
+ * \brief   The first message of a session defines it, the next one refers to the slot only. The
+ *          small payload is copied into the frame, the large one is sent from the message, and
+ *          the receiver rebuilds the messages byte by byte.
+ **/
+TEST(CompactFramingTest, encodes_and_restores_sessions)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    SocketPair pair;
+    ASSERT_TRUE(pair.open(TEST_PORT));
+
+    areg::SocketLinkMap links;
+    areg::CompactFraming sender;
+    areg::CompactFraming receiver;
+    ASSERT_TRUE(sender.attach(pair.client, links));
+    ASSERT_TRUE(receiver.attach(pair.accepted, links));
+    sender.activate_send();
+    EXPECT_EQ(links.links_of(pair.client).slFraming, &sender);
+    EXPECT_EQ(links.links_of(pair.accepted).slFraming, &receiver);
+
+    const std::vector<uint8_t> messages[]{ makeMessage(5u, 1u, 16u), makeMessage(5u, 2u, 200u), makeMessage(5u, 3u, 0u) };
+    const areg::IoBuffer ioBuffer[]{ { messages[0].data(), messages[0].size() }
+                                   , { messages[1].data(), messages[1].size() }
+                                   , { messages[2].data(), messages[2].size() } };
+
+    areg::CompactFraming::Frame frames[3];
+    areg::IoBuffer encoded[6];
+    uint32_t wireSize{ 0u };
+    const uint32_t count{ sender.encode(ioBuffer, 3u, false, frames, encoded, wireSize) };
+
+    // The large payload is the only one in a buffer of its own.
+    EXPECT_EQ(count, 4u);
+    const uint32_t compactSize{ static_cast<uint32_t>(sizeof(areg::CompactHeader)) };
+    EXPECT_EQ(wireSize, (compactSize + static_cast<uint32_t>(sizeof(areg::CompactSession)) + 16u) + (compactSize + 200u) + compactSize);
+
+    const std::vector<uint8_t> wire{ joinBuffers(encoded, count) };
+    ASSERT_EQ(wire.size(), wireSize);
+
+    std::size_t pos{ 0u };
+    for (const std::vector<uint8_t> & expected : messages)
+    {
+        std::vector<uint8_t> message;
+        pos = decodeFrame(receiver, wire, pos, message);
+        ASSERT_LE(pos, wire.size());
+        EXPECT_EQ(message, expected);
+    }
+
+    EXPECT_EQ(pos, wire.size());
+
+    sender.detach();
+    EXPECT_EQ(links.links_of(pair.client).slFraming, nullptr);
+}
+
+/**
+ * \brief   The try mode defines no session: the message of a new session keeps the full header,
+ *          while the message of a known session is still sent in the compact frame.
+ **/
+TEST(CompactFramingTest, try_mode_keeps_dictionary)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    SocketPair pair;
+    ASSERT_TRUE(pair.open(TEST_PORT + 1u));
+
+    areg::SocketLinkMap links;
+    areg::CompactFraming sender;
+    areg::CompactFraming receiver;
+    ASSERT_TRUE(sender.attach(pair.client, links));
+    ASSERT_TRUE(receiver.attach(pair.accepted, links));
+    sender.activate_send();
+
+    const std::vector<uint8_t> known{ makeMessage(5u, 1u, 8u) };
+    const std::vector<uint8_t> fresh{ makeMessage(6u, 2u, 8u) };
+    const areg::IoBuffer define[]{ { known.data(), known.size() } };
+    const areg::IoBuffer tried[]{ { fresh.data(), fresh.size() }, { known.data(), known.size() } };
+
+    areg::CompactFraming::Frame frames[2];
+    areg::IoBuffer encoded[4];
+    uint32_t wireSize{ 0u };
+
+    uint32_t count{ sender.encode(define, 1u, false, frames, encoded, wireSize) };
+    std::vector<uint8_t> wire{ joinBuffers(encoded, count) };
+    std::vector<uint8_t> message;
+    EXPECT_EQ(decodeFrame(receiver, wire, 0u, message), wire.size());
+
+    count = sender.encode(tried, 2u, true, frames, encoded, wireSize);
+    wire  = joinBuffers(encoded, count);
+    EXPECT_EQ(wire.size(), fresh.size() + sizeof(areg::CompactHeader) + 8u);
+
+    std::size_t pos{ decodeFrame(receiver, wire, 0u, message) };
+    EXPECT_EQ(pos, fresh.size());
+    EXPECT_EQ(message, fresh);
+
+    pos = decodeFrame(receiver, wire, pos, message);
+    EXPECT_EQ(pos, wire.size());
+    EXPECT_EQ(message, known);
+}
+
+/**
+ * \brief   Each socket has its own entry in the links of the connection: the sockets, which
+ *          handles differ by a power of two, both get their framing, and the second framing of
+ *          one socket is refused.
+ **/
+TEST(CompactFramingTest, attaches_each_socket)
+{
+    const SOCKETHANDLE first{ static_cast<SOCKETHANDLE>(7) };
+    const SOCKETHANDLE second{ static_cast<SOCKETHANDLE>(7 + 1024) };
+
+    areg::SocketLinkMap links;
+    areg::CompactFraming framingFirst;
+    areg::CompactFraming framingSecond;
+    areg::CompactFraming framingOther;
+    ASSERT_TRUE(framingFirst.attach(first, links));
+    ASSERT_TRUE(framingSecond.attach(second, links));
+    EXPECT_FALSE(framingOther.attach(first, links));
+    EXPECT_EQ(links.links_of(first).slFraming, &framingFirst);
+    EXPECT_EQ(links.links_of(second).slFraming, &framingSecond);
+
+    framingFirst.detach();
+    EXPECT_EQ(links.links_of(first).slFraming, nullptr);
+    EXPECT_EQ(links.links_of(second).slFraming, &framingSecond);
+    EXPECT_TRUE(framingOther.attach(first, links));
+}
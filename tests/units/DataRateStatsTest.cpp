@@ -0,0 +1,105 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/DataRateStatsTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the send and receive data rate counter.
+ *              Covers: the count of the system calls with the messages they carried,
+ *              the reset on extraction and on the change of the tracking, and the
+ *              counting from several threads.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/ipc/DataRateStats.hpp"
+
+#include <thread>
+#include <vector>
+
+/**
+ * \brief   Every accumulation is one system call: the calls, the messages and the bytes are
+ *          counted separately, so the messages per call are known. Extracting resets them.
+ **/
+TEST(DataRateStatsTest, counts_send_calls)
+{
+    areg::DataRateStats stats;
+    stats.set_enabled(true);
+
+    stats.accumulate(300u, 3u);
+    stats.accumulate(100u, 1u);
+    stats.accumulate(1200u, 12u);
+
+    EXPECT_EQ(stats.extract_calls(), 3u);
+    EXPECT_EQ(stats.extract_msgs(), 16u);
+    EXPECT_EQ(stats.extract_bytes(), 1600u);
+
+    EXPECT_EQ(stats.extract_calls(), 0u);
+    EXPECT_EQ(stats.extract_msgs(), 0u);
+    EXPECT_EQ(stats.extract_bytes(), 0u);
+
+    stats.accumulate(10u, 1u);
+    EXPECT_EQ(stats.extract_calls(), 1u);
+}
+
+/**
+ * \brief   Nothing is counted while the tracking is disabled, and a change of the tracking
+ *          drops the counts of the previous interval.
+ **/
+TEST(DataRateStatsTest, counts_only_when_enabled)
+{
+    areg::DataRateStats stats;
+    stats.accumulate(100u, 1u);
+    EXPECT_EQ(stats.extract_calls(), 0u);
+
+    stats.set_enabled(true);
+    stats.accumulate(100u, 2u);
+    stats.set_enabled(false);
+    EXPECT_EQ(stats.extract_calls(), 0u);
+    EXPECT_EQ(stats.extract_msgs(), 0u);
+
+    stats.accumulate(100u, 2u);
+    EXPECT_EQ(stats.extract_calls(), 0u);
+}
+
+/**
+ * \brief   The send thread and the producers writing into the socket themselves count the
+ *          calls at the same time, none of them is lost.
+ **/
+TEST(DataRateStatsTest, counts_calls_of_threads)
+{
+    constexpr uint32_t THREADS  { 4u };
+    constexpr uint32_t CALLS    { 10'000u };
+
+    areg::DataRateStats stats;
+    stats.set_enabled(true);
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0u; i < THREADS; ++ i)
+    {
+        threads.emplace_back([&stats]()
+        {
+            for (uint32_t k = 0u; k < CALLS; ++ k)
+            {
+                stats.accumulate(64u, 2u);
+            }
+        });
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(stats.extract_calls(), THREADS * CALLS);
+    EXPECT_EQ(stats.extract_msgs(), 2u * THREADS * CALLS);
+    EXPECT_EQ(stats.extract_bytes(), 64u * THREADS * CALLS);
+}
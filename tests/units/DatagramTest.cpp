@@ -0,0 +1,143 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/DatagramTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the datagrams.
+ *              Covers: a batch of datagrams through the loopback, the counting
+ *              of the lost and late datagrams of a link, and the links attached
+ *              to the sockets of one connection object.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SocketDefs.hpp"
+#include "areg/ipc/DatagramLink.hpp"
+#include "areg/ipc/SocketLinkMap.hpp"
+
+#include <cstring>
+
+/**
+ * \brief   A batch of datagrams of two regions each arrives in one receive call, with the
+ *          address of the sender.
+ **/
+TEST(DatagramTest, transfers_batch)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    const SOCKETHANDLE sender{ areg::datagram_socket_create("127.0.0.1", 0u) };
+    const SOCKETHANDLE receiver{ areg::datagram_socket_create("127.0.0.1", 0u) };
+    ASSERT_TRUE(areg::is_valid_socket(sender));
+    ASSERT_TRUE(areg::is_valid_socket(receiver));
+
+    areg::DatagramEndpoint peer{ };
+    areg::DatagramEndpoint self{ };
+    ASSERT_TRUE(areg::datagram_endpoint("127.0.0.1", areg::datagram_socket_port(receiver), peer));
+    ASSERT_TRUE(areg::datagram_endpoint("127.0.0.1", areg::datagram_socket_port(sender), self));
+
+    constexpr uint32_t COUNT{ 8u };
+    const uint8_t head[]{ 0xA1u, 0xB2u };
+    uint8_t bodies[COUNT][3]{ };
+    areg::DatagramOut batch[COUNT]{ };
+    for (uint32_t i = 0u; i < COUNT; ++ i)
+    {
+        bodies[i][0] = bodies[i][1] = bodies[i][2] = static_cast<uint8_t>(i);
+        batch[i].parts[0]   = areg::IoBuffer{ head, sizeof(head) };
+        batch[i].parts[1]   = areg::IoBuffer{ bodies[i], sizeof(bodies[i]) };
+        batch[i].peer       = peer;
+    }
+
+    EXPECT_EQ(areg::datagram_send(sender, batch, COUNT), static_cast<int32_t>(COUNT));
+
+    uint8_t buffers[COUNT][16]{ };
+    areg::DatagramIn received[COUNT]{ };
+    for (uint32_t i = 0u; i < COUNT; ++ i)
+    {
+        received[i] = areg::DatagramIn{ buffers[i], sizeof(buffers[i]), 0u, { 0u, 0u } };
+    }
+
+    uint32_t total{ 0u };
+    while (total < COUNT)
+    {
+        const int32_t count{ areg::datagram_receive(receiver, received + total, COUNT - total, 1000u) };
+        if (count <= 0)
+            break;
+
+        total += static_cast<uint32_t>(count);
+    }
+
+    ASSERT_EQ(total, COUNT);
+    for (uint32_t i = 0u; i < COUNT; ++ i)
+    {
+        EXPECT_EQ(received[i].size, 5u);
+        EXPECT_EQ(std::memcmp(received[i].data, head, sizeof(head)), 0);
+        EXPECT_EQ(received[i].data[2], static_cast<uint8_t>(i));
+        EXPECT_EQ(received[i].peer.port, self.port);
+        EXPECT_EQ(received[i].peer.address, self.address);
+    }
+
+    // Nothing else is pending, the receive times out.
+    EXPECT_EQ(areg::datagram_receive(receiver, received, COUNT, 10u), 0);
+
+    areg::socket_close(sender);
+    areg::socket_close(receiver);
+}
+
+/**
+ * \brief   The gaps in the sequence are counted as lost, the late datagrams are refused, and
+ *          only the droppable messages are sent as datagrams.
+ **/
+TEST(DatagramTest, counts_lost_and_late)
+{
+    areg::DatagramLink link;
+    EXPECT_FALSE(link.is_sending());
+    EXPECT_EQ(link.accept_sequence(5u), 0);
+    EXPECT_EQ(link.accept_sequence(6u), 0);
+    EXPECT_EQ(link.accept_sequence(9u), 2);
+    EXPECT_LT(link.accept_sequence(7u), 0);
+    EXPECT_EQ(link.accept_sequence(10u), 0);
+
+    // The sequence wraps around.
+    areg::DatagramLink wrapped;
+    EXPECT_EQ(wrapped.accept_sequence(0xFFFFFFFFu), 0);
+    EXPECT_EQ(wrapped.accept_sequence(1u), 1);
+
+    const uint8_t raw[16]{ };
+    EXPECT_FALSE(areg::DatagramLink::is_datagram(areg::IoBuffer{ raw, sizeof(raw) }));
+}
+
+/**
+ * \brief   Each socket of a connection object has its own link, also the sockets whose handles
+ *          differ by a multiple of a table size, and a socket takes only one link at a time.
+ **/
+TEST(DatagramTest, attaches_each_socket)
+{
+    const SOCKETHANDLE first{ static_cast<SOCKETHANDLE>(7) };
+    const SOCKETHANDLE second{ static_cast<SOCKETHANDLE>(7 + 1024) };
+    const SOCKETHANDLE datagram{ static_cast<SOCKETHANDLE>(9) };
+    const areg::DatagramEndpoint peer{ 0x7F000001u, 50000u };
+
+    areg::SocketLinkMap links;
+    areg::DatagramLink linkFirst;
+    areg::DatagramLink linkSecond;
+    areg::DatagramLink linkOther;
+    ASSERT_TRUE(linkFirst.attach(first, links, datagram, peer));
+    ASSERT_TRUE(linkSecond.attach(second, links, datagram, peer));
+    EXPECT_FALSE(linkOther.attach(first, links, datagram, peer));
+    EXPECT_EQ(links.links_of(first).slDatagram, &linkFirst);
+    EXPECT_EQ(links.links_of(second).slDatagram, &linkSecond);
+
+    linkFirst.detach();
+    EXPECT_EQ(links.links_of(first).slDatagram, nullptr);
+    EXPECT_EQ(links.links_of(second).slDatagram, &linkSecond);
+    EXPECT_TRUE(linkOther.attach(first, links, datagram, peer));
+}
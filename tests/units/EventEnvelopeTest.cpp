@@ -13,7 +13,7 @@
  * \brief       Areg Platform, unit tests for MessageEnvelope.
  *              Covers: initialization, header bulk access, consumer/provider
  *              endpoint fields, shared service fields, event routing fields,
- *              operations, streaming, copy/move semantics.
+ *              operations, streaming, copy/move semantics, multicast form.
  ************************************************************************/
 
 /************************************************************************
@@ -23,7 +23,11 @@
 #include "areg/base/MessageEnvelope.hpp"
 
 #include "areg/base/SharedBuffer.hpp"
+#include "areg/base/MathDefs.hpp"
 #include "areg/base/MemoryDefs.hpp"
+#include "areg/component/EventDefs.hpp"
+#include "areg/component/MulticastEnvelope.hpp"
+#include "areg/component/StubBase.hpp"
 
 #include <cstring>
 
@@ -541,6 +545,29 @@ TEST(EventEnvelopeTest, checksum_ignore_flag)
     EXPECT_TRUE(env.is_checksum_valid() || env.is_checksum_ignore());
 }
 
+/**
+ * \brief   The CRC kernel of the running CPU computes the same CRC32C as the table, for every
+ *          length and alignment, so peers with different kernels agree on the checksum.
+ **/
+TEST(EventEnvelopeTest, checksum_kernel_matches_table)
+{
+    uint8_t data[96];
+    for (uint32_t i = 0u; i < sizeof(data); ++ i)
+    {
+        data[i] = static_cast<uint8_t>(i * 37u + 11u);
+    }
+
+    for (int32_t offset = 0; offset < 8; ++ offset)
+    {
+        for (int32_t size = 0; size <= 80; ++ size)
+        {
+            const uint32_t expected{ areg::crc32_calculate(data + offset, size) };
+            EXPECT_EQ(areg::crc32_runtime(data + offset, size), expected);
+            EXPECT_EQ(areg::crc32_hardware(data + offset, size), expected);
+        }
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // 7. Operations
 //////////////////////////////////////////////////////////////////////////
@@ -770,4 +797,173 @@ TEST(EventEnvelopeTest, all_fields_survive_clone)
     
     EXPECT_EQ(cloned.service_role(), 0xABCDu);
     EXPECT_EQ(cloned.service_item(), 0x1234u);
-}
\ No newline at end of file
+}
+
+//////////////////////////////////////////////////////////////////////////
+// 10. Multicast form
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    areg::MessageEnvelope make_response(uint32_t payloadSize)
+    {
+        areg::MessageEnvelope env(static_cast<uint16_t>(areg::EventType::EventRemoteResponse), 0u, payloadSize);
+        env.set_message_id(0x4010u);
+        env.set_call_type(static_cast<uint8_t>(areg::EventCallType::CallRemote));
+        for (uint32_t i = 0u; i < payloadSize; ++ i)
+        {
+            env.write_pod(static_cast<uint8_t>(i));
+        }
+
+        return env;
+    }
+
+    areg::Endpoint make_endpoint(uint32_t cookie, uint32_t number)
+    {
+        areg::Endpoint ep{};
+        ep.id     = cookie;
+        ep.number = number;
+        ep.thread = 0x77u;
+        return ep;
+    }
+}
+
+/**
+ * \brief   The target list is attached after the payload and read back unchanged.
+ **/
+TEST(EventEnvelopeTest, multicast_attach_targets)
+{
+    areg::MessageEnvelope env{ make_response(13u) };
+    const areg::Endpoint targets[]{ make_endpoint(300u, 1u), make_endpoint(301u, 2u), make_endpoint(300u, 3u) };
+
+    EXPECT_FALSE(areg::MulticastEnvelope::is_multicast(env));
+    ASSERT_TRUE(areg::MulticastEnvelope::attach_targets(env, targets, 3u));
+    EXPECT_FALSE(areg::MulticastEnvelope::attach_targets(env, targets, 3u));
+
+    EXPECT_TRUE(areg::MulticastEnvelope::is_multicast(env));
+    EXPECT_EQ(env.call_type(), static_cast<uint8_t>(areg::EventCallType::CallMulticast));
+    EXPECT_EQ(areg::MulticastEnvelope::payload_size(env), 13u);
+    ASSERT_EQ(areg::MulticastEnvelope::target_count(env), 3u);
+
+    const areg::Endpoint* list{ areg::MulticastEnvelope::targets(env) };
+    ASSERT_NE(list, nullptr);
+    for (uint32_t i = 0u; i < 3u; ++ i)
+    {
+        EXPECT_EQ(list[i].id, targets[i].id);
+        EXPECT_EQ(list[i].number, targets[i].number);
+    }
+}
+
+/**
+ * \brief   A unicast copy and the in-place conversion keep the payload and restore the call type.
+ **/
+TEST(EventEnvelopeTest, multicast_to_unicast)
+{
+    areg::MessageEnvelope env{ make_response(10u) };
+    const areg::Endpoint targets[]{ make_endpoint(300u, 1u), make_endpoint(300u, 2u) };
+    ASSERT_TRUE(areg::MulticastEnvelope::attach_targets(env, targets, 2u));
+
+    areg::MessageEnvelope copy{ areg::MulticastEnvelope::extract_unicast(env, targets[0]) };
+    ASSERT_TRUE(copy.is_valid());
+    EXPECT_FALSE(copy.is_shared());
+    EXPECT_FALSE(areg::MulticastEnvelope::is_multicast(copy));
+    EXPECT_EQ(copy.size_used(), 10u);
+    EXPECT_EQ(copy.target(), 300u);
+    EXPECT_EQ(copy.consumer_number(), 1u);
+    EXPECT_EQ(copy.message_id(), 0x4010u);
+    EXPECT_EQ(copy.call_type(), static_cast<uint8_t>(areg::EventCallType::CallRemote));
+    EXPECT_EQ(std::memcmp(copy.buffer(), env.buffer(), 10u), 0);
+
+    const areg::Endpoint last{ targets[1] };
+    ASSERT_TRUE(areg::MulticastEnvelope::restore_unicast(env, last));
+    EXPECT_FALSE(areg::MulticastEnvelope::is_multicast(env));
+    EXPECT_EQ(env.size_used(), 10u);
+    EXPECT_EQ(env.consumer_number(), 2u);
+    EXPECT_EQ(env.call_type(), static_cast<uint8_t>(areg::EventCallType::CallRemote));
+}
+
+/**
+ * \brief   The router split results in one envelope per process cookie.
+ **/
+TEST(EventEnvelopeTest, multicast_split_by_process)
+{
+    areg::MessageEnvelope env{ make_response(7u) };
+    const areg::Endpoint targets[]{ make_endpoint(301u, 1u), make_endpoint(300u, 2u), make_endpoint(301u, 3u) };
+    ASSERT_TRUE(areg::MulticastEnvelope::attach_targets(env, targets, 3u));
+
+    areg::ArrayList<areg::MessageEnvelope> result;
+    ASSERT_EQ(areg::MulticastEnvelope::split_by_process(env, result), 2u);
+
+    const areg::MessageEnvelope& single{ result[0] };
+    EXPECT_FALSE(areg::MulticastEnvelope::is_multicast(single));
+    EXPECT_EQ(single.target(), 300u);
+    EXPECT_EQ(single.consumer_number(), 2u);
+    EXPECT_EQ(single.size_used(), 7u);
+
+    const areg::MessageEnvelope& group{ result[1] };
+    EXPECT_TRUE(areg::MulticastEnvelope::is_multicast(group));
+    EXPECT_EQ(group.target(), 301u);
+    ASSERT_EQ(areg::MulticastEnvelope::target_count(group), 2u);
+    EXPECT_EQ(areg::MulticastEnvelope::targets(group)[0].number, 1u);
+    EXPECT_EQ(areg::MulticastEnvelope::targets(group)[1].number, 3u);
+    EXPECT_EQ(areg::MulticastEnvelope::payload_size(group), 7u);
+    EXPECT_EQ(std::memcmp(group.buffer(), env.buffer(), 7u), 0);
+}
+
+namespace
+{
+    //!< Opens the multicast grouping of the stub to the test, the stub is never created.
+    class StubProbe : public areg::StubBase
+    {
+    public:
+        using areg::StubBase::Listener;
+        using areg::StubBase::is_multicast_listener;
+    };
+
+    StubProbe::Listener make_listener(uint32_t cookie, uint32_t number, uint32_t thread, const areg::RawService& service)
+    {
+        StubProbe::Listener listener{ 0x4010u };
+        listener.mConsumer          = make_endpoint(cookie, number);
+        listener.mConsumer.thread   = thread;
+        listener.mRawService        = service;
+        return listener;
+    }
+}
+
+/**
+ * \brief   The remote consumers of the same service and role share one multicast envelope,
+ *          whatever their threads are, and every unicast form gets the thread of its target.
+ **/
+TEST(EventEnvelopeTest, multicast_groups_consumer_threads)
+{
+    const uint32_t remote{ static_cast<uint32_t>(areg::COOKIE_REMOTE_SERVICE) };
+    const areg::RawService service{ 0x1234u, 0x5678u };
+    const areg::RawService otherRole{ 0x1234u, 0x9999u };
+    const StubProbe::Listener listeners[]
+    {
+          make_listener(remote + 1u, 1u, 0x111u, service)
+        , make_listener(remote + 1u, 2u, 0x222u, service)
+        , make_listener(remote + 2u, 3u, 0x333u, service)
+    };
+
+    for (const StubProbe::Listener& listener : listeners)
+    {
+        EXPECT_TRUE(StubProbe::is_multicast_listener(listener, service));
+    }
+
+    EXPECT_FALSE(StubProbe::is_multicast_listener(make_listener(remote + 1u, 4u, 0x111u, otherRole), service));
+    EXPECT_FALSE(StubProbe::is_multicast_listener(make_listener(remote - 1u, 5u, 0x111u, service), service));
+
+    areg::MessageEnvelope env{ make_response(9u) };
+    const areg::Endpoint targets[]{ listeners[0].mConsumer, listeners[1].mConsumer };
+    ASSERT_TRUE(areg::MulticastEnvelope::attach_targets(env, targets, 2u));
+
+    const areg::MessageEnvelope copy{ areg::MulticastEnvelope::extract_unicast(env, targets[0]) };
+    ASSERT_TRUE(copy.is_valid());
+    EXPECT_EQ(copy.consumer_number(), 1u);
+    EXPECT_EQ(copy.consumer_thread(), 0x111u);
+
+    ASSERT_TRUE(areg::MulticastEnvelope::restore_unicast(env, targets[1]));
+    EXPECT_EQ(env.consumer_number(), 2u);
+    EXPECT_EQ(env.consumer_thread(), 0x222u);
+}
@@ -12,7 +12,7 @@
  * \author      Artak Avetyan
  * \brief       Areg Platform, unit tests for EventQueue.
  *              Covers single-threaded correctness (push/pop, priority lanes,
- *              capacity, exit state, doorbell polling) and multi-threaded
+ *              capacity, exit state, doorbell polling, latest-value lane, NUMA ring) and multi-threaded
  *              stress (many producers, single consumer) verifying no event loss
  *              and no lost wake-up.
  ************************************************************************/
@@ -53,6 +53,25 @@ namespace
     {
         return TagEvent(tag, prio);
     }
+
+    //!< An update of the attribute \a attrId to the consumer \a consumer, tagged with \a tag.
+    struct UpdateEvent : public Event
+    {
+        UpdateEvent(uint32_t tag, uint32_t consumer, uint32_t attrId, bool droppable)
+            : Event(EventType::EventLocalAttribute, EventPriority::NormalPrio)
+        {
+            set_event_id(tag);
+            header()->consumer.number = consumer;
+            header()->messageId = attrId;
+            set_droppable(droppable);
+        }
+    };
+
+    //!< Builds a droppable (latest-value) or a lossless update tagged with \a tag.
+    inline Event makeUpdate(uint32_t tag, uint32_t consumer, uint32_t attrId, bool droppable = true)
+    {
+        return UpdateEvent(tag, consumer, attrId, droppable);
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -170,6 +189,89 @@ TEST(EventQueueTest, pop_events_preempts_with_exit)
     EXPECT_TRUE(out[0].is_exit_prio());
 }
 
+TEST(EventQueueTest, pop_events_bounded_batch_leads_with_priority)
+{
+    // A dispatcher takes its events in bounded batches. A priority event queued while
+    // a batch is dispatched leads the next batch, ahead of the normal events left.
+    EventQueue queue(0u);
+    for (uint32_t i = 1u; i <= 6u; ++ i)
+    {
+        Event normal = makeEvent(i);
+        queue.push_event(normal);
+    }
+
+    Event out[4];
+    EXPECT_EQ(queue.pop_events(out, 4u), 4u);
+    for (uint32_t i = 0u; i < 4u; ++ i)
+    {
+        EXPECT_EQ(out[i].event_id(), i + 1u);
+        out[i].destroy_event();
+    }
+
+    Event high = makeEvent(10u, EventPriority::HighPrio);
+    queue.push_event(high);
+
+    EXPECT_EQ(queue.pop_events(out, 4u), 3u);
+    EXPECT_EQ(out[0].event_id(), 10u);
+    EXPECT_EQ(out[1].event_id(), 5u);
+    EXPECT_EQ(out[2].event_id(), 6u);
+    EXPECT_FALSE(queue.has_pending());
+}
+
+TEST(EventQueueTest, latest_value_lane_replaces_pending_update)
+{
+    // A newer droppable update of the same attribute to the same consumer replaces the
+    // queued one at its position. Other attributes and consumers keep their own updates.
+    EventQueue queue(0u);
+    Event first  = makeEvent(1u);               queue.push_event(first);
+    Event upd10  = makeUpdate(10u, 7u, 5u);     queue.push_event(upd10);
+    Event second = makeEvent(2u);               queue.push_event(second);
+    Event upd11  = makeUpdate(11u, 7u, 5u);     queue.push_event(upd11);
+    Event upd20  = makeUpdate(20u, 8u, 5u);     queue.push_event(upd20);
+    Event upd12  = makeUpdate(12u, 7u, 5u);     queue.push_event(upd12);
+
+    EXPECT_EQ(queue.pop_event().event_id(), 1u);
+    EXPECT_EQ(queue.pop_event().event_id(), 12u);
+    EXPECT_EQ(queue.pop_event().event_id(), 2u);
+    EXPECT_EQ(queue.pop_event().event_id(), 20u);
+    EXPECT_FALSE(queue.has_pending());
+
+    // The dispatched update closed the entry, the next one is queued again.
+    Event upd13  = makeUpdate(13u, 7u, 5u);     queue.push_event(upd13);
+    EXPECT_EQ(queue.pop_event().event_id(), 13u);
+    EXPECT_FALSE(queue.has_pending());
+}
+
+TEST(EventQueueTest, latest_value_lane_keeps_lossless_order_and_full_ring)
+{
+    // A lossless update of the attribute closes the entry: no newer value overtakes it.
+    EventQueue queue(0u);
+    Event upd10    = makeUpdate(10u, 7u, 5u);           queue.push_event(upd10);
+    Event lossless = makeUpdate(30u, 7u, 5u, false);    queue.push_event(lossless);
+    Event upd11    = makeUpdate(11u, 7u, 5u);           queue.push_event(upd11);
+
+    EXPECT_EQ(queue.pop_event().event_id(), 10u);
+    EXPECT_EQ(queue.pop_event().event_id(), 30u);
+    EXPECT_EQ(queue.pop_event().event_id(), 11u);
+    EXPECT_FALSE(queue.has_pending());
+
+    // A full dropping ring still takes the newest value of a pending update.
+    EventQueue full(areg::QUEUE_MIN_RING_CAPACITY, true);
+    Event pending = makeUpdate(40u, 7u, 5u);
+    ASSERT_TRUE(full.push_event(pending));
+    for (uint32_t i = 1u; i < areg::QUEUE_MIN_RING_CAPACITY; ++ i)
+    {
+        Event normal = makeEvent(i);
+        ASSERT_TRUE(full.push_event(normal));
+    }
+
+    Event dropped = makeEvent(100u);
+    EXPECT_FALSE(full.push_event(dropped));
+    Event newest = makeUpdate(41u, 7u, 5u);
+    EXPECT_TRUE(full.push_event(newest));
+    EXPECT_EQ(full.pop_event().event_id(), 41u);
+}
+
 TEST(EventQueueTest, push_events_routes_exit_to_flag)
 {
     // A batch whose highest-priority slot is an exit must set the sticky flag, not queue it.
@@ -220,6 +322,45 @@ TEST(EventQueueTest, remove_all_events_empties_queue)
     EXPECT_FALSE(queue.pop_event().is_valid());
 }
 
+TEST(EventQueueTest, bind_to_node_replaces_empty_ring)
+{
+    constexpr uint32_t CAPACITY{ 32u };
+    EventQueue queue(CAPACITY);
+
+    // Move the cursors off zero, the new ring must continue at them.
+    for (uint32_t i = 0u; i < CAPACITY + 5u; ++i)
+    {
+        Event evt = makeEvent(i);
+        queue.push_event(evt);
+        EXPECT_EQ(queue.pop_event().event_id(), i);
+    }
+
+    Event pending = makeEvent(1000u);
+    queue.push_event(pending);
+    EXPECT_FALSE(queue.bind_to_node(0));    // a queue in use keeps its ring
+    EXPECT_EQ(queue.pop_event().event_id(), 1000u);
+
+    if (queue.bind_to_node(0) == false)
+    {
+        GTEST_SKIP() << "The platform cannot allocate the memory of the NUMA node 0";
+    }
+
+    for (uint32_t i = 0u; i < CAPACITY; ++i)
+    {
+        Event evt = makeEvent(i);
+        queue.push_event(evt);
+    }
+
+    for (uint32_t i = 0u; i < CAPACITY; ++i)
+    {
+        Event out = queue.pop_event();
+        ASSERT_TRUE(out.is_valid());
+        EXPECT_EQ(out.event_id(), i);
+    }
+
+    EXPECT_FALSE(queue.has_pending());
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Doorbell wake-up
 //////////////////////////////////////////////////////////////////////////
@@ -258,6 +399,32 @@ TEST(EventQueueTest, wait_event_wakes_on_exit)
     EXPECT_TRUE(sawExit.load(std::memory_order_acquire));
 }
 
+// A spinning consumer takes an event pushed while it spins, and falls back to the
+// timed park when nothing arrives within the spin time.
+TEST(EventQueueTest, spin_wait_takes_event_or_parks)
+{
+    EventQueue queue(0u);
+    queue.set_spin_time(200'000u);
+    EXPECT_EQ(queue.spin_time(), 200'000u);
+
+    std::atomic<bool> woke{ false };
+    std::thread consumer([&]
+    {
+        woke.store(queue.wait_event(areg::WAIT_INFINITE), std::memory_order_release);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    Event evt = makeEvent(1u);
+    queue.push_event(evt);
+    consumer.join();
+    EXPECT_TRUE(woke.load(std::memory_order_acquire));
+    EXPECT_TRUE(queue.pop_event().is_valid());
+
+    // The spin is bounded by the timeout, then the consumer parks and times out.
+    queue.set_spin_time(1'000u);
+    EXPECT_FALSE(queue.wait_event(5u));
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Multi-threaded stress
 //////////////////////////////////////////////////////////////////////////
@@ -311,6 +478,56 @@ TEST(EventQueueTest, blocking_consumer_no_lost_wakeup)
 }
 
 // Many producers, single consumer: verify every event is delivered exactly once.
+// The same with a consumer that spins briefly before it parks, so that the wake-ups
+// mix events taken while spinning with events that had to ring the doorbell.
+TEST(EventQueueTest, spinning_consumer_no_lost_wakeup)
+{
+    EventQueue queue(0u);
+    queue.set_spin_time(20u);
+    constexpr uint32_t ITERS{ 100000u };
+    std::atomic<uint32_t> consumed{ 0u };
+
+    std::thread consumer([&]
+    {
+        for (;;)
+        {
+            queue.wait_event(areg::WAIT_INFINITE);
+            bool exit = false;
+            for (;;)
+            {
+                Event evt = queue.pop_event();
+                if (!evt.is_valid())
+                    break;
+                if (evt.is_exit_prio())
+                {
+                    exit = true;
+                    break;
+                }
+                consumed.fetch_add(1u, std::memory_order_release);
+            }
+            if (exit)
+                break;
+        }
+    });
+
+    for (uint32_t i = 0u; i < ITERS; ++i)
+    {
+        Event evt = makeEvent(i);
+        queue.push_event(evt);
+        if ((i % 1024u) == 0u)
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while ((consumed.load(std::memory_order_acquire) < ITERS) && (std::chrono::steady_clock::now() < deadline))
+        std::this_thread::yield();
+
+    queue.trigger_exit();
+    consumer.join();
+
+    EXPECT_EQ(consumed.load(std::memory_order_acquire), ITERS);
+}
+
 TEST(EventQueueTest, mpsc_stress_no_event_loss)
 {
     constexpr uint32_t PRODUCERS{ 4u };
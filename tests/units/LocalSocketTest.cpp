@@ -0,0 +1,191 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/LocalSocketTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the local stream sockets.
+ *              Covers: connect, accept and data in both directions, the
+ *              connect failure after the server removed its path, the frames
+ *              served from the read-ahead buffer, and the private directory of
+ *              the path.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SocketDefs.hpp"
+#include "areg/base/MemoryDefs.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#if !defined(_WIN32)
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    //!< The port, which names the local socket of the tests. No TCP socket is opened.
+    constexpr uint16_t TEST_PORT{ 48917u };
+}
+
+/**
+ * \brief   The client connects to the local server, the data written by one side is read by the
+ *          other, and the TCP options are not applied to the local sockets.
+ **/
+TEST(LocalSocketTest, connects_and_transfers)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    const areg::String path{ areg::local_socket_path(TEST_PORT) };
+    const SOCKETHANDLE server{ areg::local_server_connect(path) };
+    ASSERT_TRUE(areg::is_valid_socket(server));
+    ASSERT_TRUE(areg::server_listen(server));
+    EXPECT_TRUE(areg::local_socket_exists(path));
+
+    const SOCKETHANDLE client{ areg::local_socket_create() };
+    ASSERT_TRUE(areg::is_valid_socket(client));
+    ASSERT_TRUE(areg::local_connect_fd(client, path));
+
+    const SOCKETHANDLE accepted{ areg::local_server_accept(server) };
+    ASSERT_TRUE(areg::is_valid_socket(accepted));
+    EXPECT_TRUE(areg::is_local_socket(client));
+    EXPECT_TRUE(areg::is_local_socket(accepted));
+    areg::socket_set_no_delay(accepted);
+
+    const uint8_t ping[]{ 1u, 2u, 3u, 4u, 5u, 6u, 7u };
+    uint8_t received[sizeof(ping)]{ };
+    EXPECT_EQ(areg::send_data(client, ping, sizeof(ping)), static_cast<int32_t>(sizeof(ping)));
+    EXPECT_EQ(areg::receive_data(accepted, received, sizeof(ping)), static_cast<int32_t>(sizeof(ping)));
+    EXPECT_EQ(std::memcmp(received, ping, sizeof(ping)), 0);
+
+    EXPECT_EQ(areg::send_data(accepted, ping, 3u), 3);
+    EXPECT_EQ(areg::receive_data(client, received, 3u), 3);
+    EXPECT_EQ(std::memcmp(received, ping, 3u), 0);
+
+    areg::socket_close(accepted);
+    areg::socket_close(client);
+    areg::socket_close(server);
+    areg::local_socket_remove(path);
+    EXPECT_FALSE(areg::local_socket_exists(path));
+}
+
+/**
+ * \brief   Once the server removed its path, the connect fails, so the client uses TCP.
+ **/
+TEST(LocalSocketTest, fails_without_server)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    const areg::String path{ areg::local_socket_path(TEST_PORT + 1u) };
+    areg::local_socket_remove(path);
+
+    const SOCKETHANDLE client{ areg::local_socket_create() };
+    ASSERT_TRUE(areg::is_valid_socket(client));
+    EXPECT_FALSE(areg::local_connect_fd(client, path));
+    areg::socket_close(client);
+}
+
+/**
+ * \brief   The frames written at once are served one by one from the read-ahead buffer, the
+ *          payload of each frame follows its header, and the frame larger than the buffer is
+ *          left to receive_data().
+ **/
+TEST(LocalSocketTest, serves_frames_from_cache)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    const areg::String path{ areg::local_socket_path(TEST_PORT + 2u) };
+    const SOCKETHANDLE server{ areg::local_server_connect(path) };
+    ASSERT_TRUE(areg::is_valid_socket(server));
+    ASSERT_TRUE(areg::server_listen(server));
+
+    const SOCKETHANDLE client{ areg::local_socket_create() };
+    ASSERT_TRUE(areg::is_valid_socket(client));
+    ASSERT_TRUE(areg::local_connect_fd(client, path));
+    const SOCKETHANDLE accepted{ areg::local_server_accept(server) };
+    ASSERT_TRUE(areg::is_valid_socket(accepted));
+
+    constexpr uint32_t HEADER{ static_cast<uint32_t>(sizeof(areg::EventHeader)) };
+    const uint32_t payloads[]{ 0u, 24u, 300u };
+    std::vector<uint8_t> wire;
+    for (uint32_t used : payloads)
+    {
+        areg::EventHeader header{ };
+        header.bufHeader.biOffset   = HEADER;
+        header.bufHeader.biUsed     = used;
+        header.messageId            = used;
+        const uint8_t * bytes{ reinterpret_cast<const uint8_t *>(&header) };
+        wire.insert(wire.end(), bytes, bytes + HEADER);
+        wire.insert(wire.end(), used, static_cast<uint8_t>(used));
+    }
+
+    ASSERT_EQ(areg::send_data(client, wire.data(), static_cast<uint32_t>(wire.size())), static_cast<int32_t>(wire.size()));
+
+    const uint8_t * frame{ nullptr };
+    EXPECT_EQ(areg::receive_frame(accepted, frame), 0);
+    EXPECT_EQ(frame, nullptr);
+
+    areg::set_receive_mode(areg::ReceiveMode::MultiCache);
+    for (uint32_t used : payloads)
+    {
+        ASSERT_EQ(areg::receive_frame(accepted, frame), static_cast<int32_t>(HEADER + used));
+        ASSERT_NE(frame, nullptr);
+        areg::EventHeader header{ };
+        std::memcpy(&header, frame, sizeof(header));
+        EXPECT_EQ(header.messageId, used);
+        if (used != 0u)
+        {
+            EXPECT_EQ(frame[HEADER + used - 1u], static_cast<uint8_t>(used));
+        }
+
+        areg::receive_frame_done(accepted, HEADER + used);
+    }
+
+    EXPECT_EQ(areg::recv_data_available(accepted), 0u);
+
+    // The frame, which does not fit the buffer, is received by the caller.
+    areg::EventHeader large{ };
+    large.bufHeader.biUsed = areg::thread_cache_size();
+    ASSERT_EQ(areg::send_data(client, reinterpret_cast<const uint8_t *>(&large), HEADER), static_cast<int32_t>(HEADER));
+    EXPECT_EQ(areg::receive_frame(accepted, frame), 0);
+    EXPECT_EQ(frame, nullptr);
+
+    areg::thread_rx_cache_release(accepted);
+    areg::set_receive_mode(areg::ReceiveMode::NoCache);
+    areg::socket_close(accepted);
+    areg::socket_close(client);
+    areg::socket_close(server);
+    areg::local_socket_remove(path);
+}
+
+#if !defined(_WIN32)
+
+/**
+ * \brief   The path is in a directory of the user, which the other users cannot access, so
+ *          nobody else can bind it first.
+ **/
+TEST(LocalSocketTest, path_in_private_dir)
+{
+    const areg::String path{ areg::local_socket_path(TEST_PORT) };
+    ASSERT_FALSE(path.is_empty());
+
+    const std::string dir{ std::filesystem::path(path.as_string()).parent_path().string() };
+    struct stat info;
+    ASSERT_EQ(::lstat(dir.c_str(), &info), 0);
+    EXPECT_TRUE(S_ISDIR(info.st_mode));
+    EXPECT_EQ(info.st_uid, ::geteuid());
+    EXPECT_EQ(info.st_mode & (S_IRWXG | S_IRWXO), 0u);
+}
+
+#endif  // !defined(_WIN32)
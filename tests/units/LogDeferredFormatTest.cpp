@@ -0,0 +1,134 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/LogDeferredFormatTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the log messages formatted on the logging thread.
+ *              Covers: the text of a captured record is the text of vsnprintf(), the
+ *              conversions and the records that cannot be captured.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/logging/LoggingDefs.hpp"
+#include "areg/logging/private/LogDeferredFormat.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <stdarg.h>
+#include <string>
+
+#if AREG_LOGGING
+
+namespace
+{
+    using areg::LogDeferredFormat;
+
+    //!< Captures the arguments in the record, returns the size of the record.
+    uint32_t capture(char * record, uint32_t space, const char * format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        const uint32_t result{ LogDeferredFormat::capture(record, space, format, args) };
+        va_end(args);
+        return result;
+    }
+
+    //!< Formats the arguments both ways and returns the text of the record, or "<none>".
+    std::string round_trip(const char * format, ...)
+    {
+        char record[areg::LOG_MSG_SIZE];
+        char text[areg::LOG_MSG_SIZE];
+
+        va_list args;
+        va_start(args, format);
+        const uint32_t length{ LogDeferredFormat::capture(record, areg::LOG_MSG_SIZE, format, args) };
+        va_end(args);
+
+        if (length == 0u)
+            return std::string("<none>");
+
+        const uint32_t len{ LogDeferredFormat::format(record, length, text, areg::LOG_MSG_SIZE) };
+        EXPECT_EQ(len, static_cast<uint32_t>(std::strlen(text)));
+        return std::string(text, len);
+    }
+
+    //!< The text vsnprintf() makes of the format and the arguments.
+    std::string expected(const char * format, ...)
+    {
+        char text[areg::LOG_MSG_SIZE];
+        va_list args;
+        va_start(args, format);
+        std::vsnprintf(text, areg::LOG_MSG_SIZE, format, args);
+        va_end(args);
+        return std::string(text);
+    }
+}
+
+/**
+ * \brief   The text of a captured record is the text of vsnprintf() for every supported conversion.
+ **/
+TEST(LogDeferredFormatTest, formats_like_vsnprintf)
+{
+    const char * name{ "component" };
+    const void * address{ &name };
+
+    EXPECT_EQ(round_trip("no arguments, 100%% literal"), expected("no arguments, 100%% literal"));
+    EXPECT_EQ(round_trip("%d %i %u %x %X %o %c", -42, 7, 42u, 0xbeefu, 0xcafeu, 8u, 'z'), expected("%d %i %u %x %X %o %c", -42, 7, 42u, 0xbeefu, 0xcafeu, 8u, 'z'));
+    EXPECT_EQ(round_trip("%hd %hhu %ld %lu %lld %llu", static_cast<short>(-3), static_cast<unsigned char>(250), -70000L, 70000UL, -1LL << 40, 1ULL << 63)
+            , expected("%hd %hhu %ld %lu %lld %llu", static_cast<short>(-3), static_cast<unsigned char>(250), -70000L, 70000UL, -1LL << 40, 1ULL << 63));
+    EXPECT_EQ(round_trip("%zu %td %jd", static_cast<size_t>(123456), static_cast<ptrdiff_t>(-5), static_cast<intmax_t>(-9)), expected("%zu %td %jd", static_cast<size_t>(123456), static_cast<ptrdiff_t>(-5), static_cast<intmax_t>(-9)));
+    EXPECT_EQ(round_trip("%f %.3e %g %lf %Lf", 3.25, 12345.678, 0.0001, 2.5, 1.5L), expected("%f %.3e %g %lf %Lf", 3.25, 12345.678, 0.0001, 2.5, 1.5L));
+    EXPECT_EQ(round_trip("[%-12s] [%8.3s] [%s]", name, name, ""), expected("[%-12s] [%8.3s] [%s]", name, name, ""));
+    EXPECT_EQ(round_trip("[%*d] [%-*.*f] [%.*s]", 6, 42, 9, 2, 3.14159, 4, name), expected("[%*d] [%-*.*f] [%.*s]", 6, 42, 9, 2, 3.14159, 4, name));
+    EXPECT_EQ(round_trip("%+05d %#x % d %p", 17, 255u, 3, address), expected("%+05d %#x % d %p", 17, 255u, 3, address));
+}
+
+/**
+ * \brief   The conversions that cannot be captured and the records that do not fit fail the
+ *          capture, so that the caller formats the message itself.
+ **/
+TEST(LogDeferredFormatTest, rejects_what_cannot_be_deferred)
+{
+    char record[areg::LOG_MSG_SIZE];
+    int written{ 0 };
+
+    EXPECT_EQ(capture(record, areg::LOG_MSG_SIZE, "%ls", L"wide"), 0u);
+    EXPECT_EQ(capture(record, areg::LOG_MSG_SIZE, "count%n", &written), 0u);
+    EXPECT_EQ(capture(record, areg::LOG_MSG_SIZE, "%hf", 1.0), 0u);
+    EXPECT_EQ(capture(record, areg::LOG_MSG_SIZE, "dangling %"), 0u);
+
+    const std::string longText(areg::LOG_MSG_SIZE, 'x');
+    EXPECT_EQ(capture(record, areg::LOG_MSG_SIZE, "%s", longText.c_str()), 0u);
+    EXPECT_EQ(capture(record, 8u, "%d", 1), 0u);
+    EXPECT_NE(capture(record, areg::LOG_MSG_SIZE, "%d", 1), 0u);
+}
+
+/**
+ * \brief   The text is truncated to the buffer and always null-terminated.
+ **/
+TEST(LogDeferredFormatTest, truncates_text_to_buffer)
+{
+    char record[areg::LOG_MSG_SIZE];
+    char text[16];
+
+    const uint32_t length{ capture(record, areg::LOG_MSG_SIZE, "value %d and name %s", 123456, "a long name") };
+    ASSERT_NE(length, 0u);
+    EXPECT_EQ(LogDeferredFormat::format(record, length, text, sizeof(text)), static_cast<uint32_t>(sizeof(text) - 1u));
+    EXPECT_STREQ(text, "value 123456 an");
+
+    // A cut record formats what it can and stays null-terminated.
+    const uint32_t len{ LogDeferredFormat::format(record, length / 2u, text, sizeof(text)) };
+    EXPECT_EQ(len, static_cast<uint32_t>(std::strlen(text)));
+}
+
+#endif  // AREG_LOGGING
@@ -0,0 +1,258 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/LogFileBufferTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the staging buffer of the file logger.
+ *              Covers: the write when the buffer is full, the write after the latency,
+ *              the write of a fatal message, the gather write of a large piece, the
+ *              direct write without a buffer and the gather write of the file.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/base/File.hpp"
+#include "areg/base/SocketDefs.hpp"
+#include "areg/logging/private/LogFileBuffer.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#if AREG_LOGGING
+
+namespace
+{
+    //!< The capacity of the buffer in the tests.
+    constexpr uint32_t  CAPACITY    { 64u };
+
+    //!< Returns the file the running test writes, the tests may run in parallel processes.
+    areg::String _test_file()
+    {
+        return areg::String("./log_file_buffer_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".log";
+    }
+
+    //!< Opens the empty test file for writing.
+    bool _open_file(areg::File & file)
+    {
+        areg::Application::set_working_directory(nullptr);
+        constexpr uint32_t mode{  static_cast<uint32_t>(areg::File::OpenMode::Write)
+                                | static_cast<uint32_t>(areg::File::OpenMode::Binary)
+                                | static_cast<uint32_t>(areg::File::OpenMode::Create) };
+        return file.open(_test_file(), mode);
+    }
+
+    //!< Returns the content of the test file, as the other readers see it.
+    std::vector<uint8_t> _read_file()
+    {
+        std::ifstream stream(_test_file().as_string(), std::ios::in | std::ios::binary);
+        return std::vector<uint8_t>{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+    }
+
+    //!< Returns a piece of the given size filled with the given value.
+    std::vector<uint8_t> _make_piece(uint32_t size, uint8_t value)
+    {
+        return std::vector<uint8_t>(size, value);
+    }
+}
+
+/**
+ * \brief   The pieces are staged until the next one does not fit, then the staged data is
+ *          written at once and the piece starts the new batch.
+ **/
+TEST(LogFileBufferTest, writes_when_full)
+{
+    areg::File file;
+    ASSERT_TRUE(_open_file(file));
+    {
+        areg::LogFileBuffer buffer(file);
+        buffer.initialize(CAPACITY, 60000u);
+        ASSERT_TRUE(buffer.is_buffered());
+
+        const std::vector<uint8_t> piece{ _make_piece(24u, 0x11u) };
+        EXPECT_EQ(buffer.write(piece.data(), 24u), 24u);
+        EXPECT_EQ(buffer.write(piece.data(), 24u), 24u);
+        EXPECT_EQ(buffer.size_staged(), 48u);
+        EXPECT_TRUE(_read_file().empty());
+
+        // 48 + 24 is more than the capacity, the first two pieces are written.
+        EXPECT_EQ(buffer.write(piece.data(), 24u), 24u);
+        EXPECT_EQ(buffer.size_staged(), 24u);
+        EXPECT_EQ(_read_file().size(), 48u);
+        EXPECT_EQ(buffer.size_written(), 72u);
+
+        buffer.release();
+        EXPECT_EQ(_read_file(), _make_piece(72u, 0x11u));
+    }
+
+    file.close();
+    areg::File::delete_file(_test_file());
+}
+
+/**
+ * \brief   The staged data is kept until it is older than the latency, then the end of the
+ *          next message writes it.
+ **/
+TEST(LogFileBufferTest, writes_after_latency)
+{
+    constexpr uint32_t LATENCY_MS{ 200u };
+
+    areg::File file;
+    ASSERT_TRUE(_open_file(file));
+    {
+        areg::LogFileBuffer buffer(file);
+        buffer.initialize(CAPACITY, LATENCY_MS);
+
+        const std::vector<uint8_t> piece{ _make_piece(10u, 0x22u) };
+        EXPECT_EQ(buffer.write(piece.data(), 10u), 10u);
+        buffer.end_message(false);
+        EXPECT_FALSE(buffer.is_flush_due());
+        EXPECT_EQ(buffer.size_staged(), 10u);
+        EXPECT_TRUE(_read_file().empty());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(LATENCY_MS + 50u));
+        EXPECT_TRUE(buffer.is_flush_due());
+        buffer.end_message(false);
+        EXPECT_EQ(buffer.size_staged(), 0u);
+        EXPECT_FALSE(buffer.is_flush_due());
+        EXPECT_EQ(_read_file(), piece);
+    }
+
+    file.close();
+    areg::File::delete_file(_test_file());
+}
+
+/**
+ * \brief   A fatal message is written to the file at once, whatever the latency is.
+ **/
+TEST(LogFileBufferTest, writes_fatal_message)
+{
+    areg::File file;
+    ASSERT_TRUE(_open_file(file));
+    {
+        areg::LogFileBuffer buffer(file);
+        buffer.initialize(CAPACITY, 60000u);
+
+        const std::vector<uint8_t> piece{ _make_piece(16u, 0x33u) };
+        EXPECT_EQ(buffer.write(piece.data(), 16u), 16u);
+        EXPECT_EQ(buffer.size_staged(), 16u);
+
+        buffer.end_message(true);
+        EXPECT_EQ(buffer.size_staged(), 0u);
+        EXPECT_EQ(_read_file(), piece);
+    }
+
+    file.close();
+    areg::File::delete_file(_test_file());
+}
+
+/**
+ * \brief   A piece, which is at least half of the capacity and does not fit, is not staged:
+ *          it is written after the staged data with one gather write, in order.
+ **/
+TEST(LogFileBufferTest, gathers_large_piece)
+{
+    areg::File file;
+    ASSERT_TRUE(_open_file(file));
+    {
+        areg::LogFileBuffer buffer(file);
+        buffer.initialize(CAPACITY, 60000u);
+
+        const std::vector<uint8_t> small{ _make_piece(40u, 0x44u) };
+        const std::vector<uint8_t> large{ _make_piece(CAPACITY / 2u, 0x55u) };
+        EXPECT_EQ(buffer.write(small.data(), 40u), 40u);
+        EXPECT_EQ(buffer.write(large.data(), CAPACITY / 2u), CAPACITY / 2u);
+        EXPECT_EQ(buffer.size_staged(), 0u);
+
+        std::vector<uint8_t> expected{ small };
+        expected.insert(expected.end(), large.begin(), large.end());
+        EXPECT_EQ(_read_file(), expected);
+
+        // Nothing staged: the piece larger than the buffer is written alone.
+        const std::vector<uint8_t> huge{ _make_piece(3u * CAPACITY, 0x66u) };
+        EXPECT_EQ(buffer.write(huge.data(), 3u * CAPACITY), 3u * CAPACITY);
+        EXPECT_EQ(buffer.size_staged(), 0u);
+        expected.insert(expected.end(), huge.begin(), huge.end());
+        EXPECT_EQ(_read_file(), expected);
+        EXPECT_EQ(buffer.size_written(), static_cast<uint64_t>(expected.size()));
+    }
+
+    file.close();
+    areg::File::delete_file(_test_file());
+}
+
+/**
+ * \brief   With zero capacity nothing is staged, every piece is written to the file directly.
+ **/
+TEST(LogFileBufferTest, writes_directly_without_buffer)
+{
+    areg::File file;
+    ASSERT_TRUE(_open_file(file));
+    {
+        areg::LogFileBuffer buffer(file);
+        buffer.initialize(0u, 60000u);
+        EXPECT_FALSE(buffer.is_buffered());
+
+        const std::vector<uint8_t> piece{ _make_piece(5u, 0x77u) };
+        EXPECT_EQ(buffer.write(piece.data(), 5u), 5u);
+        EXPECT_EQ(buffer.size_staged(), 0u);
+        EXPECT_EQ(_read_file().size(), 5u);
+
+        EXPECT_EQ(buffer.write(piece.data(), 5u), 5u);
+        EXPECT_EQ(_read_file(), _make_piece(10u, 0x77u));
+        EXPECT_EQ(buffer.size_written(), 10u);
+        EXPECT_FALSE(buffer.is_flush_due());
+    }
+
+    file.close();
+    areg::File::delete_file(_test_file());
+}
+
+/**
+ * \brief   The gather write of the file writes all buffers in order, also when there are
+ *          more of them than one system call takes.
+ **/
+TEST(LogFileBufferTest, file_write_gather)
+{
+    constexpr uint32_t COUNT{ 150u };
+
+    areg::File file;
+    ASSERT_TRUE(_open_file(file));
+
+    std::vector<uint8_t> expected;
+    std::vector<std::vector<uint8_t>> pieces;
+    std::vector<areg::IoBuffer> list;
+    pieces.reserve(COUNT);
+    for (uint32_t i = 0u; i < COUNT; ++ i)
+    {
+        pieces.push_back(_make_piece(1u + (i % 7u), static_cast<uint8_t>(i)));
+        expected.insert(expected.end(), pieces.back().begin(), pieces.back().end());
+    }
+
+    for (const std::vector<uint8_t> & piece : pieces)
+    {
+        list.push_back(areg::IoBuffer{ piece.data(), piece.size() });
+    }
+
+    EXPECT_EQ(file.write_gather(list.data(), COUNT), static_cast<uint32_t>(expected.size()));
+    EXPECT_EQ(_read_file(), expected);
+    EXPECT_EQ(file.write_gather(nullptr, 0u), 0u);
+
+    file.close();
+    EXPECT_EQ(file.write_gather(list.data(), COUNT), 0u);
+    areg::File::delete_file(_test_file());
+}
+
+#endif  // AREG_LOGGING
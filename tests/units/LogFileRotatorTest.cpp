@@ -0,0 +1,224 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/LogFileRotatorTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the rotation of the log file.
+ *              Covers: the rotation by size, the rotation by time and the retention of
+ *              the segments, including the segments of the earlier runs.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/base/File.hpp"
+#include "areg/logging/private/LogFileRotator.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#if AREG_LOGGING
+
+namespace
+{
+    //!< The longest time to wait for the rotator thread.
+    constexpr std::chrono::milliseconds WAIT_TIMEOUT{ 2000 };
+
+    //!< Creates the empty directory of the running test, the tests may run in parallel processes.
+    areg::String _test_dir()
+    {
+        areg::Application::set_working_directory(nullptr);
+        const areg::String dir{ areg::String("./log_rotator_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() };
+        areg::File::delete_dir(dir);
+        areg::File::create_dir(dir);
+        return dir;
+    }
+
+    //!< Opens the log file like the file logger does.
+    bool _open_log(areg::File & file, const areg::String & path)
+    {
+        constexpr uint32_t mode{  static_cast<uint32_t>(areg::File::OpenMode::Write)
+                                | static_cast<uint32_t>(areg::File::OpenMode::Read)
+                                | static_cast<uint32_t>(areg::File::OpenMode::ShareRead)
+                                | static_cast<uint32_t>(areg::File::OpenMode::ShareWrite)
+                                | static_cast<uint32_t>(areg::File::OpenMode::Text)
+                                | static_cast<uint32_t>(areg::File::OpenMode::Create) };
+        return file.open(path, mode);
+    }
+
+    //!< Writes the text to the file.
+    void _write(areg::File & file, const std::string & text)
+    {
+        file.write(reinterpret_cast<const uint8_t *>(text.data()), static_cast<uint32_t>(text.size()));
+    }
+
+    //!< Creates the file with the text, like a segment of an earlier run.
+    void _make_file(const areg::String & path, const std::string & text)
+    {
+        std::ofstream stream(path.as_string(), std::ios::out | std::ios::binary);
+        stream << text;
+    }
+
+    //!< Returns the content of the file.
+    std::string _read_file(const areg::String & path)
+    {
+        std::ifstream stream(path.as_string(), std::ios::in | std::ios::binary);
+        return std::string{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+    }
+
+    //!< Waits until the rotator has the next file open.
+    bool _wait_next(const areg::LogFileRotator & rotator)
+    {
+        const auto deadline{ std::chrono::steady_clock::now() + WAIT_TIMEOUT };
+        while (rotator.is_next_ready() == false)
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+                return false;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+}
+
+/**
+ * \brief   The log file is rotated when it reaches the size: the logging continues in the next
+ *          file, which gets the name of the log file, and the finished file becomes a segment.
+ **/
+TEST(LogFileRotatorTest, rotates_by_size)
+{
+    const areg::String dir{ _test_dir() };
+    const areg::String logPath{ dir + "/app.log" };
+
+    areg::File files[2];
+    ASSERT_TRUE(_open_log(files[0], logPath));
+    {
+        areg::LogFileRotator rotator;
+        ASSERT_TRUE(rotator.start(logPath, files[1], 100u, std::chrono::milliseconds(0), 0u));
+        ASSERT_TRUE(_wait_next(rotator));
+        EXPECT_TRUE(areg::File::has_file(dir + "/app.next.log"));
+
+        _write(files[0], std::string(120u, 'a'));
+        EXPECT_FALSE(rotator.is_rotation_due(99u));
+        EXPECT_TRUE(rotator.is_rotation_due(120u));
+
+        areg::File & next{ rotator.exchange(files[0]) };
+        EXPECT_EQ(&next, &files[1]);
+        // The size is of the new file now, the rotator may open the next one at any time.
+        EXPECT_FALSE(rotator.is_rotation_due(0u));
+        _write(next, "second");
+
+        ASSERT_TRUE(_wait_next(rotator));
+        EXPECT_EQ(_read_file(dir + "/app.1.log"), std::string(120u, 'a'));
+        EXPECT_EQ(_read_file(logPath), "second");
+        EXPECT_TRUE(files[0].is_opened());
+
+        // The second rotation goes the other way round.
+        areg::File & third{ rotator.exchange(next) };
+        EXPECT_EQ(&third, &files[0]);
+        _write(third, "third");
+        ASSERT_TRUE(_wait_next(rotator));
+        EXPECT_EQ(_read_file(dir + "/app.2.log"), "second");
+        EXPECT_EQ(_read_file(logPath), "third");
+
+        rotator.stop();
+        EXPECT_FALSE(areg::File::has_file(dir + "/app.next.log"));
+        third.close();
+    }
+
+    areg::File::delete_dir(dir);
+}
+
+/**
+ * \brief   The log file is rotated when the interval is over, the interval starts again at
+ *          every rotation.
+ **/
+TEST(LogFileRotatorTest, rotates_by_interval)
+{
+    constexpr std::chrono::milliseconds INTERVAL{ 300 };
+
+    const areg::String dir{ _test_dir() };
+    const areg::String logPath{ dir + "/app.log" };
+
+    areg::File files[2];
+    ASSERT_TRUE(_open_log(files[0], logPath));
+    {
+        areg::LogFileRotator rotator;
+        ASSERT_TRUE(rotator.start(logPath, files[1], 0u, INTERVAL, 0u));
+        ASSERT_TRUE(_wait_next(rotator));
+        EXPECT_FALSE(rotator.is_rotation_due(1000000u));
+
+        _write(files[0], "first");
+        std::this_thread::sleep_for(INTERVAL + std::chrono::milliseconds(50));
+        EXPECT_TRUE(rotator.is_rotation_due(0u));
+
+        areg::File & next{ rotator.exchange(files[0]) };
+        ASSERT_TRUE(_wait_next(rotator));
+        EXPECT_FALSE(rotator.is_rotation_due(0u));
+        EXPECT_EQ(_read_file(dir + "/app.1.log"), "first");
+
+        rotator.stop();
+        next.close();
+    }
+
+    areg::File::delete_dir(dir);
+}
+
+/**
+ * \brief   The segments of the earlier runs are counted as the oldest ones: the numbering
+ *          continues after them and the oldest segments above the retention count are deleted.
+ *          The other files of the directory are not touched.
+ **/
+TEST(LogFileRotatorTest, retains_segments)
+{
+    const areg::String dir{ _test_dir() };
+    const areg::String logPath{ dir + "/app.log" };
+    _make_file(dir + "/app.1.log", "run1");
+    _make_file(dir + "/app.2.log", "run2");
+    _make_file(dir + "/app.10.log", "run10");
+    _make_file(dir + "/app.old.log", "other");
+    _make_file(dir + "/app.3.log.gz", "handled");
+
+    areg::File files[2];
+    ASSERT_TRUE(_open_log(files[0], logPath));
+    {
+        areg::LogFileRotator rotator;
+        ASSERT_TRUE(rotator.start(logPath, files[1], 10u, std::chrono::milliseconds(0), 2u));
+        ASSERT_TRUE(_wait_next(rotator));
+
+        // Three segments found, the retention keeps two of them.
+        EXPECT_FALSE(areg::File::has_file(dir + "/app.1.log"));
+        EXPECT_TRUE(areg::File::has_file(dir + "/app.2.log"));
+        EXPECT_TRUE(areg::File::has_file(dir + "/app.10.log"));
+
+        _write(files[0], "current");
+        areg::File & next{ rotator.exchange(files[0]) };
+        ASSERT_TRUE(_wait_next(rotator));
+
+        EXPECT_EQ(_read_file(dir + "/app.11.log"), "current");
+        EXPECT_FALSE(areg::File::has_file(dir + "/app.2.log"));
+        EXPECT_TRUE(areg::File::has_file(dir + "/app.10.log"));
+        EXPECT_TRUE(areg::File::has_file(dir + "/app.old.log"));
+        EXPECT_TRUE(areg::File::has_file(dir + "/app.3.log.gz"));
+
+        rotator.stop();
+        next.close();
+    }
+
+    areg::File::delete_dir(dir);
+}
+
+#endif  // AREG_LOGGING
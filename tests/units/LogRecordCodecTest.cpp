@@ -0,0 +1,218 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/LogRecordCodecTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the compact log records sent to the log collector.
+ *              Covers: a decoded record is the encoded plain record, the names are sent once
+ *              per connection, the malformed records are rejected, the offer of the format
+ *              with the scope registration, and the size of the records on the wire.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/ServiceDefs.hpp"
+#include "areg/logging/LoggingDefs.hpp"
+#include "areg/logging/private/LogRecordCodec.hpp"
+
+#include <cstring>
+#include <string>
+
+#if AREG_LOGGING
+
+namespace
+{
+    using areg::LogRecordDecoder;
+    using areg::LogRecordEncoder;
+
+    //!< The cookie of the connection of the log source.
+    constexpr ITEM_ID   COOKIE      { 257u };
+
+    //!< Makes a plain log record like the log source sends.
+    areg::LogEntry make_entry(TIME64 stamp, ITEM_ID threadId, const char * thread, const char * text)
+    {
+        areg::LogEntry result(areg::LogMessageType::MessageText);
+        result.logTimestamp     = stamp;
+        result.logScopeId       = 0x9E3779B9u;
+        result.logMessagePrio   = areg::LogPriority::PrioDebug;
+        result.logDataType      = areg::LogDataType::Remote;
+        result.logDuration      = 12u;
+        result.logSessionId     = 3u;
+        result.logModuleId      = 4242u;
+        result.logThreadId      = threadId;
+        result.logSource        = areg::COOKIE_LOCAL;
+        result.logTarget        = areg::COOKIE_LOGGER;
+        result.logCookie        = COOKIE;
+        result.logMessageLen    = static_cast<uint32_t>(std::strlen(text));
+        result.logThreadLen     = static_cast<uint32_t>(std::strlen(thread));
+        result.logModuleLen     = static_cast<uint32_t>(std::strlen("test_module"));
+        std::memcpy(result.logMessage, text, result.logMessageLen + 1u);
+        std::memcpy(result.logThread, thread, result.logThreadLen + 1u);
+        std::memcpy(result.logModule, "test_module", result.logModuleLen + 1u);
+        return result;
+    }
+
+    //!< Compares the fields of the decoded plain record with the encoded one.
+    void expect_same(const areg::MessageEnvelope & msgPlain, const areg::LogEntry & expected)
+    {
+        ASSERT_TRUE(msgPlain.is_valid());
+        ASSERT_EQ(msgPlain.message_id(), static_cast<uint32_t>(areg::FuncIdRange::ServiceLogMessage));
+        ASSERT_EQ(msgPlain.size_used(), static_cast<uint32_t>(sizeof(areg::LogEntry)));
+        EXPECT_EQ(msgPlain.source(), static_cast<uint32_t>(COOKIE));
+
+        const areg::LogEntry & log{ *reinterpret_cast<const areg::LogEntry *>(msgPlain.buffer()) };
+        EXPECT_EQ(log.logTimestamp, expected.logTimestamp);
+        EXPECT_EQ(log.logReceived, expected.logReceived);
+        EXPECT_EQ(log.logScopeId, expected.logScopeId);
+        EXPECT_EQ(log.logMessagePrio, expected.logMessagePrio);
+        EXPECT_EQ(log.logMsgType, expected.logMsgType);
+        EXPECT_EQ(log.logDataType, areg::LogDataType::Remote);
+        EXPECT_EQ(log.logDuration, expected.logDuration);
+        EXPECT_EQ(log.logSessionId, expected.logSessionId);
+        EXPECT_EQ(log.logModuleId, expected.logModuleId);
+        EXPECT_EQ(log.logThreadId, expected.logThreadId);
+        EXPECT_EQ(log.logSource, expected.logSource);
+        EXPECT_EQ(log.logTarget, expected.logTarget);
+        EXPECT_EQ(log.logCookie, COOKIE);
+        EXPECT_EQ(log.logMessageLen, expected.logMessageLen);
+        EXPECT_EQ(log.logThreadLen, expected.logThreadLen);
+        EXPECT_EQ(log.logModuleLen, expected.logModuleLen);
+        EXPECT_STREQ(log.logMessage, expected.logMessage);
+        EXPECT_STREQ(log.logThread, expected.logThread);
+        EXPECT_STREQ(log.logModule, expected.logModule);
+    }
+}
+
+/**
+ * \brief   A decoded record is the encoded plain record, for new and known names, for a thread ID
+ *          reused with another name and for timestamps going back.
+ **/
+TEST(LogRecordCodecTest, decodes_the_encoded_record)
+{
+    LogRecordEncoder encoder;
+    LogRecordDecoder decoder;
+
+    const areg::LogEntry entries[]
+    {
+          make_entry(1'700'000'000'000'000u, 11u, "main_thread", "first message")
+        , make_entry(1'700'000'000'000'150u, 12u, "worker_thread", "")
+        , make_entry(1'700'000'000'000'300u, 11u, "main_thread", "the same thread again")
+        , make_entry(1'700'000'000'000'200u, 12u, "worker_thread", "the timestamp goes back")
+        , make_entry(1'700'000'000'900'000u, 11u, "renamed_thread", "the thread ID is reused")
+        , make_entry(1'700'000'000'900'001u, 11u, "renamed_thread", std::string(areg::LOG_MSG_SIZE - 1u, 'x').c_str())
+    };
+
+    for (const areg::LogEntry & entry : entries)
+    {
+        const areg::MessageEnvelope msgCompact{ encoder.encode(entry, COOKIE) };
+        ASSERT_TRUE(msgCompact.is_valid());
+        EXPECT_EQ(msgCompact.message_id(), static_cast<uint32_t>(areg::FuncIdRange::ServiceLogCompactMessage));
+        expect_same(decoder.decode(msgCompact), entry);
+    }
+
+    // A new connection starts with no names on both sides.
+    encoder.reset();
+    decoder.reset();
+    expect_same(decoder.decode(encoder.encode(entries[2], COOKIE)), entries[2]);
+}
+
+/**
+ * \brief   The names are sent with the first record of the thread, later records refer to them.
+ **/
+TEST(LogRecordCodecTest, sends_names_once_per_connection)
+{
+    LogRecordEncoder encoder;
+    const areg::LogEntry entry{ make_entry(1'700'000'000'000'000u, 11u, "main_thread", "text") };
+    const areg::LogEntry other{ make_entry(1'700'000'000'000'000u, 12u, "other_thread", "text") };
+
+    const uint32_t first{ encoder.encode(entry, COOKIE).size_used() };
+    const uint32_t newThread{ encoder.encode(other, COOKIE).size_used() };
+    const uint32_t knownThread{ encoder.encode(other, COOKIE).size_used() };
+    EXPECT_GT(first, newThread);
+    // The new name is the reference 0, the ID and the length of one byte each and the characters.
+    EXPECT_EQ(newThread - knownThread, static_cast<uint32_t>(std::strlen("other_thread") + 2u));
+
+    // A decoder that missed the names cannot decode the reference.
+    LogRecordDecoder decoder;
+    EXPECT_FALSE(decoder.decode(encoder.encode(entry, COOKIE)).is_valid());
+}
+
+/**
+ * \brief   The truncated and the empty records are rejected.
+ **/
+TEST(LogRecordCodecTest, rejects_malformed_records)
+{
+    LogRecordEncoder encoder;
+    const areg::MessageEnvelope msgCompact{ encoder.encode(make_entry(1'700'000'000'000'000u, 11u, "main_thread", "some text"), COOKIE) };
+    const uint32_t size{ msgCompact.size_used() };
+
+    for (uint32_t cut = 0u; cut < size; ++ cut)
+    {
+        areg::MessageEnvelope msgCut{ msgCompact.clone() };
+        msgCut.set_size_used(cut);
+        LogRecordDecoder decoder;
+        EXPECT_FALSE(decoder.decode(msgCut).is_valid()) << "record cut to " << cut << " of " << size << " bytes";
+    }
+}
+
+/**
+ * \brief   The log collector finds the offer after the scopes of the registration, and no offer
+ *          in the registration of an old log source.
+ **/
+TEST(LogRecordCodecTest, finds_the_offer_after_the_scopes)
+{
+    areg::MessageEnvelope msgEmpty{ areg::message_register_scopes(COOKIE, areg::COOKIE_LOGGER, areg::ScopeList()) };
+    EXPECT_FALSE(LogRecordDecoder::is_format_offered(msgEmpty));
+    LogRecordEncoder::offer_format(msgEmpty);
+    EXPECT_TRUE(LogRecordDecoder::is_format_offered(msgEmpty));
+
+    // The scope update has the layout of the registration.
+    areg::ScopeNames scopes;
+    scopes.add(areg::ScopeEntry("areg_component_first", 1u, static_cast<uint32_t>(areg::LogPriority::PrioDebug)));
+    scopes.add(areg::ScopeEntry("areg_component_second", 2u, static_cast<uint32_t>(areg::LogPriority::PrioInfo)));
+    areg::MessageEnvelope msgScopes{ areg::message_update_scopes(COOKIE, areg::COOKIE_LOGGER, scopes) };
+    EXPECT_FALSE(LogRecordDecoder::is_format_offered(msgScopes));
+    LogRecordEncoder::offer_format(msgScopes);
+    EXPECT_TRUE(LogRecordDecoder::is_format_offered(msgScopes));
+
+    // The scopes are read as before.
+    uint32_t count{ 0u };
+    areg::ScopeEntry scope;
+    msgScopes.move_to_begin();
+    msgScopes >> count >> scope;
+    EXPECT_EQ(count, 2u);
+    EXPECT_STREQ(scope.scopeName.as_string(), "areg_component_first");
+}
+
+/**
+ * \brief   A typical compact record on the wire is smaller than the plain record and adds
+ *          little to the text of the message.
+ **/
+TEST(LogRecordCodecTest, compact_smaller_than_plain)
+{
+    LogRecordEncoder encoder;
+    const char * text{ "Proxy [ TestProxy::ThreadOne::Role ] of service [ LargeDataService ] got response [ 1234 ]" };
+
+    uint32_t compact{ 0u };
+    constexpr uint32_t COUNT{ 1'000u };
+    for (uint32_t i = 0u; i < COUNT; ++ i)
+    {
+        const areg::LogEntry entry{ make_entry(1'700'000'000'000'000u + i * 37u, 11u + (i % 4u), "component_thread", text) };
+        compact += encoder.encode(entry, COOKIE).size_used();
+    }
+
+    const double average{ static_cast<double>(compact) / COUNT };
+    EXPECT_LT(average, static_cast<double>(sizeof(areg::LogEntry)));
+    EXPECT_LT(average, static_cast<double>(std::strlen(text) + 32u));
+}
+
+#endif  // AREG_LOGGING
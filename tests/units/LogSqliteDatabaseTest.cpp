@@ -0,0 +1,365 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/LogSqliteDatabaseTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for reading the log database in pages.
+ *              Covers: the pages after and before the cursor visit every log once in the
+ *              order of time, the pages of one instance, the time windows, the time
+ *              index added to a database created without it, the thread and module names
+ *              saved once in the dictionaries, and the migration of the older databases.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "aregextend/db/LogSqliteDatabase.hpp"
+#include "aregextend/db/SqliteDatabase.hpp"
+
+#include "areg/base/File.hpp"
+#include "areg/base/Process.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Use these options if compile for Windows with MSVC
+#ifdef _MSC_VER
+#if defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+    #pragma comment(lib, "sqlite3")
+#else   // defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+    #pragma comment(lib, "aregsqlite3")
+#endif  // defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+#endif // _MSC_VER
+
+namespace
+{
+    using areg::ext::LogSqliteDatabase;
+
+    //!< The number of logs written to the test database.
+    constexpr uint32_t  LOG_COUNT   { 600u };
+
+    //!< The number of logs written with the same creation time.
+    constexpr uint32_t  SAME_TIME   { 3u };
+
+    //!< The creation time of the first test log, 2100-01-01 in microseconds: later than the
+    //!< log written when the database is created, however late the test runs.
+    constexpr TIME64    BASE_TIME   { 4'102'444'800'000'000u };
+
+    //!< The number of the threads writing the test logs.
+    constexpr uint32_t  THREAD_COUNT{ 4u };
+
+    //!< Returns the unique path of the test database in the temporary folder.
+    areg::String database_path(const char * test)
+    {
+        char name[128];
+        std::snprintf(name, sizeof(name), "/areg_%s_test_%u.sqlog", test, static_cast<uint32_t>(areg::Process::instance().id()));
+        return (areg::File::temp_dir() + name);
+    }
+
+    //!< Writes the test logs: two instances, THREAD_COUNT threads, and SAME_TIME logs created at the same time.
+    void write_logs(LogSqliteDatabase & database)
+    {
+        database.begin();
+        for (uint32_t i = 0u; i < LOG_COUNT; ++ i)
+        {
+            areg::LogEntry log(areg::LogMessageType::MessageText);
+            log.logCookie       = 1u + (i % 2u);
+            log.logTimestamp    = BASE_TIME + i / SAME_TIME;
+            log.logReceived     = log.logTimestamp;
+            log.logMessagePrio  = areg::LogPriority::PrioDebug;
+            log.logMessageLen   = static_cast<uint32_t>(std::snprintf(log.logMessage, areg::LOG_MSG_SIZE, "log %u", i));
+            log.logThreadId     = 100u + (i % THREAD_COUNT);
+            log.logThreadLen    = static_cast<uint32_t>(std::snprintf(log.logThread, areg::LOG_NAME_SIZE, "test_thread_%u", i % THREAD_COUNT));
+            log.logModuleId     = 7u;
+            log.logModuleLen    = static_cast<uint32_t>(std::snprintf(log.logModule, areg::LOG_NAME_SIZE, "test_module"));
+            ASSERT_TRUE(database.log_message(log));
+        }
+
+        database.commit(true);
+    }
+
+    //!< Returns the number of the test log, or -1 for other logs.
+    int32_t log_number(const areg::SharedBuffer & buf)
+    {
+        const areg::LogEntry & log{ *reinterpret_cast<const areg::LogEntry *>(buf.buffer()) };
+        uint32_t number{ 0u };
+        return (std::sscanf(log.logMessage, "log %u", &number) == 1 ? static_cast<int32_t>(number) : -1);
+    }
+
+    //!< Returns true if the index exists in the database.
+    bool index_exists(LogSqliteDatabase & database, const char * index)
+    {
+        areg::ext::SqliteStatement stmt(database.database(), "SELECT name FROM sqlite_master WHERE type = 'index' AND name = ?;");
+        stmt.bind_text(0, index);
+        return (stmt.next() == areg::ext::SqliteStatement::QueryResult::HasMore);
+    }
+
+    //!< Returns the result of the query of a single number.
+    uint32_t query_number(LogSqliteDatabase & database, const char * sql)
+    {
+        areg::ext::SqliteStatement stmt(database.database(), sql);
+        return (stmt.next() == areg::ext::SqliteStatement::QueryResult::HasMore ? stmt.as_uint32(0) : 0u);
+    }
+
+    /**
+     * \brief   Creates the test database with the test logs and removes it at the end of the test.
+     **/
+    class LogSqliteDatabaseTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            mPath = database_path("keyset");
+            areg::File::delete_file(mPath);
+            ASSERT_TRUE(mDatabase.connect(mPath, false));
+            write_logs(mDatabase);
+        }
+
+        void TearDown() override
+        {
+            mDatabase.disconnect();
+            areg::File::delete_file(mPath);
+        }
+
+        LogSqliteDatabase   mDatabase;
+        areg::String        mPath;
+    };
+}
+
+/**
+ * \brief   The pages after the cursor visit every log once, ordered by the creation time and
+ *          by the order of writing for the logs created at the same time.
+ **/
+TEST_F(LogSqliteDatabaseTest, pages_after_cursor_visit_every_log)
+{
+    std::vector<int32_t> numbers;
+    std::vector<areg::SharedBuffer> page;
+    LogSqliteDatabase::LogCursor cursor{ };
+    while (mDatabase.log_messages_after(page, cursor, areg::TARGET_ALL, 64u) != 0u)
+    {
+        for (const areg::SharedBuffer & buf : page)
+        {
+            numbers.push_back(log_number(buf));
+        }
+    }
+
+    // The log written when the database is created, then the test logs in order.
+    ASSERT_EQ(static_cast<uint32_t>(numbers.size()), mDatabase.count_log_entries());
+    EXPECT_EQ(numbers[0], -1);
+    for (uint32_t i = 0u; i < LOG_COUNT; ++ i)
+    {
+        ASSERT_EQ(numbers[i + 1u], static_cast<int32_t>(i));
+    }
+
+    EXPECT_EQ(cursor.lcTimestamp, BASE_TIME + (LOG_COUNT - 1u) / SAME_TIME);
+}
+
+/**
+ * \brief   The pages before the cursor visit the logs backwards, each page in the order of time.
+ **/
+TEST_F(LogSqliteDatabaseTest, pages_before_cursor_visit_every_log)
+{
+    std::vector<int32_t> numbers;
+    std::vector<areg::SharedBuffer> page;
+    LogSqliteDatabase::LogCursor cursor{ LogSqliteDatabase::TIME_LAST, LogSqliteDatabase::ROW_LAST };
+    while (mDatabase.log_messages_before(page, cursor, areg::TARGET_ALL, 50u, BASE_TIME) != 0u)
+    {
+        ASSERT_LE(page.size(), 50u);
+        for (auto pos = page.rbegin(); pos != page.rend(); ++ pos)
+        {
+            numbers.push_back(log_number(*pos));
+        }
+    }
+
+    // The begin time stops before the log written when the database is created.
+    ASSERT_EQ(static_cast<uint32_t>(numbers.size()), LOG_COUNT);
+    for (uint32_t i = 0u; i < LOG_COUNT; ++ i)
+    {
+        ASSERT_EQ(numbers[i], static_cast<int32_t>(LOG_COUNT - 1u - i));
+    }
+}
+
+/**
+ * \brief   The pages of one instance have only the logs of the instance.
+ **/
+TEST_F(LogSqliteDatabaseTest, pages_of_one_instance)
+{
+    uint32_t count{ 0u };
+    std::vector<areg::SharedBuffer> page;
+    LogSqliteDatabase::LogCursor cursor{ };
+    while (mDatabase.log_messages_after(page, cursor, 2u, 7u) != 0u)
+    {
+        for (const areg::SharedBuffer & buf : page)
+        {
+            EXPECT_EQ(reinterpret_cast<const areg::LogEntry *>(buf.buffer())->logCookie, 2u);
+            EXPECT_EQ(log_number(buf), static_cast<int32_t>(2u * count + 1u));
+            ++ count;
+        }
+    }
+
+    EXPECT_EQ(count, LOG_COUNT / 2u);
+    EXPECT_EQ(count, mDatabase.count_log_entries(2u));
+}
+
+/**
+ * \brief   The logs of a time window, read at once or in pages, and their number.
+ **/
+TEST_F(LogSqliteDatabaseTest, time_window)
+{
+    const TIME64 begin{ BASE_TIME + 10u };
+    const TIME64 end{ BASE_TIME + 20u };
+    constexpr uint32_t expected{ (20u - 10u + 1u) * SAME_TIME };
+
+    std::vector<areg::SharedBuffer> logs;
+    EXPECT_EQ(mDatabase.log_messages_in_range(logs, begin, end), expected);
+    ASSERT_EQ(static_cast<uint32_t>(logs.size()), expected);
+    EXPECT_EQ(log_number(logs.front()), static_cast<int32_t>(10u * SAME_TIME));
+    EXPECT_EQ(log_number(logs.back()), static_cast<int32_t>(21u * SAME_TIME - 1u));
+    EXPECT_EQ(mDatabase.count_log_entries(begin, end), expected);
+    EXPECT_EQ(mDatabase.count_log_entries(begin, end, 1u), expected / 2u + 1u);
+
+    uint32_t count{ 0u };
+    std::vector<areg::SharedBuffer> page;
+    LogSqliteDatabase::LogCursor cursor{ begin, 0 };
+    while (mDatabase.log_messages_after(page, cursor, areg::TARGET_ALL, 5u, end) != 0u)
+    {
+        for (const areg::SharedBuffer & buf : page)
+        {
+            EXPECT_EQ(log_number(buf), log_number(logs[count]));
+            ++ count;
+        }
+    }
+
+    EXPECT_EQ(count, expected);
+}
+
+/**
+ * \brief   The time indexes are created with the database, and added to a database without them
+ *          when it is opened for writing.
+ **/
+TEST_F(LogSqliteDatabaseTest, time_index_added_to_old_database)
+{
+    EXPECT_TRUE(index_exists(mDatabase, "idx_logs_time"));
+    EXPECT_TRUE(index_exists(mDatabase, "idx_logs_inst_time"));
+
+    ASSERT_TRUE(mDatabase.execute("DROP INDEX idx_logs_time;"));
+    ASSERT_TRUE(mDatabase.execute("DROP INDEX idx_logs_inst_time;"));
+    mDatabase.commit(true);
+    mDatabase.disconnect();
+
+    ASSERT_TRUE(mDatabase.connect(mPath, true));
+    EXPECT_FALSE(index_exists(mDatabase, "idx_logs_time"));
+    mDatabase.disconnect();
+
+    ASSERT_TRUE(mDatabase.connect(mPath, false));
+    EXPECT_TRUE(index_exists(mDatabase, "idx_logs_time"));
+    EXPECT_TRUE(index_exists(mDatabase, "idx_logs_inst_time"));
+}
+
+/**
+ * \brief   The thread and module names are saved once in the dictionaries, the logs have them.
+ **/
+TEST_F(LogSqliteDatabaseTest, names_saved_once_in_dictionaries)
+{
+    EXPECT_EQ(query_number(mDatabase, "SELECT COUNT(*) FROM threads WHERE thread_name LIKE 'test_thread_%';"), THREAD_COUNT);
+    EXPECT_EQ(query_number(mDatabase, "SELECT COUNT(*) FROM modules WHERE module_name = 'test_module';"), 1u);
+    EXPECT_EQ(query_number(mDatabase, "SELECT COUNT(*) FROM logs WHERE msg_thread = 'test_thread_1' AND msg_module = 'test_module';"), LOG_COUNT / THREAD_COUNT);
+
+    std::vector<areg::SharedBuffer> logs;
+    ASSERT_EQ(mDatabase.log_messages_in_range(logs, BASE_TIME, BASE_TIME + 1u), 2u * SAME_TIME);
+    for (const areg::SharedBuffer & buf : logs)
+    {
+        const areg::LogEntry & log{ *reinterpret_cast<const areg::LogEntry *>(buf.buffer()) };
+        char thread[areg::LOG_NAME_SIZE];
+        std::snprintf(thread, sizeof(thread), "test_thread_%u", static_cast<uint32_t>(log_number(buf)) % THREAD_COUNT);
+        EXPECT_STREQ(log.logThread, thread);
+        EXPECT_STREQ(log.logModule, "test_module");
+        EXPECT_EQ(log.logThreadLen, static_cast<uint32_t>(std::strlen(thread)));
+    }
+
+    std::vector<areg::String> names;
+    mDatabase.log_thread_names(names);
+    EXPECT_EQ(names.size(), static_cast<size_t>(THREAD_COUNT + 1u));
+}
+
+/**
+ * \brief   A database of the older versions is read as it is, and migrated to the dictionaries
+ *          when it is opened for writing. The names and the row IDs are kept.
+ **/
+TEST(LogSqliteDatabaseMigrationTest, old_database_migrated)
+{
+    const areg::String path{ database_path("migration") };
+    areg::File::delete_file(path);
+
+    do
+    {
+        areg::ext::SqliteDatabase old;
+        ASSERT_TRUE(old.connect(path, false));
+        ASSERT_TRUE(old.execute("CREATE TABLE logs (id INTEGER NOT NULL UNIQUE, cookie_id INTEGER, scope_id INTEGER, session_id INTEGER,"
+                                " msg_type INTEGER, msg_prio INTEGER, msg_module_id INTEGER, msg_thread_id INTEGER, msg_log TEXT, msg_thread TEXT,"
+                                " msg_module TEXT, time_created NUMERIC, time_received NUMERIC, time_duration NUMERIC,"
+                                " CONSTRAINT pk_msg_id PRIMARY KEY(id AUTOINCREMENT));"));
+        ASSERT_TRUE(old.execute("CREATE INDEX idx_logs ON logs(scope_id, msg_prio, cookie_id);"));
+        for (uint32_t i = 0u; i < 10u; ++ i)
+        {
+            char sql[256];
+            std::snprintf(sql, sizeof(sql), "INSERT INTO logs VALUES (%u, 1, 0, 0, 2, 512, 7, %u, 'log %u', 'old_thread_%u', 'old_module', %u, %u, 0);"
+                          , 101u + i, 100u + i % 2u, i, i % 2u, 1000u + i, 1000u + i);
+            ASSERT_TRUE(old.execute(sql));
+        }
+
+        old.disconnect();
+    } while (false);
+
+    LogSqliteDatabase database;
+    std::vector<areg::SharedBuffer> logs;
+
+    // Read only, the database does not change.
+    ASSERT_TRUE(database.connect(path, true));
+    EXPECT_EQ(database.log_messages_in_range(logs, 0u, LogSqliteDatabase::TIME_LAST), 10u);
+    EXPECT_FALSE(database.table_exists("log_rows"));
+    database.disconnect();
+
+    ASSERT_TRUE(database.connect(path, false));
+    EXPECT_TRUE(database.table_exists("log_rows"));
+    EXPECT_FALSE(database.table_exists("logs"));
+    EXPECT_TRUE(index_exists(database, "idx_logs"));
+    EXPECT_TRUE(index_exists(database, "idx_logs_time"));
+    EXPECT_EQ(query_number(database, "SELECT COUNT(*) FROM threads;"), 2u);
+
+    LogSqliteDatabase::LogCursor cursor{ };
+    ASSERT_EQ(database.log_messages_after(logs, cursor, areg::TARGET_ALL, 100u), 10u);
+    EXPECT_EQ(cursor.lcRowId, 110);
+    for (uint32_t i = 0u; i < 10u; ++ i)
+    {
+        const areg::LogEntry & log{ *reinterpret_cast<const areg::LogEntry *>(logs[i].buffer()) };
+        char thread[areg::LOG_NAME_SIZE];
+        std::snprintf(thread, sizeof(thread), "old_thread_%u", i % 2u);
+        EXPECT_EQ(log_number(logs[i]), static_cast<int32_t>(i));
+        EXPECT_STREQ(log.logThread, thread);
+        EXPECT_STREQ(log.logModule, "old_module");
+    }
+
+    // The new logs follow the migrated logs.
+    areg::LogEntry log(areg::LogMessageType::MessageText);
+    log.logTimestamp    = 2000u;
+    log.logThreadId     = 100u;
+    log.logThreadLen    = static_cast<uint32_t>(std::snprintf(log.logThread, areg::LOG_NAME_SIZE, "old_thread_0"));
+    EXPECT_TRUE(database.log_message(log));
+    EXPECT_EQ(database.log_messages_after(logs, cursor, areg::TARGET_ALL, 100u), 1u);
+    EXPECT_EQ(cursor.lcRowId, 111);
+    EXPECT_STREQ(reinterpret_cast<const areg::LogEntry *>(logs[0].buffer())->logThread, "old_thread_0");
+    EXPECT_EQ(query_number(database, "SELECT COUNT(*) FROM threads;"), 2u);
+
+    database.disconnect();
+    areg::File::delete_file(path);
+}
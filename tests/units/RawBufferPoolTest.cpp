@@ -0,0 +1,144 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/RawBufferPoolTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for RawBufferPool.
+ *              Covers: block reuse, size classes, oversize blocks,
+ *              cross-thread release and shared buffer integration.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RawBufferPool.hpp"
+#include "areg/base/SharedBuffer.hpp"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief   A released block is handed out again to the same thread for the same size class.
+ **/
+TEST(RawBufferPoolTest, block_reuse_same_thread)
+{
+    uint8_t* first = areg::RawBufferPool::allocate(200u);
+    ASSERT_NE(first, nullptr);
+    std::memset(first, 0xAB, 200u);
+    areg::RawBufferPool::release(first);
+
+    uint8_t* second = areg::RawBufferPool::allocate(180u);
+    EXPECT_EQ(first, second);
+    areg::RawBufferPool::release(second);
+}
+
+/**
+ * \brief   Blocks of different size classes are not mixed.
+ **/
+TEST(RawBufferPoolTest, size_classes_are_separated)
+{
+    uint8_t* small = areg::RawBufferPool::allocate(100u);
+    areg::RawBufferPool::release(small);
+
+    uint8_t* large = areg::RawBufferPool::allocate(4000u);
+    ASSERT_NE(large, nullptr);
+    EXPECT_NE(small, large);
+    std::memset(large, 0xCD, 4000u);
+    areg::RawBufferPool::release(large);
+}
+
+/**
+ * \brief   Zero size returns nullptr, releasing nullptr is a no-op.
+ **/
+TEST(RawBufferPoolTest, zero_size_and_null)
+{
+    EXPECT_EQ(areg::RawBufferPool::allocate(0u), nullptr);
+    areg::RawBufferPool::release(nullptr);
+}
+
+/**
+ * \brief   Blocks above the largest size class bypass the pool.
+ **/
+TEST(RawBufferPoolTest, oversize_block)
+{
+    constexpr uint32_t size{ areg::RawBufferPool::MAX_SLOT_SIZE * 2u };
+    const areg::RawBufferPool::Stats before{ areg::RawBufferPool::stats() };
+
+    uint8_t* block = areg::RawBufferPool::allocate(size);
+    ASSERT_NE(block, nullptr);
+    std::memset(block, 0x5A, size);
+    areg::RawBufferPool::release(block);
+
+    const areg::RawBufferPool::Stats after{ areg::RawBufferPool::stats() };
+    EXPECT_GT(after.misses, before.misses);
+}
+
+/**
+ * \brief   Blocks allocated in one thread and released in another are reused.
+ **/
+TEST(RawBufferPoolTest, cross_thread_release)
+{
+    constexpr uint32_t count{ 1024u };
+    std::vector<uint8_t*> blocks;
+    blocks.reserve(count);
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        blocks.push_back(areg::RawBufferPool::allocate(512u));
+        ASSERT_NE(blocks.back(), nullptr);
+    }
+
+    std::thread consumer([&blocks]
+        {
+            for (uint8_t* block : blocks)
+                areg::RawBufferPool::release(block);
+        });
+    consumer.join();
+
+    // The consumer thread exited, its cache is handed to the depot.
+    const areg::RawBufferPool::Stats before{ areg::RawBufferPool::stats() };
+    EXPECT_GT(before.retainedBytes, 0u);
+
+    for (uint32_t i = 0u; i < count; ++ i)
+        blocks[i] = areg::RawBufferPool::allocate(512u);
+
+    const areg::RawBufferPool::Stats after{ areg::RawBufferPool::stats() };
+    EXPECT_GT(after.hits, before.hits);
+
+    for (uint8_t* block : blocks)
+        areg::RawBufferPool::release(block);
+
+    areg::RawBufferPool::trim();
+}
+
+/**
+ * \brief   Shared buffers share the pooled block and keep data across growth.
+ **/
+TEST(RawBufferPoolTest, shared_buffer_integration)
+{
+    areg::SharedBuffer buf;
+    for (uint32_t i = 0u; i < 10'000u; ++ i)
+    {
+        buf << i;
+    }
+
+    areg::SharedBuffer copy(buf);
+    EXPECT_TRUE(copy.is_shared());
+    buf.invalidate();
+
+    copy.move_to_begin();
+    for (uint32_t i = 0u; i < 10'000u; ++ i)
+    {
+        uint32_t value{ 0u };
+        copy >> value;
+        ASSERT_EQ(value, i);
+    }
+}
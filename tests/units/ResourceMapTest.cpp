@@ -0,0 +1,192 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/ResourceMapTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for ReadMostlyResourceMap.
+ *              Covers: register, find, unregister, the registration of many resources
+ *              at once, the move to another key and the lookups of many threads,
+ *              which run while a thread changes the map.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/ResourceMap.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using SharedMap = areg::ReadMostlyResourceMap<uint32_t, std::shared_ptr<uint32_t>>;
+}
+
+/**
+ * \brief   The registered resources are found, the unregistered ones are not, and the removed
+ *          resource is returned to the caller.
+ **/
+TEST(ResourceMapTest, read_mostly_register_and_find)
+{
+    areg::ReadMostlyResourceMap<uint32_t, uint32_t *> map;
+    uint32_t first{ 1u };
+    uint32_t second{ 2u };
+
+    EXPECT_TRUE(map.is_empty());
+    EXPECT_EQ(map.find_resource_object(1u), nullptr);
+
+    map.register_resource_object(1u, &first);
+    map.register_resource_object(2u, &second);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_TRUE(map.exist(2u));
+    EXPECT_EQ(map.find_resource_object(1u), &first);
+
+    map.register_resource_object(1u, &second);
+    EXPECT_EQ(map.find_resource_object(1u), &second);
+
+    EXPECT_EQ(map.unregister_resource_object(1u), &second);
+    EXPECT_EQ(map.unregister_resource_object(1u), nullptr);
+    EXPECT_FALSE(map.exist(1u));
+
+    map.remove_all_resources();
+    EXPECT_TRUE(map.is_empty());
+}
+
+/**
+ * \brief   The readers search the map while a thread registers and unregisters the resources.
+ *          Every resource found is alive and holds the value of its key, the stable entries are
+ *          always found.
+ **/
+TEST(ResourceMapTest, read_mostly_concurrent_lookups)
+{
+    constexpr uint32_t STABLE{ 16u };
+    constexpr uint32_t READERS{ 4u };
+    constexpr uint32_t CHANGES{ 2000u };
+
+    SharedMap map;
+    for (uint32_t key = 0u; key < STABLE; ++ key)
+    {
+        map.register_resource_object(key, std::make_shared<uint32_t>(key));
+    }
+
+    std::atomic_bool stop{ false };
+    std::atomic<uint32_t> failures{ 0u };
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0u; i < READERS; ++ i)
+    {
+        readers.emplace_back([&map, &stop, &failures]()
+        {
+            for (uint32_t round = 0u; !stop.load(std::memory_order_acquire); ++ round)
+            {
+                const uint32_t stable{ round % STABLE };
+                const std::shared_ptr<uint32_t> found{ map.find_resource_object(stable) };
+                if ((found == nullptr) || (*found != stable))
+                    failures.fetch_add(1u);
+
+                const uint32_t changing{ STABLE + (round % 8u) };
+                const std::shared_ptr<uint32_t> other{ map.find_resource_object(changing) };
+                if ((other != nullptr) && (*other != changing))
+                    failures.fetch_add(1u);
+            }
+        });
+    }
+
+    for (uint32_t i = 0u; i < CHANGES; ++ i)
+    {
+        const uint32_t key{ STABLE + (i % 8u) };
+        map.register_resource_object(key, std::make_shared<uint32_t>(key));
+        EXPECT_NE(map.unregister_resource_object(key), nullptr);
+    }
+
+    stop.store(true, std::memory_order_release);
+    for (std::thread & reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0u);
+    EXPECT_EQ(map.size(), STABLE);
+}
+
+/**
+ * \brief   The resources registered with one call are all found, and a moved resource is found
+ *          by the new key only.
+ **/
+TEST(ResourceMapTest, read_mostly_register_many_and_move)
+{
+    areg::ReadMostlyResourceMap<uint32_t, uint32_t *> map;
+    uint32_t values[4]{ 10u, 11u, 12u, 13u };
+    const std::pair<uint32_t, uint32_t *> entries[4]
+    {
+          { 0u, &values[0] }
+        , { 1u, &values[1] }
+        , { 2u, &values[2] }
+        , { 3u, &values[3] }
+    };
+
+    map.register_resource_objects(entries, 4u);
+    EXPECT_EQ(map.size(), 4u);
+    for (uint32_t key = 0u; key < 4u; ++ key)
+    {
+        EXPECT_EQ(map.find_resource_object(key), &values[key]);
+    }
+
+    map.move_resource_object(2u, 20u, &values[2]);
+    EXPECT_EQ(map.size(), 4u);
+    EXPECT_FALSE(map.exist(2u));
+    EXPECT_EQ(map.find_resource_object(20u), &values[2]);
+}
+
+/**
+ * \brief   The readers check the map, while a resource is moved between two keys all the time:
+ *          no reader sees the map without the resource.
+ **/
+TEST(ResourceMapTest, read_mostly_move_never_missed)
+{
+    constexpr uint32_t READERS{ 4u };
+    constexpr uint32_t MOVES{ 2000u };
+
+    SharedMap map;
+    const std::shared_ptr<uint32_t> resource{ std::make_shared<uint32_t>(7u) };
+    map.register_resource_object(1u, resource);
+
+    std::atomic_bool stop{ false };
+    std::atomic<uint32_t> failures{ 0u };
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0u; i < READERS; ++ i)
+    {
+        readers.emplace_back([&map, &stop, &failures]()
+        {
+            while (!stop.load(std::memory_order_acquire))
+            {
+                // Each snapshot has the resource under one of the keys, never none.
+                if (map.size() != 1u)
+                    failures.fetch_add(1u);
+            }
+        });
+    }
+
+    for (uint32_t i = 0u; i < MOVES; ++ i)
+    {
+        map.move_resource_object(1u + (i % 2u), 2u - (i % 2u), resource);
+    }
+
+    stop.store(true, std::memory_order_release);
+    for (std::thread & reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0u);
+    EXPECT_EQ(map.size(), 1u);
+}
@@ -0,0 +1,134 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/SendBatchWindowTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the time window of a send batch.
+ *              Covers: no wait when the messages are sparse, the wait limited by the
+ *              latency budget, the stop after the idle arrival intervals and the
+ *              disabled window.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/ipc/private/SendBatchWindow.hpp"
+
+#include <chrono>
+
+namespace
+{
+    using areg::SendBatchWindow;
+    using std::chrono::microseconds;
+    using std::chrono::nanoseconds;
+
+    //!< The latency budget of the tests in microseconds.
+    constexpr uint32_t  BUDGET_US   { 100u };
+
+    //!< The time the tests start, the window gets the times from the caller.
+    const SendBatchWindow::TimePoint START{ SendBatchWindow::TimePoint{ } + std::chrono::seconds(1) };
+
+    //!< Starts batches of 10 messages every microsecond, until the arrival interval is settled.
+    //!< Returns the time the last batch started, or the empty time if that batch does not wait.
+    SendBatchWindow::TimePoint _make_dense(SendBatchWindow & window)
+    {
+        SendBatchWindow::TimePoint now{ START };
+        bool waits{ false };
+        for (uint32_t i = 0u; i < 100u; ++ i)
+        {
+            now += microseconds(1);
+            waits = window.begin(now, 10u);
+        }
+
+        return (waits ? now : SendBatchWindow::TimePoint{ });
+    }
+}
+
+/**
+ * \brief   The messages, which arrive less often than the budget, are sent at once: the
+ *          batch does not wait for the next one.
+ **/
+TEST(SendBatchWindowTest, skips_wait_when_sparse)
+{
+    SendBatchWindow window;
+    window.reset(BUDGET_US, START);
+    EXPECT_TRUE(window.is_enabled());
+    EXPECT_EQ(window.budget_ns(), BUDGET_US * 1'000u);
+
+    // Until the rate is seen, the messages are taken as rare.
+    EXPECT_FALSE(window.begin(START + microseconds(1), 1u));
+
+    // One message every two budgets never waits.
+    SendBatchWindow::TimePoint now{ START + microseconds(1) };
+    for (uint32_t i = 0u; i < 100u; ++ i)
+    {
+        now += microseconds(2u * BUDGET_US);
+        EXPECT_FALSE(window.begin(now, 1u));
+        EXPECT_GE(window.arrival_ns(), window.budget_ns());
+    }
+}
+
+/**
+ * \brief   The batch waits at most the budget, also while the messages keep arriving.
+ **/
+TEST(SendBatchWindowTest, waits_no_longer_than_budget)
+{
+    SendBatchWindow window;
+    window.reset(BUDGET_US, START);
+    const SendBatchWindow::TimePoint batchBegin{ _make_dense(window) };
+    ASSERT_NE(batchBegin, SendBatchWindow::TimePoint{ });
+    EXPECT_LT(window.arrival_ns(), window.budget_ns());
+
+    const SendBatchWindow::TimePoint deadline{ batchBegin + microseconds(BUDGET_US) };
+    SendBatchWindow::TimePoint now{ batchBegin };
+    do
+    {
+        now += nanoseconds(window.arrival_ns() / 2u);
+    } while ((now < deadline + microseconds(BUDGET_US)) && (window.is_over(now, true) == false));
+
+    EXPECT_GE(now, deadline);
+    EXPECT_LT(now, deadline + nanoseconds(window.arrival_ns()));
+    EXPECT_TRUE(window.is_over(deadline, true));
+    EXPECT_TRUE(window.is_over(deadline, false));
+}
+
+/**
+ * \brief   The batch stops waiting when no message arrives for ARRIVAL_IDLE_FACTOR arrival
+ *          intervals, every arrival starts the idle time again.
+ **/
+TEST(SendBatchWindowTest, stops_after_idle_intervals)
+{
+    SendBatchWindow window;
+    window.reset(BUDGET_US, START);
+    const SendBatchWindow::TimePoint batchBegin{ _make_dense(window) };
+    ASSERT_NE(batchBegin, SendBatchWindow::TimePoint{ });
+
+    const nanoseconds interval{ static_cast<nanoseconds::rep>(window.arrival_ns()) };
+    const nanoseconds idle{ interval * static_cast<nanoseconds::rep>(SendBatchWindow::ARRIVAL_IDLE_FACTOR) };
+    ASSERT_LT(interval + 2 * idle, microseconds(BUDGET_US));
+
+    EXPECT_FALSE(window.is_over(batchBegin + idle - nanoseconds(1), false));
+    EXPECT_FALSE(window.is_over(batchBegin + interval, true));
+    EXPECT_FALSE(window.is_over(batchBegin + interval + idle - nanoseconds(1), false));
+    EXPECT_TRUE(window.is_over(batchBegin + interval + idle, false));
+}
+
+/**
+ * \brief   Without the budget the window is disabled and the batches never wait.
+ **/
+TEST(SendBatchWindowTest, disabled_without_budget)
+{
+    SendBatchWindow window;
+    window.reset(0u, START);
+    EXPECT_FALSE(window.is_enabled());
+    EXPECT_FALSE(window.begin(START + nanoseconds(1), 100u));
+    EXPECT_TRUE(window.is_over(START + nanoseconds(1), true));
+}
@@ -0,0 +1,147 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/SharedMemoryChannelTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for SharedMemoryChannel.
+ *              Covers: both directions of the segment, streaming across the
+ *              wrap-around of the ring between two threads, full ring and
+ *              shutdown.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SharedMemoryChannel.hpp"
+#include "areg/base/SocketDefs.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using areg::SharedMemoryChannel;
+
+    //!< Sends the single buffer through the channel.
+    int32_t send_bytes(SharedMemoryChannel & channel, const uint8_t * data, uint32_t size)
+    {
+        const areg::IoBuffer buffer{ data, size };
+        return channel.send(&buffer, 1u, size, 1000u);
+    }
+}
+
+/**
+ * \brief   The data written by one side is read by the other, in both directions.
+ **/
+TEST(SharedMemoryChannelTest, transfers_both_directions)
+{
+    SharedMemoryChannel creator;
+    SharedMemoryChannel peer;
+    ASSERT_TRUE(creator.create(0u, 0u));
+    ASSERT_TRUE(peer.open(creator.name()));
+
+    const uint8_t ping[]{ 1u, 2u, 3u, 4u, 5u };
+    const uint8_t pong[]{ 9u, 8u, 7u };
+    uint8_t received[8]{ };
+
+    EXPECT_EQ(send_bytes(creator, ping, sizeof(ping)), static_cast<int32_t>(sizeof(ping)));
+    EXPECT_EQ(peer.size_readable(), static_cast<uint32_t>(sizeof(ping)));
+    EXPECT_EQ(peer.receive(received, sizeof(ping), 1000u), static_cast<int32_t>(sizeof(ping)));
+    EXPECT_EQ(std::memcmp(received, ping, sizeof(ping)), 0);
+
+    EXPECT_EQ(send_bytes(peer, pong, sizeof(pong)), static_cast<int32_t>(sizeof(pong)));
+    EXPECT_EQ(creator.receive(received, sizeof(pong), 1000u), static_cast<int32_t>(sizeof(pong)));
+    EXPECT_EQ(std::memcmp(received, pong, sizeof(pong)), 0);
+
+    // Once the name is removed, nobody else can open the segment.
+    creator.remove_name();
+    SharedMemoryChannel late;
+    EXPECT_FALSE(late.open(creator.name()));
+}
+
+/**
+ * \brief   A stream much larger than the ring arrives complete and in order, while the
+ *          producer and the consumer wait for each other.
+ **/
+TEST(SharedMemoryChannelTest, streams_across_wrap_around)
+{
+    SharedMemoryChannel creator;
+    SharedMemoryChannel peer;
+    ASSERT_TRUE(creator.create(SharedMemoryChannel::MIN_RING_SIZE, SharedMemoryChannel::MIN_RING_SIZE));
+    ASSERT_TRUE(peer.open(creator.name()));
+
+    constexpr uint32_t TOTAL_SIZE{ 4u * areg::ONE_MEGABYTE };
+    std::vector<uint8_t> source(TOTAL_SIZE);
+    for (uint32_t i = 0u; i < TOTAL_SIZE; ++ i)
+    {
+        source[i] = static_cast<uint8_t>((i * 31u) ^ (i >> 11));
+    }
+
+    std::thread producer([&creator, &source]()
+        {
+            uint32_t offset{ 0u };
+            uint32_t chunk{ 1u };
+            while (offset < TOTAL_SIZE)
+            {
+                // Odd sizes up to the half of the ring, so that the chunks cross the end of it.
+                const uint32_t size{ std::min<uint32_t>(chunk, TOTAL_SIZE - offset) };
+                if (send_bytes(creator, source.data() + offset, size) != static_cast<int32_t>(size))
+                    break;
+
+                offset += size;
+                chunk = (chunk * 7u + 13u) % (SharedMemoryChannel::MIN_RING_SIZE / 2u) + 1u;
+            }
+        });
+
+    std::vector<uint8_t> target(TOTAL_SIZE);
+    uint32_t offset{ 0u };
+    while (offset < TOTAL_SIZE)
+    {
+        const uint32_t size{ std::min<uint32_t>(4099u, TOTAL_SIZE - offset) };
+        if (peer.receive(target.data() + offset, size, 5000u) != static_cast<int32_t>(size))
+            break;
+
+        offset += size;
+    }
+
+    producer.join();
+    ASSERT_EQ(offset, TOTAL_SIZE);
+    EXPECT_EQ(source, target);
+}
+
+/**
+ * \brief   try_send() refuses the data that does not fit, and the shutdown ends both sides
+ *          after the pending data is read.
+ **/
+TEST(SharedMemoryChannelTest, full_ring_and_shutdown)
+{
+    SharedMemoryChannel creator;
+    SharedMemoryChannel peer;
+    ASSERT_TRUE(creator.create(SharedMemoryChannel::MIN_RING_SIZE, SharedMemoryChannel::MIN_RING_SIZE));
+    ASSERT_TRUE(peer.open(creator.name()));
+
+    std::vector<uint8_t> block(SharedMemoryChannel::MIN_RING_SIZE, 0x5Au);
+    const areg::IoBuffer whole{ block.data(), block.size() };
+    const areg::IoBuffer single{ block.data(), 1u };
+    EXPECT_EQ(creator.try_send(&whole, 1u, SharedMemoryChannel::MIN_RING_SIZE), static_cast<int32_t>(SharedMemoryChannel::MIN_RING_SIZE));
+    EXPECT_EQ(creator.try_send(&single, 1u, 1u), 0);
+
+    creator.shutdown();
+    EXPECT_TRUE(peer.is_shutdown());
+    EXPECT_LT(creator.try_send(&single, 1u, 1u), 0);
+
+    // The data written before the shutdown is still delivered.
+    EXPECT_EQ(peer.receive(block.data(), SharedMemoryChannel::MIN_RING_SIZE, 1000u), static_cast<int32_t>(SharedMemoryChannel::MIN_RING_SIZE));
+    uint8_t extra{ 0u };
+    EXPECT_LT(peer.receive(&extra, 1u, areg::WAIT_INFINITE), 0);
+}
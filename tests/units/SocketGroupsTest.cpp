@@ -0,0 +1,142 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/SocketGroupsTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the grouped sends and the socket multiplexer.
+ *              Covers: the groups of many sockets sent in one call, the order of the
+ *              groups of one socket, and the readiness and the wakeup of the multiplexer.
+ *              On Linux built with AREG_IO_URING, both run on io_uring.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SocketDefs.hpp"
+#include "areg/base/SocketMultiplexer.hpp"
+
+#include <cstring>
+
+namespace
+{
+    //!< The first port, which names the local sockets of the tests. No TCP socket is opened.
+    constexpr uint16_t TEST_PORT{ 48931u };
+
+    /**
+     * \brief   A connected pair of local stream sockets.
+     **/
+    struct SocketPair
+    {
+        SOCKETHANDLE    server  { areg::InvalidSocketHandle };
+        SOCKETHANDLE    client  { areg::InvalidSocketHandle };
+        SOCKETHANDLE    accepted{ areg::InvalidSocketHandle };
+        areg::String    path    { };
+
+        bool open(uint16_t port)
+        {
+            path    = areg::local_socket_path(port);
+            server  = areg::local_server_connect(path);
+            if ((areg::is_valid_socket(server) == false) || (areg::server_listen(server) == false))
+                return false;
+
+            client = areg::local_socket_create();
+            if ((areg::is_valid_socket(client) == false) || (areg::local_connect_fd(client, path) == false))
+                return false;
+
+            accepted = areg::local_server_accept(server);
+            return areg::is_valid_socket(accepted);
+        }
+
+        ~SocketPair()
+        {
+            areg::socket_close(accepted);
+            areg::socket_close(client);
+            areg::socket_close(server);
+            areg::local_socket_remove(path);
+        }
+    };
+}
+
+/**
+ * \brief   The groups of two sockets are sent in one call, the two groups of one socket arrive in
+ *          the order of the array, and every group has its own result.
+ **/
+TEST(SocketGroupsTest, sends_groups_in_order)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    SocketPair first;
+    SocketPair second;
+    ASSERT_TRUE(first.open(TEST_PORT));
+    ASSERT_TRUE(second.open(TEST_PORT + 1u));
+
+    const uint8_t head[]{ 1u, 2u, 3u };
+    const uint8_t body[]{ 4u, 5u, 6u, 7u, 8u };
+    const uint8_t tail[]{ 9u, 10u };
+
+    const areg::IoBuffer firstParts[]{ { head, sizeof(head) }, { body, sizeof(body) } };
+    const areg::IoBuffer tailParts[] { { tail, sizeof(tail) } };
+    const areg::IoBuffer secondParts[]{ { body, sizeof(body) }, { head, sizeof(head) } };
+
+    areg::IoGroup groups[]
+    {
+          { first.accepted , firstParts , 2u, static_cast<uint32_t>(sizeof(head) + sizeof(body)), 0 }
+        , { first.accepted , tailParts  , 1u, static_cast<uint32_t>(sizeof(tail))             , 0 }
+        , { second.accepted, secondParts, 2u, static_cast<uint32_t>(sizeof(body) + sizeof(head)), 0 }
+    };
+
+    areg::send_data_groups(groups, 3u, 1000u);
+    EXPECT_EQ(groups[0].result, static_cast<int32_t>(sizeof(head) + sizeof(body)));
+    EXPECT_EQ(groups[1].result, static_cast<int32_t>(sizeof(tail)));
+    EXPECT_EQ(groups[2].result, static_cast<int32_t>(sizeof(body) + sizeof(head)));
+
+    const uint8_t firstExpected[]{ 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u };
+    uint8_t received[sizeof(firstExpected)]{ };
+    ASSERT_EQ(areg::receive_data(first.client, received, sizeof(firstExpected)), static_cast<int32_t>(sizeof(firstExpected)));
+    EXPECT_EQ(std::memcmp(received, firstExpected, sizeof(firstExpected)), 0);
+
+    const uint8_t secondExpected[]{ 4u, 5u, 6u, 7u, 8u, 1u, 2u, 3u };
+    ASSERT_EQ(areg::receive_data(second.client, received, sizeof(secondExpected)), static_cast<int32_t>(sizeof(secondExpected)));
+    EXPECT_EQ(std::memcmp(received, secondExpected, sizeof(secondExpected)), 0);
+}
+
+/**
+ * \brief   The multiplexer reports a socket with data until the data is read, the wakeup
+ *          interrupts the wait without a socket, and the reset fails the wait.
+ **/
+TEST(SocketGroupsTest, multiplexer_reports_readiness)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    SocketPair pair;
+    ASSERT_TRUE(pair.open(TEST_PORT + 2u));
+
+    areg::SocketMultiplexer multiplexer;
+    ASSERT_TRUE(multiplexer.register_socket(pair.accepted, true));
+    EXPECT_EQ(multiplexer.wait(0), areg::InvalidSocketHandle);
+
+    const uint8_t ping[]{ 1u, 2u, 3u, 4u };
+    ASSERT_EQ(areg::send_data(pair.client, ping, sizeof(ping)), static_cast<int32_t>(sizeof(ping)));
+    EXPECT_EQ(multiplexer.wait(1000), pair.accepted);
+
+    // Level-triggered: the unread data is reported again.
+    EXPECT_EQ(multiplexer.wait(1000), pair.accepted);
+
+    uint8_t received[sizeof(ping)]{ };
+    ASSERT_EQ(areg::receive_data(pair.accepted, received, sizeof(ping)), static_cast<int32_t>(sizeof(ping)));
+    EXPECT_EQ(multiplexer.wait(50), areg::InvalidSocketHandle);
+
+    multiplexer.wakeup();
+    EXPECT_EQ(multiplexer.wait(1000), areg::InvalidSocketHandle);
+
+    multiplexer.reset();
+    EXPECT_EQ(multiplexer.wait(1000), areg::FailedSocketHandle);
+}
@@ -0,0 +1,233 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/StrandExecutorTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the executor running the strands.
+ *              Covers: the turns of one strand never overlap while many threads schedule
+ *              it, no scheduled work is lost, a finished strand is not run again, and the
+ *              life cycle of a component thread running as a strand.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/private/StrandExecutor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using areg::Strand;
+    using areg::StrandExecutor;
+
+    //!< A strand consuming the work counted by the producers, and checking that no two
+    //!< turns run at the same time.
+    class CountingStrand final : public Strand
+    {
+    public:
+        CountingStrand() = default;
+
+        //!< Adds one unit of work and schedules the strand.
+        void add_work()
+        {
+            mPending.fetch_add(1u, std::memory_order_acq_rel);
+            StrandExecutor::instance().schedule(*this);
+        }
+
+        //!< Makes the next turn the last one.
+        void stop_next_turn()
+        {
+            mStopNext.store(true, std::memory_order_release);
+        }
+
+        std::atomic<uint32_t>   mPending    { 0u };
+        std::atomic<uint32_t>   mDone       { 0u };
+        std::atomic<uint32_t>   mTurns      { 0u };
+        std::atomic<uint32_t>   mOverlaps   { 0u };
+        std::atomic<bool>       mInTurn     { false };
+        std::atomic<bool>       mStopNext   { false };
+
+    protected:
+        Strand::StrandRun run_strand(uint32_t budget) override
+        {
+            if (mInTurn.exchange(true, std::memory_order_acq_rel))
+            {
+                mOverlaps.fetch_add(1u, std::memory_order_relaxed);
+            }
+
+            mTurns.fetch_add(1u, std::memory_order_relaxed);
+            if (mStopNext.load(std::memory_order_acquire))
+            {
+                finish_strand();
+                mInTurn.store(false, std::memory_order_release);
+                return Strand::StrandRun::Finished;
+            }
+
+            uint32_t count{ 0u };
+            while ((count < budget) && (mPending.load(std::memory_order_acquire) != 0u))
+            {
+                mPending.fetch_sub(1u, std::memory_order_acq_rel);
+                mDone.fetch_add(1u, std::memory_order_relaxed);
+                ++ count;
+            }
+
+            const bool hasMore{ mPending.load(std::memory_order_acquire) != 0u };
+            mInTurn.store(false, std::memory_order_release);
+            return (hasMore ? Strand::StrandRun::Yield : Strand::StrandRun::Idle);
+        }
+    };
+
+    //!< Waits until the condition is true or the timeout expires.
+    template<typename Condition>
+    bool wait_for(Condition condition, std::chrono::milliseconds timeout = std::chrono::seconds(20))
+    {
+        const auto deadline{ std::chrono::steady_clock::now() + timeout };
+        while (condition() == false)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        return true;
+    }
+}
+
+/**
+ * \brief   Many threads schedule a few strands on a few workers. Every unit of work is done
+ *          once, and no two turns of one strand run at the same time.
+ **/
+TEST(StrandExecutorTest, turns_of_a_strand_never_overlap)
+{
+    constexpr uint32_t  STRANDS     { 8u };
+    constexpr uint32_t  PRODUCERS   { 4u };
+    constexpr uint32_t  WORK        { 20'000u };
+
+    StrandExecutor & executor{ StrandExecutor::instance() };
+    ASSERT_TRUE(executor.attach(4u));
+    EXPECT_EQ(executor.worker_count(), 4u);
+
+    std::vector<CountingStrand> strands(STRANDS);
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0u; p < PRODUCERS; ++ p)
+    {
+        producers.emplace_back([&strands, p]()
+            {
+                for (uint32_t i = 0u; i < WORK; ++ i)
+                {
+                    strands[(i + p) % STRANDS].add_work();
+                }
+            });
+    }
+
+    for (std::thread & producer : producers)
+    {
+        producer.join();
+    }
+
+    const bool completed{ wait_for([&strands]()
+        {
+            uint32_t done{ 0u };
+            for (const CountingStrand & strand : strands)
+            {
+                done += strand.mDone.load(std::memory_order_acquire);
+            }
+
+            return (done == PRODUCERS * WORK);
+        }) };
+
+    // The strands must be idle before the workers stop.
+    EXPECT_TRUE(wait_for([&strands]()
+        {
+            for (const CountingStrand & strand : strands)
+            {
+                if (strand.mInTurn.load(std::memory_order_acquire))
+                    return false;
+            }
+
+            return true;
+        }));
+
+    executor.detach();
+    EXPECT_EQ(executor.worker_count(), 0u);
+
+    EXPECT_TRUE(completed);
+    for (const CountingStrand & strand : strands)
+    {
+        EXPECT_EQ(strand.mOverlaps.load(), 0u);
+        EXPECT_EQ(strand.mPending.load(), 0u);
+        EXPECT_EQ(strand.mDone.load(), PRODUCERS * WORK / STRANDS);
+    }
+}
+
+/**
+ * \brief   A strand that finished its last turn is not run again, however often it is scheduled.
+ **/
+TEST(StrandExecutorTest, finished_strand_is_not_run_again)
+{
+    StrandExecutor & executor{ StrandExecutor::instance() };
+    ASSERT_TRUE(executor.attach(2u));
+
+    CountingStrand strand;
+    strand.stop_next_turn();
+    strand.add_work();
+    EXPECT_TRUE(wait_for([&strand]() { return (strand.mTurns.load(std::memory_order_acquire) == 1u); }));
+
+    for (uint32_t i = 0u; i < 100u; ++ i)
+    {
+        strand.add_work();
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    executor.detach();
+
+    EXPECT_EQ(strand.mTurns.load(), 1u);
+    EXPECT_EQ(strand.mDone.load(), 0u);
+}
+
+/**
+ * \brief   A component thread running as a strand starts on the executor and, having no
+ *          component to run, completes in its first turn like a thread does.
+ **/
+TEST(StrandExecutorTest, component_thread_runs_as_strand)
+{
+    StrandExecutor & executor{ StrandExecutor::instance() };
+    ASSERT_TRUE(executor.attach(2u));
+
+    areg::ComponentThread * thread{ new areg::ComponentThread( "StrandExecutorTest_thread"
+                                                             , areg::WATCHDOG_IGNORE
+                                                             , areg::DEFAULT_STACK_SIZE
+                                                             , areg::IGNORE_VALUE
+                                                             , areg::Bool::Undefined
+                                                             , areg::WAIT_INFINITE
+                                                             , true ) };
+    EXPECT_TRUE(thread->runs_as_strand());
+    EXPECT_EQ(thread->watchdog_timeout(), areg::WATCHDOG_IGNORE);
+    ASSERT_TRUE(thread->start(areg::WAIT_INFINITE));
+    EXPECT_TRUE(thread->is_strand());
+
+    // The logical ID is not the ID of any OS thread.
+    EXPECT_NE(static_cast<id_type>(thread->id()) & 1u, 0u);
+
+    EXPECT_TRUE(thread->wait_completion(areg::WAIT_INFINITE));
+    EXPECT_FALSE(thread->is_running());
+    EXPECT_NE(thread->shutdown(areg::WAIT_INFINITE), areg::Thread::ThreadCompletion::Stuck);
+    EXPECT_FALSE(thread->is_strand());
+    delete thread;
+
+    executor.detach();
+}
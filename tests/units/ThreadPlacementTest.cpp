@@ -0,0 +1,151 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/ThreadPlacementTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the CPU affinity and scheduling policy of threads.
+ *              Covers: parsing the core lists and the policy names, reading the placement of
+ *              a thread from the configuration, and pinning a started thread to a core.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/base/ThreadConsumer.hpp"
+#include "areg/persist/ConfigManager.hpp"
+
+#include <vector>
+
+#ifdef __linux__
+    #include <sched.h>
+#endif // __linux__
+
+namespace
+{
+    //!< Records the cores the thread may run on, as the thread sees them.
+    class AffinityConsumer final : public areg::ThreadConsumer
+    {
+    public:
+        AffinityConsumer() = default;
+
+        std::vector<uint32_t>   mCpus   { };
+
+    protected:
+        void on_run() override
+        {
+#ifdef __linux__
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            if (::sched_getaffinity(0, sizeof(mask), &mask) == 0)
+            {
+                for (uint32_t cpu = 0u; cpu < CPU_SETSIZE; ++ cpu)
+                {
+                    if (CPU_ISSET(cpu, &mask))
+                    {
+                        mCpus.push_back(cpu);
+                    }
+                }
+            }
+#endif // __linux__
+        }
+    };
+}
+
+/**
+ * \brief   The core lists are numbers and ranges separated by commas. A malformed list gives
+ *          an empty result.
+ **/
+TEST(ThreadPlacementTest, parse_cpu_list)
+{
+    std::vector<uint32_t> cpus;
+    EXPECT_TRUE(areg::Thread::parse_cpu_list("0,2-4, 7", cpus));
+    EXPECT_EQ(cpus, (std::vector<uint32_t>{ 0u, 2u, 3u, 4u, 7u }));
+
+    EXPECT_TRUE(areg::Thread::parse_cpu_list("3,1,3,1-2", cpus));
+    EXPECT_EQ(cpus, (std::vector<uint32_t>{ 1u, 2u, 3u }));
+
+    EXPECT_FALSE(areg::Thread::parse_cpu_list("", cpus));
+    EXPECT_TRUE(cpus.empty());
+    EXPECT_FALSE(areg::Thread::parse_cpu_list("4-2", cpus));
+    EXPECT_TRUE(cpus.empty());
+    EXPECT_FALSE(areg::Thread::parse_cpu_list("1,x", cpus));
+    EXPECT_TRUE(cpus.empty());
+}
+
+/**
+ * \brief   The policy names are not case-sensitive, an unknown name keeps the default policy.
+ **/
+TEST(ThreadPlacementTest, parse_sched_policy)
+{
+    EXPECT_EQ(areg::Thread::parse_sched_policy("FIFO"), areg::Thread::SchedPolicy::Fifo);
+    EXPECT_EQ(areg::Thread::parse_sched_policy("rr"), areg::Thread::SchedPolicy::RoundRobin);
+    EXPECT_EQ(areg::Thread::parse_sched_policy("normal"), areg::Thread::SchedPolicy::Normal);
+    EXPECT_EQ(areg::Thread::parse_sched_policy("other"), areg::Thread::SchedPolicy::Normal);
+    EXPECT_EQ(areg::Thread::parse_sched_policy("batch"), areg::Thread::SchedPolicy::Default);
+}
+
+/**
+ * \brief   The placement of a thread is read from the keys with the name of the thread.
+ **/
+TEST(ThreadPlacementTest, placement_from_configuration)
+{
+    constexpr std::string_view THREAD_NAME{ "ThreadPlacementTest_thread" };
+
+    areg::ConfigManager config;
+    config.set_module_property(areg::String("thread"), areg::String(THREAD_NAME), areg::String("cpus"), areg::String("1-2"), areg::ConfigEntry::ThreadCpus, true);
+    config.set_module_property(areg::String("thread"), areg::String(THREAD_NAME), areg::String("policy"), areg::String("fifo"), areg::ConfigEntry::ThreadPolicy, true);
+    config.set_module_property(areg::String("thread"), areg::String(THREAD_NAME), areg::String("priority"), areg::String("10"), areg::ConfigEntry::ThreadPriority, true);
+    config.set_module_property(areg::String("thread"), areg::String(THREAD_NAME), areg::String("numa"), areg::String("0"), areg::ConfigEntry::ThreadNumaNode, true);
+
+    const areg::Thread::ThreadPlacement placement{ config.thread_placement(areg::String(THREAD_NAME)) };
+    EXPECT_EQ(placement.cpus, "1-2");
+    EXPECT_EQ(placement.policy, areg::Thread::SchedPolicy::Fifo);
+    EXPECT_EQ(placement.priority, 10);
+    EXPECT_EQ(placement.numaNode, 0);
+
+    EXPECT_TRUE(config.thread_placement(areg::String("ThreadPlacementTest_other")).is_empty());
+}
+
+#ifdef __linux__
+
+/**
+ * \brief   A thread pinned to one core runs only on that core.
+ **/
+TEST(ThreadPlacementTest, started_thread_is_pinned)
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+
+    uint32_t lastCpu{ 0u };
+    for (uint32_t cpu = 0u; cpu < CPU_SETSIZE; ++ cpu)
+    {
+        if (CPU_ISSET(cpu, &allowed))
+        {
+            lastCpu = cpu;
+        }
+    }
+
+    AffinityConsumer consumer;
+    areg::Thread thread(consumer, "ThreadPlacementTest_pinned");
+    areg::Thread::ThreadPlacement placement{ };
+    placement.cpus = areg::String::make_string(lastCpu);
+    thread.set_placement(placement);
+
+    ASSERT_TRUE(thread.start(areg::WAIT_INFINITE));
+    EXPECT_TRUE(thread.wait_completion(areg::WAIT_INFINITE));
+    thread.shutdown(areg::WAIT_INFINITE);
+
+    EXPECT_EQ(consumer.mCpus, (std::vector<uint32_t>{ lastCpu }));
+}
+
+#endif // __linux__
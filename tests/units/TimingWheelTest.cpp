@@ -0,0 +1,196 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/TimingWheelTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for TimingWheel.
+ *              Covers: expiry on the exact tick across all levels, cancel,
+ *              reschedule, next tick reporting and a randomized comparison
+ *              against a sorted reference.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/private/TimingWheel.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using areg::TimingWheel;
+
+    //!< Advances the wheel tick by tick and checks that every entry expires exactly on its tick.
+    void expect_exact_expiry(TimingWheel & wheel, uint64_t lastTick)
+    {
+        std::vector<TimingWheel::Entry *> expired;
+        uint64_t next{ 0u };
+        while (wheel.next_tick(next) && (next <= lastTick))
+        {
+            expired.clear();
+            wheel.advance(next, expired);
+            for (TimingWheel::Entry * entry : expired)
+            {
+                ASSERT_EQ(entry->expires, next);
+            }
+        }
+    }
+}
+
+/**
+ * \brief   Deadlines on every level expire on their tick, not earlier and not later.
+ **/
+TEST(TimingWheelTest, expires_on_exact_tick)
+{
+    TimingWheel wheel(1000u);
+    const uint64_t delays[]{ 0u, 1u, 63u, 64u, 65u, 4095u, 4096u, 4097u, 262'143u, 262'144u, 50'000'000u };
+    std::vector<TimingWheel::Entry> entries(std::size(delays));
+    for (uint32_t i = 0u; i < entries.size(); ++ i)
+    {
+        wheel.schedule(entries[i], 1000u + delays[i]);
+    }
+
+    EXPECT_EQ(wheel.size(), static_cast<uint32_t>(entries.size()));
+
+    std::vector<TimingWheel::Entry *> expired;
+    uint64_t next{ 0u };
+    uint32_t fired{ 0u };
+    while (wheel.next_tick(next))
+    {
+        expired.clear();
+        wheel.advance(next, expired);
+        for (TimingWheel::Entry * entry : expired)
+        {
+            EXPECT_EQ(entry->expires, next);
+            EXPECT_FALSE(TimingWheel::is_scheduled(*entry));
+            ++ fired;
+        }
+    }
+
+    EXPECT_EQ(fired, static_cast<uint32_t>(entries.size()));
+    EXPECT_TRUE(wheel.is_empty());
+}
+
+/**
+ * \brief   Advancing to a tick expires everything due up to it and nothing after it.
+ **/
+TEST(TimingWheelTest, advance_stops_at_tick)
+{
+    TimingWheel wheel;
+    TimingWheel::Entry early, late;
+    wheel.schedule(early, 100u);
+    wheel.schedule(late, 5000u);
+
+    std::vector<TimingWheel::Entry *> expired;
+    EXPECT_EQ(wheel.advance(99u, expired), 0u);
+    EXPECT_EQ(wheel.advance(4999u, expired), 1u);
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_EQ(expired[0], &early);
+    EXPECT_EQ(wheel.current_tick(), 5000u);
+
+    uint64_t next{ 0u };
+    ASSERT_TRUE(wheel.next_tick(next));
+    EXPECT_LE(next, 5000u);
+    expect_exact_expiry(wheel, 5000u);
+    EXPECT_TRUE(wheel.is_empty());
+}
+
+/**
+ * \brief   A cancelled entry never expires, a rescheduled entry expires only on the new tick.
+ **/
+TEST(TimingWheelTest, cancel_and_reschedule)
+{
+    TimingWheel wheel;
+    TimingWheel::Entry cancelled, moved;
+    wheel.schedule(cancelled, 300u);
+    wheel.schedule(moved, 70'000u);
+    wheel.cancel(cancelled);
+    wheel.cancel(cancelled);
+    EXPECT_FALSE(TimingWheel::is_scheduled(cancelled));
+
+    wheel.schedule(moved, 20u);
+    EXPECT_EQ(wheel.size(), 1u);
+
+    std::vector<TimingWheel::Entry *> expired;
+    wheel.advance(100'000u, expired);
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_EQ(expired[0], &moved);
+    EXPECT_EQ(moved.expires, 20u);
+}
+
+/**
+ * \brief   A deadline in the past expires with the next advance.
+ **/
+TEST(TimingWheelTest, past_deadline_expires_next)
+{
+    TimingWheel wheel(500u);
+    TimingWheel::Entry entry;
+    wheel.schedule(entry, 10u);
+
+    uint64_t next{ 0u };
+    ASSERT_TRUE(wheel.next_tick(next));
+    EXPECT_EQ(next, 500u);
+
+    std::vector<TimingWheel::Entry *> expired;
+    EXPECT_EQ(wheel.advance(500u, expired), 1u);
+}
+
+/**
+ * \brief   Random schedules, cancels and advances give the same expiries as a sorted reference.
+ **/
+TEST(TimingWheelTest, random_against_reference)
+{
+    constexpr uint32_t count{ 5000u };
+    std::mt19937_64 random(12345u);
+    std::uniform_int_distribution<uint64_t> delay(0u, 200'000u);
+
+    TimingWheel wheel(7u);
+    std::vector<TimingWheel::Entry> entries(count);
+    std::vector<uint64_t> due(count, 0u);
+    for (uint32_t i = 0u; i < count; ++ i)
+    {
+        due[i] = 7u + delay(random);
+        wheel.schedule(entries[i], due[i]);
+    }
+
+    // Every third entry is cancelled.
+    for (uint32_t i = 0u; i < count; i += 3u)
+    {
+        wheel.cancel(entries[i]);
+        due[i] = 0u;
+    }
+
+    std::vector<TimingWheel::Entry *> expired;
+    uint32_t fired{ 0u };
+    for (uint64_t tick = 7u; tick <= 210'000u; tick += 1 + (tick % 977u))
+    {
+        expired.clear();
+        wheel.advance(tick, expired);
+        for (TimingWheel::Entry * entry : expired)
+        {
+            const uint32_t index{ static_cast<uint32_t>(entry - entries.data()) };
+            ASSERT_NE(due[index], 0u);
+            ASSERT_LE(due[index], tick);
+            due[index] = 0u;
+            ++ fired;
+        }
+
+        for (uint32_t i = 0u; i < count; ++ i)
+        {
+            ASSERT_TRUE((due[i] == 0u) || (due[i] > tick));
+        }
+    }
+
+    EXPECT_EQ(fired, count - (count + 2u) / 3u);
+    EXPECT_TRUE(wheel.is_empty());
+}
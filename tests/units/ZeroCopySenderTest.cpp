@@ -0,0 +1,263 @@
+/************************************************************************
+ * This file is part of the Areg SDK core engine.
+ * Areg SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the Areg SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]areg.tech
+ *
+ * \copyright   (c) 2017-2026 Aregtech (Artak Avetyan)
+ * \file        units/ZeroCopySenderTest.cpp
+ * \ingroup     Areg SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       Areg Platform, unit tests for the zero-copy send of the large messages.
+ *              Covers: the copying send of a socket without the zero-copy send, the
+ *              message kept until the kernel releases it on a TCP loopback connection,
+ *              the message kept after the sender is detached and the socket closed, and
+ *              the completed sends counted across the wrap of the ids.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RawBufferPool.hpp"
+#include "areg/base/SocketDefs.hpp"
+#include "areg/ipc/SocketLinkMap.hpp"
+#include "areg/ipc/ZeroCopySender.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< The first port of the tests: names the local socket, the second one is the TCP loopback port.
+    constexpr uint16_t      TEST_PORT       { 48941u };
+
+    //!< The size of the data of the sent message.
+    constexpr uint32_t      MESSAGE_SIZE    { 4u * areg::MIN_ZEROCOPY_BLOCK };
+
+    //!< Allocates a message of the pool with the data filled by a pattern.
+    areg::RawBufferPtr _make_message()
+    {
+        constexpr uint32_t HEADER{ static_cast<uint32_t>(sizeof(areg::BufferHeader)) };
+        areg::RawBuffer * block{ reinterpret_cast<areg::RawBuffer *>(areg::RawBufferPool::allocate(HEADER + MESSAGE_SIZE)) };
+        if (block == nullptr)
+            return areg::RawBufferPtr{ };
+
+        block->bufHeader.biLength   = MESSAGE_SIZE;
+        block->bufHeader.biOffset   = HEADER;
+        block->bufHeader.biUsed     = MESSAGE_SIZE;
+        uint8_t * data{ reinterpret_cast<uint8_t *>(block) + HEADER };
+        for (uint32_t i = 0u; i < MESSAGE_SIZE; ++ i)
+        {
+            data[i] = static_cast<uint8_t>(i * 7u);
+        }
+
+        return areg::RawBufferPtr{ block };
+    }
+
+    //!< Receives the message in another thread, returns true if it has the pattern.
+    bool _receive_message(SOCKETHANDLE hSocket)
+    {
+        std::vector<uint8_t> received(MESSAGE_SIZE);
+        if (areg::receive_data(hSocket, received.data(), MESSAGE_SIZE) != static_cast<int32_t>(MESSAGE_SIZE))
+            return false;
+
+        for (uint32_t i = 0u; i < MESSAGE_SIZE; ++ i)
+        {
+            if (received[i] != static_cast<uint8_t>(i * 7u))
+                return false;
+        }
+
+        return true;
+    }
+}
+
+/**
+ * \brief   A local socket has no zero-copy send: the sender does not attach, and the large
+ *          message is sent by copying it, the message is not kept.
+ **/
+TEST(ZeroCopySenderTest, copies_without_zerocopy)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    const areg::String path{ areg::local_socket_path(TEST_PORT) };
+    const SOCKETHANDLE server{ areg::local_server_connect(path) };
+    ASSERT_TRUE(areg::is_valid_socket(server));
+    ASSERT_TRUE(areg::server_listen(server));
+
+    const SOCKETHANDLE client{ areg::local_socket_create() };
+    ASSERT_TRUE(areg::local_connect_fd(client, path));
+    const SOCKETHANDLE accepted{ areg::local_server_accept(server) };
+    ASSERT_TRUE(areg::is_valid_socket(accepted));
+
+    areg::RawBufferPtr message{ _make_message() };
+    ASSERT_TRUE(static_cast<bool>(message));
+    {
+        areg::SocketLinkMap links;
+        areg::ZeroCopySender sender;
+        EXPECT_FALSE(sender.attach(client, links, areg::MIN_ZEROCOPY_BLOCK));
+        EXPECT_EQ(links.links_of(client).slZeroCopy, nullptr);
+
+        bool valid{ false };
+        std::thread reader([accepted, &valid]() { valid = _receive_message(accepted); });
+        const areg::IoBuffer buffer{ reinterpret_cast<const uint8_t *>(message.get()) + message->bufHeader.biOffset, MESSAGE_SIZE };
+        EXPECT_EQ(areg::ZeroCopySender::send_stream(client, links.links_of(client).slZeroCopy, &buffer, 1u, MESSAGE_SIZE, &message, 1u), static_cast<int32_t>(MESSAGE_SIZE));
+        reader.join();
+
+        EXPECT_TRUE(valid);
+        EXPECT_EQ(message.use_count(), 1u);
+    }
+
+    areg::socket_close(accepted);
+    areg::socket_close(client);
+    areg::socket_close(server);
+    areg::local_socket_remove(path);
+}
+
+/**
+ * \brief   On a TCP loopback connection the large message is sent without copying and kept
+ *          until the kernel releases it. The loopback copies the data anyway and reports it,
+ *          so the sender stops the zero-copy send and counts no saved bytes.
+ **/
+TEST(ZeroCopySenderTest, keeps_message_until_released)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    const SOCKETHANDLE server{ areg::server_connect(areg::String("127.0.0.1"), TEST_PORT + 1u) };
+    ASSERT_TRUE(areg::is_valid_socket(server));
+    ASSERT_TRUE(areg::server_listen(server));
+
+    const SOCKETHANDLE client{ areg::client_connect(areg::String("127.0.0.1"), TEST_PORT + 1u) };
+    ASSERT_TRUE(areg::is_valid_socket(client));
+    const SOCKETHANDLE accepted{ areg::server_accept(server, &server, 1) };
+    ASSERT_TRUE(areg::is_valid_socket(accepted));
+
+    areg::RawBufferPtr message{ _make_message() };
+    ASSERT_TRUE(static_cast<bool>(message));
+    {
+        areg::SocketLinkMap links;
+        areg::ZeroCopySender sender;
+        if (sender.attach(client, links, areg::MIN_ZEROCOPY_BLOCK) == false)
+        {
+            areg::socket_close(accepted);
+            areg::socket_close(client);
+            areg::socket_close(server);
+            GTEST_SKIP() << "The platform has no zero-copy send";
+        }
+
+        EXPECT_EQ(links.links_of(client).slZeroCopy, &sender);
+        EXPECT_TRUE(sender.is_sending());
+
+        bool valid{ false };
+        std::thread reader([accepted, &valid]() { valid = _receive_message(accepted); });
+        const areg::IoBuffer buffer{ reinterpret_cast<const uint8_t *>(message.get()) + message->bufHeader.biOffset, MESSAGE_SIZE };
+        EXPECT_EQ(sender.send(&buffer, 1u, &message, 1u), static_cast<int32_t>(MESSAGE_SIZE));
+        reader.join();
+        EXPECT_TRUE(valid);
+
+        for (uint32_t i = 0u; (i < 20u) && (message.use_count() != 1u); ++ i)
+        {
+            sender.reap(50u);
+        }
+
+        EXPECT_EQ(message.use_count(), 1u);
+        EXPECT_FALSE(sender.is_sending());
+        EXPECT_EQ(sender.extract_saved(), 0u);
+
+        sender.detach();
+        EXPECT_EQ(links.links_of(client).slZeroCopy, nullptr);
+    }
+
+    areg::socket_close(accepted);
+    areg::socket_close(client);
+    areg::socket_close(server);
+}
+
+/**
+ * \brief   The message the kernel did not release when the sender is detached is not dropped:
+ *          a retired sender keeps it after the socket is closed, until the peer receives the
+ *          data and the kernel releases the message.
+ **/
+TEST(ZeroCopySenderTest, keeps_message_after_detach)
+{
+    ASSERT_TRUE(areg::socket_initialize());
+
+    const SOCKETHANDLE server{ areg::server_connect(areg::String("127.0.0.1"), TEST_PORT + 2u) };
+    ASSERT_TRUE(areg::is_valid_socket(server));
+    // The small receive window of the peer keeps the most of the message in the send queue.
+    areg::set_recv_size(server, 4096u);
+    ASSERT_TRUE(areg::server_listen(server));
+
+    const SOCKETHANDLE client{ areg::client_connect(areg::String("127.0.0.1"), TEST_PORT + 2u) };
+    ASSERT_TRUE(areg::is_valid_socket(client));
+    areg::set_send_size(client, 4u * MESSAGE_SIZE);
+    const SOCKETHANDLE accepted{ areg::server_accept(server, &server, 1) };
+    ASSERT_TRUE(areg::is_valid_socket(accepted));
+
+    areg::RawBufferPtr message{ _make_message() };
+    ASSERT_TRUE(static_cast<bool>(message));
+    {
+        areg::SocketLinkMap links;
+        areg::ZeroCopySender sender;
+        if (sender.attach(client, links, areg::MIN_ZEROCOPY_BLOCK) == false)
+        {
+            areg::socket_close(accepted);
+            areg::socket_close(client);
+            areg::socket_close(server);
+            GTEST_SKIP() << "The platform has no zero-copy send";
+        }
+
+        const areg::IoBuffer buffer{ reinterpret_cast<const uint8_t *>(message.get()) + message->bufHeader.biOffset, MESSAGE_SIZE };
+        EXPECT_EQ(sender.send(&buffer, 1u, &message, 1u), static_cast<int32_t>(MESSAGE_SIZE));
+        ASSERT_NE(message.use_count(), 1u);
+
+        sender.detach();
+        areg::socket_close(client);
+        EXPECT_EQ(message.use_count(), 2u);
+        EXPECT_EQ(areg::ZeroCopySender::count_retired(), 1u);
+
+        // The peer reads the rest, then the kernel releases the message.
+        EXPECT_TRUE(_receive_message(accepted));
+        for (uint32_t i = 0u; (i < 100u) && (message.use_count() != 1u); ++ i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            sender.reap(0u);
+        }
+
+        EXPECT_EQ(message.use_count(), 1u);
+        EXPECT_EQ(areg::ZeroCopySender::count_retired(), 0u);
+    }
+
+    areg::socket_close(accepted);
+    areg::socket_close(server);
+}
+
+/**
+ * \brief   The ids of the sends wrap at 32 bits: the sends of a buffer, which cross the wrap,
+ *          are counted by the completed ranges before, across and after it.
+ **/
+TEST(ZeroCopySenderTest, counts_completions_across_wrap)
+{
+    constexpr uint32_t FIRST{ 0xFFFFFFFEu };
+    constexpr uint32_t SENDS{ 4u };
+
+    // The whole buffer, ids 0xFFFFFFFE to 1, in one range.
+    EXPECT_EQ(areg::ZeroCopySender::completed_sends(FIRST, SENDS, areg::ZeroCopyDone{ FIRST, 1u, false }), SENDS);
+
+    // Before and after the wrap in separate ranges.
+    EXPECT_EQ(areg::ZeroCopySender::completed_sends(FIRST, SENDS, areg::ZeroCopyDone{ FIRST, 0xFFFFFFFFu, false }), 2u);
+    EXPECT_EQ(areg::ZeroCopySender::completed_sends(FIRST, SENDS, areg::ZeroCopyDone{ 0u, 1u, false }), 2u);
+
+    // A range, which covers the earlier and the later buffers too.
+    EXPECT_EQ(areg::ZeroCopySender::completed_sends(FIRST, SENDS, areg::ZeroCopyDone{ FIRST - 10u, 20u, false }), SENDS);
+
+    // The ranges of the other buffers.
+    EXPECT_EQ(areg::ZeroCopySender::completed_sends(FIRST, SENDS, areg::ZeroCopyDone{ FIRST - 10u, FIRST - 1u, false }), 0u);
+    EXPECT_EQ(areg::ZeroCopySender::completed_sends(FIRST, SENDS, areg::ZeroCopyDone{ 2u, 5u, false }), 0u);
+
+    // Without the wrap.
+    EXPECT_EQ(areg::ZeroCopySender::completed_sends(10u, 3u, areg::ZeroCopyDone{ 11u, 11u, false }), 1u);
+}
@@ -21,7 +21,9 @@ What is measured
                              consumer in one thread, once with each in its own thread.
                              The difference between the two is the price of one thread
                              wake-up; the difference to example 30 is the price of
-                             leaving the process.
+                             leaving the process. Once more with each thread spinning
+                             on its empty queue before it parks: the difference to the
+                             parking threads is the price of parking.
 
 Nothing here is specific to a machine or a checkout: every path is derived from the
 arguments, and the module is imported, never executed on its own.
@@ -76,11 +78,11 @@ _LATENCY_PLAIN = re.compile(
 # topology, mode, payload bytes, repetition, samples, then min p50 p90 p99 p99.9 max mean
 # stddev in-leg msg/s.
 # Metric names produced above, read back by _derive_ladder to build the latency ladder.
-_LEVEL_LOCAL = re.compile(r'^(same|cross) (\w+) P50$')
+_LEVEL_LOCAL = re.compile(r'^(same|cross|spin) (\w+) P50$')
 _LEVEL_PROC  = re.compile(r'^run \d+ (\w+) P50$')
 
 _LOCLATENCY = re.compile(
-    r'(same|cross)\s*\|\s*(\w+)\s*\|\s*(\d+)\s*\|\s*(\d+)\s*\|\s*(\d+)\s*\|'
+    r'(same|cross|strand|spin)\s*\|\s*(\w+)\s*\|\s*(\d+)\s*\|\s*(\d+)\s*\|\s*(\d+)\s*\|'
     + r'\s*([0-9.]+)\s*\|' * 9 + r'\s*([0-9.]+)')
 
 # The unit names come from areg::STR_ONE_BYTE and friends in CommonDefs.hpp, which are
@@ -282,7 +284,7 @@ def _derive_ladder(measures):
     """
     # Only the very same mode may be compared: a round trip carries two messages and a one
     # way trip carries one, so mixing them would invent a number that was never measured.
-    levels = {'same': {}, 'cross': {}, 'proc': {}}
+    levels = {'same': {}, 'cross': {}, 'spin': {}, 'proc': {}}
     for m in measures:
         local = _LEVEL_LOCAL.match(m['metric'])
         if local is not None:
@@ -295,6 +297,8 @@ def _derive_ladder(measures):
 
     steps = (('same', 'cross', 'price of one thread wake-up',
               'two threads minus one thread'),
+             ('spin', 'cross', 'price of parking the thread',
+              'parking threads minus spinning threads'),
              ('cross', 'proc', 'price of leaving the process',
               'two processes minus two threads: both sockets and the router'))
 
@@ -338,6 +338,13 @@ SCENARIOS = [
                     args=['-t=cross', '-m=bc0,pp0,bc64,pp64,bc1024,pp1024',
                           '-c=20000', '-w=2000'],
                     expect=[r'cross\s+\|\s+bc0'])]},
+
+    {'name': '31_locspin', 'tier': 'perf', 'timeout': 300, 'measure': 'loclatency',
+     'router': False,
+     'procs': [proc('31_loclatency',
+                    args=['-t=spin', '-p=100', '-m=bc0,pp0,bc64,pp64,bc1024,pp1024',
+                          '-c=20000', '-w=2000'],
+                    expect=[r'spin\s+\|\s+bc0'])]},
 ]
 
 # Exit codes that mean the process was terminated abnormally.